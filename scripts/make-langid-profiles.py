@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+make-langid-profiles.py
+Regenerates src/translate-langid-profiles.h, the trigram profiles of the
+in-process language identifier (src/translate-langid.c).
+
+The text comes from installed gettext catalogs (*.mo): the msgstr
+strings of each language, and for English the msgids of the German
+catalogs. The iso-codes catalogs (lists of language and country names)
+are left out. Desktop UI strings are short, but several dozen catalogs
+per language give stable trigram frequencies.
+
+Usage: scripts/make-langid-profiles.py [--locale-dir /usr/share/locale] > src/translate-langid-profiles.h
+"""
+
+import argparse
+import glob
+import os
+import re
+import struct
+import sys
+import unicodedata
+from collections import Counter
+
+# Argos Translate codes of the languages told apart by trigrams; scripts
+# used by a single language are recognised without a profile
+LANGUAGES = [
+    "en", "de", "fr", "es", "it", "pt", "nl", "sv", "da", "nb", "pl", "cs",
+    "sk", "tr", "fi", "hu", "ro", "id", "ca", "et", "sl", "lt", "gl", "eo",
+    "ga", "vi", "ru", "uk", "bg", "ar", "fa",
+]
+# Catalog directories to read for each language, besides its own code
+CATALOG_ALIASES = {"pt": ["pt_BR"], "fa": ["fa_IR"]}
+PROFILE_SIZE = 1000
+
+_FORMAT = re.compile(r"%(\d+\$)?[-#0 +']*\d*(\.\d+)?[hlLqjzt]*[a-zA-Z%]|\{[^}]*\}|<[^>]*>|&\w+;|\$\w+")
+
+
+def read_mo(path):
+    """(msgid, msgstr) pairs of a GNU .mo file."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic = struct.unpack("<I", data[:4])[0]
+    order = "<" if magic == 0x950412de else ">"
+    _, count, ids_at, strs_at = struct.unpack(order + "4I", data[4:20])
+    for i in range(count):
+        id_len, id_off = struct.unpack(order + "2I", data[ids_at + 8 * i:ids_at + 8 * i + 8])
+        str_len, str_off = struct.unpack(order + "2I", data[strs_at + 8 * i:strs_at + 8 * i + 8])
+        msgid = data[id_off:id_off + id_len]
+        if not msgid:
+            continue  # The header entry
+        yield (msgid.decode("utf-8", "replace").split("\0")[0],
+               data[str_off:str_off + str_len].decode("utf-8", "replace").split("\0")[0])
+
+
+def words_of(text):
+    """Lower-cased letter runs, as translate-langid.c cuts them."""
+    text = _FORMAT.sub(" ", text).replace("_", "")
+    word = []
+    for ch in unicodedata.normalize("NFC", text.lower()):
+        if ch.isalpha():
+            word.append(ch)
+        elif word:
+            yield "".join(word)
+            word = []
+    if word:
+        yield "".join(word)
+
+
+def trigrams_of(word):
+    padded = f" {word} "
+    return (padded[i:i + 3] for i in range(len(padded) - 2))
+
+
+def profile(texts):
+    counts = Counter()
+    for text in texts:
+        for word in words_of(text):
+            counts.update(trigrams_of(word))
+    return [t for t, _ in counts.most_common(PROFILE_SIZE)]
+
+
+def catalog_texts(locale_dir, lang):
+    texts = []
+    codes = ["de"] if lang == "en" else [lang] + CATALOG_ALIASES.get(lang, [])
+    for code in codes:
+        for path in glob.glob(os.path.join(locale_dir, code, "LC_MESSAGES", "*.mo")):
+            if os.path.basename(path).startswith("iso_"):
+                continue
+            try:
+                pairs = list(read_mo(path))
+            except (OSError, struct.error):
+                continue
+            texts.extend(msgid if lang == "en" else msgstr for msgid, msgstr in pairs)
+    return texts
+
+
+def c_string(profile_list):
+    body = "|".join(profile_list).replace("\\", "\\\\").replace('"', '\\"')
+    lines = [body[i:i + 72] for i in range(0, len(body), 72)]
+    return "\n".join(f'      "{line}"' for line in lines)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--locale-dir", default="/usr/share/locale")
+    args = ap.parse_args()
+
+    out = sys.stdout
+    out.write("/* SPDX-License-Identifier: LGPL-2.1-or-later */\n")
+    out.write("/* Generated by scripts/make-langid-profiles.py; do not edit.\n")
+    out.write(" * The most frequent trigrams of each language, most frequent first,\n")
+    out.write(" * separated by '|'; a space marks a word boundary. */\n\n")
+    out.write("#ifndef TRANSLATE_LANGID_PROFILES_H\n#define TRANSLATE_LANGID_PROFILES_H\n\n")
+    out.write("static const struct {\n    const gchar *code;\n    const gchar *trigrams;\n")
+    out.write("} langid_profiles[] = {\n")
+    for lang in LANGUAGES:
+        texts = catalog_texts(args.locale_dir, lang)
+        if not texts:
+            print(f"No catalogs for {lang}, skipped", file=sys.stderr)
+            continue
+        print(f"{lang}: {len(texts)} strings", file=sys.stderr)
+        out.write(f'    {{ "{lang}",\n{c_string(profile(texts))} }},\n')
+    out.write("};\n\n#endif /* TRANSLATE_LANGID_PROFILES_H */\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
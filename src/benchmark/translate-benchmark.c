@@ -0,0 +1,499 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-benchmark.c
+ * Headless benchmark of the translation pipeline over a directory of .eml files
+ *
+ * Every message goes through the extension's own code: translate-extract
+ * for the MIME walk, decoding and language detection, then
+ * translate_common_translate_whole_async() with its cache, windows,
+ * scheduler, provider and helper pool; messages past "max-translate-size"
+ * are translated whole, as after a click on continue. The corpus is
+ * translated --passes times; the first pass starts with no helper
+ * running, later ones reuse the helpers unless --cold restarts them.
+ * Each pass reports throughput, p50/p95/p99 latency, bytes sent and
+ * received and peak RSS, followed by the per-stage breakdown of
+ * translate-stats.
+ *
+ * Settings live in a memory GSettings backend and caches in a scratch
+ * $XDG_CACHE_HOME, so runs neither depend on nor change the user's
+ * configuration, translation cache or translation memory. --fake makes
+ * the Argos helper "translate" by upper-casing (TRANSLATE_FAKE_UPPERCASE),
+ * which measures the pipeline itself without models or network.
+ *
+ * Usage: translate-benchmark [OPTION...] DIRECTORY
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <gio/gio.h>
+#include <camel/camel.h>
+
+#include "translate-cache.h"
+#include "translate-common.h"
+#include "translate-extract.h"
+#include "translate-langid.h"
+#include "translate-models.h"
+#include "translate-stats.h"
+#include "translate-utils.h"
+#include "providers/translate-provider.h"
+#include "providers/translate-provider-argos.h"
+#include "providers/translate-provider-google.h"
+#include "providers/translate-provider-libre.h"
+#include "providers/translate-provider-mymemory.h"
+#include "providers/translate-http.h"
+#include "providers/translate-worker.h"
+
+/* The providers are dynamic types, normally registered by Evolution's
+ * module loader; this module is never unloaded */
+typedef GTypeModule BenchTypeModule;
+typedef GTypeModuleClass BenchTypeModuleClass;
+
+GType bench_type_module_get_type (void);
+G_DEFINE_TYPE (BenchTypeModule, bench_type_module, G_TYPE_TYPE_MODULE)
+
+static gboolean
+bench_type_module_load (GTypeModule *module)
+{
+    (void)module;
+    return TRUE;
+}
+
+static void
+bench_type_module_unload (GTypeModule *module)
+{
+    (void)module;
+}
+
+static void
+bench_type_module_class_init (BenchTypeModuleClass *klass)
+{
+    klass->load = bench_type_module_load;
+    klass->unload = bench_type_module_unload;
+}
+
+static void
+bench_type_module_init (BenchTypeModule *module)
+{
+    (void)module;
+}
+
+typedef struct {
+    GPtrArray  *messages;     /* TranslateContent*, those worth translating */
+    guint       passes;
+    guint       jobs;
+    gboolean    cold;
+
+    /* The pass running */
+    guint       pass;
+    guint       next;
+    guint       in_flight;
+    gint64      started;
+    GArray     *latencies;    /* gint64 microseconds, one per message */
+    guint64     bytes_in;
+    guint64     bytes_out;
+    guint       failures;
+    GMainLoop  *loop;
+} Bench;
+
+typedef struct {
+    Bench  *bench;
+    gint64  submitted;
+    gsize   size;
+} BenchRequest;
+
+static gchar   *opt_provider = NULL;
+static gchar   *opt_target = NULL;
+static gint     opt_passes = 2;
+static gint     opt_jobs = 1;
+static gboolean opt_cold = FALSE;
+static gboolean opt_cache = FALSE;
+static gboolean opt_no_memory = FALSE;
+static gboolean opt_fake = FALSE;
+static gchar  **opt_dirs = NULL;
+
+static const GOptionEntry bench_options[] = {
+    { "provider", 'p', 0, G_OPTION_ARG_STRING, &opt_provider, "Provider to benchmark (default: argos)", "ID" },
+    { "target", 't', 0, G_OPTION_ARG_STRING, &opt_target, "Target language (default: en)", "LANG" },
+    { "passes", 'n', 0, G_OPTION_ARG_INT, &opt_passes, "Times to translate the corpus (default: 2)", "N" },
+    { "jobs", 'j', 0, G_OPTION_ARG_INT, &opt_jobs, "Messages in flight, also the helper pool size (default: 1)", "N" },
+    { "cold", 0, 0, G_OPTION_ARG_NONE, &opt_cold, "Restart the helpers before every pass", NULL },
+    { "cache", 0, 0, G_OPTION_ARG_NONE, &opt_cache, "Keep the whole-message cache on", NULL },
+    { "no-memory", 0, 0, G_OPTION_ARG_NONE, &opt_no_memory, "Turn the helpers' translation memory off", NULL },
+    { "fake", 0, 0, G_OPTION_ARG_NONE, &opt_fake, "Upper-case instead of translating (Argos helper, no models)", NULL },
+    { G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &opt_dirs, NULL, "DIRECTORY" },
+    { NULL }
+};
+
+static gint
+compare_gint64 (gconstpointer a,
+                gconstpointer b)
+{
+    gint64 x = *(const gint64 *) a, y = *(const gint64 *) b;
+
+    return x < y ? -1 : x > y;
+}
+
+static gint
+compare_paths (gconstpointer a,
+               gconstpointer b)
+{
+    return g_strcmp0 (*(const gchar * const *) a, *(const gchar * const *) b);
+}
+
+/* Parses and extracts one .eml file; NULL (with a warning) if unreadable */
+static TranslateContent *
+load_message (const gchar *path)
+{
+    g_autoptr(CamelStream) stream = NULL;
+    g_autoptr(CamelMimeMessage) message = NULL;
+    g_autoptr(GError) error = NULL;
+    gint64 begin = g_get_monotonic_time ();
+
+    stream = camel_stream_fs_new_with_name (path, O_RDONLY, 0, &error);
+    if (!stream) {
+        g_printerr ("Skipping %s: %s\n", path, error->message);
+        return NULL;
+    }
+
+    message = camel_mime_message_new ();
+    if (!camel_data_wrapper_construct_from_stream_sync (CAMEL_DATA_WRAPPER (message), stream, NULL, &error)) {
+        g_printerr ("Skipping %s: %s\n", path, error->message);
+        return NULL;
+    }
+    translate_stats_add_stage ("fetch", begin);
+
+    return translate_extract_message (message, path, NULL);
+}
+
+/* Loads every *.eml file of @dir, in name order */
+static GPtrArray *
+load_corpus (const gchar  *dir,
+             const gchar  *target_lang,
+             GError      **error)
+{
+    g_autoptr(GDir) gdir = g_dir_open (dir, 0, error);
+    g_autoptr(GPtrArray) paths = g_ptr_array_new_with_free_func (g_free);
+    GPtrArray *messages;
+    const gchar *name;
+    guint64 bytes = 0;
+    guint in_target = 0, empty = 0;
+    gint64 begin = g_get_monotonic_time ();
+
+    if (!gdir)
+        return NULL;
+
+    while ((name = g_dir_read_name (gdir)))
+        if (g_str_has_suffix (name, ".eml"))
+            g_ptr_array_add (paths, g_build_filename (dir, name, NULL));
+    g_ptr_array_sort (paths, compare_paths);
+
+    messages = g_ptr_array_new_with_free_func ((GDestroyNotify) translate_content_free);
+    for (guint i = 0; i < paths->len; i++) {
+        TranslateContent *content = load_message (g_ptr_array_index (paths, i));
+
+        if (!content)
+            continue;
+        if (!content->body_html || !*content->body_html) {
+            empty++;
+            translate_content_free (content);
+        } else if (content->source_lang &&
+                   translate_langid_same_language (content->source_lang, target_lang)) {
+            /* Answered without a provider; would only flatter the numbers */
+            in_target++;
+            translate_content_free (content);
+        } else {
+            bytes += strlen (content->body_html);
+            g_ptr_array_add (messages, content);
+        }
+    }
+
+    g_print ("Loaded %u of %u messages (%.1f MB of HTML) in %.0f ms; skipped %u without text, %u already in %s\n",
+             messages->len, paths->len, bytes / 1e6, (g_get_monotonic_time () - begin) / 1000.0,
+             empty, in_target, target_lang);
+    return messages;
+}
+
+static gchar *
+format_duration (gint64 usec)
+{
+    if (usec < 10000000)
+        return g_strdup_printf ("%.1f ms", usec / 1000.0);
+    return g_strdup_printf ("%.2f s", usec / 1000000.0);
+}
+
+static gint64
+percentile (GArray *sorted,
+            guint   p)
+{
+    if (sorted->len == 0)
+        return 0;
+    return g_array_index (sorted, gint64, (sorted->len - 1) * p / 100);
+}
+
+static void
+bench_report_pass (Bench *bench)
+{
+    gint64 elapsed = MAX (g_get_monotonic_time () - bench->started, 1);
+    g_autofree gchar *p50 = NULL, *p95 = NULL, *p99 = NULL;
+    g_autofree gchar *sent = g_format_size (bench->bytes_in);
+    g_autofree gchar *received = g_format_size (bench->bytes_out);
+    g_autofree gchar *own_rss = NULL;
+    g_autofree gchar *helper_rss = g_format_size (translate_worker_get_peak_rss ());
+    struct rusage usage;
+    guint done = bench->messages->len;
+
+    g_array_sort (bench->latencies, compare_gint64);
+    p50 = format_duration (percentile (bench->latencies, 50));
+    p95 = format_duration (percentile (bench->latencies, 95));
+    p99 = format_duration (percentile (bench->latencies, 99));
+
+    /* ru_maxrss is in KiB on Linux */
+    getrusage (RUSAGE_SELF, &usage);
+    own_rss = g_format_size ((guint64) usage.ru_maxrss * 1024);
+
+    g_print ("\nPass %u (%s): %u messages in %.2f s, %.2f messages/s, %.1f KB/s sent\n",
+             bench->pass, bench->pass == 1 || bench->cold ? "cold" : "warm",
+             done, elapsed / 1e6, done * 1e6 / elapsed, bench->bytes_in * 1e3 / elapsed);
+    g_print ("  latency   p50 %s, p95 %s, p99 %s\n", p50, p95, p99);
+    g_print ("  bytes     %s sent, %s received, %u failed\n", sent, received, bench->failures);
+    g_print ("  peak RSS  %s benchmark, %s helpers\n", own_rss, helper_rss);
+}
+
+static void bench_submit (Bench *bench);
+
+static void
+on_translated (GObject      *source,
+               GAsyncResult *res,
+               gpointer      user_data)
+{
+    BenchRequest *request = user_data;
+    Bench *bench = request->bench;
+    g_autoptr(GError) error = NULL;
+    g_autofree gchar *translated = NULL;
+    gint64 latency = g_get_monotonic_time () - request->submitted;
+
+    (void)source;
+
+    if (translate_common_translate_finish (res, &translated, &error)) {
+        g_array_append_val (bench->latencies, latency);
+        bench->bytes_in += request->size;
+        bench->bytes_out += strlen (translated);
+    } else {
+        g_printerr ("Translation failed: %s\n", error->message);
+        bench->failures++;
+    }
+    g_free (request);
+
+    bench->in_flight--;
+    bench_submit (bench);
+}
+
+static void
+bench_start_pass (Bench *bench)
+{
+    bench->pass++;
+    if (bench->pass > 1 && bench->cold)
+        translate_worker_shutdown_all ();
+
+    bench->next = 0;
+    bench->bytes_in = bench->bytes_out = 0;
+    bench->failures = 0;
+    g_array_set_size (bench->latencies, 0);
+    bench->started = g_get_monotonic_time ();
+    bench_submit (bench);
+}
+
+/* Keeps --jobs messages in flight; moves on once the pass is done */
+static void
+bench_submit (Bench *bench)
+{
+    while (bench->in_flight < bench->jobs && bench->next < bench->messages->len) {
+        TranslateContent *content = g_ptr_array_index (bench->messages, bench->next++);
+        BenchRequest *request = g_new0 (BenchRequest, 1);
+
+        request->bench = bench;
+        request->size = strlen (content->body_html);
+        request->submitted = g_get_monotonic_time ();
+        bench->in_flight++;
+        translate_common_translate_whole_async (content->body_html, content->message_key,
+                                                (const gchar * const *) content->parent_keys, content->source_lang,
+                                                TRANSLATE_PRIORITY_INTERACTIVE, content->flags, NULL, NULL, NULL,
+                                                on_translated, request);
+    }
+
+    if (bench->in_flight > 0 || bench->next < bench->messages->len)
+        return;
+
+    bench_report_pass (bench);
+    if (bench->pass < bench->passes)
+        bench_start_pass (bench);
+    else
+        g_main_loop_quit (bench->loop);
+}
+
+/* Removes the scratch cache directory and everything the run put in it */
+static void
+remove_tree (const gchar *path)
+{
+    g_autoptr(GDir) dir = g_dir_open (path, 0, NULL);
+    const gchar *name;
+
+    while (dir && (name = g_dir_read_name (dir))) {
+        g_autofree gchar *child = g_build_filename (path, name, NULL);
+
+        if (g_file_test (child, G_FILE_TEST_IS_DIR) && !g_file_test (child, G_FILE_TEST_IS_SYMLINK))
+            remove_tree (child);
+        else
+            g_unlink (child);
+    }
+    g_rmdir (path);
+}
+
+static gboolean
+bench_configure (GError **error)
+{
+    GSettingsSchemaSource *source = g_settings_schema_source_get_default ();
+    g_autoptr(GSettingsSchema) schema = source ?
+        g_settings_schema_source_lookup (source, "org.gnome.evolution.translate", TRUE) : NULL;
+    GSettings *settings, *provider_settings;
+
+    if (!schema) {
+        g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                     "The org.gnome.evolution.translate schema is not installed; "
+                     "install it or point GSETTINGS_SCHEMA_DIR at a compiled copy");
+        return FALSE;
+    }
+
+    settings = translate_utils_get_settings ();
+    provider_settings = translate_utils_get_provider_settings ();
+    g_settings_set_string (settings, "provider-id", opt_provider);
+    g_settings_set_string (settings, "target-language", opt_target);
+    g_settings_set_int (settings, "max-workers", CLAMP (opt_jobs, 1, 16));
+    g_settings_set_boolean (settings, "prefetch-enabled", FALSE);
+    if (!opt_cache) {
+        g_settings_set_int (settings, "cache-memory-size", 0);
+        g_settings_set_int (settings, "cache-disk-size", 0);
+    }
+    /* Models are not downloaded halfway through a measurement */
+    g_settings_set_boolean (provider_settings, "install-on-demand", FALSE);
+    return TRUE;
+}
+
+int
+main (int    argc,
+      char **argv)
+{
+    g_autoptr(GOptionContext) context = NULL;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(GPtrArray) messages = NULL;
+    g_autofree gchar *cache_dir = NULL;
+    g_autofree gchar *report = NULL;
+    g_autofree gchar *helpers = NULL;
+    GTypeModule *module;
+    Bench bench = { 0 };
+
+    context = g_option_context_new ("DIRECTORY");
+    g_option_context_set_summary (context, "Translates every .eml file of DIRECTORY through the extension's pipeline.");
+    g_option_context_add_main_entries (context, bench_options, NULL);
+    if (!g_option_context_parse (context, &argc, &argv, &error)) {
+        g_printerr ("%s\n", error->message);
+        return EXIT_FAILURE;
+    }
+    if (!opt_dirs || !opt_dirs[0] || opt_dirs[1] || opt_passes < 1 || opt_jobs < 1) {
+        g_autofree gchar *help = g_option_context_get_help (context, TRUE, NULL);
+        g_printerr ("%s", help);
+        return EXIT_FAILURE;
+    }
+    if (!opt_provider)
+        opt_provider = g_strdup ("argos");
+    if (!opt_target)
+        opt_target = g_strdup ("en");
+    if (opt_fake && g_strcmp0 (opt_provider, "argos") != 0) {
+        g_printerr ("--fake needs the Argos helper; not benchmarking %s\n", opt_provider);
+        return EXIT_FAILURE;
+    }
+
+    /* Before anything reads them: GLib caches both on first use */
+    g_setenv ("GSETTINGS_BACKEND", "memory", TRUE);
+    cache_dir = g_dir_make_tmp ("translate-benchmark-XXXXXX", &error);
+    if (!cache_dir) {
+        g_printerr ("%s\n", error->message);
+        return EXIT_FAILURE;
+    }
+    g_setenv ("XDG_CACHE_HOME", cache_dir, TRUE);
+    if (opt_fake)
+        g_setenv ("TRANSLATE_FAKE_UPPERCASE", "1", TRUE);
+    if (opt_no_memory)
+        g_setenv ("TRANSLATE_TM_PATH", "off", TRUE);
+
+    if (!bench_configure (&error)) {
+        g_printerr ("%s\n", error->message);
+        remove_tree (cache_dir);
+        return EXIT_FAILURE;
+    }
+
+    module = g_object_new (bench_type_module_get_type (), NULL);
+    g_type_module_use (module);
+    translate_provider_argos_type_register (module);
+    translate_provider_register (TRANSLATE_TYPE_PROVIDER_ARGOS);
+    translate_provider_google_type_register (module);
+    translate_provider_register (TRANSLATE_TYPE_PROVIDER_GOOGLE);
+    translate_provider_mymemory_type_register (module);
+    translate_provider_register (TRANSLATE_TYPE_PROVIDER_MYMEMORY);
+    translate_provider_libre_type_register (module);
+    translate_provider_register (TRANSLATE_TYPE_PROVIDER_LIBRE);
+
+    if (!translate_provider_get_active ()) {
+        g_printerr ("No translation provider named '%s'\n", opt_provider);
+        remove_tree (cache_dir);
+        return EXIT_FAILURE;
+    }
+
+    messages = load_corpus (opt_dirs[0], opt_target, &error);
+    if (!messages) {
+        g_printerr ("%s\n", error->message);
+        remove_tree (cache_dir);
+        return EXIT_FAILURE;
+    }
+
+    g_print ("Provider %s into %s, %u passes, %u in flight, helpers %s, cache %s, translation memory %s%s\n",
+             opt_provider, opt_target, opt_passes, opt_jobs,
+             opt_cold ? "restarted every pass" : "kept", opt_cache ? "on" : "off",
+             opt_no_memory ? "off" : "on", opt_fake ? ", fake (upper-casing)" : "");
+
+    if (messages->len > 0) {
+        bench.messages = messages;
+        bench.passes = (guint) opt_passes;
+        bench.jobs = (guint) opt_jobs;
+        bench.cold = opt_cold;
+        bench.latencies = g_array_new (FALSE, FALSE, sizeof (gint64));
+        bench.loop = g_main_loop_new (NULL, FALSE);
+
+        bench_start_pass (&bench);
+        g_main_loop_run (bench.loop);
+
+        g_main_loop_unref (bench.loop);
+        g_array_unref (bench.latencies);
+    }
+
+    report = translate_stats_format ();
+    g_print ("\n%s", report);
+    helpers = translate_worker_format_stats ();
+    g_print ("\n%s", helpers);
+
+    translate_models_shutdown ();
+    translate_worker_shutdown_all ();
+    translate_provider_registry_shutdown ();
+    translate_http_shutdown ();
+    translate_cache_shutdown ();
+    remove_tree (cache_dir);
+    return EXIT_SUCCESS;
+}
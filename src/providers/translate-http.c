@@ -0,0 +1,943 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate HTTP - direct requests to online translation services
+ *
+ * Every input text is cut into pieces that fit into one request
+ * (preferably at line breaks, then sentence ends, then spaces) with their
+ * surrounding whitespace set aside, since services tend to drop it. Pieces
+ * are then packed into requests up to the backend's text and size limits
+ * and sent on the shared session, at most HTTP_MAX_RUNNING per job. A
+ * backend that takes a single text per request gets several pieces joined
+ * by line breaks, as long as the service answers with as many lines; when
+ * it merges or splits lines, those pieces are sent again one by one. For
+ * HTML input the pieces come from the segments' text runs; a segment is
+ * streamed as soon as all of its pieces are back, and the document is
+ * rebuilt once every request has been answered.
+ *
+ * Every backend has a token bucket shared by all jobs, so a long message
+ * or a bulk run goes out as fast as the service's quota allows and no
+ * faster. The helper runs on the same bucket: a request handed to it is
+ * lent the tokens that are left, and charged for any it sent beyond them
+ * once it answers. A request that is throttled (HTTP 429), hits a server error or
+ * fails on the network is sent again on its own after a backoff that
+ * doubles each time, or as long as Retry-After asks; the rest of the job
+ * goes on meanwhile. Any other failure, or running out of attempts, stops
+ * the job, so the provider can retry it another way as a whole.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include <json-glib/json-glib.h>
+#include <libsoup/soup.h>
+
+#include "translate-http.h"
+#include "../translate-segment.h"
+#include "../translate-stats.h"
+
+#define HTTP_MAX_CONNS_PER_HOST  4
+#define HTTP_MAX_RUNNING         4     /* Requests in flight per job */
+#define HTTP_TIMEOUT_SECONDS     30
+#define HTTP_IDLE_TIMEOUT        60    /* Keep idle connections this long */
+#define HTTP_DEFAULT_MAX_CHARS   4000  /* For backends without a limit */
+#define HTTP_MAX_ATTEMPTS        4
+#define HTTP_BACKOFF_MS          500   /* Doubled after every failed attempt */
+#define HTTP_MAX_RETRY_AFTER_MS  30000
+
+static SoupSession *http_session = NULL;
+
+typedef struct {
+    gdouble tokens;
+    gint64  stamp;   /* Monotonic time of the last refill */
+} HttpBucket;
+
+static GHashTable *http_buckets = NULL;  /* Backend name → HttpBucket */
+
+/* Created on first use and kept for the life of the module, so requests to
+ * the same service reuse its connections */
+static SoupSession *
+http_get_session (void)
+{
+    if (!http_session) {
+        /* A trailing space makes libsoup append its own product token */
+        http_session = soup_session_new_with_options ("max-conns-per-host", HTTP_MAX_CONNS_PER_HOST,
+                                                      "timeout", HTTP_TIMEOUT_SECONDS,
+                                                      "idle-timeout", HTTP_IDLE_TIMEOUT,
+                                                      "user-agent", "evolution-translate ",
+                                                      NULL);
+    }
+    return http_session;
+}
+
+void
+translate_http_shutdown (void)
+{
+    if (http_session) {
+        soup_session_abort (http_session);
+        g_clear_object (&http_session);
+    }
+    g_clear_pointer (&http_buckets, g_hash_table_unref);
+}
+
+static gsize
+http_backend_get_max_chars (const TranslateHttpBackend *backend)
+{
+    return backend->max_chars > 0 ? backend->max_chars : HTTP_DEFAULT_MAX_CHARS;
+}
+
+static HttpBucket *
+http_bucket_refill (const TranslateHttpBackend *backend)
+{
+    gint64 now = g_get_monotonic_time ();
+    HttpBucket *bucket;
+
+    if (!http_buckets)
+        http_buckets = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, g_free);
+    bucket = g_hash_table_lookup (http_buckets, backend->name);
+    if (!bucket) {
+        bucket = g_new0 (HttpBucket, 1);
+        bucket->tokens = MAX (backend->burst, 1);
+        bucket->stamp = now;
+        g_hash_table_insert (http_buckets, (gpointer) backend->name, bucket);
+    }
+
+    bucket->tokens = MIN ((gdouble) MAX (backend->burst, 1),
+                          bucket->tokens + (gdouble) (now - bucket->stamp) / G_USEC_PER_SEC * backend->rate);
+    bucket->stamp = now;
+    return bucket;
+}
+
+/* Takes a request token of @backend. Returns 0 on success, otherwise the
+ * milliseconds until the next token is due. */
+static guint
+http_bucket_take (const TranslateHttpBackend *backend)
+{
+    HttpBucket *bucket;
+
+    if (backend->rate <= 0)
+        return 0;
+
+    bucket = http_bucket_refill (backend);
+    if (bucket->tokens >= 1.0) {
+        bucket->tokens -= 1.0;
+        return 0;
+    }
+    return (guint) ((1.0 - bucket->tokens) * 1000.0 / backend->rate) + 1;
+}
+
+/* The service asked us to slow down: no bursts until the bucket refills */
+static void
+http_bucket_drain (const TranslateHttpBackend *backend)
+{
+    if (backend->rate > 0)
+        http_bucket_refill (backend)->tokens = 0.0;
+}
+
+void
+translate_http_lend_budget (const TranslateHttpBackend *backend,
+                            JsonObject                 *request)
+{
+    HttpBucket *bucket;
+    gint64 tokens;
+
+    g_return_if_fail (backend != NULL);
+    g_return_if_fail (request != NULL);
+
+    json_object_set_int_member (request, "max_chars", (gint64) http_backend_get_max_chars (backend));
+    json_object_set_double_member (request, "rate", backend->rate);
+    json_object_set_int_member (request, "burst", MAX (backend->burst, 1));
+    if (backend->rate <= 0)
+        return;
+
+    /* Whole tokens only; the fraction keeps refilling here */
+    bucket = http_bucket_refill (backend);
+    tokens = MAX ((gint64) bucket->tokens, 0);
+    bucket->tokens -= (gdouble) tokens;
+    json_object_set_int_member (request, "tokens", tokens);
+}
+
+void
+translate_http_settle_budget (const TranslateHttpBackend *backend,
+                              JsonObject                 *response)
+{
+    HttpBucket *bucket;
+    gint64 extra;
+
+    g_return_if_fail (backend != NULL);
+
+    if (backend->rate <= 0 || !response || !json_object_has_member (response, "extra_requests"))
+        return;
+
+    /* Negative when the helper sent fewer requests than it was lent. The
+     * bucket may go below zero, which delays the next direct request until
+     * the helper's excess has been paid off. */
+    extra = json_object_get_int_member (response, "extra_requests");
+    bucket = http_bucket_refill (backend);
+    bucket->tokens = MIN ((gdouble) MAX (backend->burst, 1), bucket->tokens - (gdouble) extra);
+}
+
+TranslateHttpFallback *
+translate_http_fallback_new (const gchar         *input,
+                             gboolean             is_html,
+                             const gchar         *source_lang_opt,
+                             const gchar         *target_lang,
+                             TranslateStreamFunc  stream_func,
+                             gpointer             stream_data)
+{
+    TranslateHttpFallback *fallback = g_new0 (TranslateHttpFallback, 1);
+    fallback->input = g_strdup (input);
+    fallback->is_html = is_html;
+    fallback->source_lang = g_strdup (source_lang_opt);
+    fallback->target_lang = g_strdup (target_lang);
+    fallback->stream_func = stream_func;
+    fallback->stream_data = stream_data;
+    return fallback;
+}
+
+TranslateHttpFallback *
+translate_http_fallback_new_batch (const gchar * const *inputs,
+                                   guint                n_inputs,
+                                   const gchar         *source_lang_opt,
+                                   const gchar         *target_lang)
+{
+    TranslateHttpFallback *fallback = g_new0 (TranslateHttpFallback, 1);
+    fallback->inputs = g_new0 (gchar *, n_inputs + 1);
+    for (guint i = 0; i < n_inputs; i++)
+        fallback->inputs[i] = g_strdup (inputs[i] ? inputs[i] : "");
+    fallback->n_inputs = n_inputs;
+    fallback->source_lang = g_strdup (source_lang_opt);
+    fallback->target_lang = g_strdup (target_lang);
+    return fallback;
+}
+
+void
+translate_http_fallback_free (TranslateHttpFallback *fallback)
+{
+    if (!fallback)
+        return;
+    g_free (fallback->input);
+    g_strfreev (fallback->inputs);
+    g_free (fallback->source_lang);
+    g_free (fallback->target_lang);
+    g_free (fallback);
+}
+
+gboolean
+translate_http_should_fall_back (const GError *error)
+{
+    return error && !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED);
+}
+
+/* Part of one input text, small enough for a single request */
+typedef struct {
+    guint  text;        /* Index of the text it belongs to */
+    gchar *lead;        /* Whitespace around the piece, put back afterwards */
+    gchar *core;        /* What is sent */
+    gchar *trail;
+    gchar *translated;  /* Set once answered; empty pieces are never sent */
+} HttpPiece;
+
+typedef struct {
+    const TranslateHttpBackend *backend;
+    GTask              *task;         /* Owned until the job completes */
+    TranslateSegments  *segments;     /* HTML input only */
+    GPtrArray          *pieces;       /* HttpPiece *, in text order */
+    GArray             *starts;       /* Index of each text's first piece */
+    guint               next;         /* Next piece to send */
+    GQueue              ready;        /* HttpChunk * to send before new ones */
+    guint               running;      /* Requests in flight */
+    GQueue              backoff;      /* HttpChunk * waiting to be retried */
+    guint               rate_wait_id; /* Waiting for a token of the bucket */
+    gulong              cancelled_id;
+    guint               cancel_idle_id;
+    gsize               max_chars;
+    guint               max_texts;
+    gchar              *source_lang;
+    gchar              *target_lang;
+    TranslateStreamFunc stream_func;
+    gpointer            stream_data;
+    gboolean            skeleton_sent;
+    gboolean            batch;        /* Returns every text instead of one result */
+    GError             *error;        /* First failure */
+} HttpJob;
+
+typedef struct {
+    HttpJob     *job;
+    SoupMessage *msg;
+    GArray      *pieces;    /* Piece indices, in the order they were sent */
+    gboolean     packed;    /* Pieces go out as one text, joined by line breaks */
+    guint        attempts;
+    guint        retry_id;  /* Backoff timeout */
+    gint64       sent_at;   /* Monotonic time the current attempt went out */
+} HttpChunk;
+
+static void
+http_piece_free (gpointer data)
+{
+    HttpPiece *piece = data;
+    g_free (piece->lead);
+    g_free (piece->core);
+    g_free (piece->trail);
+    g_free (piece->translated);
+    g_free (piece);
+}
+
+static void http_chunk_free (HttpChunk *chunk);
+
+static void
+http_job_free (gpointer data)
+{
+    HttpJob *job = data;
+    g_queue_clear_full (&job->ready, (GDestroyNotify) http_chunk_free);
+    g_clear_pointer (&job->segments, translate_segments_free);
+    g_ptr_array_unref (job->pieces);
+    g_array_unref (job->starts);
+    g_free (job->source_lang);
+    g_free (job->target_lang);
+    g_clear_error (&job->error);
+    g_free (job);
+}
+
+static void
+http_chunk_free (HttpChunk *chunk)
+{
+    g_clear_object (&chunk->msg);
+    g_array_unref (chunk->pieces);
+    g_free (chunk);
+}
+
+static void http_job_pump (HttpJob *job);
+
+static gboolean
+on_cancel_idle (gpointer user_data)
+{
+    HttpJob *job = user_data;
+
+    job->cancel_idle_id = 0;
+    http_job_pump (job);
+    return G_SOURCE_REMOVE;
+}
+
+/* Wakes the job up if it is only waiting for a backoff or a token; from
+ * an idle, since this may run in the middle of one of the job's callbacks */
+static void
+on_job_cancelled (GCancellable *cancellable,
+                  gpointer      user_data)
+{
+    HttpJob *job = user_data;
+
+    (void)cancellable;
+    if (!job->cancel_idle_id)
+        job->cancel_idle_id = g_idle_add (on_cancel_idle, job);
+}
+
+static HttpJob *
+http_job_new (const TranslateHttpBackend *backend,
+              gpointer                    source_object,
+              const gchar                *source_lang_opt,
+              const gchar                *target_lang,
+              GCancellable               *cancellable,
+              GAsyncReadyCallback         callback,
+              gpointer                    user_data,
+              gpointer                    source_tag)
+{
+    HttpJob *job = g_new0 (HttpJob, 1);
+    job->backend = backend;
+    job->task = g_task_new (source_object, cancellable, callback, user_data);
+    g_task_set_source_tag (job->task, source_tag);
+    g_task_set_task_data (job->task, job, http_job_free);
+    job->pieces = g_ptr_array_new_with_free_func (http_piece_free);
+    job->starts = g_array_new (FALSE, FALSE, sizeof (guint));
+    job->max_chars = http_backend_get_max_chars (backend);
+    /* Joined pieces count as one text */
+    job->max_texts = backend->join_lines ? G_MAXUINT : MAX (backend->max_texts, 1);
+    job->source_lang = (source_lang_opt && *source_lang_opt) ? g_strdup (source_lang_opt) : NULL;
+    job->target_lang = g_strdup (target_lang);
+    if (cancellable)
+        job->cancelled_id = g_cancellable_connect (cancellable, G_CALLBACK (on_job_cancelled), job, NULL);
+    return job;
+}
+
+static void
+http_job_add_piece (HttpJob     *job,
+                    const gchar *start,
+                    gsize        len)
+{
+    const gchar *end = start + len;
+    const gchar *core = start;
+    const gchar *core_end = end;
+    HttpPiece *piece = g_new0 (HttpPiece, 1);
+
+    while (core < end && g_ascii_isspace (*core))
+        core++;
+    while (core_end > core && g_ascii_isspace (core_end[-1]))
+        core_end--;
+
+    piece->text = job->starts->len - 1;
+    piece->lead = g_strndup (start, core - start);
+    piece->core = g_strndup (core, core_end - core);
+    piece->trail = g_strndup (core_end, end - core_end);
+    if (!*piece->core)
+        piece->translated = g_strdup ("");
+    g_ptr_array_add (job->pieces, piece);
+}
+
+/* Returns the byte offset after the last occurrence of @sep within the
+ * first @max bytes of @text, ignoring the first half so pieces do not
+ * get tiny; 0 if there is none */
+static gsize
+http_find_break (const gchar *text,
+                 gsize        max,
+                 const gchar *sep)
+{
+    gsize sep_len = strlen (sep);
+    for (gsize end = max; end > max / 2 && end >= sep_len; end--) {
+        if (memcmp (text + end - sep_len, sep, sep_len) == 0)
+            return end;
+    }
+    return 0;
+}
+
+/* Where to cut @text so the first part is at most @max bytes long */
+static gsize
+http_find_cut (const gchar *text,
+               gsize        max)
+{
+    static const gchar * const separators[] = { "\n", ". ", "! ", "? ", " " };
+    gsize cut;
+
+    for (guint i = 0; i < G_N_ELEMENTS (separators); i++) {
+        cut = http_find_break (text, max, separators[i]);
+        if (cut > 0)
+            return cut;
+    }
+
+    /* No break at all; cut at a character boundary */
+    cut = max;
+    while (cut > 0 && ((guchar) text[cut] & 0xC0) == 0x80)
+        cut--;
+    return cut > 0 ? cut : max;
+}
+
+static void
+http_job_add_text (HttpJob     *job,
+                   const gchar *text)
+{
+    guint start = job->pieces->len;
+    gsize len = strlen (text);
+
+    g_array_append_val (job->starts, start);
+    while (len > job->max_chars) {
+        gsize cut = http_find_cut (text, job->max_chars);
+        http_job_add_piece (job, text, cut);
+        text += cut;
+        len -= cut;
+    }
+    http_job_add_piece (job, text, len);
+}
+
+static guint
+http_job_get_n_texts (HttpJob *job)
+{
+    return job->starts->len;
+}
+
+static gboolean
+http_job_text_is_done (HttpJob *job,
+                       guint    text)
+{
+    guint end = text + 1 < job->starts->len ?
+        g_array_index (job->starts, guint, text + 1) : job->pieces->len;
+    for (guint i = g_array_index (job->starts, guint, text); i < end; i++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, i);
+        if (!piece->translated)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+/* Returns (transfer full) the translation of @text from its pieces */
+static gchar *
+http_job_assemble (HttpJob *job,
+                   guint    text)
+{
+    guint end = text + 1 < job->starts->len ?
+        g_array_index (job->starts, guint, text + 1) : job->pieces->len;
+    GString *out = g_string_new (NULL);
+    for (guint i = g_array_index (job->starts, guint, text); i < end; i++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, i);
+        g_string_append (out, piece->lead);
+        g_string_append (out, piece->translated);
+        g_string_append (out, piece->trail);
+    }
+    return g_string_free (out, FALSE);
+}
+
+static gchar **
+http_job_assemble_all (HttpJob *job)
+{
+    guint n = http_job_get_n_texts (job);
+    gchar **texts = g_new0 (gchar *, n + 1);
+    for (guint i = 0; i < n; i++)
+        texts[i] = http_job_assemble (job, i);
+    return texts;
+}
+
+/* Streams the segments this chunk completed */
+static void
+http_job_emit_segments (HttpJob   *job,
+                        HttpChunk *chunk)
+{
+    TranslateStreamEvent ev = { 0 };
+    guint last = G_MAXUINT;
+
+    if (!job->stream_func || !job->segments)
+        return;
+
+    for (guint i = 0; i < chunk->pieces->len; i++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, g_array_index (chunk->pieces, guint, i));
+        g_autofree gchar *text = NULL;
+
+        if (piece->text == last || !http_job_text_is_done (job, piece->text))
+            continue;
+        last = piece->text;
+
+        /* Like the helper path, the original stays up until the first
+         * segment is ready */
+        if (!job->skeleton_sent) {
+            g_autofree gchar *skeleton = translate_segments_build_skeleton (job->segments);
+            ev.type = TRANSLATE_STREAM_SKELETON;
+            ev.text = skeleton;
+            ev.n_segments = translate_segments_get_count (job->segments);
+            job->skeleton_sent = TRUE;
+            job->stream_func (&ev, job->stream_data);
+        }
+
+        text = http_job_assemble (job, piece->text);
+        ev.type = TRANSLATE_STREAM_SEGMENT;
+        ev.text = text;
+        ev.index = piece->text;
+        job->stream_func (&ev, job->stream_data);
+    }
+}
+
+static guint
+http_count_lines (const gchar *text)
+{
+    guint lines = 1;
+    for (; *text; text++) {
+        if (*text == '\n')
+            lines++;
+    }
+    return lines;
+}
+
+/* Hands the lines of a packed chunk's single translation, which it takes
+ * over, back to its pieces. Fails with %G_IO_ERROR_PARTIAL_INPUT if the
+ * service did not keep the line breaks. */
+static gboolean
+http_chunk_parse_lines (HttpChunk  *chunk,
+                        gchar     **translations,
+                        GError    **error)
+{
+    HttpJob *job = chunk->job;
+    g_auto(GStrv) lines = NULL;
+    guint n_lines = 0;
+    guint expected = 0;
+    guint line = 0;
+
+    for (guint i = 0; i < chunk->pieces->len; i++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, g_array_index (chunk->pieces, guint, i));
+        expected += http_count_lines (piece->core);
+    }
+    if (translations[0])
+        lines = g_strsplit (g_strstrip (translations[0]), "\n", -1);
+    g_strfreev (translations);
+    n_lines = lines ? g_strv_length (lines) : 0;
+    if (n_lines != expected) {
+        g_set_error (error, G_IO_ERROR, G_IO_ERROR_PARTIAL_INPUT,
+                     "%s answered %u lines for %u", job->backend->name, n_lines, expected);
+        return FALSE;
+    }
+
+    for (guint i = 0; i < chunk->pieces->len; i++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, g_array_index (chunk->pieces, guint, i));
+        guint count = http_count_lines (piece->core);
+        GString *out = g_string_new (NULL);
+        for (guint j = 0; j < count; j++, line++) {
+            if (j > 0)
+                g_string_append_c (out, '\n');
+            g_string_append (out, lines[line]);
+        }
+        piece->translated = g_strstrip (g_string_free (out, FALSE));
+    }
+    return TRUE;
+}
+
+static gboolean
+http_chunk_parse (HttpChunk *chunk,
+                  GBytes    *body,
+                  GError   **error)
+{
+    HttpJob *job = chunk->job;
+    guint status = soup_message_get_status (chunk->msg);
+    guint n = chunk->pieces->len;
+    g_autoptr(JsonParser) parser = NULL;
+    g_autoptr(GError) local_error = NULL;
+    gsize size = 0;
+    const gchar *data;
+    gchar **translations;
+    gint64 begin;
+
+    if (!SOUP_STATUS_IS_SUCCESSFUL (status)) {
+        /* 429: the service is rate limiting us */
+        g_set_error (error, G_IO_ERROR, status == 429 ? G_IO_ERROR_BUSY : G_IO_ERROR_FAILED,
+                     "%s answered HTTP %u %s", job->backend->name, status,
+                     soup_message_get_reason_phrase (chunk->msg));
+        return FALSE;
+    }
+
+    data = g_bytes_get_data (body, &size);
+    begin = g_get_monotonic_time ();
+    parser = json_parser_new ();
+    if (!json_parser_load_from_data (parser, data, (gssize) size, &local_error)) {
+        g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+                     "Unreadable response from %s: %s", job->backend->name, local_error->message);
+        return FALSE;
+    }
+    translate_stats_add_stage ("parse", begin);
+
+    translations = g_new0 (gchar *, n + 1);
+    if (!job->backend->parse (json_parser_get_root (parser), chunk->packed ? 1 : n, translations, error)) {
+        g_strfreev (translations);
+        return FALSE;
+    }
+    if (chunk->packed)
+        return http_chunk_parse_lines (chunk, translations, error);
+
+    for (guint i = 0; i < n; i++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, g_array_index (chunk->pieces, guint, i));
+        /* A missing entry keeps the original text */
+        piece->translated = translations[i] ? g_strstrip (translations[i]) : g_strdup (piece->core);
+    }
+    g_free (translations);
+    return TRUE;
+}
+
+static void
+http_job_complete (HttpJob *job)
+{
+    GTask *task = job->task;
+
+    if (job->cancelled_id)
+        g_cancellable_disconnect (g_task_get_cancellable (task), job->cancelled_id);
+    g_clear_handle_id (&job->cancel_idle_id, g_source_remove);
+
+    if (job->error) {
+        g_task_return_error (task, g_steal_pointer (&job->error));
+    } else if (job->batch) {
+        g_task_return_pointer (task, http_job_assemble_all (job), (GDestroyNotify) g_strfreev);
+    } else if (job->segments) {
+        g_auto(GStrv) translations = http_job_assemble_all (job);
+        g_task_return_pointer (task,
+                               translate_segments_rebuild (job->segments,
+                                                           (const gchar * const *) translations,
+                                                           http_job_get_n_texts (job)),
+                               g_free);
+    } else {
+        g_task_return_pointer (task, http_job_assemble (job, 0), g_free);
+    }
+    /* Frees the job along with the task */
+    g_object_unref (task);
+}
+
+static gboolean
+on_retry_due (gpointer user_data)
+{
+    HttpChunk *chunk = user_data;
+    HttpJob *job = chunk->job;
+
+    chunk->retry_id = 0;
+    g_queue_remove (&job->backoff, chunk);
+    g_queue_push_tail (&job->ready, chunk);
+    http_job_pump (job);
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean
+on_rate_due (gpointer user_data)
+{
+    HttpJob *job = user_data;
+
+    job->rate_wait_id = 0;
+    http_job_pump (job);
+    return G_SOURCE_REMOVE;
+}
+
+/* How long to wait before sending @chunk again, or 0 if it must not be */
+static guint
+http_chunk_retry_delay (HttpChunk    *chunk,
+                        const GError *error)
+{
+    guint status = soup_message_get_status (chunk->msg);
+    const gchar *retry_after;
+
+    if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED) ||
+        chunk->attempts >= HTTP_MAX_ATTEMPTS)
+        return 0;
+
+    /* Throttled, either as HTTP 429 or in the response body */
+    if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_BUSY)) {
+        http_bucket_drain (chunk->job->backend);
+        retry_after = soup_message_headers_get_one (soup_message_get_response_headers (chunk->msg),
+                                                    "Retry-After");
+        if (retry_after && g_ascii_isdigit (*retry_after))
+            return (guint) CLAMP (g_ascii_strtoll (retry_after, NULL, 10) * 1000, HTTP_BACKOFF_MS,
+                                  HTTP_MAX_RETRY_AFTER_MS);
+    } else if (status != SOUP_STATUS_NONE && status < 500) {
+        /* Answered, but not with something a retry would change */
+        return 0;
+    }
+
+    return HTTP_BACKOFF_MS << (chunk->attempts - 1);
+}
+
+static HttpChunk *
+http_chunk_new (HttpJob *job)
+{
+    HttpChunk *chunk = g_new0 (HttpChunk, 1);
+    chunk->job = job;
+    chunk->pieces = g_array_new (FALSE, FALSE, sizeof (guint));
+    return chunk;
+}
+
+/* Queues every piece of @chunk to be sent again on its own */
+static void
+http_job_unpack (HttpJob   *job,
+                 HttpChunk *chunk)
+{
+    for (guint i = 0; i < chunk->pieces->len; i++) {
+        HttpChunk *single = http_chunk_new (job);
+        g_array_append_val (single->pieces, g_array_index (chunk->pieces, guint, i));
+        g_queue_push_tail (&job->ready, single);
+    }
+}
+
+static void
+on_chunk_done (GObject      *source,
+               GAsyncResult *res,
+               gpointer      user_data)
+{
+    HttpChunk *chunk = user_data;
+    HttpJob *job = chunk->job;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(GBytes) body = soup_session_send_and_read_finish (SOUP_SESSION (source), res, &error);
+    guint delay;
+
+    job->running--;
+    if (body)
+        translate_stats_add_stage ("http", chunk->sent_at);
+    if (body && http_chunk_parse (chunk, body, &error)) {
+        http_job_emit_segments (job, chunk);
+        http_chunk_free (chunk);
+    } else if (!job->error && chunk->packed &&
+               g_error_matches (error, G_IO_ERROR, G_IO_ERROR_PARTIAL_INPUT)) {
+        g_debug ("[http] %s, sending its %u pieces one by one", error->message, chunk->pieces->len);
+        http_job_unpack (job, chunk);
+        http_chunk_free (chunk);
+    } else if (!job->error && (delay = http_chunk_retry_delay (chunk, error)) > 0) {
+        g_debug ("[http] %s: %s, retrying in %u ms (attempt %u of %u)", job->backend->name,
+                 error->message, delay, chunk->attempts + 1, HTTP_MAX_ATTEMPTS);
+        chunk->retry_id = g_timeout_add (delay, on_retry_due, chunk);
+        g_queue_push_tail (&job->backoff, chunk);
+    } else {
+        if (!job->error)
+            job->error = g_steal_pointer (&error);
+        http_chunk_free (chunk);
+    }
+
+    http_job_pump (job);
+}
+
+/* Returns the next pieces to send as a new chunk, or NULL if none are left */
+static HttpChunk *
+http_job_next_chunk (HttpJob *job)
+{
+    HttpChunk *chunk = http_chunk_new (job);
+    gsize chars = 0;
+
+    for (; job->next < job->pieces->len && chunk->pieces->len < job->max_texts; job->next++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, job->next);
+        gsize len;
+        if (piece->translated)
+            continue;
+        /* Joined pieces also need room for the line break between them */
+        len = strlen (piece->core) + (job->backend->join_lines && chunk->pieces->len > 0 ? 1 : 0);
+        if (chunk->pieces->len > 0 && chars + len > job->max_chars)
+            break;
+        g_array_append_val (chunk->pieces, job->next);
+        chars += len;
+    }
+    if (chunk->pieces->len == 0) {
+        http_chunk_free (chunk);
+        return NULL;
+    }
+    chunk->packed = job->backend->join_lines && chunk->pieces->len > 1;
+    return chunk;
+}
+
+static gboolean
+http_chunk_send (HttpChunk *chunk)
+{
+    HttpJob *job = chunk->job;
+    g_autofree const gchar **texts = g_new0 (const gchar *, chunk->pieces->len + 1);
+    g_autofree gchar *joined = NULL;
+
+    for (guint i = 0; i < chunk->pieces->len; i++) {
+        HttpPiece *piece = g_ptr_array_index (job->pieces, g_array_index (chunk->pieces, guint, i));
+        texts[i] = piece->core;
+    }
+    if (chunk->packed) {
+        joined = g_strjoinv ("\n", (gchar **) texts);
+        texts[0] = joined;
+        texts[1] = NULL;
+    }
+
+    /* A message is only sent once; retries get a fresh one */
+    g_clear_object (&chunk->msg);
+    chunk->msg = job->backend->build (texts, chunk->packed ? 1 : chunk->pieces->len,
+                                      job->source_lang, job->target_lang);
+    if (!chunk->msg) {
+        g_set_error (&job->error, G_IO_ERROR, G_IO_ERROR_INVALID_ARGUMENT,
+                     "Could not build a request for %s", job->backend->name);
+        return FALSE;
+    }
+
+    chunk->attempts++;
+    chunk->sent_at = g_get_monotonic_time ();
+    job->running++;
+    soup_session_send_and_read_async (http_get_session (), chunk->msg, G_PRIORITY_DEFAULT,
+                                      g_task_get_cancellable (job->task), on_chunk_done, chunk);
+    return TRUE;
+}
+
+/* Sends as many requests as the job and the backend's rate allow, and
+ * completes the job once nothing is left to send or wait for */
+static void
+http_job_pump (HttpJob *job)
+{
+    if (!job->error)
+        g_cancellable_set_error_if_cancelled (g_task_get_cancellable (job->task), &job->error);
+    if (job->error) {
+        HttpChunk *chunk;
+        g_clear_handle_id (&job->rate_wait_id, g_source_remove);
+        while ((chunk = g_queue_pop_head (&job->backoff))) {
+            g_clear_handle_id (&chunk->retry_id, g_source_remove);
+            http_chunk_free (chunk);
+        }
+    }
+
+    while (!job->error && !job->rate_wait_id && job->running < HTTP_MAX_RUNNING) {
+        HttpChunk *chunk = g_queue_pop_head (&job->ready);
+        guint delay;
+
+        if (!chunk)
+            chunk = http_job_next_chunk (job);
+        if (!chunk)
+            break;
+
+        delay = http_bucket_take (job->backend);
+        if (delay > 0) {
+            g_queue_push_head (&job->ready, chunk);
+            job->rate_wait_id = g_timeout_add (delay, on_rate_due, job);
+            break;
+        }
+        if (!http_chunk_send (chunk)) {
+            http_chunk_free (chunk);
+            break;
+        }
+    }
+
+    if (job->running == 0 && g_queue_is_empty (&job->backoff) && !job->rate_wait_id)
+        http_job_complete (job);
+}
+
+void
+translate_http_translate_async (const TranslateHttpBackend *backend,
+                                gpointer                    source_object,
+                                const gchar                *input,
+                                gboolean                    is_html,
+                                const gchar                *source_lang_opt,
+                                const gchar                *target_lang,
+                                TranslateStreamFunc         stream_func,
+                                gpointer                    stream_data,
+                                GCancellable               *cancellable,
+                                GAsyncReadyCallback         callback,
+                                gpointer                    user_data)
+{
+    g_return_if_fail (backend != NULL);
+    g_return_if_fail (input != NULL);
+    g_return_if_fail (target_lang != NULL);
+
+    HttpJob *job = http_job_new (backend, source_object, source_lang_opt, target_lang,
+                                 cancellable, callback, user_data, translate_http_translate_async);
+    job->stream_func = stream_func;
+    job->stream_data = stream_data;
+
+    if (is_html) {
+        job->segments = translate_segments_parse (input);
+        for (guint i = 0; i < translate_segments_get_count (job->segments); i++)
+            http_job_add_text (job, translate_segments_get_text (job->segments, i));
+    } else {
+        http_job_add_text (job, input);
+    }
+
+    g_debug ("[http] %s: %u texts in %u pieces, target=%s",
+             backend->name, http_job_get_n_texts (job), job->pieces->len, target_lang);
+    http_job_pump (job);
+}
+
+gchar *
+translate_http_translate_finish (GAsyncResult *res,
+                                 GError      **error)
+{
+    g_return_val_if_fail (g_task_get_source_tag (G_TASK (res)) == translate_http_translate_async, NULL);
+    return g_task_propagate_pointer (G_TASK (res), error);
+}
+
+void
+translate_http_translate_batch_async (const TranslateHttpBackend *backend,
+                                      gpointer                    source_object,
+                                      const gchar * const        *inputs,
+                                      guint                       n_inputs,
+                                      const gchar                *source_lang_opt,
+                                      const gchar                *target_lang,
+                                      GCancellable               *cancellable,
+                                      GAsyncReadyCallback         callback,
+                                      gpointer                    user_data)
+{
+    g_return_if_fail (backend != NULL);
+    g_return_if_fail (inputs != NULL || n_inputs == 0);
+    g_return_if_fail (target_lang != NULL);
+
+    HttpJob *job = http_job_new (backend, source_object, source_lang_opt, target_lang,
+                                 cancellable, callback, user_data, translate_http_translate_batch_async);
+    job->batch = TRUE;
+    for (guint i = 0; i < n_inputs; i++)
+        http_job_add_text (job, inputs[i] ? inputs[i] : "");
+
+    g_debug ("[http] %s: batch of %u texts in %u pieces, target=%s",
+             backend->name, n_inputs, job->pieces->len, target_lang);
+    http_job_pump (job);
+}
+
+gchar **
+translate_http_translate_batch_finish (GAsyncResult *res,
+                                       GError      **error)
+{
+    g_return_val_if_fail (g_task_get_source_tag (G_TASK (res)) == translate_http_translate_batch_async, NULL);
+    return g_task_propagate_pointer (G_TASK (res), error);
+}
@@ -0,0 +1,148 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate HTTP - direct requests to online translation services
+ *
+ * One SoupSession is shared by every online provider, so connections
+ * (and their TLS sessions) are kept alive and reused, over HTTP/2 where
+ * the service offers it. A provider only describes its service as a
+ * TranslateHttpBackend: how to build a request for a few texts and how to
+ * read the translations out of the JSON response. Splitting into requests,
+ * running them concurrently, HTML segmentation and streaming happen here. */
+
+#ifndef TRANSLATE_HTTP_H
+#define TRANSLATE_HTTP_H
+
+#include <glib.h>
+#include <gio/gio.h>
+#include <json-glib/json-glib.h>
+#include <libsoup/soup.h>
+
+#include "translate-provider.h"
+
+G_BEGIN_DECLS
+
+/* Returns (transfer full) the request translating @texts */
+typedef SoupMessage * (*TranslateHttpBuildFunc) (const gchar * const *texts,
+                                                 guint                n_texts,
+                                                 const gchar         *source_lang_opt,
+                                                 const gchar         *target_lang);
+
+/* Stores one newly allocated translation per text in @out_translations */
+typedef gboolean (*TranslateHttpParseFunc) (JsonNode  *root,
+                                             guint      n_texts,
+                                             gchar    **out_translations,
+                                             GError   **error);
+
+typedef struct {
+    const gchar            *name;       /* For log messages, e.g. "google" */
+    gsize                   max_chars;  /* Text per request; longer texts are split */
+    guint                   max_texts;  /* Texts per request; 1 if the API takes one */
+    gboolean                join_lines; /* Pack texts into one, a line each, up to @max_chars */
+    gdouble                 rate;       /* Requests per second; 0 = unlimited */
+    guint                   burst;      /* Requests allowed at once before @rate applies */
+    TranslateHttpBuildFunc  build;
+    TranslateHttpParseFunc  parse;
+} TranslateHttpBackend;
+
+/* The arguments of a translation, kept by a provider to hand the same
+ * request to its helper if the service cannot be reached */
+typedef struct {
+    gchar               *input;        /* translate_stream_async only */
+    gboolean             is_html;
+    gchar              **inputs;       /* translate_batch_async only */
+    guint                n_inputs;
+    gchar               *source_lang;  /* nullable */
+    gchar               *target_lang;
+    TranslateStreamFunc  stream_func;
+    gpointer             stream_data;
+} TranslateHttpFallback;
+
+TranslateHttpFallback *translate_http_fallback_new (const gchar         *input,
+                                                    gboolean             is_html,
+                                                    const gchar         *source_lang_opt,
+                                                    const gchar         *target_lang,
+                                                    TranslateStreamFunc  stream_func,
+                                                    gpointer             stream_data);
+
+TranslateHttpFallback *translate_http_fallback_new_batch (const gchar * const *inputs,
+                                                          guint                n_inputs,
+                                                          const gchar         *source_lang_opt,
+                                                          const gchar         *target_lang);
+
+void translate_http_fallback_free (TranslateHttpFallback *fallback);
+
+/* Adds @backend's request limits to a helper @request for the same
+ * service, and lends it the whole tokens left in the shared bucket */
+void translate_http_lend_budget (const TranslateHttpBackend *backend,
+                                 JsonObject                 *request);
+
+/* Charges the shared bucket for the requests a helper @response (nullable)
+ * reports sending beyond what it was lent, or gives back those it did not
+ * use */
+void translate_http_settle_budget (const TranslateHttpBackend *backend,
+                                   JsonObject                 *response);
+
+/* Whether a failed direct request is worth retrying through the helper:
+ * anything but cancellation */
+gboolean translate_http_should_fall_back (const GError *error);
+
+/**
+ * translate_http_translate_async:
+ * @backend: The service to use
+ * @source_object: The provider, passed on to @callback
+ * @input: Text or HTML to translate
+ * @is_html: Whether @input is HTML; only its text segments are sent
+ * @source_lang_opt: (nullable): Source language, or %NULL to let the
+ *   service detect it
+ * @target_lang: Target language code
+ * @stream_func: (nullable): Receives the skeleton and finished segments
+ *   of HTML input
+ * @stream_data: User data for @stream_func; must stay valid until @callback runs
+ * @cancellable: (nullable): Optional #GCancellable
+ * @callback: Callback to invoke with the translation
+ * @user_data: User data for @callback
+ *
+ * Translates @input with as few requests as @backend's limits allow,
+ * a few of them at a time and no faster than its rate. Requests that are
+ * throttled or fail on the network are retried on their own with
+ * backoff; once one has failed for good, or answers with another HTTP
+ * error or an unreadable response, the translation fails with
+ * %G_IO_ERROR.
+ */
+void translate_http_translate_async (const TranslateHttpBackend *backend,
+                                     gpointer                    source_object,
+                                     const gchar                *input,
+                                     gboolean                    is_html,
+                                     const gchar                *source_lang_opt,
+                                     const gchar                *target_lang,
+                                     TranslateStreamFunc         stream_func,
+                                     gpointer                    stream_data,
+                                     GCancellable               *cancellable,
+                                     GAsyncReadyCallback         callback,
+                                     gpointer                    user_data);
+
+/* Returns (transfer full) the translation, or NULL with @error set */
+gchar *translate_http_translate_finish (GAsyncResult *res,
+                                        GError      **error);
+
+/* Like translate_http_translate_async() for plain-text @inputs, without
+ * partial output */
+void translate_http_translate_batch_async (const TranslateHttpBackend *backend,
+                                           gpointer                    source_object,
+                                           const gchar * const        *inputs,
+                                           guint                       n_inputs,
+                                           const gchar                *source_lang_opt,
+                                           const gchar                *target_lang,
+                                           GCancellable               *cancellable,
+                                           GAsyncReadyCallback         callback,
+                                           gpointer                    user_data);
+
+/* Returns (transfer full) one translation per input, %NULL-terminated */
+gchar **translate_http_translate_batch_finish (GAsyncResult *res,
+                                               GError      **error);
+
+/* Drops the shared session and its connections */
+void translate_http_shutdown (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_HTTP_H */
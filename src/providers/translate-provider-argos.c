@@ -6,16 +6,21 @@
 #include <config.h>
 #endif
 
+#include <string.h>
 #include <glib.h>
 #include <glib-object.h>
 #include <json-glib/json-glib.h>
 
 #include "translate-provider-argos.h"
 #include "translate-provider.h"
+#include "translate-worker.h"
+#include "../translate-models.h"
 #include "../translate-utils.h"
 
 struct _TranslateProviderArgos {
     GObject parent_instance;
+
+    TranslateWorker *worker;  /* Helper pool, resolved on first use */
 };
 
 static void translate_provider_iface_init (TranslateProviderInterface *iface);
@@ -42,208 +47,149 @@ tp_argos_get_name (gpointer self)
     return "Argos Translate (offline)";
 }
 
-typedef struct {
-    gchar *input;
-    gchar *target_lang;
-    gboolean is_html;
-} TranslateTaskData;
-
-/**
- * extract_translated_field:
- * @json: JSON string from Python helper
- *
- * Extracts the "translated" field from JSON response using json-glib.
- * Expected format: {"translated": "..."}
- *
- * Returns: (transfer full): The translated text, or NULL on error
- */
-static gchar *
-extract_translated_field (const gchar *json)
+/* Decoder settings, the same for every request: a helper creates a
+ * model's CTranslate2 translator once, with the threads of the first
+ * request that needs it, and again only if they change. 0 and "auto"
+ * leave the choice to the helper, which knows the device; it also
+ * needs the pool size to share the cores among the helpers, and the
+ * memory budget (MiB) past which it unloads least recently used models. */
+static void
+tp_argos_set_decoder_options (JsonObject *request)
 {
-    g_autoptr(GError) error = NULL;
-    g_autoptr(JsonParser) parser = NULL;
-    JsonNode *root = NULL;
-    JsonObject *obj = NULL;
-    const gchar *translated = NULL;
-
-    if (!json || !*json) {
-        g_warning ("[argos] Empty JSON response");
-        return NULL;
-    }
-
-    /* Parse JSON response */
-    parser = json_parser_new ();
-    if (!json_parser_load_from_data (parser, json, -1, &error)) {
-        g_warning ("[argos] Failed to parse JSON: %s", error ? error->message : "unknown error");
-        return NULL;
-    }
-
-    /* Get root object */
-    root = json_parser_get_root (parser);
-    if (!root || !JSON_NODE_HOLDS_OBJECT (root)) {
-        g_warning ("[argos] JSON root is not an object");
-        return NULL;
-    }
+    g_autofree gchar *compute_type = translate_utils_get_compute_type ();
+
+    json_object_set_int_member (request, "max_batch_tokens", translate_utils_get_max_batch_tokens ());
+    json_object_set_int_member (request, "inter_threads", translate_utils_get_inter_threads ());
+    json_object_set_int_member (request, "intra_threads", translate_utils_get_intra_threads ());
+    json_object_set_string_member (request, "compute_type", compute_type);
+    json_object_set_int_member (request, "beam_size", translate_utils_get_beam_size ());
+    json_object_set_int_member (request, "pool_size", translate_utils_get_max_workers ());
+    json_object_set_int_member (request, "memory_budget", translate_utils_get_model_memory_budget ());
+}
 
-    obj = json_node_get_object (root);
-    if (!json_object_has_member (obj, "translated")) {
-        g_warning ("[argos] JSON response missing 'translated' field");
-        return NULL;
-    }
+/* Looks the helper pool up once; the registry keeps this instance alive,
+ * so later requests skip the script and interpreter probing */
+static TranslateWorker *
+tp_argos_get_worker (TranslateProviderArgos *self,
+                     GError                **error)
+{
+    if (!self->worker)
+        self->worker = translate_worker_get_shared ("translate_runner.py", error);
+    return self->worker;
+}
 
-    /* Extract translated field */
-    translated = json_object_get_string_member (obj, "translated");
-    if (!translated) {
-        g_warning ("[argos] 'translated' field is not a string");
-        return NULL;
+/* The helper answers a request for a model that is not installed at
+ * once, with the untranslated input and "model_pending"; the download
+ * is left to translate-models. Returns TRUE if @response was such an
+ * answer and @task has failed with TRANSLATE_WORKER_ERROR_MODEL_PENDING. */
+static gboolean
+tp_argos_check_model_pending (GTask      *task,
+                              JsonObject *response)
+{
+    JsonObject *pending;
+    const gchar *source_lang = NULL;
+    const gchar *target_lang = NULL;
+
+    if (!json_object_has_member (response, "model_pending"))
+        return FALSE;
+
+    pending = json_object_get_object_member (response, "model_pending");
+    if (pending && json_object_has_member (pending, "source"))
+        source_lang = json_object_get_string_member (pending, "source");
+    if (pending && json_object_has_member (pending, "target"))
+        target_lang = json_object_get_string_member (pending, "target");
+
+    if (!source_lang || !target_lang) {
+        g_task_return_new_error (task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_PROTOCOL,
+                                 "Translate helper reported a pending model without its languages");
+        return TRUE;
     }
 
-    return g_strdup (translated);
+    translate_models_install (source_lang, target_lang);
+    g_task_return_new_error (task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_MODEL_PENDING,
+                             "The %s → %s translation model is being downloaded; "
+                             "translate again once it is installed",
+                             source_lang, target_lang);
+    return TRUE;
 }
 
 static void
-on_helper_done (GObject *source, GAsyncResult *res, gpointer user_data)
+on_worker_done (GObject *source, GAsyncResult *res, gpointer user_data)
 {
     (void)source;
     GTask *task = G_TASK (user_data);
-    g_autofree gchar *stdout_str = NULL;
-    g_autofree gchar *stderr_str = NULL;
     g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_task_get_task_data (task);
-    if (!g_subprocess_communicate_utf8_finish (proc, res, &stdout_str, &stderr_str, &error)) {
+    GBytes *payload = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, &payload, &error);
+    if (!response) {
         g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
-    if (!g_subprocess_get_successful (proc)) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Translate helper failed: %s", stderr_str ? stderr_str : "unknown");
+    if (tp_argos_check_model_pending (task, response)) {
+        g_bytes_unref (payload);
         g_object_unref (task);
         return;
     }
-    g_autofree gchar *translated = extract_translated_field (stdout_str);
-    if (!translated) {
-        /* Fallback: use whole stdout */
-        translated = g_strdup (stdout_str ? stdout_str : "");
-    }
-    g_task_return_pointer (task, g_steal_pointer (&translated), g_free);
+    /* The payload is the translated document, handed on without a copy */
+    g_task_return_pointer (task, translate_worker_payload_to_string (payload), g_free);
     g_object_unref (task);
 }
 
 static void
-tp_argos_translate_async (gpointer              self,
-                          const gchar          *input,
-                          gboolean              is_html,
-                          const gchar          *source_lang_opt,
-                          const gchar          *target_lang,
-                          GCancellable         *cancellable,
-                          GAsyncReadyCallback   callback,
-                          gpointer              user_data)
+tp_argos_translate_stream_async (gpointer              self,
+                                 const gchar          *input,
+                                 gboolean              is_html,
+                                 const gchar          *source_lang_opt,
+                                 const gchar          *target_lang,
+                                 TranslateStreamFunc   stream_func,
+                                 gpointer              stream_data,
+                                 GCancellable         *cancellable,
+                                 GAsyncReadyCallback   callback,
+                                 gpointer              user_data)
 {
-    (void)source_lang_opt;
     /* Basic parameter validation */
     g_return_if_fail (input != NULL);
     g_return_if_fail (target_lang != NULL);
     GTask *task = g_task_new (self, cancellable, callback, user_data);
 
-    /* Build helper command */
-    const gchar *helper_env = g_getenv ("TRANSLATE_HELPER_PATH");
-    const gchar *python_env = g_getenv ("TRANSLATE_PYTHON_BIN");
-
-    g_autofree gchar *helper_usr = NULL;
-    g_autofree gchar *helper_local = NULL;
-    g_autofree gchar *helper_choice = NULL;
-
-    g_autofree gchar *python_usr = NULL;
-    g_autofree gchar *python_usr3 = NULL;
-    g_autofree gchar *python_local = NULL;
-    const gchar *python = NULL;
-    const gchar *helper_path = NULL;
-
-    /* Preferred helper path order:
-     * 1) TRANSLATE_HELPER_PATH (if set)
-     * 2) /usr/share/evolution-translate/translate/translate_runner.py (installed)
-     * 3) ~/.local/lib/evolution-translate/translate/translate_runner.py (developer)
-     */
-    if (helper_env && *helper_env) {
-        helper_path = helper_env;
-    } else {
-        /* Prefer new data install location (architecture-independent) */
-        helper_usr = g_build_filename ("/usr", "share", "evolution-translate", "translate", "translate_runner.py", NULL);
-        if (g_file_test (helper_usr, G_FILE_TEST_EXISTS)) {
-            helper_choice = g_steal_pointer (&helper_usr);
-        } else {
-            /* Developer/user-local location */
-            const gchar *home = g_get_home_dir ();
-            helper_local = g_build_filename (home, ".local", "lib", "evolution-translate", "translate", "translate_runner.py", NULL);
-            if (g_file_test (helper_local, G_FILE_TEST_EXISTS)) {
-                helper_choice = g_steal_pointer (&helper_local);
-            }
-        }
-
-        if (helper_choice) {
-            helper_path = helper_choice;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Translate helper not found. Set TRANSLATE_HELPER_PATH or run 'evolution-translate-setup'.");
-            g_object_unref (task);
-            return;
-        }
-    }
-
-    /* Preferred python order:
-     * 1) TRANSLATE_PYTHON_BIN (if set)
-     * 2) ~/.local/lib/evolution-translate/venv/bin/python (user venv)
-     */
-    if (python_env && *python_env) {
-        python = python_env;
-    } else {
-        /* User-level venv location */
-        const gchar *home = g_get_home_dir ();
-        python_local = g_build_filename (home, ".local", "lib", "evolution-translate", "venv", "bin", "python", NULL);
-        if (g_file_test (python_local, G_FILE_TEST_IS_EXECUTABLE)) {
-            python = python_local;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Python environment not found. Set TRANSLATE_PYTHON_BIN or run 'evolution-translate-setup'.");
-            g_object_unref (task);
-            return;
-        }
-    }
-
-    g_debug ("[argos] Using helper: %s", helper_path);
-    g_debug ("[argos] Using python: %s", python);
-
-    /* Get install-on-demand setting */
-    gboolean install_on_demand = translate_utils_get_install_on_demand ();
-
-    /* Build command arguments: pass target language, HTML flag, and install-on-demand flag */
-    g_autofree gchar *target_copy = g_strdup (target_lang ? target_lang : "en");
-    const gchar *install_flag = install_on_demand ? "--install-on-demand" : "--no-install-on-demand";
-    const gchar *argvv[] = { python, helper_path, "--target", target_copy,
-                              is_html ? "--html" : "--text", install_flag, NULL };
-    g_debug ("[argos] Running: %s %s --target %s %s %s", python, helper_path, target_copy,
-             is_html ? "--html" : "--text", install_flag);
+    /* The Argos helper stays resident between requests */
     g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_subprocess_newv (argvv, G_SUBPROCESS_FLAGS_STDIN_PIPE | G_SUBPROCESS_FLAGS_STDOUT_PIPE, &error);
-    if (!proc) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Failed to spawn helper: %s", error ? error->message : "unknown error");
+    TranslateWorker *worker = tp_argos_get_worker (self, &error);
+    if (!worker) {
+        g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
 
-    /* For now, send plain input (no JSON) to the helper */
-    const gchar *payload = input ? input : "";
-
-    g_task_set_task_data (task, g_object_ref (proc), g_object_unref);
-    /* Release our local reference; task data holds its own reference */
-    g_object_unref (proc);
-    g_subprocess_communicate_utf8_async (proc,
-                                         payload,
-                                         cancellable,
-                                         on_helper_done,
-                                         task);
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_string_member (request, "text", input);
+    json_object_set_string_member (request, "target", target_lang);
+    json_object_set_boolean_member (request, "html", is_html);
+    if (source_lang_opt && *source_lang_opt)
+        json_object_set_string_member (request, "source", source_lang_opt);
+    json_object_set_boolean_member (request, "install_on_demand", translate_utils_get_install_on_demand ());
+    tp_argos_set_decoder_options (request);
+
+    g_debug ("[argos] Queued request: target=%s %s (%zu bytes)",
+             target_lang, is_html ? "html" : "text", strlen (input));
+
+    translate_worker_request_stream_async (worker, request, stream_func, stream_data,
+                                           cancellable, on_worker_done, task);
+}
+
+static void
+tp_argos_translate_async (gpointer              self,
+                          const gchar          *input,
+                          gboolean              is_html,
+                          const gchar          *source_lang_opt,
+                          const gchar          *target_lang,
+                          GCancellable         *cancellable,
+                          GAsyncReadyCallback   callback,
+                          gpointer              user_data)
+{
+    tp_argos_translate_stream_async (self, input, is_html, source_lang_opt, target_lang,
+                                     NULL, NULL, cancellable, callback, user_data);
 }
 
 static gboolean
@@ -260,11 +206,150 @@ tp_argos_translate_finish (gpointer       self,
     return ret != NULL;
 }
 
+static void
+on_batch_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    (void)source;
+    GTask *task = G_TASK (user_data);
+    g_autoptr(GError) error = NULL;
+    g_autoptr(GBytes) payload = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, &payload, &error);
+    guint count = GPOINTER_TO_UINT (g_task_get_task_data (task));
+    gchar **translations;
+    if (!response || tp_argos_check_model_pending (task, response)) {
+        if (error)
+            g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+        return;
+    }
+    translations = translate_worker_payload_to_strv (payload, count);
+    if (!translations)
+        g_task_return_new_error (task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_PROTOCOL,
+                                 "Translate helper returned a malformed batch");
+    else
+        g_task_return_pointer (task, translations, (GDestroyNotify) g_strfreev);
+    g_object_unref (task);
+}
+
+static void
+tp_argos_translate_batch_async (gpointer              self,
+                                const gchar * const  *inputs,
+                                guint                 n_inputs,
+                                const gchar          *source_lang_opt,
+                                const gchar          *target_lang,
+                                GCancellable         *cancellable,
+                                GAsyncReadyCallback   callback,
+                                gpointer              user_data)
+{
+    g_return_if_fail (inputs != NULL);
+    g_return_if_fail (target_lang != NULL);
+    GTask *task = g_task_new (self, cancellable, callback, user_data);
+    g_task_set_source_tag (task, tp_argos_translate_batch_async);
+    g_task_set_task_data (task, GUINT_TO_POINTER (n_inputs), NULL);
+
+    g_autoptr(GError) error = NULL;
+    TranslateWorker *worker = tp_argos_get_worker (self, &error);
+    if (!worker) {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+        return;
+    }
+
+    /* All inputs go out as one "segments" request */
+    JsonArray *segments = json_array_sized_new (n_inputs);
+    for (guint i = 0; i < n_inputs; i++)
+        json_array_add_string_element (segments, inputs[i] ? inputs[i] : "");
+
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_array_member (request, "segments", segments);
+    json_object_set_string_member (request, "target", target_lang);
+    if (source_lang_opt && *source_lang_opt)
+        json_object_set_string_member (request, "source", source_lang_opt);
+    json_object_set_boolean_member (request, "install_on_demand", translate_utils_get_install_on_demand ());
+    tp_argos_set_decoder_options (request);
+
+    g_debug ("[argos] Queued batch: target=%s, %u texts", target_lang, n_inputs);
+
+    translate_worker_request_async (worker, request, cancellable, on_batch_done, task);
+}
+
+static gboolean
+tp_argos_translate_batch_finish (gpointer       self,
+                                 GAsyncResult  *res,
+                                 gchar       ***out_translations,
+                                 GError       **error)
+{
+    g_return_val_if_fail (g_task_is_valid (res, self), FALSE);
+    gchar **ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_translations)
+        *out_translations = ret;
+    else
+        g_strfreev (ret);
+    return ret != NULL;
+}
+
+static void
+tp_argos_get_capabilities (gpointer                       self,
+                           TranslateProviderCapabilities *caps)
+{
+    (void)self;
+    /* One CTranslate2 batch; the helper bounds it by tokens, not chars */
+    caps->max_chars = 0;
+    caps->native_batch = TRUE;
+    caps->offline = TRUE;
+    caps->source_lang_hint = TRUE;
+}
+
+static void
+on_warm_up_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    (void)source;
+    (void)user_data;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, NULL, &error);
+    JsonArray *warmed;
+
+    if (!response) {
+        g_debug ("[argos] Warm start failed: %s", error->message);
+        return;
+    }
+    warmed = json_object_has_member (response, "warmed") ?
+        json_object_get_array_member (response, "warmed") : NULL;
+    g_message ("[argos] Warm start: %u models loaded", warmed ? json_array_get_length (warmed) : 0);
+}
+
+/* Starts a helper and has it load the models for the source languages
+ * it translated from most often, so the first click does not pay for
+ * interpreter start-up, imports, device probing and model loading */
+static void
+tp_argos_warm_up (gpointer     self,
+                  const gchar *target_lang)
+{
+    g_autoptr(GError) error = NULL;
+    TranslateWorker *worker = tp_argos_get_worker (self, &error);
+    if (!worker) {
+        g_debug ("[argos] No warm start: %s", error->message);
+        return;
+    }
+
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_boolean_member (request, "warm", TRUE);
+    json_object_set_string_member (request, "target", target_lang);
+    tp_argos_set_decoder_options (request);
+
+    translate_worker_request_async (worker, request, NULL, on_warm_up_done, NULL);
+}
+
 static void
 translate_provider_iface_init (TranslateProviderInterface *iface)
 {
     iface->translate_async = tp_argos_translate_async;
     iface->translate_finish = tp_argos_translate_finish;
+    iface->translate_stream_async = tp_argos_translate_stream_async;
+    iface->translate_batch_async = tp_argos_translate_batch_async;
+    iface->translate_batch_finish = tp_argos_translate_batch_finish;
+    iface->get_capabilities = tp_argos_get_capabilities;
+    iface->warm_up = tp_argos_warm_up;
     iface->get_id = tp_argos_get_id;
     iface->get_name = tp_argos_get_name;
 }
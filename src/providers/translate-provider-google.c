@@ -1,20 +1,29 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
-/* Google Translate Provider (online via deep-translator) */
+/* Google Translate Provider (online)
+ *
+ * Talks to Google's web endpoint directly over the shared libsoup session
+ * unless "native-http" is off; the deep-translator helper is used then,
+ * and whenever a direct request fails. */
 
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
 
+#include <string.h>
 #include <glib.h>
 #include <glib-object.h>
 #include <json-glib/json-glib.h>
 
 #include "translate-provider-google.h"
 #include "translate-provider.h"
+#include "translate-worker.h"
+#include "translate-http.h"
 #include "../translate-utils.h"
 
 struct _TranslateProviderGoogle {
     GObject parent_instance;
+
+    TranslateWorker *worker;  /* Helper pool, resolved on first use */
 };
 
 static void translate_provider_iface_init (TranslateProviderInterface *iface);
@@ -41,86 +50,191 @@ tp_google_get_name (gpointer self)
     return "Google Translate (online)";
 }
 
-/**
- * extract_translated_field:
- * @json: JSON string from Python helper
- *
- * Extracts the "translated" field from JSON response using json-glib.
- * Expected format: {"translated": "..."}
- *
- * Returns: (transfer full): The translated text, or NULL on error
- */
-static gchar *
-extract_translated_field (const gchar *json)
+/* Looks the helper pool up once; the registry keeps this instance alive,
+ * so later requests skip the script and interpreter probing */
+static TranslateWorker *
+tp_google_get_worker (TranslateProviderGoogle *self,
+                      GError                 **error)
 {
-    g_autoptr(GError) error = NULL;
-    g_autoptr(JsonParser) parser = NULL;
-    JsonNode *root = NULL;
-    JsonObject *obj = NULL;
-    const gchar *translated = NULL;
-
-    if (!json || !*json) {
-        g_warning ("[google] Empty JSON response");
-        return NULL;
-    }
+    if (!self->worker)
+        self->worker = translate_worker_get_shared ("translate_runner_online.py", error);
+    return self->worker;
+}
 
-    /* Parse JSON response */
-    parser = json_parser_new ();
-    if (!json_parser_load_from_data (parser, json, -1, &error)) {
-        g_warning ("[google] Failed to parse JSON: %s", error ? error->message : "unknown error");
-        return NULL;
-    }
+static SoupMessage *
+google_http_build (const gchar * const *texts,
+                   guint                n_texts,
+                   const gchar         *source_lang_opt,
+                   const gchar         *target_lang)
+{
+    g_autofree gchar *sl = g_uri_escape_string (source_lang_opt ? source_lang_opt : "auto", NULL, FALSE);
+    g_autofree gchar *tl = g_uri_escape_string (target_lang, NULL, FALSE);
+    g_autofree gchar *url = g_strdup_printf ("https://translate.googleapis.com/translate_a/single"
+                                             "?client=gtx&dt=t&sl=%s&tl=%s", sl, tl);
+    g_return_val_if_fail (n_texts == 1, NULL);
+    /* The text goes in the body, so its length is not bound by URL limits */
+    return soup_message_new_from_encoded_form ("POST", url, soup_form_encode ("q", texts[0], NULL));
+}
 
-    /* Get root object */
-    root = json_parser_get_root (parser);
-    if (!root || !JSON_NODE_HOLDS_OBJECT (root)) {
-        g_warning ("[google] JSON root is not an object");
-        return NULL;
+/* The answer is [[["sentence", "original", ...], ...], ...]; the
+ * translation is the first column of the first array, concatenated */
+static gboolean
+google_http_parse (JsonNode  *root,
+                   guint      n_texts,
+                   gchar    **out_translations,
+                   GError   **error)
+{
+    JsonArray *sentences = NULL;
+    GString *out;
+
+    (void)n_texts;
+    if (JSON_NODE_HOLDS_ARRAY (root) && json_array_get_length (json_node_get_array (root)) > 0) {
+        JsonNode *first = json_array_get_element (json_node_get_array (root), 0);
+        if (JSON_NODE_HOLDS_ARRAY (first))
+            sentences = json_node_get_array (first);
     }
-
-    obj = json_node_get_object (root);
-    if (!json_object_has_member (obj, "translated")) {
-        g_warning ("[google] JSON response missing 'translated' field");
-        return NULL;
+    if (!sentences) {
+        g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+                     "Unexpected response from Google Translate");
+        return FALSE;
     }
 
-    /* Extract translated field */
-    translated = json_object_get_string_member (obj, "translated");
-    if (!translated) {
-        g_warning ("[google] 'translated' field is not a string");
-        return NULL;
+    out = g_string_new (NULL);
+    for (guint i = 0; i < json_array_get_length (sentences); i++) {
+        JsonNode *node = json_array_get_element (sentences, i);
+        JsonArray *sentence;
+        JsonNode *text;
+        if (!JSON_NODE_HOLDS_ARRAY (node))
+            continue;
+        sentence = json_node_get_array (node);
+        if (json_array_get_length (sentence) == 0)
+            continue;
+        text = json_array_get_element (sentence, 0);
+        /* Transliteration rows carry null here */
+        if (JSON_NODE_HOLDS_VALUE (text) && json_node_get_value_type (text) == G_TYPE_STRING)
+            g_string_append (out, json_node_get_string (text));
     }
-
-    return g_strdup (translated);
+    out_translations[0] = g_string_free (out, FALSE);
+    return TRUE;
 }
 
+static const TranslateHttpBackend google_http = {
+    .name = "google",
+    .max_chars = 5000,
+    .max_texts = 1,
+    .join_lines = TRUE,
+    .rate = 5.0,
+    .burst = 5,
+    .build = google_http_build,
+    .parse = google_http_parse,
+};
+
 static void
-on_helper_done (GObject *source, GAsyncResult *res, gpointer user_data)
+on_worker_done (GObject *source, GAsyncResult *res, gpointer user_data)
 {
     (void)source;
     GTask *task = G_TASK (user_data);
-    g_autofree gchar *stdout_str = NULL;
-    g_autofree gchar *stderr_str = NULL;
     g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_task_get_task_data (task);
-    if (!g_subprocess_communicate_utf8_finish (proc, res, &stdout_str, &stderr_str, &error)) {
+    GBytes *payload = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, &payload, &error);
+    if (!response) {
         g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
-    if (!g_subprocess_get_successful (proc)) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Translate helper failed: %s", stderr_str ? stderr_str : "unknown");
+    translate_http_settle_budget (&google_http, response);
+    /* The payload is the translated document, handed on without a copy */
+    g_task_return_pointer (task, translate_worker_payload_to_string (payload), g_free);
+    g_object_unref (task);
+}
+
+/* Completes @task through the helper */
+static void
+tp_google_worker_translate (TranslateProviderGoogle *self,
+                            GTask                   *task,
+                            const gchar             *input,
+                            gboolean                 is_html,
+                            const gchar             *source_lang_opt,
+                            const gchar             *target_lang,
+                            TranslateStreamFunc      stream_func,
+                            gpointer                 stream_data)
+{
+    /* The online helper stays resident between requests */
+    g_autoptr(GError) error = NULL;
+    TranslateWorker *worker = tp_google_get_worker (self, &error);
+    if (!worker) {
+        g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
-    g_autofree gchar *translated = extract_translated_field (stdout_str);
-    if (!translated) {
-        /* Fallback: use whole stdout */
-        translated = g_strdup (stdout_str ? stdout_str : "");
+
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_string_member (request, "text", input);
+    json_object_set_string_member (request, "target", target_lang);
+    json_object_set_boolean_member (request, "html", is_html);
+    if (source_lang_opt && *source_lang_opt)
+        json_object_set_string_member (request, "source", source_lang_opt);
+    json_object_set_string_member (request, "provider", "google");
+    translate_http_lend_budget (&google_http, request);
+
+    g_debug ("[google] Queued request: target=%s %s (%zu bytes)",
+             target_lang, is_html ? "html" : "text", strlen (input));
+
+    translate_worker_request_stream_async (worker, request, stream_func, stream_data,
+                                           g_task_get_cancellable (task), on_worker_done, task);
+}
+
+static void
+on_http_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    GTask *task = G_TASK (user_data);
+    TranslateHttpFallback *fallback = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    gchar *translated = translate_http_translate_finish (res, &error);
+
+    if (translated) {
+        g_task_return_pointer (task, translated, g_free);
+        g_object_unref (task);
+    } else if (translate_http_should_fall_back (error)) {
+        g_message ("[google] Direct request failed (%s), retrying through the helper", error->message);
+        tp_google_worker_translate (TRANSLATE_PROVIDER_GOOGLE (source), task, fallback->input,
+                                    fallback->is_html, fallback->source_lang, fallback->target_lang,
+                                    fallback->stream_func, fallback->stream_data);
+    } else {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+    }
+}
+
+static void
+tp_google_translate_stream_async (gpointer              self,
+                                  const gchar          *input,
+                                  gboolean              is_html,
+                                  const gchar          *source_lang_opt,
+                                  const gchar          *target_lang,
+                                  TranslateStreamFunc   stream_func,
+                                  gpointer              stream_data,
+                                  GCancellable         *cancellable,
+                                  GAsyncReadyCallback   callback,
+                                  gpointer              user_data)
+{
+    /* Basic parameter validation */
+    g_return_if_fail (input != NULL);
+    g_return_if_fail (target_lang != NULL);
+    GTask *task = g_task_new (self, cancellable, callback, user_data);
+
+    if (!translate_utils_get_native_http ()) {
+        tp_google_worker_translate (self, task, input, is_html, source_lang_opt, target_lang,
+                                    stream_func, stream_data);
+        return;
     }
-    g_task_return_pointer (task, g_steal_pointer (&translated), g_free);
-    g_object_unref (task);
+
+    g_task_set_task_data (task,
+                          translate_http_fallback_new (input, is_html, source_lang_opt, target_lang,
+                                                       stream_func, stream_data),
+                          (GDestroyNotify) translate_http_fallback_free);
+    translate_http_translate_async (&google_http, self, input, is_html, source_lang_opt, target_lang,
+                                    stream_func, stream_data, cancellable, on_http_done, task);
 }
 
 static void
@@ -133,127 +247,163 @@ tp_google_translate_async (gpointer              self,
                            GAsyncReadyCallback   callback,
                            gpointer              user_data)
 {
-    (void)source_lang_opt;
-    /* Basic parameter validation */
-    g_return_if_fail (input != NULL);
-    g_return_if_fail (target_lang != NULL);
-    GTask *task = g_task_new (self, cancellable, callback, user_data);
+    tp_google_translate_stream_async (self, input, is_html, source_lang_opt, target_lang,
+                                      NULL, NULL, cancellable, callback, user_data);
+}
 
-    /* Build helper command - use online helper */
-    const gchar *helper_env = g_getenv ("TRANSLATE_HELPER_PATH");
-    const gchar *python_env = g_getenv ("TRANSLATE_PYTHON_BIN");
-
-    g_autofree gchar *helper_usr = NULL;
-    g_autofree gchar *helper_local = NULL;
-    g_autofree gchar *helper_choice = NULL;
-
-    g_autofree gchar *python_local = NULL;
-    const gchar *python = NULL;
-    const gchar *helper_path = NULL;
-
-    /* Preferred helper path order:
-     * 1) TRANSLATE_HELPER_PATH (if set)
-     * 2) /usr/share/evolution-translate/translate/translate_runner_online.py (installed)
-     * 3) ~/.local/lib/evolution-translate/translate/translate_runner_online.py (developer)
-     */
-    if (helper_env && *helper_env) {
-        helper_path = helper_env;
-    } else {
-        /* Prefer new data install location (architecture-independent) */
-        helper_usr = g_build_filename ("/usr", "share", "evolution-translate", "translate", "translate_runner_online.py", NULL);
-        if (g_file_test (helper_usr, G_FILE_TEST_EXISTS)) {
-            helper_choice = g_steal_pointer (&helper_usr);
-        } else {
-            /* Developer/user-local location */
-            const gchar *home = g_get_home_dir ();
-            helper_local = g_build_filename (home, ".local", "lib", "evolution-translate", "translate", "translate_runner_online.py", NULL);
-            if (g_file_test (helper_local, G_FILE_TEST_EXISTS)) {
-                helper_choice = g_steal_pointer (&helper_local);
-            }
-        }
-
-        if (helper_choice) {
-            helper_path = helper_choice;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Online translate helper not found.");
-            g_object_unref (task);
-            return;
-        }
+static gboolean
+tp_google_translate_finish (gpointer       self,
+                            GAsyncResult  *res,
+                            gchar        **out_translated_html,
+                            GError       **error)
+{
+    (void)self;
+    g_return_val_if_fail (G_IS_TASK (res), FALSE);
+    gchar *ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_translated_html)
+        *out_translated_html = ret;
+    return ret != NULL;
+}
+
+static void
+on_batch_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    (void)source;
+    GTask *task = G_TASK (user_data);
+    TranslateHttpFallback *fallback = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    g_autoptr(GBytes) payload = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, &payload, &error);
+    gchar **translations;
+    if (!response) {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+        return;
     }
+    translate_http_settle_budget (&google_http, response);
+    translations = translate_worker_payload_to_strv (payload, fallback->n_inputs);
+    if (!translations)
+        g_task_return_new_error (task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_PROTOCOL,
+                                 "Translate helper returned a malformed batch");
+    else
+        g_task_return_pointer (task, translations, (GDestroyNotify) g_strfreev);
+    g_object_unref (task);
+}
 
-    /* Preferred python order:
-     * 1) TRANSLATE_PYTHON_BIN (if set)
-     * 2) ~/.local/lib/evolution-translate/venv/bin/python (user venv)
-     */
-    if (python_env && *python_env) {
-        python = python_env;
-    } else {
-        /* User-level venv location */
-        const gchar *home = g_get_home_dir ();
-        python_local = g_build_filename (home, ".local", "lib", "evolution-translate", "venv", "bin", "python", NULL);
-        if (g_file_test (python_local, G_FILE_TEST_IS_EXECUTABLE)) {
-            python = python_local;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Python environment not found. Set TRANSLATE_PYTHON_BIN or run 'evolution-translate-setup'.");
-            g_object_unref (task);
-            return;
-        }
+/* Completes @task, whose data is its TranslateHttpFallback, through the helper */
+static void
+tp_google_worker_translate_batch (TranslateProviderGoogle *self,
+                                  GTask                   *task)
+{
+    TranslateHttpFallback *fallback = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    TranslateWorker *worker = tp_google_get_worker (self, &error);
+    if (!worker) {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+        return;
     }
 
-    g_debug ("[google] Using helper: %s", helper_path);
-    g_debug ("[google] Using python: %s", python);
+    /* All inputs go out as one "segments" request */
+    JsonArray *segments = json_array_sized_new (fallback->n_inputs);
+    for (guint i = 0; i < fallback->n_inputs; i++)
+        json_array_add_string_element (segments, fallback->inputs[i]);
 
-    /* Build command arguments: pass target language, provider, and HTML flag */
-    g_autofree gchar *target_copy = g_strdup (target_lang ? target_lang : "en");
-    const gchar *argvv[] = { python, helper_path, "--target", target_copy,
-                              "--provider", "google",
-                              is_html ? "--html" : "--text", NULL };
-    g_debug ("[google] Running: %s %s --target %s --provider google %s",
-             python, helper_path, target_copy, is_html ? "--html" : "--text");
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_array_member (request, "segments", segments);
+    json_object_set_string_member (request, "target", fallback->target_lang);
+    if (fallback->source_lang && *fallback->source_lang)
+        json_object_set_string_member (request, "source", fallback->source_lang);
+    json_object_set_string_member (request, "provider", "google");
+    translate_http_lend_budget (&google_http, request);
+
+    g_debug ("[google] Queued batch: target=%s, %u texts", fallback->target_lang, fallback->n_inputs);
+
+    translate_worker_request_async (worker, request, g_task_get_cancellable (task), on_batch_done, task);
+}
 
+static void
+on_http_batch_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    GTask *task = G_TASK (user_data);
     g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_subprocess_newv (argvv, G_SUBPROCESS_FLAGS_STDIN_PIPE | G_SUBPROCESS_FLAGS_STDOUT_PIPE, &error);
-    if (!proc) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Failed to spawn helper: %s", error ? error->message : "unknown error");
+    gchar **translations = translate_http_translate_batch_finish (res, &error);
+
+    if (translations) {
+        g_task_return_pointer (task, translations, (GDestroyNotify) g_strfreev);
         g_object_unref (task);
+    } else if (translate_http_should_fall_back (error)) {
+        g_message ("[google] Direct batch failed (%s), retrying through the helper", error->message);
+        tp_google_worker_translate_batch (TRANSLATE_PROVIDER_GOOGLE (source), task);
+    } else {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+    }
+}
+
+static void
+tp_google_translate_batch_async (gpointer              self,
+                                 const gchar * const  *inputs,
+                                 guint                 n_inputs,
+                                 const gchar          *source_lang_opt,
+                                 const gchar          *target_lang,
+                                 GCancellable         *cancellable,
+                                 GAsyncReadyCallback   callback,
+                                 gpointer              user_data)
+{
+    g_return_if_fail (inputs != NULL);
+    g_return_if_fail (target_lang != NULL);
+    GTask *task = g_task_new (self, cancellable, callback, user_data);
+    g_task_set_source_tag (task, tp_google_translate_batch_async);
+    g_task_set_task_data (task,
+                          translate_http_fallback_new_batch (inputs, n_inputs, source_lang_opt, target_lang),
+                          (GDestroyNotify) translate_http_fallback_free);
+
+    if (!translate_utils_get_native_http ()) {
+        tp_google_worker_translate_batch (self, task);
         return;
     }
 
-    /* Send input to the helper */
-    const gchar *payload = input ? input : "";
-
-    g_task_set_task_data (task, g_object_ref (proc), g_object_unref);
-    /* Release our local reference; task data holds its own reference */
-    g_object_unref (proc);
-    g_subprocess_communicate_utf8_async (proc,
-                                         payload,
-                                         cancellable,
-                                         on_helper_done,
-                                         task);
+    translate_http_translate_batch_async (&google_http, self, inputs, n_inputs, source_lang_opt,
+                                          target_lang, cancellable, on_http_batch_done, task);
 }
 
 static gboolean
-tp_google_translate_finish (gpointer       self,
-                            GAsyncResult  *res,
-                            gchar        **out_translated_html,
-                            GError       **error)
+tp_google_translate_batch_finish (gpointer       self,
+                                  GAsyncResult  *res,
+                                  gchar       ***out_translations,
+                                  GError       **error)
 {
-    (void)self;
-    g_return_val_if_fail (G_IS_TASK (res), FALSE);
-    gchar *ret = g_task_propagate_pointer (G_TASK (res), error);
-    if (out_translated_html)
-        *out_translated_html = ret;
+    g_return_val_if_fail (g_task_is_valid (res, self), FALSE);
+    gchar **ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_translations)
+        *out_translations = ret;
+    else
+        g_strfreev (ret);
     return ret != NULL;
 }
 
+static void
+tp_google_get_capabilities (gpointer                       self,
+                            TranslateProviderCapabilities *caps)
+{
+    (void)self;
+    /* Google's web endpoint rejects longer texts */
+    caps->max_chars = google_http.max_chars;
+    caps->native_batch = TRUE;
+    caps->offline = FALSE;
+    caps->source_lang_hint = TRUE;
+}
+
 static void
 translate_provider_iface_init (TranslateProviderInterface *iface)
 {
     iface->translate_async = tp_google_translate_async;
     iface->translate_finish = tp_google_translate_finish;
+    iface->translate_stream_async = tp_google_translate_stream_async;
+    iface->translate_batch_async = tp_google_translate_batch_async;
+    iface->translate_batch_finish = tp_google_translate_batch_finish;
+    iface->get_capabilities = tp_google_get_capabilities;
     iface->get_id = tp_google_get_id;
     iface->get_name = tp_google_get_name;
 }
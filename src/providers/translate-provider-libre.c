@@ -1,20 +1,30 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
-/* LibreTranslate Translate Provider (online via deep-translator) */
+/* LibreTranslate Translate Provider (online)
+ *
+ * Talks to the configured LibreTranslate server directly over the shared
+ * libsoup session unless "native-http" is off; the deep-translator helper
+ * is used then, and whenever a direct request fails. The API takes a list
+ * of texts, so HTML segments and batches go out in few requests. */
 
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
 
+#include <string.h>
 #include <glib.h>
 #include <glib-object.h>
 #include <json-glib/json-glib.h>
 
 #include "translate-provider-libre.h"
 #include "translate-provider.h"
+#include "translate-worker.h"
+#include "translate-http.h"
 #include "../translate-utils.h"
 
 struct _TranslateProviderLibreTranslate {
     GObject parent_instance;
+
+    TranslateWorker *worker;  /* Helper pool, resolved on first use */
 };
 
 static void translate_provider_iface_init (TranslateProviderInterface *iface);
@@ -41,198 +51,233 @@ tp_libre_get_name (gpointer self)
     return "LibreTranslate Translate (online)";
 }
 
-/**
- * extract_translated_field:
- * @json: JSON string from Python helper
- *
- * Extracts the "translated" field from JSON response using json-glib.
- * Expected format: {"translated": "..."}
- *
- * Returns: (transfer full): The translated text, or NULL on error
- */
-static gchar *
-extract_translated_field (const gchar *json)
+/* Looks the helper pool up once; the registry keeps this instance alive,
+ * so later requests skip the script and interpreter probing */
+static TranslateWorker *
+tp_libre_get_worker (TranslateProviderLibreTranslate *self,
+                     GError                         **error)
 {
-    g_autoptr(GError) error = NULL;
-    g_autoptr(JsonParser) parser = NULL;
-    JsonNode *root = NULL;
-    JsonObject *obj = NULL;
-    const gchar *translated = NULL;
+    if (!self->worker)
+        self->worker = translate_worker_get_shared ("translate_runner_online.py", error);
+    return self->worker;
+}
 
-    if (!json || !*json) {
-        g_warning ("[libre] Empty JSON response");
+static SoupMessage *
+libre_http_build (const gchar * const *texts,
+                  guint                n_texts,
+                  const gchar         *source_lang_opt,
+                  const gchar         *target_lang)
+{
+    g_autofree gchar *base = translate_utils_get_libre_url ();
+    g_autofree gchar *api_key = translate_utils_get_libre_api_key ();
+    g_autofree gchar *url = NULL;
+    g_autofree gchar *body = NULL;
+    g_autoptr(JsonNode) root = NULL;
+    g_autoptr(JsonGenerator) generator = NULL;
+    JsonObject *request = json_object_new ();
+    JsonArray *q = json_array_sized_new (n_texts);
+    SoupMessage *msg;
+    gsize body_len = 0;
+
+    for (guint i = 0; i < n_texts; i++)
+        json_array_add_string_element (q, texts[i]);
+    json_object_set_array_member (request, "q", q);
+    json_object_set_string_member (request, "source", source_lang_opt ? source_lang_opt : "auto");
+    json_object_set_string_member (request, "target", target_lang);
+    json_object_set_string_member (request, "format", "text");
+    if (api_key && *api_key)
+        json_object_set_string_member (request, "api_key", api_key);
+
+    root = json_node_new (JSON_NODE_OBJECT);
+    json_node_take_object (root, request);
+    generator = json_generator_new ();
+    json_generator_set_root (generator, root);
+    body = json_generator_to_data (generator, &body_len);
+
+    g_strchomp (base);
+    url = g_str_has_suffix (base, "/") ? g_strconcat (base, "translate", NULL)
+                                       : g_strconcat (base, "/translate", NULL);
+    msg = soup_message_new ("POST", url);
+    if (!msg)
         return NULL;
-    }
+    soup_message_set_request_body_from_bytes (msg, "application/json",
+                                              g_bytes_new_take (g_steal_pointer (&body), body_len));
+    return msg;
+}
 
-    /* Parse JSON response */
-    parser = json_parser_new ();
-    if (!json_parser_load_from_data (parser, json, -1, &error)) {
-        g_warning ("[libre] Failed to parse JSON: %s", error ? error->message : "unknown error");
-        return NULL;
+/* {"translatedText": [...]} for a list of texts; servers that only take
+ * one text answer with a plain string */
+static gboolean
+libre_http_parse (JsonNode  *root,
+                  guint      n_texts,
+                  gchar    **out_translations,
+                  GError   **error)
+{
+    JsonObject *response = JSON_NODE_HOLDS_OBJECT (root) ? json_node_get_object (root) : NULL;
+    JsonNode *translated = response && json_object_has_member (response, "translatedText") ?
+        json_object_get_member (response, "translatedText") : NULL;
+
+    if (translated && JSON_NODE_HOLDS_ARRAY (translated) &&
+        json_array_get_length (json_node_get_array (translated)) == n_texts) {
+        JsonArray *texts = json_node_get_array (translated);
+        for (guint i = 0; i < n_texts; i++)
+            out_translations[i] = g_strdup (json_array_get_string_element (texts, i));
+        return TRUE;
     }
-
-    /* Get root object */
-    root = json_parser_get_root (parser);
-    if (!root || !JSON_NODE_HOLDS_OBJECT (root)) {
-        g_warning ("[libre] JSON root is not an object");
-        return NULL;
+    if (translated && n_texts == 1 && JSON_NODE_HOLDS_VALUE (translated)) {
+        out_translations[0] = g_strdup (json_node_get_string (translated));
+        return TRUE;
     }
 
-    obj = json_node_get_object (root);
-    if (!json_object_has_member (obj, "translated")) {
-        g_warning ("[libre] JSON response missing 'translated' field");
-        return NULL;
-    }
+    g_set_error (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA, "Unexpected response from LibreTranslate%s%s",
+                 response && json_object_has_member (response, "error") ? ": " : "",
+                 response && json_object_has_member (response, "error") ?
+                     json_object_get_string_member (response, "error") : "");
+    return FALSE;
+}
 
-    /* Extract translated field */
-    translated = json_object_get_string_member (obj, "translated");
-    if (!translated) {
-        g_warning ("[libre] 'translated' field is not a string");
-        return NULL;
-    }
+static const TranslateHttpBackend libre_http = {
+    .name = "libre",
+    .max_chars = 5000,
+    .max_texts = 50,
+    .rate = 1.0,
+    .burst = 3,
+    .build = libre_http_build,
+    .parse = libre_http_parse,
+};
 
-    return g_strdup (translated);
+/* The server settings, for the helper to use the same instance */
+static void
+libre_set_server_members (JsonObject *request)
+{
+    g_autofree gchar *url = translate_utils_get_libre_url ();
+    g_autofree gchar *api_key = translate_utils_get_libre_api_key ();
+    json_object_set_string_member (request, "url", url);
+    if (api_key && *api_key)
+        json_object_set_string_member (request, "api_key", api_key);
 }
 
 static void
-on_helper_done (GObject *source, GAsyncResult *res, gpointer user_data)
+on_worker_done (GObject *source, GAsyncResult *res, gpointer user_data)
 {
     (void)source;
     GTask *task = G_TASK (user_data);
-    g_autofree gchar *stdout_str = NULL;
-    g_autofree gchar *stderr_str = NULL;
     g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_task_get_task_data (task);
-    if (!g_subprocess_communicate_utf8_finish (proc, res, &stdout_str, &stderr_str, &error)) {
+    GBytes *payload = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, &payload, &error);
+    if (!response) {
         g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
-    if (!g_subprocess_get_successful (proc)) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Translate helper failed: %s", stderr_str ? stderr_str : "unknown");
+    translate_http_settle_budget (&libre_http, response);
+    /* The payload is the translated document, handed on without a copy */
+    g_task_return_pointer (task, translate_worker_payload_to_string (payload), g_free);
+    g_object_unref (task);
+}
+
+/* Completes @task through the helper */
+static void
+tp_libre_worker_translate (TranslateProviderLibreTranslate *self,
+                           GTask                           *task,
+                           const gchar                     *input,
+                           gboolean                         is_html,
+                           const gchar                     *source_lang_opt,
+                           const gchar                     *target_lang,
+                           TranslateStreamFunc              stream_func,
+                           gpointer                         stream_data)
+{
+    /* The online helper stays resident between requests */
+    g_autoptr(GError) error = NULL;
+    TranslateWorker *worker = tp_libre_get_worker (self, &error);
+    if (!worker) {
+        g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
-    g_autofree gchar *translated = extract_translated_field (stdout_str);
-    if (!translated) {
-        /* Fallback: use whole stdout */
-        translated = g_strdup (stdout_str ? stdout_str : "");
+
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_string_member (request, "text", input);
+    json_object_set_string_member (request, "target", target_lang);
+    json_object_set_boolean_member (request, "html", is_html);
+    if (source_lang_opt && *source_lang_opt)
+        json_object_set_string_member (request, "source", source_lang_opt);
+    json_object_set_string_member (request, "provider", "libre");
+    translate_http_lend_budget (&libre_http, request);
+    libre_set_server_members (request);
+
+    g_debug ("[libre] Queued request: target=%s %s (%zu bytes)",
+             target_lang, is_html ? "html" : "text", strlen (input));
+
+    translate_worker_request_stream_async (worker, request, stream_func, stream_data,
+                                           g_task_get_cancellable (task), on_worker_done, task);
+}
+
+static void
+on_http_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    GTask *task = G_TASK (user_data);
+    TranslateHttpFallback *fallback = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    gchar *translated = translate_http_translate_finish (res, &error);
+
+    if (translated) {
+        g_task_return_pointer (task, translated, g_free);
+        g_object_unref (task);
+    } else if (translate_http_should_fall_back (error)) {
+        g_message ("[libre] Direct request failed (%s), retrying through the helper", error->message);
+        tp_libre_worker_translate (TRANSLATE_PROVIDER_LIBRE (source), task, fallback->input,
+                                   fallback->is_html, fallback->source_lang, fallback->target_lang,
+                                   fallback->stream_func, fallback->stream_data);
+    } else {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
     }
-    g_task_return_pointer (task, g_steal_pointer (&translated), g_free);
-    g_object_unref (task);
 }
 
 static void
-tp_libre_translate_async (gpointer              self,
-                           const gchar          *input,
-                           gboolean              is_html,
-                           const gchar          *source_lang_opt,
-                           const gchar          *target_lang,
-                           GCancellable         *cancellable,
-                           GAsyncReadyCallback   callback,
-                           gpointer              user_data)
+tp_libre_translate_stream_async (gpointer              self,
+                                 const gchar          *input,
+                                 gboolean              is_html,
+                                 const gchar          *source_lang_opt,
+                                 const gchar          *target_lang,
+                                 TranslateStreamFunc   stream_func,
+                                 gpointer              stream_data,
+                                 GCancellable         *cancellable,
+                                 GAsyncReadyCallback   callback,
+                                 gpointer              user_data)
 {
-    (void)source_lang_opt;
     /* Basic parameter validation */
     g_return_if_fail (input != NULL);
     g_return_if_fail (target_lang != NULL);
     GTask *task = g_task_new (self, cancellable, callback, user_data);
 
-    /* Build helper command - use online helper */
-    const gchar *helper_env = g_getenv ("TRANSLATE_HELPER_PATH");
-    const gchar *python_env = g_getenv ("TRANSLATE_PYTHON_BIN");
-
-    g_autofree gchar *helper_usr = NULL;
-    g_autofree gchar *helper_local = NULL;
-    g_autofree gchar *helper_choice = NULL;
-
-    g_autofree gchar *python_local = NULL;
-    const gchar *python = NULL;
-    const gchar *helper_path = NULL;
-
-    /* Preferred helper path order:
-     * 1) TRANSLATE_HELPER_PATH (if set)
-     * 2) /usr/share/evolution-translate/translate/translate_runner_online.py (installed)
-     * 3) ~/.local/lib/evolution-translate/translate/translate_runner_online.py (developer)
-     */
-    if (helper_env && *helper_env) {
-        helper_path = helper_env;
-    } else {
-        /* Prefer new data install location (architecture-independent) */
-        helper_usr = g_build_filename ("/usr", "share", "evolution-translate", "translate", "translate_runner_online.py", NULL);
-        if (g_file_test (helper_usr, G_FILE_TEST_EXISTS)) {
-            helper_choice = g_steal_pointer (&helper_usr);
-        } else {
-            /* Developer/user-local location */
-            const gchar *home = g_get_home_dir ();
-            helper_local = g_build_filename (home, ".local", "lib", "evolution-translate", "translate", "translate_runner_online.py", NULL);
-            if (g_file_test (helper_local, G_FILE_TEST_EXISTS)) {
-                helper_choice = g_steal_pointer (&helper_local);
-            }
-        }
-
-        if (helper_choice) {
-            helper_path = helper_choice;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Online translate helper not found.");
-            g_object_unref (task);
-            return;
-        }
-    }
-
-    /* Preferred python order:
-     * 1) TRANSLATE_PYTHON_BIN (if set)
-     * 2) ~/.local/lib/evolution-translate/venv/bin/python (user venv)
-     */
-    if (python_env && *python_env) {
-        python = python_env;
-    } else {
-        /* User-level venv location */
-        const gchar *home = g_get_home_dir ();
-        python_local = g_build_filename (home, ".local", "lib", "evolution-translate", "venv", "bin", "python", NULL);
-        if (g_file_test (python_local, G_FILE_TEST_IS_EXECUTABLE)) {
-            python = python_local;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Python environment not found. Set TRANSLATE_PYTHON_BIN or run 'evolution-translate-setup'.");
-            g_object_unref (task);
-            return;
-        }
-    }
-
-    g_debug ("[libre] Using helper: %s", helper_path);
-    g_debug ("[libre] Using python: %s", python);
-
-    /* Build command arguments: pass target language, provider, and HTML flag */
-    g_autofree gchar *target_copy = g_strdup (target_lang ? target_lang : "en");
-    const gchar *argvv[] = { python, helper_path, "--target", target_copy,
-                              "--provider", "libre",
-                              is_html ? "--html" : "--text", NULL };
-    g_debug ("[libre] Running: %s %s --target %s --provider libre %s",
-             python, helper_path, target_copy, is_html ? "--html" : "--text");
-
-    g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_subprocess_newv (argvv, G_SUBPROCESS_FLAGS_STDIN_PIPE | G_SUBPROCESS_FLAGS_STDOUT_PIPE, &error);
-    if (!proc) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Failed to spawn helper: %s", error ? error->message : "unknown error");
-        g_object_unref (task);
+    if (!translate_utils_get_native_http ()) {
+        tp_libre_worker_translate (self, task, input, is_html, source_lang_opt, target_lang,
+                                   stream_func, stream_data);
         return;
     }
 
-    /* Send input to the helper */
-    const gchar *payload = input ? input : "";
-
-    g_task_set_task_data (task, g_object_ref (proc), g_object_unref);
-    /* Release our local reference; task data holds its own reference */
-    g_object_unref (proc);
-    g_subprocess_communicate_utf8_async (proc,
-                                         payload,
-                                         cancellable,
-                                         on_helper_done,
-                                         task);
+    g_task_set_task_data (task,
+                          translate_http_fallback_new (input, is_html, source_lang_opt, target_lang,
+                                                       stream_func, stream_data),
+                          (GDestroyNotify) translate_http_fallback_free);
+    translate_http_translate_async (&libre_http, self, input, is_html, source_lang_opt, target_lang,
+                                    stream_func, stream_data, cancellable, on_http_done, task);
+}
+
+static void
+tp_libre_translate_async (gpointer              self,
+                          const gchar          *input,
+                          gboolean              is_html,
+                          const gchar          *source_lang_opt,
+                          const gchar          *target_lang,
+                          GCancellable         *cancellable,
+                          GAsyncReadyCallback   callback,
+                          gpointer              user_data)
+{
+    tp_libre_translate_stream_async (self, input, is_html, source_lang_opt, target_lang,
+                                     NULL, NULL, cancellable, callback, user_data);
 }
 
 static gboolean
@@ -249,11 +294,146 @@ tp_libre_translate_finish (gpointer       self,
     return ret != NULL;
 }
 
+static void
+on_batch_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    (void)source;
+    GTask *task = G_TASK (user_data);
+    TranslateHttpFallback *fallback = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    g_autoptr(GBytes) payload = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, &payload, &error);
+    gchar **translations;
+    if (!response) {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+        return;
+    }
+    translate_http_settle_budget (&libre_http, response);
+    translations = translate_worker_payload_to_strv (payload, fallback->n_inputs);
+    if (!translations)
+        g_task_return_new_error (task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_PROTOCOL,
+                                 "Translate helper returned a malformed batch");
+    else
+        g_task_return_pointer (task, translations, (GDestroyNotify) g_strfreev);
+    g_object_unref (task);
+}
+
+/* Completes @task, whose data is its TranslateHttpFallback, through the helper */
+static void
+tp_libre_worker_translate_batch (TranslateProviderLibreTranslate *self,
+                                 GTask                           *task)
+{
+    TranslateHttpFallback *fallback = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    TranslateWorker *worker = tp_libre_get_worker (self, &error);
+    if (!worker) {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+        return;
+    }
+
+    /* All inputs go out as one "segments" request */
+    JsonArray *segments = json_array_sized_new (fallback->n_inputs);
+    for (guint i = 0; i < fallback->n_inputs; i++)
+        json_array_add_string_element (segments, fallback->inputs[i]);
+
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_array_member (request, "segments", segments);
+    json_object_set_string_member (request, "target", fallback->target_lang);
+    if (fallback->source_lang && *fallback->source_lang)
+        json_object_set_string_member (request, "source", fallback->source_lang);
+    json_object_set_string_member (request, "provider", "libre");
+    translate_http_lend_budget (&libre_http, request);
+    libre_set_server_members (request);
+
+    g_debug ("[libre] Queued batch: target=%s, %u texts", fallback->target_lang, fallback->n_inputs);
+
+    translate_worker_request_async (worker, request, g_task_get_cancellable (task), on_batch_done, task);
+}
+
+static void
+on_http_batch_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    GTask *task = G_TASK (user_data);
+    g_autoptr(GError) error = NULL;
+    gchar **translations = translate_http_translate_batch_finish (res, &error);
+
+    if (translations) {
+        g_task_return_pointer (task, translations, (GDestroyNotify) g_strfreev);
+        g_object_unref (task);
+    } else if (translate_http_should_fall_back (error)) {
+        g_message ("[libre] Direct batch failed (%s), retrying through the helper", error->message);
+        tp_libre_worker_translate_batch (TRANSLATE_PROVIDER_LIBRE (source), task);
+    } else {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
+    }
+}
+
+static void
+tp_libre_translate_batch_async (gpointer              self,
+                                const gchar * const  *inputs,
+                                guint                 n_inputs,
+                                const gchar          *source_lang_opt,
+                                const gchar          *target_lang,
+                                GCancellable         *cancellable,
+                                GAsyncReadyCallback   callback,
+                                gpointer              user_data)
+{
+    g_return_if_fail (inputs != NULL);
+    g_return_if_fail (target_lang != NULL);
+    GTask *task = g_task_new (self, cancellable, callback, user_data);
+    g_task_set_source_tag (task, tp_libre_translate_batch_async);
+    g_task_set_task_data (task,
+                          translate_http_fallback_new_batch (inputs, n_inputs, source_lang_opt, target_lang),
+                          (GDestroyNotify) translate_http_fallback_free);
+
+    if (!translate_utils_get_native_http ()) {
+        tp_libre_worker_translate_batch (self, task);
+        return;
+    }
+
+    translate_http_translate_batch_async (&libre_http, self, inputs, n_inputs, source_lang_opt,
+                                          target_lang, cancellable, on_http_batch_done, task);
+}
+
+static gboolean
+tp_libre_translate_batch_finish (gpointer       self,
+                                 GAsyncResult  *res,
+                                 gchar       ***out_translations,
+                                 GError       **error)
+{
+    g_return_val_if_fail (g_task_is_valid (res, self), FALSE);
+    gchar **ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_translations)
+        *out_translations = ret;
+    else
+        g_strfreev (ret);
+    return ret != NULL;
+}
+
+static void
+tp_libre_get_capabilities (gpointer                       self,
+                           TranslateProviderCapabilities *caps)
+{
+    (void)self;
+    caps->max_chars = 0;
+    /* The API takes a list of texts; the helper loops over them */
+    caps->native_batch = TRUE;
+    caps->offline = FALSE;
+    caps->source_lang_hint = TRUE;
+}
+
 static void
 translate_provider_iface_init (TranslateProviderInterface *iface)
 {
     iface->translate_async = tp_libre_translate_async;
     iface->translate_finish = tp_libre_translate_finish;
+    iface->translate_stream_async = tp_libre_translate_stream_async;
+    iface->translate_batch_async = tp_libre_translate_batch_async;
+    iface->translate_batch_finish = tp_libre_translate_batch_finish;
+    iface->get_capabilities = tp_libre_get_capabilities;
     iface->get_id = tp_libre_get_id;
     iface->get_name = tp_libre_get_name;
 }
@@ -1,20 +1,29 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
-/* MyMemory Translate Provider (online via deep-translator) */
+/* MyMemory Translate Provider (online)
+ *
+ * Talks to the MyMemory API directly over the shared libsoup session
+ * unless "native-http" is off; the deep-translator helper is used then,
+ * and whenever a direct request fails. */
 
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
 
+#include <string.h>
 #include <glib.h>
 #include <glib-object.h>
 #include <json-glib/json-glib.h>
 
 #include "translate-provider-mymemory.h"
 #include "translate-provider.h"
+#include "translate-worker.h"
+#include "translate-http.h"
 #include "../translate-utils.h"
 
 struct _TranslateProviderMyMemory {
     GObject parent_instance;
+
+    TranslateWorker *worker;  /* Helper pool, resolved on first use */
 };
 
 static void translate_provider_iface_init (TranslateProviderInterface *iface);
@@ -41,198 +50,198 @@ tp_mymemory_get_name (gpointer self)
     return "MyMemory Translate (online)";
 }
 
-/**
- * extract_translated_field:
- * @json: JSON string from Python helper
- *
- * Extracts the "translated" field from JSON response using json-glib.
- * Expected format: {"translated": "..."}
- *
- * Returns: (transfer full): The translated text, or NULL on error
- */
-static gchar *
-extract_translated_field (const gchar *json)
+/* Looks the helper pool up once; the registry keeps this instance alive,
+ * so later requests skip the script and interpreter probing */
+static TranslateWorker *
+tp_mymemory_get_worker (TranslateProviderMyMemory *self,
+                        GError                   **error)
 {
-    g_autoptr(GError) error = NULL;
-    g_autoptr(JsonParser) parser = NULL;
-    JsonNode *root = NULL;
-    JsonObject *obj = NULL;
-    const gchar *translated = NULL;
-
-    if (!json || !*json) {
-        g_warning ("[mymemory] Empty JSON response");
-        return NULL;
-    }
-
-    /* Parse JSON response */
-    parser = json_parser_new ();
-    if (!json_parser_load_from_data (parser, json, -1, &error)) {
-        g_warning ("[mymemory] Failed to parse JSON: %s", error ? error->message : "unknown error");
-        return NULL;
-    }
+    if (!self->worker)
+        self->worker = translate_worker_get_shared ("translate_runner_online.py", error);
+    return self->worker;
+}
 
-    /* Get root object */
-    root = json_parser_get_root (parser);
-    if (!root || !JSON_NODE_HOLDS_OBJECT (root)) {
-        g_warning ("[mymemory] JSON root is not an object");
-        return NULL;
-    }
+static SoupMessage *
+mymemory_http_build (const gchar * const *texts,
+                     guint                n_texts,
+                     const gchar         *source_lang_opt,
+                     const gchar         *target_lang)
+{
+    g_autofree gchar *langpair = g_strdup_printf ("%s|%s", source_lang_opt ? source_lang_opt : "Autodetect",
+                                                  target_lang);
+    g_autofree gchar *query = NULL;
+    g_autofree gchar *url = NULL;
+    g_return_val_if_fail (n_texts == 1, NULL);
+
+    query = soup_form_encode ("q", texts[0], "langpair", langpair, NULL);
+    url = g_strconcat ("https://api.mymemory.translated.net/get?", query, NULL);
+    return soup_message_new ("GET", url);
+}
 
-    obj = json_node_get_object (root);
-    if (!json_object_has_member (obj, "translated")) {
-        g_warning ("[mymemory] JSON response missing 'translated' field");
-        return NULL;
+/* {"responseData": {"translatedText": ...}, "responseStatus": 200, ...};
+ * quota and input errors come with HTTP 200 and another responseStatus */
+static gboolean
+mymemory_http_parse (JsonNode  *root,
+                     guint      n_texts,
+                     gchar    **out_translations,
+                     GError   **error)
+{
+    JsonObject *response = JSON_NODE_HOLDS_OBJECT (root) ? json_node_get_object (root) : NULL;
+    JsonObject *data = response && json_object_has_member (response, "responseData") ?
+        json_object_get_object_member (response, "responseData") : NULL;
+    gint64 status = 200;
+
+    (void)n_texts;
+    if (response && json_object_has_member (response, "responseStatus")) {
+        JsonNode *node = json_object_get_member (response, "responseStatus");
+        /* Sent as a number or as a string, depending on the error */
+        status = json_node_get_value_type (node) == G_TYPE_STRING ?
+            g_ascii_strtoll (json_node_get_string (node), NULL, 10) : json_node_get_int (node);
     }
-
-    /* Extract translated field */
-    translated = json_object_get_string_member (obj, "translated");
-    if (!translated) {
-        g_warning ("[mymemory] 'translated' field is not a string");
-        return NULL;
+    if (status != 200 || !data || !json_object_has_member (data, "translatedText")) {
+        g_set_error (error, G_IO_ERROR, status == 429 ? G_IO_ERROR_BUSY : G_IO_ERROR_FAILED,
+                     "MyMemory answered %" G_GINT64_FORMAT "%s%s", status,
+                     response && json_object_has_member (response, "responseDetails") ? ": " : "",
+                     response && json_object_has_member (response, "responseDetails") ?
+                         json_object_get_string_member (response, "responseDetails") : "");
+        return FALSE;
     }
 
-    return g_strdup (translated);
+    out_translations[0] = g_strdup (json_object_get_string_member (data, "translatedText"));
+    return TRUE;
 }
 
+static const TranslateHttpBackend mymemory_http = {
+    .name = "mymemory",
+    .max_chars = 500,
+    .max_texts = 1,
+    .join_lines = TRUE,
+    .rate = 2.0,
+    .burst = 2,
+    .build = mymemory_http_build,
+    .parse = mymemory_http_parse,
+};
+
 static void
-on_helper_done (GObject *source, GAsyncResult *res, gpointer user_data)
+on_worker_done (GObject *source, GAsyncResult *res, gpointer user_data)
 {
     (void)source;
     GTask *task = G_TASK (user_data);
-    g_autofree gchar *stdout_str = NULL;
-    g_autofree gchar *stderr_str = NULL;
     g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_task_get_task_data (task);
-    if (!g_subprocess_communicate_utf8_finish (proc, res, &stdout_str, &stderr_str, &error)) {
+    GBytes *payload = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, &payload, &error);
+    if (!response) {
         g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
-    if (!g_subprocess_get_successful (proc)) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Translate helper failed: %s", stderr_str ? stderr_str : "unknown");
+    translate_http_settle_budget (&mymemory_http, response);
+    /* The payload is the translated document, handed on without a copy */
+    g_task_return_pointer (task, translate_worker_payload_to_string (payload), g_free);
+    g_object_unref (task);
+}
+
+/* Completes @task through the helper */
+static void
+tp_mymemory_worker_translate (TranslateProviderMyMemory *self,
+                              GTask                     *task,
+                              const gchar               *input,
+                              gboolean                   is_html,
+                              const gchar               *source_lang_opt,
+                              const gchar               *target_lang,
+                              TranslateStreamFunc        stream_func,
+                              gpointer                   stream_data)
+{
+    /* The online helper stays resident between requests */
+    g_autoptr(GError) error = NULL;
+    TranslateWorker *worker = tp_mymemory_get_worker (self, &error);
+    if (!worker) {
+        g_task_return_error (task, g_steal_pointer (&error));
         g_object_unref (task);
         return;
     }
-    g_autofree gchar *translated = extract_translated_field (stdout_str);
-    if (!translated) {
-        /* Fallback: use whole stdout */
-        translated = g_strdup (stdout_str ? stdout_str : "");
+
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_string_member (request, "text", input);
+    json_object_set_string_member (request, "target", target_lang);
+    json_object_set_boolean_member (request, "html", is_html);
+    if (source_lang_opt && *source_lang_opt)
+        json_object_set_string_member (request, "source", source_lang_opt);
+    json_object_set_string_member (request, "provider", "mymemory");
+    translate_http_lend_budget (&mymemory_http, request);
+
+    g_debug ("[mymemory] Queued request: target=%s %s (%zu bytes)",
+             target_lang, is_html ? "html" : "text", strlen (input));
+
+    translate_worker_request_stream_async (worker, request, stream_func, stream_data,
+                                           g_task_get_cancellable (task), on_worker_done, task);
+}
+
+static void
+on_http_done (GObject *source, GAsyncResult *res, gpointer user_data)
+{
+    GTask *task = G_TASK (user_data);
+    TranslateHttpFallback *fallback = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    gchar *translated = translate_http_translate_finish (res, &error);
+
+    if (translated) {
+        g_task_return_pointer (task, translated, g_free);
+        g_object_unref (task);
+    } else if (translate_http_should_fall_back (error)) {
+        g_message ("[mymemory] Direct request failed (%s), retrying through the helper", error->message);
+        tp_mymemory_worker_translate (TRANSLATE_PROVIDER_MYMEMORY (source), task, fallback->input,
+                                      fallback->is_html, fallback->source_lang, fallback->target_lang,
+                                      fallback->stream_func, fallback->stream_data);
+    } else {
+        g_task_return_error (task, g_steal_pointer (&error));
+        g_object_unref (task);
     }
-    g_task_return_pointer (task, g_steal_pointer (&translated), g_free);
-    g_object_unref (task);
 }
 
 static void
-tp_mymemory_translate_async (gpointer              self,
-                           const gchar          *input,
-                           gboolean              is_html,
-                           const gchar          *source_lang_opt,
-                           const gchar          *target_lang,
-                           GCancellable         *cancellable,
-                           GAsyncReadyCallback   callback,
-                           gpointer              user_data)
+tp_mymemory_translate_stream_async (gpointer              self,
+                                    const gchar          *input,
+                                    gboolean              is_html,
+                                    const gchar          *source_lang_opt,
+                                    const gchar          *target_lang,
+                                    TranslateStreamFunc   stream_func,
+                                    gpointer              stream_data,
+                                    GCancellable         *cancellable,
+                                    GAsyncReadyCallback   callback,
+                                    gpointer              user_data)
 {
-    (void)source_lang_opt;
     /* Basic parameter validation */
     g_return_if_fail (input != NULL);
     g_return_if_fail (target_lang != NULL);
     GTask *task = g_task_new (self, cancellable, callback, user_data);
 
-    /* Build helper command - use online helper */
-    const gchar *helper_env = g_getenv ("TRANSLATE_HELPER_PATH");
-    const gchar *python_env = g_getenv ("TRANSLATE_PYTHON_BIN");
-
-    g_autofree gchar *helper_usr = NULL;
-    g_autofree gchar *helper_local = NULL;
-    g_autofree gchar *helper_choice = NULL;
-
-    g_autofree gchar *python_local = NULL;
-    const gchar *python = NULL;
-    const gchar *helper_path = NULL;
-
-    /* Preferred helper path order:
-     * 1) TRANSLATE_HELPER_PATH (if set)
-     * 2) /usr/share/evolution-translate/translate/translate_runner_online.py (installed)
-     * 3) ~/.local/lib/evolution-translate/translate/translate_runner_online.py (developer)
-     */
-    if (helper_env && *helper_env) {
-        helper_path = helper_env;
-    } else {
-        /* Prefer new data install location (architecture-independent) */
-        helper_usr = g_build_filename ("/usr", "share", "evolution-translate", "translate", "translate_runner_online.py", NULL);
-        if (g_file_test (helper_usr, G_FILE_TEST_EXISTS)) {
-            helper_choice = g_steal_pointer (&helper_usr);
-        } else {
-            /* Developer/user-local location */
-            const gchar *home = g_get_home_dir ();
-            helper_local = g_build_filename (home, ".local", "lib", "evolution-translate", "translate", "translate_runner_online.py", NULL);
-            if (g_file_test (helper_local, G_FILE_TEST_EXISTS)) {
-                helper_choice = g_steal_pointer (&helper_local);
-            }
-        }
-
-        if (helper_choice) {
-            helper_path = helper_choice;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Online translate helper not found.");
-            g_object_unref (task);
-            return;
-        }
-    }
-
-    /* Preferred python order:
-     * 1) TRANSLATE_PYTHON_BIN (if set)
-     * 2) ~/.local/lib/evolution-translate/venv/bin/python (user venv)
-     */
-    if (python_env && *python_env) {
-        python = python_env;
-    } else {
-        /* User-level venv location */
-        const gchar *home = g_get_home_dir ();
-        python_local = g_build_filename (home, ".local", "lib", "evolution-translate", "venv", "bin", "python", NULL);
-        if (g_file_test (python_local, G_FILE_TEST_IS_EXECUTABLE)) {
-            python = python_local;
-        } else {
-            g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                     "Python environment not found. Set TRANSLATE_PYTHON_BIN or run 'evolution-translate-setup'.");
-            g_object_unref (task);
-            return;
-        }
-    }
-
-    g_debug ("[mymemory] Using helper: %s", helper_path);
-    g_debug ("[mymemory] Using python: %s", python);
-
-    /* Build command arguments: pass target language, provider, and HTML flag */
-    g_autofree gchar *target_copy = g_strdup (target_lang ? target_lang : "en");
-    const gchar *argvv[] = { python, helper_path, "--target", target_copy,
-                              "--provider", "mymemory",
-                              is_html ? "--html" : "--text", NULL };
-    g_debug ("[mymemory] Running: %s %s --target %s --provider mymemory %s",
-             python, helper_path, target_copy, is_html ? "--html" : "--text");
-
-    g_autoptr(GError) error = NULL;
-    GSubprocess *proc = g_subprocess_newv (argvv, G_SUBPROCESS_FLAGS_STDIN_PIPE | G_SUBPROCESS_FLAGS_STDOUT_PIPE, &error);
-    if (!proc) {
-        g_task_return_new_error (task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
-                                 "Failed to spawn helper: %s", error ? error->message : "unknown error");
-        g_object_unref (task);
+    if (!translate_utils_get_native_http ()) {
+        tp_mymemory_worker_translate (self, task, input, is_html, source_lang_opt, target_lang,
+                                      stream_func, stream_data);
         return;
     }
 
-    /* Send input to the helper */
-    const gchar *payload = input ? input : "";
-
-    g_task_set_task_data (task, g_object_ref (proc), g_object_unref);
-    /* Release our local reference; task data holds its own reference */
-    g_object_unref (proc);
-    g_subprocess_communicate_utf8_async (proc,
-                                         payload,
-                                         cancellable,
-                                         on_helper_done,
-                                         task);
+    g_task_set_task_data (task,
+                          translate_http_fallback_new (input, is_html, source_lang_opt, target_lang,
+                                                       stream_func, stream_data),
+                          (GDestroyNotify) translate_http_fallback_free);
+    translate_http_translate_async (&mymemory_http, self, input, is_html, source_lang_opt, target_lang,
+                                    stream_func, stream_data, cancellable, on_http_done, task);
+}
+
+static void
+tp_mymemory_translate_async (gpointer              self,
+                             const gchar          *input,
+                             gboolean              is_html,
+                             const gchar          *source_lang_opt,
+                             const gchar          *target_lang,
+                             GCancellable         *cancellable,
+                             GAsyncReadyCallback   callback,
+                             gpointer              user_data)
+{
+    tp_mymemory_translate_stream_async (self, input, is_html, source_lang_opt, target_lang,
+                                        NULL, NULL, cancellable, callback, user_data);
 }
 
 static gboolean
@@ -249,11 +258,25 @@ tp_mymemory_translate_finish (gpointer       self,
     return ret != NULL;
 }
 
+static void
+tp_mymemory_get_capabilities (gpointer                       self,
+                              TranslateProviderCapabilities *caps)
+{
+    (void)self;
+    /* MyMemory's free tier limit */
+    caps->max_chars = mymemory_http.max_chars;
+    caps->native_batch = FALSE;
+    caps->offline = FALSE;
+    caps->source_lang_hint = TRUE;
+}
+
 static void
 translate_provider_iface_init (TranslateProviderInterface *iface)
 {
     iface->translate_async = tp_mymemory_translate_async;
     iface->translate_finish = tp_mymemory_translate_finish;
+    iface->translate_stream_async = tp_mymemory_translate_stream_async;
+    iface->get_capabilities = tp_mymemory_get_capabilities;
     iface->get_id = tp_mymemory_get_id;
     iface->get_name = tp_mymemory_get_name;
 }
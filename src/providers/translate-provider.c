@@ -1,16 +1,23 @@
 /* SPDX-License-Identifier: LGPL-2.1-or-later */
-/* Translate Provider - Interface and Registry implementation (skeleton) */
+/* Translate Provider - Interface and Registry implementation */
 
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
 
+#include <string.h>
 #include <glib.h>
 #include <glib-object.h>
 
 #include "translate-provider.h"
+#include "../translate-utils.h"
 
-static GHashTable *provider_registry; /* id -> GType */
+/* id -> TranslateProvider*, the one long-lived instance of each type */
+static GHashTable *provider_registry;
+
+/* The instance named by "provider-id"; follows changes to the setting */
+static TranslateProvider *active_provider;
+static gulong provider_id_handler;
 
 G_DEFINE_INTERFACE(TranslateProvider, translate_provider, G_TYPE_OBJECT)
 
@@ -36,6 +43,28 @@ translate_provider_translate_async (TranslateProvider  *self,
     iface->translate_async (self, input, is_html, source_lang_opt, target_lang, cancellable, callback, user_data);
 }
 
+void
+translate_provider_translate_stream_async (TranslateProvider  *self,
+                                           const gchar        *input,
+                                           gboolean            is_html,
+                                           const gchar        *source_lang_opt,
+                                           const gchar        *target_lang,
+                                           TranslateStreamFunc stream_func,
+                                           gpointer            stream_data,
+                                           GCancellable       *cancellable,
+                                           GAsyncReadyCallback callback,
+                                           gpointer            user_data)
+{
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (self));
+    TranslateProviderInterface *iface = TRANSLATE_PROVIDER_GET_IFACE (self);
+    if (!stream_func || !iface->translate_stream_async) {
+        translate_provider_translate_async (self, input, is_html, source_lang_opt, target_lang, cancellable, callback, user_data);
+        return;
+    }
+    iface->translate_stream_async (self, input, is_html, source_lang_opt, target_lang,
+                                   stream_func, stream_data, cancellable, callback, user_data);
+}
+
 gboolean
 translate_provider_translate_finish (TranslateProvider *self,
                                      GAsyncResult      *res,
@@ -48,6 +77,187 @@ translate_provider_translate_finish (TranslateProvider *self,
     return iface->translate_finish (self, res, out_translated_html, error);
 }
 
+/* Batch emulation for providers without translate_batch_async: one
+ * translate_async per input, a few at a time */
+typedef struct {
+    gchar  **inputs;
+    gchar  **results;      /* NULL-terminated once complete */
+    guint    n_inputs;
+    guint    next;         /* Next input to start */
+    guint    running;
+    gchar   *source_lang;
+    gchar   *target_lang;
+    GError  *error;        /* First failure; stops starting new inputs */
+} BatchFallback;
+
+typedef struct {
+    GTask *task;
+    guint  index;
+} BatchFallbackItem;
+
+static void
+batch_fallback_free (BatchFallback *batch)
+{
+    g_strfreev (batch->inputs);
+    g_strfreev (batch->results);
+    g_free (batch->source_lang);
+    g_free (batch->target_lang);
+    g_clear_error (&batch->error);
+    g_free (batch);
+}
+
+static void batch_fallback_start (GTask *task);
+
+static void
+on_batch_item_done (GObject      *source,
+                    GAsyncResult *res,
+                    gpointer      user_data)
+{
+    BatchFallbackItem *item = user_data;
+    GTask *task = item->task;
+    BatchFallback *batch = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    gchar *translated = NULL;
+
+    batch->running--;
+    if (translate_provider_translate_finish (TRANSLATE_PROVIDER (source), res, &translated, &error)) {
+        g_free (batch->results[item->index]);
+        batch->results[item->index] = translated;
+    } else if (!batch->error) {
+        batch->error = g_steal_pointer (&error);
+    }
+    g_free (item);
+
+    batch_fallback_start (task);
+    g_object_unref (task);
+}
+
+/* Keeps up to "max-workers" inputs in flight; completes @task when the
+ * last one is back */
+static void
+batch_fallback_start (GTask *task)
+{
+    BatchFallback *batch = g_task_get_task_data (task);
+    TranslateProvider *self = g_task_get_source_object (task);
+    guint limit = (guint) MAX (1, translate_utils_get_max_workers ());
+
+    while (!batch->error && batch->next < batch->n_inputs && batch->running < limit) {
+        BatchFallbackItem *item;
+        guint index = batch->next++;
+
+        /* Nothing to translate; the result already holds the input */
+        if (!*batch->inputs[index])
+            continue;
+
+        item = g_new0 (BatchFallbackItem, 1);
+        item->task = g_object_ref (task);
+        item->index = index;
+        batch->running++;
+        translate_provider_translate_async (self, batch->inputs[index], FALSE,
+                                            batch->source_lang, batch->target_lang,
+                                            g_task_get_cancellable (task),
+                                            on_batch_item_done, item);
+    }
+
+    if (batch->running > 0 || (!batch->error && batch->next < batch->n_inputs))
+        return;
+
+    if (batch->error)
+        g_task_return_error (task, g_steal_pointer (&batch->error));
+    else
+        g_task_return_pointer (task, g_steal_pointer (&batch->results), (GDestroyNotify) g_strfreev);
+}
+
+void
+translate_provider_translate_batch_async (TranslateProvider  *self,
+                                          const gchar * const *inputs,
+                                          guint               n_inputs,
+                                          const gchar        *source_lang_opt,
+                                          const gchar        *target_lang,
+                                          GCancellable       *cancellable,
+                                          GAsyncReadyCallback callback,
+                                          gpointer            user_data)
+{
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (self));
+    g_return_if_fail (inputs != NULL || n_inputs == 0);
+    g_return_if_fail (target_lang != NULL);
+    TranslateProviderInterface *iface = TRANSLATE_PROVIDER_GET_IFACE (self);
+
+    if (iface->translate_batch_async && n_inputs > 0) {
+        iface->translate_batch_async (self, inputs, n_inputs, source_lang_opt, target_lang,
+                                      cancellable, callback, user_data);
+        return;
+    }
+
+    GTask *task = g_task_new (self, cancellable, callback, user_data);
+    g_task_set_source_tag (task, translate_provider_translate_batch_async);
+
+    BatchFallback *batch = g_new0 (BatchFallback, 1);
+    batch->n_inputs = n_inputs;
+    batch->inputs = g_new0 (gchar *, n_inputs + 1);
+    batch->results = g_new0 (gchar *, n_inputs + 1);
+    for (guint i = 0; i < n_inputs; i++) {
+        batch->inputs[i] = g_strdup (inputs[i] ? inputs[i] : "");
+        batch->results[i] = g_strdup (batch->inputs[i]);
+    }
+    batch->source_lang = g_strdup (source_lang_opt);
+    batch->target_lang = g_strdup (target_lang);
+    g_task_set_task_data (task, batch, (GDestroyNotify) batch_fallback_free);
+
+    batch_fallback_start (task);
+    g_object_unref (task);
+}
+
+gboolean
+translate_provider_translate_batch_finish (TranslateProvider *self,
+                                           GAsyncResult      *res,
+                                           gchar           ***out_translations,
+                                           GError           **error)
+{
+    g_return_val_if_fail (TRANSLATE_IS_PROVIDER (self), FALSE);
+    TranslateProviderInterface *iface = TRANSLATE_PROVIDER_GET_IFACE (self);
+
+    if (g_task_is_valid (res, self) &&
+        g_task_get_source_tag (G_TASK (res)) == translate_provider_translate_batch_async) {
+        gchar **ret = g_task_propagate_pointer (G_TASK (res), error);
+        if (out_translations)
+            *out_translations = ret;
+        else
+            g_strfreev (ret);
+        return ret != NULL;
+    }
+
+    g_return_val_if_fail (iface->translate_batch_finish != NULL, FALSE);
+    return iface->translate_batch_finish (self, res, out_translations, error);
+}
+
+void
+translate_provider_get_capabilities (TranslateProvider             *self,
+                                     TranslateProviderCapabilities *caps)
+{
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (self));
+    g_return_if_fail (caps != NULL);
+    TranslateProviderInterface *iface = TRANSLATE_PROVIDER_GET_IFACE (self);
+
+    memset (caps, 0, sizeof (*caps));
+    if (iface->get_capabilities)
+        iface->get_capabilities (self, caps);
+    /* Whatever the provider claims, only a real vfunc batches natively */
+    caps->native_batch = caps->native_batch && iface->translate_batch_async != NULL;
+}
+
+void
+translate_provider_warm_up (TranslateProvider *self,
+                            const gchar       *target_lang)
+{
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (self));
+    g_return_if_fail (target_lang != NULL);
+    TranslateProviderInterface *iface = TRANSLATE_PROVIDER_GET_IFACE (self);
+
+    if (iface->warm_up)
+        iface->warm_up (self, target_lang);
+}
+
 const gchar*
 translate_provider_get_id (TranslateProvider *self)
 {
@@ -68,29 +278,76 @@ void
 translate_provider_register (GType provider_type)
 {
     if (!provider_registry)
-        provider_registry = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+        provider_registry = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_object_unref);
 
-    /* Create a temporary instance to query ID */
+    /* The instance that answers the ID is the one that gets shared */
     GObject *obj = g_object_new (provider_type, NULL);
     const gchar *id = translate_provider_get_id ((TranslateProvider*)obj);
     if (id && *id) {
-        g_hash_table_replace (provider_registry, g_strdup (id), (gpointer)provider_type);
+        g_hash_table_replace (provider_registry, g_strdup (id), obj);
         g_debug ("Registered translate provider: %s", id);
     } else {
         g_warning ("Provider type has no valid ID; skipping registration");
+        g_object_unref (obj);
     }
-    g_object_unref (obj);
 }
 
-GObject*
-translate_provider_new_by_id (const gchar *id)
+TranslateProvider *
+translate_provider_get_shared (const gchar *id)
 {
     if (!provider_registry || !id)
         return NULL;
-    GType t = (GType)g_hash_table_lookup (provider_registry, id);
-    if (!t)
+    return g_hash_table_lookup (provider_registry, id);
+}
+
+static void
+update_active_provider (void)
+{
+    g_autofree gchar *id = translate_utils_get_provider_id ();
+
+    active_provider = translate_provider_get_shared (id);
+    if (active_provider)
+        g_debug ("[translate] Active provider: %s", id);
+    else
+        g_warning ("[translate] No provider found for '%s'", id);
+}
+
+static void
+on_provider_id_changed (GSettings   *settings,
+                        const gchar *key,
+                        gpointer     user_data)
+{
+    (void)settings;
+    (void)key;
+    (void)user_data;
+
+    /* Running requests keep their own reference to the old instance */
+    update_active_provider ();
+}
+
+TranslateProvider *
+translate_provider_get_active (void)
+{
+    GSettings *settings;
+
+    if (!provider_id_handler && (settings = translate_utils_get_settings ())) {
+        provider_id_handler = g_signal_connect (settings, "changed::provider-id",
+                                                G_CALLBACK (on_provider_id_changed), NULL);
+        update_active_provider ();
+    } else if (!active_provider) {
+        update_active_provider ();
+    }
+    return active_provider;
+}
+
+GObject*
+translate_provider_new_by_id (const gchar *id)
+{
+    TranslateProvider *shared = translate_provider_get_shared (id);
+
+    if (!shared)
         return NULL;
-    return g_object_new (t, NULL);
+    return g_object_new (G_OBJECT_TYPE (shared), NULL);
 }
 
 gchar**
@@ -108,3 +365,14 @@ translate_provider_list_ids (void)
     g_list_free (keys);
     return arr; /* NULL-terminated */
 }
+
+void
+translate_provider_registry_shutdown (void)
+{
+    if (provider_id_handler) {
+        g_signal_handler_disconnect (translate_utils_get_settings (), provider_id_handler);
+        provider_id_handler = 0;
+    }
+    active_provider = NULL;
+    g_clear_pointer (&provider_registry, g_hash_table_destroy);
+}
@@ -12,6 +12,34 @@ G_BEGIN_DECLS
 #define TRANSLATE_TYPE_PROVIDER (translate_provider_get_type())
 G_DECLARE_INTERFACE(TranslateProvider, translate_provider, TRANSLATE, PROVIDER, GObject)
 
+/* Partial output of a streaming translation */
+typedef enum {
+    TRANSLATE_STREAM_SKELETON,  /* text: the original HTML with segment markers */
+    TRANSLATE_STREAM_SEGMENT    /* text: translation of segment @index */
+} TranslateStreamEventType;
+
+typedef struct {
+    TranslateStreamEventType type;
+    const gchar *text;
+    guint        index;       /* SEGMENT only */
+    guint        n_segments;  /* SKELETON only */
+} TranslateStreamEvent;
+
+/* Attribute carrying the segment index on the skeleton's marker spans */
+#define TRANSLATE_STREAM_SEGMENT_ATTR "data-translate-seg"
+
+/* Called on the main thread; @event is only valid during the call */
+typedef void (*TranslateStreamFunc) (const TranslateStreamEvent *event,
+                                     gpointer                    user_data);
+
+/* What a provider's backend can do, for callers that pack requests */
+typedef struct {
+    gsize    max_chars;         /* Per request or batch entry; 0 = no limit */
+    gboolean native_batch;      /* translate_batch_async is one backend call */
+    gboolean offline;           /* Never sends text off the machine */
+    gboolean source_lang_hint;  /* Honours source_lang_opt instead of detecting */
+} TranslateProviderCapabilities;
+
 struct _TranslateProviderInterface {
     GTypeInterface parent_iface;
 
@@ -30,6 +58,44 @@ struct _TranslateProviderInterface {
                                   gchar       **out_translated_html,
                                   GError      **error);
 
+    /* Optional: like translate_async, but reports partial output through
+     * @stream_func until @callback runs. Finished with translate_finish. */
+    void (*translate_stream_async) (gpointer            self,
+                                    const gchar        *input,
+                                    gboolean            is_html,
+                                    const gchar        *source_lang_opt,
+                                    const gchar        *target_lang,
+                                    TranslateStreamFunc stream_func,
+                                    gpointer            stream_data,
+                                    GCancellable       *cancellable,
+                                    GAsyncReadyCallback callback,
+                                    gpointer            user_data);
+
+    /* Optional: translates @n_inputs plain-text segments in one go */
+    void (*translate_batch_async) (gpointer            self,
+                                   const gchar * const *inputs,
+                                   guint               n_inputs,
+                                   const gchar        *source_lang_opt,
+                                   const gchar        *target_lang,
+                                   GCancellable       *cancellable,
+                                   GAsyncReadyCallback callback,
+                                   gpointer            user_data);
+
+    gboolean (*translate_batch_finish) (gpointer      self,
+                                        GAsyncResult *res,
+                                        gchar      ***out_translations,
+                                        GError      **error);
+
+    /* Optional: fills @caps; left at the defaults (no limit, no native
+     * batch, online, no source hints) otherwise */
+    void (*get_capabilities) (gpointer                       self,
+                              TranslateProviderCapabilities *caps);
+
+    /* Optional: loads whatever the first translation into @target_lang
+     * would otherwise wait for. Fire and forget; must not block. */
+    void (*warm_up) (gpointer     self,
+                     const gchar *target_lang);
+
     const gchar* (*get_id)   (gpointer self);
     const gchar* (*get_name) (gpointer self);
 };
@@ -44,18 +110,66 @@ void translate_provider_translate_async (TranslateProvider  *self,
                                          GAsyncReadyCallback callback,
                                          gpointer           user_data);
 
+/* Falls back to translate_async (no partial output) if the provider
+ * cannot stream. @stream_data must stay valid until @callback runs. */
+void translate_provider_translate_stream_async (TranslateProvider  *self,
+                                                const gchar        *input,
+                                                gboolean            is_html,
+                                                const gchar        *source_lang_opt,
+                                                const gchar        *target_lang,
+                                                TranslateStreamFunc stream_func,
+                                                gpointer            stream_data,
+                                                GCancellable       *cancellable,
+                                                GAsyncReadyCallback callback,
+                                                gpointer            user_data);
+
 gboolean translate_provider_translate_finish (TranslateProvider *self,
                                               GAsyncResult      *res,
                                               gchar            **out_translated_html,
                                               GError           **error);
 
+/* Translates each of the plain-text @inputs into one result, in order.
+ * Providers without a native batch get one translate_async call per
+ * input (at most "max-workers" at a time). Empty inputs are passed
+ * through untranslated. */
+void translate_provider_translate_batch_async (TranslateProvider  *self,
+                                               const gchar * const *inputs,
+                                               guint               n_inputs,
+                                               const gchar        *source_lang_opt,
+                                               const gchar        *target_lang,
+                                               GCancellable       *cancellable,
+                                               GAsyncReadyCallback callback,
+                                               gpointer            user_data);
+
+/* @out_translations: (transfer full): NULL-terminated, one entry per input */
+gboolean translate_provider_translate_batch_finish (TranslateProvider *self,
+                                                    GAsyncResult      *res,
+                                                    gchar           ***out_translations,
+                                                    GError           **error);
+
+void translate_provider_get_capabilities (TranslateProvider             *self,
+                                          TranslateProviderCapabilities *caps);
+
+/* Does nothing for providers without warm_up */
+void translate_provider_warm_up (TranslateProvider *self,
+                                 const gchar       *target_lang);
+
 const gchar* translate_provider_get_id   (TranslateProvider *self);
 const gchar* translate_provider_get_name (TranslateProvider *self);
 
-/* Registry */
+/* Registry. Each registered type has one long-lived instance, so
+ * providers can keep warm state (helper handles, sessions) on it. */
 void      translate_provider_register      (GType provider_type);
+/* (transfer none): the shared instance, or NULL if @id is unknown */
+TranslateProvider *translate_provider_get_shared (const gchar *id);
+/* (transfer none): the shared instance named by the "provider-id"
+ * setting; switches over as soon as the setting changes */
+TranslateProvider *translate_provider_get_active (void);
+/* A fresh, unshared instance; most callers want get_shared() */
 GObject*  translate_provider_new_by_id     (const gchar *id);
 gchar**   translate_provider_list_ids      (void); /* NULL-terminated list, free with g_strfreev */
+/* Drops the shared instances; call before the module unloads */
+void      translate_provider_registry_shutdown (void);
 
 G_END_DECLS
 
@@ -0,0 +1,1295 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate Worker - resident Python helper process shared by providers
+ *
+ * Each helper script runs as a small pool of long-lived processes started
+ * with --worker. Requests and responses are frames on a helper's stdin and
+ * stdout, so only the first request per process pays for interpreter
+ * start-up, imports and model loading. Each process serves one
+ * request at a time; the pool grows on demand up to the "max-workers"
+ * setting. If a helper dies it is dropped from the pool and the interrupted
+ * request is retried once on another process. Cancelling a request that a
+ * helper is already working on kills that helper, so it does not keep
+ * translating a message nobody is looking at any more.
+ *
+ * Helpers hold their models for as long as they live, so they are not
+ * kept forever: one that has been idle for "worker-idle-timeout" seconds
+ * is stopped, and when the system reports low memory (GMemoryMonitor)
+ * every idle helper is stopped at once, and at the more severe levels busy
+ * ones too as soon as they answer. Exiting is the only reliable way to
+ * give a model's memory back. Within a helper, the least recently used
+ * models are unloaded to keep it under "model-memory-budget"; each
+ * response lists the language pairs still loaded ("models") and how many
+ * were just dropped ("unloaded"), which translate_worker_format_stats()
+ * reports next to each helper's resident size.
+ *
+ * A frame is a 12-byte header ("TRW1", then the big-endian 32-bit lengths
+ * of the two parts), a small JSON object with the request parameters or
+ * the response status, and a raw UTF-8 payload: the text to translate or
+ * the translation, never JSON-escaped. Lists of segments are separated by
+ * NUL bytes. Payloads are read straight into a NUL-terminated buffer that
+ * the caller takes over as a string without copying. A failed request is
+ * answered with "status": "error" and a "code" that maps onto
+ * TRANSLATE_WORKER_ERROR.
+ *
+ * HTML requests are segmented here (see translate-segment.c): the helper
+ * receives only the text runs as "segments" and answers with an equally
+ * long "translations" array, which is spliced back into the document
+ * before the response payload is handed to the provider. Batches of plain
+ * texts ("segments" in the request) skip the splicing; their response
+ * payload holds one translation per text.
+ *
+ * Streaming requests ("stream": true) are answered with "segments" event
+ * frames (and, for unsegmented input, a "skeleton") before the final
+ * response frame; these are turned into TranslateStreamEvents for the
+ * caller as they arrive.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <string.h>
+#include <glib.h>
+#include <glib/gi18n-lib.h>
+#include <gio/gio.h>
+#include <json-glib/json-glib.h>
+
+#include "translate-worker.h"
+#include "../translate-segment.h"
+#include "../translate-stats.h"
+#include "../translate-utils.h"
+
+/* A request is sent at most this many times (first try + one retry) */
+#define WORKER_MAX_ATTEMPTS 2
+
+#define WORKER_FRAME_MAGIC       "TRW1"
+#define WORKER_FRAME_HEADER_SIZE 12
+/* Anything larger means the stream is out of sync */
+#define WORKER_MAX_META_SIZE     (1024 * 1024)
+#define WORKER_MAX_PAYLOAD_SIZE  (256 * 1024 * 1024)
+
+G_DEFINE_QUARK (translate-worker-error-quark, translate_worker_error)
+
+typedef struct _TranslateWorkerProcess WorkerProcess;
+
+typedef struct {
+    GTask  *task;
+    GBytes *frame;     /* Serialized request */
+    gint64  id;
+    guint  attempts;
+
+    TranslateWorker *worker;
+    WorkerProcess   *wp;            /* Helper serving the call, NULL while queued */
+    GSource         *cancel_source; /* Watches the task's cancellable */
+
+    TranslateStreamFunc stream_func;  /* Streaming requests only */
+    gpointer            stream_data;
+    gboolean            skeleton_sent;
+
+    TranslateSegments  *segments;     /* HTML requests: the parsed document */
+    gint                n_texts;      /* "segments" requests: texts sent, else -1 */
+} WorkerCall;
+
+/* One running helper; reference counted because pending reads and writes
+ * keep it alive after it has been removed from the pool. */
+struct _TranslateWorkerProcess {
+    TranslateWorker  *owner;
+    GSubprocess      *proc;
+    GOutputStream    *stdin_pipe;
+    GInputStream     *stdout_pipe;  /* Buffered */
+    GCancellable     *io_cancellable;
+    WorkerCall       *in_flight;    /* Sent, waiting for the response frame */
+    GSource          *idle_source;  /* Stops the helper once idle too long */
+    gboolean          retire_when_idle; /* Low memory: exit after this response */
+    gchar           **models;       /* Loaded language pairs, as last reported */
+
+    /* Frame being read */
+    guint8            header[WORKER_FRAME_HEADER_SIZE];
+    gchar            *meta;
+    gsize             meta_len;
+    gchar            *payload;      /* payload_len bytes plus a NUL */
+    gsize             payload_len;
+};
+
+/* What a call completes with */
+typedef struct {
+    JsonObject *meta;
+    GBytes     *payload;
+} WorkerResult;
+
+struct _TranslateWorker {
+    gchar *script_name;
+    gchar *helper_path;
+    gchar *python;
+
+    GPtrArray *procs;       /* WorkerProcess*, live helpers */
+    GQueue     pending;     /* WorkerCall*, waiting for an idle helper */
+    gint64     next_id;
+    guint      restarts;
+
+    /* Translation memory counters reported by the helpers */
+    guint64    tm_hits;
+    guint64    tm_misses;
+};
+
+/* Global table: script name → TranslateWorker* (never freed) */
+static GHashTable *s_workers;
+static GMemoryMonitor *s_memory_monitor;
+
+static void worker_dispatch (TranslateWorker *worker);
+
+static void
+worker_call_free (WorkerCall *call)
+{
+    if (!call)
+        return;
+    if (call->cancel_source) {
+        g_source_destroy (call->cancel_source);
+        g_source_unref (call->cancel_source);
+    }
+    g_clear_object (&call->task);
+    g_clear_pointer (&call->segments, translate_segments_free);
+    g_clear_pointer (&call->frame, g_bytes_unref);
+    g_free (call);
+}
+
+static void
+worker_result_free (WorkerResult *result)
+{
+    json_object_unref (result->meta);
+    g_bytes_unref (result->payload);
+    g_free (result);
+}
+
+/* ============================================================================
+ * HELPER / INTERPRETER LOOKUP
+ * ============================================================================ */
+
+/**
+ * find_helper_script:
+ * @script_name: Helper script file name
+ * @error: Return location for a #GError
+ *
+ * Preferred helper path order:
+ * 1) TRANSLATE_HELPER_PATH (if set)
+ * 2) /usr/share/evolution-translate/translate/<script> (installed)
+ * 3) ~/.local/lib/evolution-translate/translate/<script> (developer)
+ *
+ * Returns: (transfer full) (nullable): Path to the helper script
+ */
+static gchar *
+find_helper_script (const gchar *script_name,
+                    GError     **error)
+{
+    const gchar *helper_env = g_getenv ("TRANSLATE_HELPER_PATH");
+    if (helper_env && *helper_env)
+        return g_strdup (helper_env);
+
+    /* Prefer data install location (architecture-independent) */
+    g_autofree gchar *helper_usr = g_build_filename ("/usr", "share", "evolution-translate", "translate", script_name, NULL);
+    if (g_file_test (helper_usr, G_FILE_TEST_EXISTS))
+        return g_steal_pointer (&helper_usr);
+
+    /* Developer/user-local location */
+    g_autofree gchar *helper_local = g_build_filename (g_get_home_dir (), ".local", "lib", "evolution-translate", "translate", script_name, NULL);
+    if (g_file_test (helper_local, G_FILE_TEST_EXISTS))
+        return g_steal_pointer (&helper_local);
+
+    g_set_error (error, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
+                 "Translate helper %s not found. Set TRANSLATE_HELPER_PATH or run 'evolution-translate-setup'.",
+                 script_name);
+    return NULL;
+}
+
+/**
+ * find_python:
+ * @error: Return location for a #GError
+ *
+ * Preferred python order:
+ * 1) TRANSLATE_PYTHON_BIN (if set)
+ * 2) ~/.local/lib/evolution-translate/venv/bin/python (user venv)
+ *
+ * Returns: (transfer full) (nullable): Path to the Python interpreter
+ */
+static gchar *
+find_python (GError **error)
+{
+    const gchar *python_env = g_getenv ("TRANSLATE_PYTHON_BIN");
+    if (python_env && *python_env)
+        return g_strdup (python_env);
+
+    /* User-level venv location */
+    g_autofree gchar *python_local = g_build_filename (g_get_home_dir (), ".local", "lib", "evolution-translate", "venv", "bin", "python", NULL);
+    if (g_file_test (python_local, G_FILE_TEST_IS_EXECUTABLE))
+        return g_steal_pointer (&python_local);
+
+    g_set_error (error, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
+                 "Python environment not found. Set TRANSLATE_PYTHON_BIN or run 'evolution-translate-setup'.");
+    return NULL;
+}
+
+/* ============================================================================
+ * PROCESS LIFECYCLE
+ * ============================================================================ */
+
+static void
+worker_process_clear (WorkerProcess *wp)
+{
+    /* No idle_source here: it holds a reference until it is destroyed */
+    g_strfreev (wp->models);
+    g_clear_object (&wp->io_cancellable);
+    g_clear_object (&wp->stdin_pipe);
+    g_clear_object (&wp->stdout_pipe);
+    g_clear_object (&wp->proc);
+    g_free (wp->meta);
+    g_free (wp->payload);
+    worker_call_free (wp->in_flight);
+}
+
+static WorkerProcess *
+worker_process_ref (WorkerProcess *wp)
+{
+    return g_rc_box_acquire (wp);
+}
+
+static void
+worker_process_unref (WorkerProcess *wp)
+{
+    g_rc_box_release_full (wp, (GDestroyNotify) worker_process_clear);
+}
+
+static void on_header_read (GObject *source, GAsyncResult *res, gpointer user_data);
+
+static void
+worker_read_next (WorkerProcess *wp)
+{
+    g_input_stream_read_all_async (wp->stdout_pipe,
+                                   wp->header,
+                                   WORKER_FRAME_HEADER_SIZE,
+                                   G_PRIORITY_DEFAULT,
+                                   wp->io_cancellable,
+                                   on_header_read,
+                                   worker_process_ref (wp));
+}
+
+static WorkerProcess *
+worker_spawn (TranslateWorker *worker,
+              GError         **error)
+{
+    const gchar *argvv[] = { worker->python, worker->helper_path, "--worker", NULL };
+    g_autoptr(GSubprocess) proc = NULL;
+    gint64 begin = g_get_monotonic_time ();
+    WorkerProcess *wp;
+
+    g_debug ("[worker] Starting %s #%u: %s %s --worker",
+             worker->script_name, worker->procs->len + 1, worker->python, worker->helper_path);
+    proc = g_subprocess_newv (argvv, G_SUBPROCESS_FLAGS_STDIN_PIPE | G_SUBPROCESS_FLAGS_STDOUT_PIPE, error);
+    if (!proc)
+        return NULL;
+    translate_stats_add_stage ("spawn", begin);
+
+    wp = g_rc_box_new0 (WorkerProcess);
+    wp->owner = worker;
+    wp->proc = g_steal_pointer (&proc);
+    wp->stdin_pipe = g_object_ref (g_subprocess_get_stdin_pipe (wp->proc));
+    wp->stdout_pipe = g_buffered_input_stream_new (g_subprocess_get_stdout_pipe (wp->proc));
+    wp->io_cancellable = g_cancellable_new ();
+
+    /* The pool holds the initial reference */
+    g_ptr_array_add (worker->procs, wp);
+    worker_read_next (wp);
+    return wp;
+}
+
+static void worker_process_retire (WorkerProcess *wp, gboolean graceful);
+
+static void
+worker_process_unwatch_idle (WorkerProcess *wp)
+{
+    if (wp->idle_source) {
+        g_source_destroy (wp->idle_source);
+        g_clear_pointer (&wp->idle_source, g_source_unref);
+    }
+}
+
+static gboolean
+on_process_idle_timeout (gpointer user_data)
+{
+    WorkerProcess *wp = user_data;
+
+    g_clear_pointer (&wp->idle_source, g_source_unref);
+    if (wp->owner && !wp->in_flight) {
+        g_debug ("[worker] Stopping idle %s helper %s",
+                 wp->owner->script_name, g_subprocess_get_identifier (wp->proc));
+        translate_stats_add_helper_stop (FALSE);
+        worker_process_retire (wp, TRUE);
+    }
+    return G_SOURCE_REMOVE;
+}
+
+/* Starts the idle countdown of a helper that has nothing to do */
+static void
+worker_process_watch_idle (WorkerProcess *wp)
+{
+    gint timeout = translate_utils_get_worker_idle_timeout ();
+
+    if (wp->idle_source || timeout <= 0)
+        return;
+
+    wp->idle_source = g_timeout_source_new_seconds ((guint) timeout);
+    g_source_set_callback (wp->idle_source, on_process_idle_timeout,
+                           worker_process_ref (wp), (GDestroyNotify) worker_process_unref);
+    g_source_attach (wp->idle_source, NULL);
+}
+
+/**
+ * worker_process_retire:
+ * @wp: A process in its owner's pool
+ * @graceful: Close stdin and let the helper exit on its own instead of killing it
+ *
+ * Stops the helper process and removes it from the pool. Outstanding reads
+ * and writes complete with %G_IO_ERROR_CANCELLED and are ignored. Any
+ * in-flight call must have been taken off @wp beforehand.
+ */
+static void
+worker_process_retire (WorkerProcess *wp,
+                       gboolean       graceful)
+{
+    TranslateWorker *worker = wp->owner;
+
+    worker_process_unwatch_idle (wp);
+    g_cancellable_cancel (wp->io_cancellable);
+
+    if (graceful)
+        g_output_stream_close (wp->stdin_pipe, NULL, NULL);
+    else
+        g_subprocess_force_exit (wp->proc);
+
+    wp->owner = NULL;
+    /* Drops the pool's reference */
+    g_ptr_array_remove_fast (worker->procs, wp);
+}
+
+/* Called when a helper stopped answering: EOF, read error or write error */
+static void
+worker_handle_crash (WorkerProcess *wp,
+                     const gchar   *reason)
+{
+    TranslateWorker *worker = wp->owner;
+    WorkerCall *call = g_steal_pointer (&wp->in_flight);
+
+    g_warning ("[worker] %s stopped unexpectedly: %s", worker->script_name, reason);
+    worker_process_retire (wp, FALSE);
+    worker->restarts++;
+    translate_stats_add_worker_restart ();
+
+    if (call) {
+        call->wp = NULL;
+        if (call->attempts < WORKER_MAX_ATTEMPTS &&
+            !g_cancellable_is_cancelled (g_task_get_cancellable (call->task))) {
+            /* Retry on a fresh process before anything else */
+            g_queue_push_head (&worker->pending, call);
+        } else {
+            g_task_return_new_error (call->task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_CRASHED,
+                                     "Translate helper exited unexpectedly: %s", reason);
+            worker_call_free (call);
+        }
+    }
+
+    worker_dispatch (worker);
+}
+
+/* ============================================================================
+ * REQUEST / RESPONSE HANDLING
+ * ============================================================================ */
+
+/* Accumulates and logs the helper's segment translation memory hit ratio */
+static void
+worker_note_memory_stats (TranslateWorker *worker,
+                          JsonObject      *obj)
+{
+    gint64 hits, misses;
+
+    if (!json_object_has_member (obj, "tm_hits") || !json_object_has_member (obj, "tm_misses"))
+        return;
+
+    hits = json_object_get_int_member (obj, "tm_hits");
+    misses = json_object_get_int_member (obj, "tm_misses");
+    worker->tm_hits += (guint64) MAX (hits, 0);
+    worker->tm_misses += (guint64) MAX (misses, 0);
+    translate_stats_add_memory_lookups ((guint64) MAX (hits, 0), (guint64) MAX (misses, 0));
+
+    if (worker->tm_hits + worker->tm_misses > 0) {
+        g_debug ("[worker] %s translation memory: %" G_GINT64_FORMAT "/%" G_GINT64_FORMAT
+                 " segments reused, %.1f%% overall",
+                 worker->script_name, hits, hits + misses,
+                 100.0 * (gdouble) worker->tm_hits / (gdouble) (worker->tm_hits + worker->tm_misses));
+    }
+}
+
+/* Remembers which models the helper has loaded, for the statistics */
+static void
+worker_note_models (WorkerProcess *wp,
+                    JsonObject    *obj)
+{
+    if (json_object_has_member (obj, "models") &&
+        JSON_NODE_HOLDS_ARRAY (json_object_get_member (obj, "models"))) {
+        JsonArray *models = json_object_get_array_member (obj, "models");
+        guint n = json_array_get_length (models);
+
+        g_strfreev (wp->models);
+        wp->models = g_new0 (gchar *, n + 1);
+        for (guint i = 0; i < n; i++)
+            wp->models[i] = g_strdup (json_array_get_string_element (models, i));
+    }
+
+    if (json_object_has_member (obj, "unloaded")) {
+        gint64 unloaded = json_object_get_int_member (obj, "unloaded");
+
+        if (unloaded > 0) {
+            g_debug ("[worker] %s unloaded %" G_GINT64_FORMAT " models to stay within its memory budget",
+                     wp->owner->script_name, unloaded);
+            translate_stats_add_models_unloaded ((guint) unloaded);
+        }
+    }
+}
+
+/* For segmented requests the skeleton is ours to build; it goes out with
+ * the first translated segments so the original stays up until then */
+static void
+worker_emit_skeleton (WorkerCall *call)
+{
+    TranslateStreamEvent ev = { 0 };
+    g_autofree gchar *skeleton = NULL;
+
+    if (!call->segments || call->skeleton_sent)
+        return;
+
+    skeleton = translate_segments_build_skeleton (call->segments);
+    ev.type = TRANSLATE_STREAM_SKELETON;
+    ev.text = skeleton;
+    ev.n_segments = translate_segments_get_count (call->segments);
+    call->skeleton_sent = TRUE;
+    call->stream_func (&ev, call->stream_data);
+}
+
+/* Splits a payload of @count NUL-separated texts in place; the pointers
+ * stay valid as long as @payload does. Returns NULL if the count is off. */
+static GPtrArray *
+worker_split_payload (GBytes *payload,
+                      guint   count)
+{
+    gsize size = 0;
+    const gchar *data = g_bytes_get_data (payload, &size);
+    const gchar *end = data + size;
+    const gchar *p = data;
+    GPtrArray *texts = g_ptr_array_sized_new (count);
+
+    /* Every payload is NUL-terminated right after its last byte */
+    for (; texts->len < count && p <= end; p += strlen (p) + 1)
+        g_ptr_array_add (texts, (gpointer) p);
+
+    if (texts->len != count || (count > 0 && p != end + 1)) {
+        g_ptr_array_unref (texts);
+        return NULL;
+    }
+    return texts;
+}
+
+static guint
+meta_get_count (JsonObject *meta)
+{
+    return json_object_has_member (meta, "count") ?
+        (guint) MAX (0, json_object_get_int_member (meta, "count")) : 0;
+}
+
+/* Forwards a helper's streaming event frame to the caller */
+static void
+worker_handle_event (WorkerCall *call,
+                     JsonObject *meta,
+                     GBytes     *payload)
+{
+    const gchar *event = json_object_get_string_member (meta, "event");
+    TranslateStreamEvent ev = { 0 };
+
+    if (!call->stream_func || !event)
+        return;
+
+    if (g_strcmp0 (event, "skeleton") == 0) {
+        ev.type = TRANSLATE_STREAM_SKELETON;
+        ev.text = g_bytes_get_data (payload, NULL);
+        ev.n_segments = json_object_has_member (meta, "segments") ?
+            (guint) MAX (0, json_object_get_int_member (meta, "segments")) : 0;
+        call->stream_func (&ev, call->stream_data);
+    } else if (g_strcmp0 (event, "segments") == 0) {
+        gint64 first = json_object_has_member (meta, "first") ?
+            json_object_get_int_member (meta, "first") : 0;
+        g_autoptr(GPtrArray) texts = worker_split_payload (payload, meta_get_count (meta));
+
+        if (!texts || first < 0) {
+            g_debug ("[worker] Ignoring malformed segments event from %s", call->worker->script_name);
+            return;
+        }
+
+        worker_emit_skeleton (call);
+        ev.type = TRANSLATE_STREAM_SEGMENT;
+        for (guint i = 0; i < texts->len; i++) {
+            ev.index = (guint) first + i;
+            ev.text = g_ptr_array_index (texts, i);
+            call->stream_func (&ev, call->stream_data);
+        }
+    } else {
+        g_debug ("[worker] Ignoring unknown event '%s' from %s", event, call->worker->script_name);
+    }
+}
+
+/* Splices the translations of a segmented request back into its document,
+ * which replaces the payload */
+static GBytes *
+worker_rebuild_document (WorkerCall *call,
+                         JsonObject *meta,
+                         GBytes     *payload,
+                         GError    **error)
+{
+    guint count = translate_segments_get_count (call->segments);
+    g_autoptr(GPtrArray) texts = NULL;
+    gchar *html;
+
+    if (meta_get_count (meta) != count ||
+        !(texts = worker_split_payload (payload, count))) {
+        g_set_error (error, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_PROTOCOL,
+                     "Translate helper returned %u translations for %u segments",
+                     texts ? texts->len : meta_get_count (meta), count);
+        return NULL;
+    }
+
+    html = translate_segments_rebuild (call->segments, (const gchar * const *) texts->pdata, count);
+    return g_bytes_new_take (html, strlen (html));
+}
+
+/* Maps the "code" of an error response onto TRANSLATE_WORKER_ERROR */
+static TranslateWorkerError
+worker_error_from_code (const gchar *code)
+{
+    if (g_strcmp0 (code, "invalid-request") == 0)
+        return TRANSLATE_WORKER_ERROR_INVALID_REQUEST;
+    if (g_strcmp0 (code, "unavailable") == 0)
+        return TRANSLATE_WORKER_ERROR_UNAVAILABLE;
+    return TRANSLATE_WORKER_ERROR_FAILED;
+}
+
+/* Takes over @payload, so the caller can steal the buffer without a copy */
+static void
+worker_handle_frame (WorkerProcess *wp,
+                     const gchar   *meta_data,
+                     gsize          meta_len,
+                     GBytes        *payload)
+{
+    g_autoptr(JsonParser) parser = json_parser_new ();
+    g_autoptr(GError) error = NULL;
+    g_autoptr(GBytes) owned = payload;
+    g_autoptr(GBytes) document = NULL;
+    WorkerCall *call = wp->in_flight;
+    WorkerResult *result;
+    JsonNode *root;
+    JsonObject *meta;
+    gsize size = 0;
+    const gchar *data = g_bytes_get_data (payload, &size);
+    gint64 begin = g_get_monotonic_time ();
+
+    if (!call) {
+        g_debug ("[worker] Discarding unsolicited frame from %s", wp->owner->script_name);
+        return;
+    }
+
+    if (!json_parser_load_from_data (parser, meta_data, (gssize) meta_len, &error) ||
+        !(root = json_parser_get_root (parser)) ||
+        !JSON_NODE_HOLDS_OBJECT (root) ||
+        !g_utf8_validate_len (data, size, NULL)) {
+        wp->in_flight = NULL;
+        g_task_return_new_error (call->task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_PROTOCOL,
+                                 "Malformed frame from translate helper: %s",
+                                 error ? error->message : "payload is not UTF-8 or header is not an object");
+        worker_call_free (call);
+        return;
+    }
+    translate_stats_add_stage ("parse", begin);
+
+    meta = json_node_get_object (root);
+    if (json_object_has_member (meta, "id") &&
+        JSON_NODE_HOLDS_VALUE (json_object_get_member (meta, "id")) &&
+        json_object_get_int_member (meta, "id") != call->id) {
+        g_debug ("[worker] Discarding stale frame from %s", wp->owner->script_name);
+        return;
+    }
+
+    /* Progress of a streaming request; the final response follows */
+    if (json_object_has_member (meta, "event")) {
+        worker_handle_event (call, meta, payload);
+        return;
+    }
+
+    worker_note_memory_stats (wp->owner, meta);
+    worker_note_models (wp, meta);
+    if (json_object_has_member (meta, "timings") &&
+        JSON_NODE_HOLDS_OBJECT (json_object_get_member (meta, "timings")))
+        translate_stats_add_helper_timings (json_object_get_object_member (meta, "timings"));
+    wp->in_flight = NULL;
+
+    if (json_object_has_member (meta, "status") &&
+        g_strcmp0 (json_object_get_string_member (meta, "status"), "ok") != 0) {
+        const gchar *code = json_object_has_member (meta, "code") ?
+            json_object_get_string_member (meta, "code") : NULL;
+        const gchar *message = json_object_has_member (meta, "message") ?
+            json_object_get_string_member (meta, "message") : NULL;
+
+        g_task_return_new_error (call->task, TRANSLATE_WORKER_ERROR, worker_error_from_code (code),
+                                 "%s", message ? message : "Translate helper failed");
+        worker_call_free (call);
+        return;
+    }
+
+    if (call->n_texts >= 0 && meta_get_count (meta) != (guint) call->n_texts) {
+        g_task_return_new_error (call->task, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_PROTOCOL,
+                                 "Translate helper returned %u translations for %d texts",
+                                 meta_get_count (meta), call->n_texts);
+        worker_call_free (call);
+        return;
+    }
+
+    if (call->segments &&
+        !(document = worker_rebuild_document (call, meta, payload, &error))) {
+        g_task_return_error (call->task, g_steal_pointer (&error));
+        worker_call_free (call);
+        return;
+    }
+
+    result = g_new0 (WorkerResult, 1);
+    result->meta = json_object_ref (meta);
+    result->payload = document ? g_steal_pointer (&document) : g_steal_pointer (&owned);
+    g_task_return_pointer (call->task, result, (GDestroyNotify) worker_result_free);
+    worker_call_free (call);
+}
+
+/* Serializes one request frame */
+static GBytes *
+worker_build_frame (JsonObject  *meta,
+                    const gchar *payload,
+                    gsize        payload_len)
+{
+    g_autoptr(JsonNode) node = json_node_new (JSON_NODE_OBJECT);
+    g_autofree gchar *json = NULL;
+    GByteArray *frame;
+    guint32 lengths[2];
+
+    json_node_set_object (node, meta);
+    json = json_to_string (node, FALSE);
+    lengths[0] = GUINT32_TO_BE ((guint32) strlen (json));
+    lengths[1] = GUINT32_TO_BE ((guint32) payload_len);
+
+    frame = g_byte_array_sized_new (WORKER_FRAME_HEADER_SIZE + strlen (json) + payload_len);
+    g_byte_array_append (frame, (const guint8 *) WORKER_FRAME_MAGIC, 4);
+    g_byte_array_append (frame, (const guint8 *) lengths, sizeof (lengths));
+    g_byte_array_append (frame, (const guint8 *) json, strlen (json));
+    g_byte_array_append (frame, (const guint8 *) payload, payload_len);
+    return g_byte_array_free_to_bytes (frame);
+}
+
+/* Returns TRUE if the read in @res filled its @len bytes; otherwise the
+ * helper is handled as crashed (or ignored if it was retired) */
+static gboolean
+worker_finish_read (WorkerProcess *wp,
+                    GAsyncResult  *res,
+                    gsize          len,
+                    const gchar   *what)
+{
+    g_autoptr(GError) error = NULL;
+    gsize bytes_read = 0;
+
+    if (!g_input_stream_read_all_finish (wp->stdout_pipe, res, &bytes_read, &error) &&
+        g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        return FALSE;
+
+    /* Retired on purpose: nothing left to do */
+    if (!wp->owner)
+        return FALSE;
+
+    if (error) {
+        worker_handle_crash (wp, error->message);
+        return FALSE;
+    }
+    if (bytes_read < len) {
+        g_autofree gchar *reason = bytes_read == 0 && g_str_equal (what, "header") ?
+            g_strdup ("end of stream") : g_strdup_printf ("truncated frame %s", what);
+        worker_handle_crash (wp, reason);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static void
+on_payload_read (GObject      *source,
+                 GAsyncResult *res,
+                 gpointer      user_data)
+{
+    WorkerProcess *wp = user_data;
+    TranslateWorker *worker = wp->owner;
+
+    (void)source;
+
+    if (wp->payload_len == 0 || worker_finish_read (wp, res, wp->payload_len, "payload")) {
+        g_autofree gchar *meta = g_steal_pointer (&wp->meta);
+        gsize meta_len = wp->meta_len;
+        GBytes *payload = g_bytes_new_take (g_steal_pointer (&wp->payload), wp->payload_len);
+
+        /* Re-arm first: handling the response may dispatch the next request */
+        worker_read_next (wp);
+        worker_handle_frame (wp, meta, meta_len, payload);
+        worker_dispatch (worker);
+    }
+
+    worker_process_unref (wp);
+}
+
+static void
+on_meta_read (GObject      *source,
+              GAsyncResult *res,
+              gpointer      user_data)
+{
+    WorkerProcess *wp = user_data;
+
+    (void)source;
+
+    if (!worker_finish_read (wp, res, wp->meta_len, "meta")) {
+        worker_process_unref (wp);
+        return;
+    }
+
+    if (wp->payload_len == 0) {
+        on_payload_read (NULL, NULL, wp);
+        return;
+    }
+
+    /* Hands our reference on to on_payload_read() */
+    g_input_stream_read_all_async (wp->stdout_pipe,
+                                   wp->payload,
+                                   wp->payload_len,
+                                   G_PRIORITY_DEFAULT,
+                                   wp->io_cancellable,
+                                   on_payload_read,
+                                   wp);
+}
+
+static void
+on_header_read (GObject      *source,
+                GAsyncResult *res,
+                gpointer      user_data)
+{
+    WorkerProcess *wp = user_data;
+    guint32 meta_len, payload_len;
+
+    (void)source;
+
+    if (!worker_finish_read (wp, res, WORKER_FRAME_HEADER_SIZE, "header")) {
+        worker_process_unref (wp);
+        return;
+    }
+
+    memcpy (&meta_len, wp->header + 4, sizeof (meta_len));
+    memcpy (&payload_len, wp->header + 8, sizeof (payload_len));
+    meta_len = GUINT32_FROM_BE (meta_len);
+    payload_len = GUINT32_FROM_BE (payload_len);
+
+    if (memcmp (wp->header, WORKER_FRAME_MAGIC, 4) != 0 ||
+        meta_len == 0 || meta_len > WORKER_MAX_META_SIZE || payload_len > WORKER_MAX_PAYLOAD_SIZE) {
+        /* Most likely something printed to stdout; the stream is lost */
+        worker_handle_crash (wp, "malformed frame header");
+        worker_process_unref (wp);
+        return;
+    }
+
+    wp->meta_len = meta_len;
+    wp->meta = g_malloc (meta_len);
+    wp->payload_len = payload_len;
+    wp->payload = g_malloc (payload_len + 1);
+    wp->payload[payload_len] = '\0';
+
+    /* Hands our reference on to on_meta_read() */
+    g_input_stream_read_all_async (wp->stdout_pipe,
+                                   wp->meta,
+                                   wp->meta_len,
+                                   G_PRIORITY_DEFAULT,
+                                   wp->io_cancellable,
+                                   on_meta_read,
+                                   wp);
+}
+
+static void
+on_request_written (GObject      *source,
+                    GAsyncResult *res,
+                    gpointer      user_data)
+{
+    WorkerProcess *wp = user_data;
+    g_autoptr(GError) error = NULL;
+
+    if (!g_output_stream_write_all_finish (G_OUTPUT_STREAM (source), res, NULL, &error) &&
+        wp->owner && !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        worker_handle_crash (wp, error ? error->message : "write failed");
+
+    worker_process_unref (wp);
+}
+
+static guint
+worker_pool_limit (void)
+{
+    return (guint) CLAMP (translate_utils_get_max_workers (), 1, 16);
+}
+
+/* Returns an idle helper, spawning one if the pool has room, or NULL */
+static WorkerProcess *
+worker_get_idle_process (TranslateWorker *worker,
+                         GError         **error)
+{
+    guint limit = worker_pool_limit ();
+
+    /* Walk backwards so retiring (a swap-remove) does not skip entries */
+    for (guint i = worker->procs->len; i > 0; i--) {
+        WorkerProcess *wp = g_ptr_array_index (worker->procs, i - 1);
+        if (wp->in_flight)
+            continue;
+        if (wp->retire_when_idle) {
+            worker_process_retire (wp, TRUE);
+            continue;
+        }
+        if (worker->procs->len > limit) {
+            /* The limit was lowered: shrink the pool as helpers go idle */
+            worker_process_retire (wp, TRUE);
+            continue;
+        }
+        return wp;
+    }
+
+    if (worker->procs->len < limit)
+        return worker_spawn (worker, error);
+
+    return NULL;
+}
+
+static void
+worker_dispatch (TranslateWorker *worker)
+{
+    while (!g_queue_is_empty (&worker->pending)) {
+        WorkerCall *call = g_queue_peek_head (&worker->pending);
+        g_autoptr(GError) error = NULL;
+        WorkerProcess *wp;
+
+        if (g_task_return_error_if_cancelled (call->task)) {
+            worker_call_free (g_queue_pop_head (&worker->pending));
+            continue;
+        }
+
+        wp = worker_get_idle_process (worker, &error);
+        if (!wp && error) {
+            g_task_return_new_error (call->task, G_SPAWN_ERROR, G_SPAWN_ERROR_FAILED,
+                                     "Failed to spawn helper: %s", error->message);
+            worker_call_free (g_queue_pop_head (&worker->pending));
+            continue;
+        }
+        if (!wp)
+            break; /* Every helper is busy */
+
+        g_queue_pop_head (&worker->pending);
+        worker_process_unwatch_idle (wp);
+        call->attempts++;
+        call->wp = wp;
+        wp->in_flight = call;
+        g_output_stream_write_all_async (wp->stdin_pipe,
+                                         g_bytes_get_data (call->frame, NULL),
+                                         g_bytes_get_size (call->frame),
+                                         G_PRIORITY_DEFAULT,
+                                         wp->io_cancellable,
+                                         on_request_written,
+                                         worker_process_ref (wp));
+    }
+
+    for (guint i = worker->procs->len; i > 0; i--) {
+        WorkerProcess *wp = g_ptr_array_index (worker->procs, i - 1);
+
+        if (wp->in_flight)
+            continue;
+        if (wp->retire_when_idle)
+            worker_process_retire (wp, TRUE);
+        else
+            worker_process_watch_idle (wp);
+    }
+}
+
+/* Stopping a helper frees its models at once, where unloading them one
+ * by one would leave most of the memory in the helper's heap */
+static void
+on_low_memory_warning (GMemoryMonitor            *monitor,
+                       GMemoryMonitorWarningLevel level,
+                       gpointer                   user_data)
+{
+    GHashTableIter iter;
+    gpointer value;
+    guint stopped = 0;
+
+    (void)monitor;
+    (void)user_data;
+
+    g_hash_table_iter_init (&iter, s_workers);
+    while (g_hash_table_iter_next (&iter, NULL, &value)) {
+        TranslateWorker *worker = value;
+
+        for (guint i = worker->procs->len; i > 0; i--) {
+            WorkerProcess *wp = g_ptr_array_index (worker->procs, i - 1);
+
+            if (!wp->in_flight) {
+                translate_stats_add_helper_stop (TRUE);
+                worker_process_retire (wp, TRUE);
+                stopped++;
+            } else if (level >= G_MEMORY_MONITOR_WARNING_LEVEL_MEDIUM && !wp->retire_when_idle) {
+                translate_stats_add_helper_stop (TRUE);
+                wp->retire_when_idle = TRUE;
+                stopped++;
+            }
+        }
+    }
+
+    if (stopped > 0)
+        g_message ("[worker] Low memory (level %d): stopping %u translate helpers", (gint) level, stopped);
+}
+
+/* Runs in the main loop when a call's cancellable fires */
+static gboolean
+on_call_cancelled (GCancellable *cancellable,
+                   gpointer      user_data)
+{
+    WorkerCall *call = user_data;
+    TranslateWorker *worker = call->worker;
+    WorkerProcess *wp = call->wp;
+
+    (void)cancellable;
+
+    if (wp && wp->in_flight == call) {
+        /* The helper cannot be interrupted mid-request: replace it */
+        g_debug ("[worker] Request %" G_GINT64_FORMAT " cancelled, stopping its %s helper",
+                 call->id, worker->script_name);
+        wp->in_flight = NULL;
+        worker_process_retire (wp, FALSE);
+    } else {
+        g_queue_remove (&worker->pending, call);
+    }
+
+    g_task_return_error_if_cancelled (call->task);
+    worker_call_free (call);
+
+    worker_dispatch (worker);
+    return G_SOURCE_REMOVE;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+TranslateWorker *
+translate_worker_get_shared (const gchar *script_name,
+                             GError     **error)
+{
+    TranslateWorker *worker;
+
+    g_return_val_if_fail (script_name != NULL, NULL);
+
+    if (!s_workers) {
+        s_workers = g_hash_table_new (g_str_hash, g_str_equal);
+        s_memory_monitor = g_memory_monitor_dup_default ();
+        g_signal_connect (s_memory_monitor, "low-memory-warning", G_CALLBACK (on_low_memory_warning), NULL);
+    }
+
+    worker = g_hash_table_lookup (s_workers, script_name);
+    if (worker)
+        return worker;
+
+    g_autofree gchar *helper_path = find_helper_script (script_name, error);
+    if (!helper_path)
+        return NULL;
+    g_autofree gchar *python = find_python (error);
+    if (!python)
+        return NULL;
+
+    g_debug ("[worker] Using helper: %s", helper_path);
+    g_debug ("[worker] Using python: %s", python);
+
+    worker = g_new0 (TranslateWorker, 1);
+    worker->script_name = g_strdup (script_name);
+    worker->helper_path = g_steal_pointer (&helper_path);
+    worker->python = g_steal_pointer (&python);
+    worker->procs = g_ptr_array_new_with_free_func ((GDestroyNotify) worker_process_unref);
+    g_queue_init (&worker->pending);
+
+    g_hash_table_insert (s_workers, worker->script_name, worker);
+    return worker;
+}
+
+void
+translate_worker_request_async (TranslateWorker    *worker,
+                                JsonObject         *request,
+                                GCancellable       *cancellable,
+                                GAsyncReadyCallback callback,
+                                gpointer            user_data)
+{
+    translate_worker_request_stream_async (worker, request, NULL, NULL, cancellable, callback, user_data);
+}
+
+void
+translate_worker_request_stream_async (TranslateWorker    *worker,
+                                       JsonObject         *request,
+                                       TranslateStreamFunc stream_func,
+                                       gpointer            stream_data,
+                                       GCancellable       *cancellable,
+                                       GAsyncReadyCallback callback,
+                                       gpointer            user_data)
+{
+    g_return_if_fail (worker != NULL);
+    g_return_if_fail (request != NULL);
+
+    GTask *task = g_task_new (NULL, cancellable, callback, user_data);
+    g_task_set_source_tag (task, translate_worker_request_async);
+
+    WorkerCall *call = g_new0 (WorkerCall, 1);
+    call->task = task;
+    call->worker = worker;
+    call->id = ++worker->next_id;
+    call->stream_func = stream_func;
+    call->stream_data = stream_data;
+    call->n_texts = -1;
+    json_object_set_int_member (request, "id", call->id);
+    if (stream_func)
+        json_object_set_boolean_member (request, "stream", TRUE);
+
+    /* The text travels as the raw payload, not inside the JSON */
+    g_autoptr(GString) payload = g_string_new (NULL);
+    if (json_object_has_member (request, "text")) {
+        const gchar *text = json_object_get_string_member (request, "text");
+
+        if (json_object_has_member (request, "html") && json_object_get_boolean_member (request, "html")) {
+            /* Parse HTML once here; the helper only needs the text runs */
+            guint count;
+
+            call->segments = translate_segments_parse (text);
+            count = translate_segments_get_count (call->segments);
+            for (guint i = 0; i < count; i++) {
+                if (i > 0)
+                    g_string_append_c (payload, '\0');
+                g_string_append (payload, translate_segments_get_text (call->segments, i));
+            }
+
+            g_debug ("[worker] Sending %u segments (%zu bytes) instead of %zu bytes of HTML",
+                     count, payload->len, text ? strlen (text) : 0);
+            json_object_set_string_member (request, "payload", "segments");
+            json_object_set_int_member (request, "count", count);
+        } else {
+            g_string_append (payload, text ? text : "");
+            json_object_set_string_member (request, "payload", "text");
+        }
+        json_object_remove_member (request, "text");
+    } else if (json_object_has_member (request, "segments")) {
+        /* Plain-text batches are already segments */
+        JsonArray *texts = json_object_get_array_member (request, "segments");
+        guint count = texts ? json_array_get_length (texts) : 0;
+
+        for (guint i = 0; i < count; i++) {
+            const gchar *text = json_array_get_string_element (texts, i);
+
+            if (i > 0)
+                g_string_append_c (payload, '\0');
+            g_string_append (payload, text ? text : "");
+        }
+        call->n_texts = (gint) count;
+        json_object_set_string_member (request, "payload", "segments");
+        json_object_set_int_member (request, "count", count);
+        json_object_remove_member (request, "segments");
+    }
+
+    call->frame = worker_build_frame (request, payload->str, payload->len);
+
+    if (cancellable) {
+        call->cancel_source = g_cancellable_source_new (cancellable);
+        g_source_set_callback (call->cancel_source, (GSourceFunc) on_call_cancelled, call, NULL);
+        g_source_attach (call->cancel_source, NULL);
+    }
+
+    g_queue_push_tail (&worker->pending, call);
+    worker_dispatch (worker);
+}
+
+JsonObject *
+translate_worker_request_finish (GAsyncResult *res,
+                                 GBytes      **out_payload,
+                                 GError      **error)
+{
+    WorkerResult *result;
+    JsonObject *meta;
+
+    g_return_val_if_fail (g_task_is_valid (res, NULL), NULL);
+
+    result = g_task_propagate_pointer (G_TASK (res), error);
+    if (!result)
+        return NULL;
+
+    meta = g_steal_pointer (&result->meta);
+    if (out_payload)
+        *out_payload = g_steal_pointer (&result->payload);
+    g_clear_pointer (&result->payload, g_bytes_unref);
+    g_free (result);
+    return meta;
+}
+
+gchar *
+translate_worker_payload_to_string (GBytes *payload)
+{
+    gsize size = 0;
+    gchar *data;
+
+    g_return_val_if_fail (payload != NULL, NULL);
+
+    /* Steals the buffer when we hold the only reference. The buffer
+     * already has room for the NUL, so the realloc does not move it. */
+    data = g_bytes_unref_to_data (payload, &size);
+    data = g_realloc (data, size + 1);
+    data[size] = '\0';
+    return data;
+}
+
+gchar **
+translate_worker_payload_to_strv (GBytes *payload,
+                                  guint   count)
+{
+    g_autoptr(GPtrArray) texts = NULL;
+    gchar **strv;
+
+    g_return_val_if_fail (payload != NULL, NULL);
+
+    if (!(texts = worker_split_payload (payload, count)))
+        return NULL;
+
+    strv = g_new0 (gchar *, count + 1);
+    for (guint i = 0; i < count; i++)
+        strv[i] = g_strdup (g_ptr_array_index (texts, i));
+    return strv;
+}
+
+/* A size field of one helper's /proc/<pid>/status ("VmHWM:", "VmRSS:"), in bytes */
+static guint64
+worker_process_read_status (WorkerProcess *wp,
+                            const gchar   *field)
+{
+    const gchar *pid = g_subprocess_get_identifier (wp->proc);
+    g_autofree gchar *path = NULL;
+    g_autofree gchar *status = NULL;
+    const gchar *line;
+
+    if (!pid)
+        return 0;
+
+    path = g_build_filename ("/proc", pid, "status", NULL);
+    if (!g_file_get_contents (path, &status, NULL, NULL) ||
+        !(line = strstr (status, field)))
+        return 0;
+    return g_ascii_strtoull (line + strlen (field), NULL, 10) * 1024;
+}
+
+guint64
+translate_worker_get_peak_rss (void)
+{
+    GHashTableIter iter;
+    gpointer value;
+    guint64 total = 0;
+
+    if (!s_workers)
+        return 0;
+
+    g_hash_table_iter_init (&iter, s_workers);
+    while (g_hash_table_iter_next (&iter, NULL, &value)) {
+        TranslateWorker *worker = value;
+
+        for (guint i = 0; i < worker->procs->len; i++)
+            total += worker_process_read_status (g_ptr_array_index (worker->procs, i), "VmHWM:");
+    }
+    return total;
+}
+
+gchar *
+translate_worker_format_stats (void)
+{
+    GString *out = g_string_new (NULL);
+    g_autoptr(GList) names = s_workers ? g_hash_table_get_keys (s_workers) : NULL;
+    guint64 total = 0;
+    guint count = 0;
+
+    g_string_append_printf (out, "%-18s%8s  %10s  %s\n", _("Helper"), _("PID"), _("Memory"), _("Models"));
+
+    names = g_list_sort (names, (GCompareFunc) g_strcmp0);
+    for (GList *l = names; l; l = l->next) {
+        TranslateWorker *worker = g_hash_table_lookup (s_workers, l->data);
+        g_autofree gchar *name = g_strdup (worker->script_name);
+
+        if (g_str_has_suffix (name, ".py"))
+            name[strlen (name) - 3] = '\0';
+
+        for (guint i = 0; i < worker->procs->len; i++) {
+            WorkerProcess *wp = g_ptr_array_index (worker->procs, i);
+            guint64 rss = worker_process_read_status (wp, "VmRSS:");
+            g_autofree gchar *rss_text = g_format_size (rss);
+            g_autofree gchar *models = wp->models && wp->models[0] ?
+                g_strjoinv (", ", wp->models) : g_strdup ("-");
+            const gchar *pid = g_subprocess_get_identifier (wp->proc);
+
+            g_string_append_printf (out, "%-18s%8s  %10s  %s\n",
+                                    name, pid ? pid : "-", rss_text, models);
+            total += rss;
+            count++;
+        }
+    }
+
+    if (count == 0) {
+        g_string_append_printf (out, "%s\n", _("No helper running"));
+    } else {
+        g_autofree gchar *total_text = g_format_size (total);
+        g_string_append_printf (out, "%-18s%8u  %10s\n", _("Total"), count, total_text);
+    }
+
+    return g_string_free (out, FALSE);
+}
+
+void
+translate_worker_shutdown_all (void)
+{
+    GHashTableIter iter;
+    gpointer value;
+
+    if (!s_workers)
+        return;
+
+    g_hash_table_iter_init (&iter, s_workers);
+    while (g_hash_table_iter_next (&iter, NULL, &value)) {
+        TranslateWorker *worker = value;
+        WorkerCall *call;
+
+        while (worker->procs->len > 0) {
+            WorkerProcess *wp = g_ptr_array_index (worker->procs, 0);
+            if (wp->in_flight) {
+                wp->in_flight->wp = NULL;
+                g_queue_push_head (&worker->pending, g_steal_pointer (&wp->in_flight));
+            }
+            worker_process_retire (wp, TRUE);
+        }
+
+        while ((call = g_queue_pop_head (&worker->pending))) {
+            g_task_return_new_error (call->task, G_IO_ERROR, G_IO_ERROR_CLOSED,
+                                     "Translate helper was shut down");
+            worker_call_free (call);
+        }
+    }
+}
@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate Worker - pool of resident Python helper processes shared by providers */
+
+#ifndef TRANSLATE_WORKER_H
+#define TRANSLATE_WORKER_H
+
+#include <glib.h>
+#include <gio/gio.h>
+#include <json-glib/json-glib.h>
+
+#include "translate-provider.h"
+
+G_BEGIN_DECLS
+
+typedef struct _TranslateWorker TranslateWorker;
+
+#define TRANSLATE_WORKER_ERROR (translate_worker_error_quark ())
+
+/* Failures reported by or about a helper process */
+typedef enum {
+    TRANSLATE_WORKER_ERROR_PROTOCOL,        /* Malformed or inconsistent frame */
+    TRANSLATE_WORKER_ERROR_CRASHED,         /* The helper exited mid-request */
+    TRANSLATE_WORKER_ERROR_INVALID_REQUEST, /* The helper rejected the request */
+    TRANSLATE_WORKER_ERROR_UNAVAILABLE,     /* Missing library or model */
+    TRANSLATE_WORKER_ERROR_FAILED,          /* Translation itself failed */
+    TRANSLATE_WORKER_ERROR_MODEL_PENDING    /* The model is still being downloaded */
+} TranslateWorkerError;
+
+GQuark translate_worker_error_quark (void);
+
+/**
+ * translate_worker_get_shared:
+ * @script_name: Helper script file name (e.g. "translate_runner.py")
+ * @error: Return location for a #GError
+ *
+ * Returns the process-wide worker for @script_name, creating it on first use.
+ * Helper processes are spawned lazily, up to the "max-workers" setting, and
+ * replaced transparently if they exit.
+ *
+ * Returns: (transfer none) (nullable): The shared worker, or %NULL if the
+ *          helper script or Python interpreter could not be located
+ */
+TranslateWorker *translate_worker_get_shared (const gchar *script_name,
+                                              GError     **error);
+
+/**
+ * translate_worker_request_async:
+ * @worker: A #TranslateWorker
+ * @request: JSON request parameters; "id" is added and "text" (or a
+ *           "segments" array of plain texts) is moved into the raw payload
+ *           by the worker
+ * @cancellable: (nullable): Optional #GCancellable
+ * @callback: Callback to invoke with the response
+ * @user_data: User data for @callback
+ *
+ * Queues @request for the helper pool. Requests are handed to idle helpers
+ * in submission order, one request per helper at a time. An HTML "text"
+ * is sent as its text segments and the response payload is the rebuilt
+ * document; for "segments" it holds one translation per text (see
+ * translate_worker_payload_to_strv()). Errors reported by the helper come back as #TRANSLATE_WORKER_ERROR. If a helper dies
+ * while serving a request, the request is retried once. Cancelling a request
+ * that is already being served kills its helper; the pool respawns on demand.
+ */
+void translate_worker_request_async (TranslateWorker    *worker,
+                                     JsonObject         *request,
+                                     GCancellable       *cancellable,
+                                     GAsyncReadyCallback callback,
+                                     gpointer            user_data);
+
+/**
+ * translate_worker_request_stream_async:
+ * @worker: A #TranslateWorker
+ * @request: JSON request object; "id" and "stream" members are added
+ * @stream_func: (nullable): Receives partial output while the helper works
+ * @stream_data: User data for @stream_func; must stay valid until @callback runs
+ * @cancellable: (nullable): Optional #GCancellable
+ * @callback: Callback to invoke with the final response
+ * @user_data: User data for @callback
+ *
+ * Like translate_worker_request_async(), but asks the helper to stream
+ * the skeleton and finished segments of an HTML document. @stream_func
+ * is never called after @callback.
+ */
+void translate_worker_request_stream_async (TranslateWorker    *worker,
+                                            JsonObject         *request,
+                                            TranslateStreamFunc stream_func,
+                                            gpointer            stream_data,
+                                            GCancellable       *cancellable,
+                                            GAsyncReadyCallback callback,
+                                            gpointer            user_data);
+
+/**
+ * translate_worker_request_finish:
+ * @res: The #GAsyncResult passed to the callback
+ * @out_payload: (out) (optional): Return location for the translated text;
+ *               the buffer is NUL-terminated after its last byte
+ * @error: Return location for a #GError
+ *
+ * Returns: (transfer full) (nullable): The response header (id, counters)
+ */
+JsonObject *translate_worker_request_finish (GAsyncResult *res,
+                                             GBytes      **out_payload,
+                                             GError      **error);
+
+/**
+ * translate_worker_payload_to_string:
+ * @payload: (transfer full): A payload from translate_worker_request_finish()
+ *
+ * Turns @payload into a string, reusing its buffer when @payload holds the
+ * only reference.
+ *
+ * Returns: (transfer full): The payload as a NUL-terminated UTF-8 string
+ */
+gchar *translate_worker_payload_to_string (GBytes *payload);
+
+/**
+ * translate_worker_payload_to_strv:
+ * @payload: A payload from translate_worker_request_finish()
+ * @count: Number of texts in @payload (the request's "segments" length)
+ *
+ * Returns: (transfer full) (nullable): The NUL-separated texts of @payload
+ *          as a %NULL-terminated array, or %NULL if @count does not match
+ */
+gchar **translate_worker_payload_to_strv (GBytes *payload,
+                                          guint   count);
+
+/**
+ * translate_worker_get_peak_rss:
+ *
+ * Reads the peak resident set size (VmHWM) of every running helper from
+ * /proc. Helpers that already exited are not counted.
+ *
+ * Returns: The sum in bytes, or 0 where /proc is not available
+ */
+guint64 translate_worker_get_peak_rss (void);
+
+/**
+ * translate_worker_format_stats:
+ *
+ * Describes every running helper: its PID, current resident set size
+ * (VmRSS) and the language pairs it last reported as loaded, one line
+ * each, for the statistics shown in the preferences.
+ *
+ * Returns: (transfer full): The report, translated for display
+ */
+gchar *translate_worker_format_stats (void);
+
+/**
+ * translate_worker_shutdown_all:
+ *
+ * Closes the stdin of every running helper so they exit on their own.
+ * Queued and in-flight requests fail with %G_IO_ERROR_CLOSED; the next
+ * request starts a fresh helper.
+ */
+void translate_worker_shutdown_all (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_WORKER_H */
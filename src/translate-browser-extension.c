@@ -23,25 +23,80 @@
 #include "translate-content.h"
 #include "translate-dom.h"
 #include "translate-preferences.h"
+#include "translate-prefetch.h"
+#include "translate-utils.h"
 #include "m-utils.h"
 
 G_DEFINE_DYNAMIC_TYPE(TranslateBrowserExtension, translate_browser_extension, E_TYPE_EXTENSION)
 
+/* One click on "Translate Message", from loading the body to applying */
+typedef struct {
+    EMailReader  *reader;
+    GCancellable *cancellable;  /* Owned by the display's DOM state */
+    gboolean      whole;        /* Translate the rest of a partial translation */
+} BrowserRequest;
+
+static void
+browser_request_free (BrowserRequest *req)
+{
+    /* Unblock the next click if nothing was applied */
+    g_cancellable_cancel (req->cancellable);
+    g_object_unref (req->cancellable);
+    g_object_unref (req->reader);
+    g_free (req);
+}
+
+/* Partial output; @req stays alive until on_translate_finished_browser */
+static void
+on_translate_stream_browser (const TranslateStreamEvent *event,
+                             gpointer user_data)
+{
+    BrowserRequest *req = user_data;
+    translate_dom_stream_to_reader (req->reader, event);
+}
+
 static void
 on_translate_finished_browser (GObject *source_object,
                                GAsyncResult *res,
                                gpointer user_data)
 {
-    TranslateProvider *provider = (TranslateProvider*)source_object;
-    EMailReader *reader = E_MAIL_READER (user_data);
+    BrowserRequest *req = user_data;
     g_autofree gchar *translated = NULL;
     g_autoptr(GError) error = NULL;
-    if (!translate_provider_translate_finish (provider, res, &translated, &error)) {
+    if (translate_common_translate_finish (res, &translated, &error)) {
+        /* Apply into this reader's display */
+        translate_dom_apply_to_reader (req->reader, translated, translate_common_translate_is_partial (res));
+        translate_prefetch_neighbours (req->reader);
+    } else if (!g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
         g_warning ("Translate failed: %s", error ? error->message : "unknown error");
+    browser_request_free (req);
+}
+
+static void
+on_content_loaded_browser (GObject *source_object,
+                           GAsyncResult *res,
+                           gpointer user_data)
+{
+    BrowserRequest *req = user_data;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(TranslateContent) content = translate_content_load_finish (res, &error);
+    if (!content || !content->body_html || !*content->body_html) {
+        browser_request_free (req);
         return;
     }
-    /* Apply into this reader's display */
-    translate_dom_apply_to_reader (reader, translated);
+
+    /* Use the centralized translation logic; the finish callback takes
+     * over the request */
+    if (req->whole)
+        translate_common_translate_whole_async (content->body_html, content->message_key,
+                                                (const gchar * const *) content->parent_keys, content->source_lang,
+                                                TRANSLATE_PRIORITY_INTERACTIVE, content->flags, on_translate_stream_browser, req,
+                                                req->cancellable, on_translate_finished_browser, req);
+    else
+        translate_common_translate_async (content->body_html, content->message_key,
+                                          (const gchar * const *) content->parent_keys, content->source_lang,
+                                          TRANSLATE_PRIORITY_INTERACTIVE, content->flags, on_translate_stream_browser, req,
+                                          req->cancellable, on_translate_finished_browser, req);
 }
 
 /**
@@ -50,8 +105,8 @@ on_translate_finished_browser (GObject *source_object,
  * @user_data: The TranslateBrowserExtension instance
  *
  * Handles the "Translate Message" action in the browser window.
- * Extracts the current message body and initiates translation
- * using the common translation logic.
+ * Loads the current message body off the main thread, then initiates
+ * translation using the common translation logic.
  */
 static void
 action_translate_message_cb (GtkAction *action,
@@ -59,22 +114,37 @@ action_translate_message_cb (GtkAction *action,
 {
     TranslateBrowserExtension *self = user_data;
     EMailReader *reader = E_MAIL_READER (e_extension_get_extensible (E_EXTENSION (self)));
+    BrowserRequest *req;
+    GCancellable *cancellable;
+    gboolean whole;
 
-    /* Toggle behavior: if already translated, restore original */
-    if (translate_dom_is_translated_reader (reader)) {
+    /* Toggle behavior: if already translated, restore original; a partial
+     * translation gets the rest translated instead */
+    whole = translate_dom_is_partial_reader (reader);
+    if (!whole && translate_dom_is_translated_reader (reader)) {
         translate_dom_restore_original_reader (reader);
         return;
     }
-
-    /* Extract the message body HTML */
-    g_autofree gchar *body_html = translate_get_selected_message_body_html_from_reader (reader);
-    if (!body_html || !*body_html)
+    if (!whole && translate_utils_get_translate_in_place ()) {
+        translate_dom_translate_in_place_reader (reader);
+        return;
+    }
+    if (!whole && translate_dom_show_translation_reader (reader))
         return;
 
-    /* Use the centralized translation logic (fixes memory leak) */
-    translate_common_translate_async (body_html,
-                                      on_translate_finished_browser,
-                                      reader);
+    cancellable = translate_dom_begin_request_reader (reader);
+    if (!cancellable)
+        return; /* Already translating this message */
+
+    /* The reader is kept alive until the translation has been applied */
+    req = g_new0 (BrowserRequest, 1);
+    req->reader = g_object_ref (reader);
+    req->cancellable = cancellable;
+    req->whole = whole;
+    translate_content_load_async (reader,
+                                  req->cancellable,
+                                  on_content_loaded_browser,
+                                  req);
 }
 
 static void
@@ -128,6 +198,7 @@ update_actions_cb (TranslateBrowserExtension *self)
 
     /* Clear translation state if the displayed message has changed */
     translate_dom_clear_if_message_changed_reader (reader);
+    translate_prefetch_selection_changed (reader);
 
     if (reader) {
         g_autoptr(GPtrArray) uids = e_mail_reader_get_selected_uids (reader);
@@ -0,0 +1,448 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-bulk.c
+ * Background translation of many messages into the translation cache
+ *
+ * A bulk job walks a list of UIDs (the selection, or a whole folder) and
+ * keeps a bounded number of messages loading at a time, so a folder with
+ * thousands of messages is never fetched all at once. Messages that are
+ * already cached are only counted. For providers that batch natively, the
+ * text segments of several messages are sent as one background batch and
+ * each document is rebuilt, cached and remembered for replies on its own;
+ * other providers, and messages too large for a batch or past
+ * "max-translate-size", get one background translation per message
+ * through translate-common, which windows them. Either way the scheduler
+ * keeps a slot free for interactive requests.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <glib.h>
+#include <glib/gi18n-lib.h>
+#include <camel/camel.h>
+#include <e-util/e-util.h>
+#include <mail/message-list.h>
+
+#include "translate-bulk.h"
+#include "translate-cache.h"
+#include "translate-common.h"
+#include "translate-content.h"
+#include "translate-langid.h"
+#include "translate-scheduler.h"
+#include "translate-segment.h"
+#include "translate-thread.h"
+#include "translate-utils.h"
+
+/* Messages being fetched at the same time */
+#define BULK_MAX_LOADS 4
+/* Messages loaded but not yet translated; bounds memory on huge folders */
+#define BULK_MAX_AHEAD 32
+/* Segment text per batch; keeps one batch from holding a helper for long */
+#define BULK_BATCH_CHARS (16 * 1024)
+
+typedef struct {
+    gchar             *cache_key;
+    gchar             *message_key;  /* For translate_thread_remember(), or NULL */
+    TranslateSegments *segments;
+} BulkMessage;
+
+typedef struct {
+    EActivity         *activity;
+    GCancellable      *cancellable;   /* The activity's */
+    CamelFolder       *folder;
+    GPtrArray         *uids;          /* gchar*, every message of the job */
+
+    TranslateProvider *provider;
+    gchar             *provider_id;
+    gchar             *target_lang;
+    gboolean           native_batch;
+
+    guint              next;          /* Next UID to load */
+    guint              loading;       /* Loads in flight */
+    guint              queued;        /* Loaded, waiting for their translation */
+    guint              done;          /* Finished, cached or not */
+    guint              failed;
+
+    GPtrArray         *batch;         /* BulkMessage*, not yet submitted */
+    gsize              batch_chars;
+    const gchar       *batch_source;  /* Detected language of the batch, or NULL */
+} BulkJob;
+
+typedef struct {
+    BulkJob   *job;
+    GPtrArray *messages;  /* BulkMessage* */
+} BulkBatch;
+
+/* Running jobs, so shutdown can cancel them */
+static GList *s_jobs;
+
+static void bulk_job_pump (BulkJob *job);
+
+static void
+bulk_message_free (BulkMessage *message)
+{
+    g_free (message->cache_key);
+    g_free (message->message_key);
+    g_clear_pointer (&message->segments, translate_segments_free);
+    g_free (message);
+}
+
+static void
+bulk_job_free (BulkJob *job)
+{
+    s_jobs = g_list_remove (s_jobs, job);
+    g_ptr_array_unref (job->batch);
+    g_ptr_array_unref (job->uids);
+    g_free (job->provider_id);
+    g_free (job->target_lang);
+    g_object_unref (job->provider);
+    g_object_unref (job->folder);
+    g_object_unref (job->cancellable);
+    g_object_unref (job->activity);
+    g_free (job);
+}
+
+static void
+bulk_job_update_progress (BulkJob *job)
+{
+    g_autofree gchar *text = NULL;
+
+    text = g_strdup_printf (_("Translating messages (%u of %u)"), job->done, job->uids->len);
+    e_activity_set_text (job->activity, text);
+    e_activity_set_percent (job->activity, 100.0 * job->done / MAX (1, job->uids->len));
+}
+
+/* Ends the job once nothing is outstanding any more */
+static gboolean
+bulk_job_maybe_finish (BulkJob *job)
+{
+    gboolean cancelled = g_cancellable_is_cancelled (job->cancellable);
+
+    if (job->loading > 0 || job->queued > 0 ||
+        (!cancelled && job->next < job->uids->len))
+        return FALSE;
+
+    if (cancelled) {
+        g_debug ("[translate] Bulk translation cancelled after %u of %u messages",
+                 job->done, job->uids->len);
+        e_activity_set_state (job->activity, E_ACTIVITY_CANCELLED);
+    } else {
+        g_message ("[translate] Bulk translation finished: %u messages, %u failed",
+                   job->uids->len, job->failed);
+        e_activity_set_state (job->activity, E_ACTIVITY_COMPLETED);
+    }
+    bulk_job_free (job);
+    return TRUE;
+}
+
+static void
+bulk_job_count_done (BulkJob  *job,
+                     guint     n,
+                     GError   *error)
+{
+    job->done += n;
+    if (error && !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED)) {
+        job->failed += n;
+        g_debug ("[translate] Bulk translation of %u message(s) failed: %s", n, error->message);
+    }
+    bulk_job_update_progress (job);
+}
+
+static void
+on_batch_translated (GObject      *source_object,
+                     GAsyncResult *res,
+                     gpointer      user_data)
+{
+    BulkBatch *batch = user_data;
+    BulkJob *job = batch->job;
+    g_autoptr(GError) error = NULL;
+    g_auto(GStrv) translations = NULL;
+
+    (void)source_object;
+
+    if (translate_scheduler_submit_batch_finish (res, &translations, &error)) {
+        guint offset = 0;
+
+        for (guint i = 0; i < batch->messages->len; i++) {
+            BulkMessage *message = g_ptr_array_index (batch->messages, i);
+            guint count = translate_segments_get_count (message->segments);
+            g_autofree gchar *html = NULL;
+
+            html = translate_segments_rebuild (message->segments,
+                                               (const gchar * const *) translations + offset,
+                                               count);
+            translate_cache_store (message->cache_key, html);
+            translate_thread_remember (message->message_key, job->provider_id, job->target_lang,
+                                       message->segments,
+                                       (const gchar * const *) translations + offset);
+            offset += count;
+        }
+    }
+
+    job->queued -= batch->messages->len;
+    bulk_job_count_done (job, batch->messages->len, error);
+    g_ptr_array_unref (batch->messages);
+    g_free (batch);
+
+    bulk_job_pump (job);
+}
+
+/* Sends the collected messages' segments out as one background batch */
+static void
+bulk_job_flush_batch (BulkJob *job)
+{
+    g_autoptr(GPtrArray) texts = g_ptr_array_new ();
+    BulkBatch *batch;
+
+    if (job->batch->len == 0)
+        return;
+
+    batch = g_new0 (BulkBatch, 1);
+    batch->job = job;
+    batch->messages = g_steal_pointer (&job->batch);
+    job->batch = g_ptr_array_new_with_free_func ((GDestroyNotify) bulk_message_free);
+    job->batch_chars = 0;
+
+    for (guint i = 0; i < batch->messages->len; i++) {
+        BulkMessage *message = g_ptr_array_index (batch->messages, i);
+        guint count = translate_segments_get_count (message->segments);
+
+        for (guint s = 0; s < count; s++)
+            g_ptr_array_add (texts, (gpointer) translate_segments_get_text (message->segments, s));
+    }
+
+    g_debug ("[translate] Bulk batch: %u messages, %u segments, from %s",
+             batch->messages->len, texts->len, job->batch_source ? job->batch_source : "(detect)");
+    translate_scheduler_submit_batch_async (job->provider,
+                                            (const gchar * const *) texts->pdata,
+                                            texts->len,
+                                            job->batch_source,
+                                            job->target_lang,
+                                            TRANSLATE_PRIORITY_BACKGROUND,
+                                            job->cancellable,
+                                            on_batch_translated,
+                                            batch);
+}
+
+static void
+on_message_translated (GObject      *source_object,
+                       GAsyncResult *res,
+                       gpointer      user_data)
+{
+    BulkJob *job = user_data;
+    g_autoptr(GError) error = NULL;
+
+    (void)source_object;
+
+    /* translate-common has already put the result in the cache */
+    translate_common_translate_finish (res, NULL, &error);
+    job->queued--;
+    bulk_job_count_done (job, 1, error);
+    bulk_job_pump (job);
+}
+
+/* One background translation of @content through translate-common,
+ * which caches the result itself */
+static void
+bulk_job_translate_one (BulkJob          *job,
+                        TranslateContent *content)
+{
+    translate_common_translate_async (content->body_html,
+                                      content->message_key,
+                                      (const gchar * const *) content->parent_keys,
+                                      content->source_lang,
+                                      TRANSLATE_PRIORITY_BACKGROUND,
+                                      content->flags,
+                                      NULL, NULL,  /* no partial output */
+                                      job->cancellable,
+                                      on_message_translated,
+                                      job);
+}
+
+static void
+on_message_loaded (GObject      *source_object,
+                   GAsyncResult *res,
+                   gpointer      user_data)
+{
+    BulkJob *job = user_data;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(TranslateContent) content = translate_content_load_finish (res, &error);
+    g_autofree gchar *cache_key = NULL;
+    g_autofree gchar *cached = NULL;
+
+    (void)source_object;
+    job->loading--;
+
+    if (!content || !content->body_html || !*content->body_html ||
+        g_cancellable_is_cancelled (job->cancellable)) {
+        bulk_job_count_done (job, 1, error);
+        bulk_job_pump (job);
+        return;
+    }
+
+    /* Already in the target language: nothing to translate or cache */
+    if (content->source_lang && translate_langid_same_language (content->source_lang, job->target_lang)) {
+        bulk_job_count_done (job, 1, NULL);
+        bulk_job_pump (job);
+        return;
+    }
+
+    cache_key = translate_cache_make_key (content->message_key, content->body_html,
+                                          job->provider_id, job->target_lang);
+    if ((cached = translate_cache_lookup (cache_key))) {
+        bulk_job_count_done (job, 1, NULL);
+        bulk_job_pump (job);
+        return;
+    }
+
+    job->queued++;
+
+    /* Past "max-translate-size" only the head is translated, in windows;
+     * translate-common does that, without parsing the whole message here */
+    gsize limit = translate_utils_get_max_translate_size ();
+    if (!job->native_batch || (limit > 0 && strlen (content->body_html) > limit)) {
+        bulk_job_translate_one (job, content);
+        bulk_job_pump (job);
+        return;
+    }
+
+    g_autoptr(TranslateSegments) segments = translate_segments_parse (content->body_html);
+    gsize chars = 0;
+
+    for (guint i = 0; i < translate_segments_get_count (segments); i++)
+        chars += strlen (translate_segments_get_text (segments, i));
+
+    /* More than a batch on its own: translate-common windows it */
+    if (chars > BULK_BATCH_CHARS) {
+        bulk_job_translate_one (job, content);
+        bulk_job_pump (job);
+        return;
+    }
+
+    /* One batch has one source language, so the helper need not guess
+     * one for text that came from several messages, and stays within
+     * BULK_BATCH_CHARS */
+    if (job->batch->len > 0 &&
+        (g_strcmp0 (job->batch_source, content->source_lang) != 0 ||
+         job->batch_chars + chars > BULK_BATCH_CHARS))
+        bulk_job_flush_batch (job);
+    job->batch_source = content->source_lang;
+
+    BulkMessage *message = g_new0 (BulkMessage, 1);
+    message->cache_key = g_steal_pointer (&cache_key);
+    message->message_key = g_strdup (content->message_key);
+    message->segments = g_steal_pointer (&segments);
+    job->batch_chars += chars;
+    g_ptr_array_add (job->batch, message);
+    if (job->batch_chars >= BULK_BATCH_CHARS)
+        bulk_job_flush_batch (job);
+
+    bulk_job_pump (job);
+}
+
+/* Starts loads while there is room, and flushes the last partial batch
+ * once nothing else can join it */
+static void
+bulk_job_pump (BulkJob *job)
+{
+    while (!g_cancellable_is_cancelled (job->cancellable) &&
+           job->next < job->uids->len &&
+           job->loading < BULK_MAX_LOADS &&
+           job->loading + job->queued < BULK_MAX_AHEAD) {
+        const gchar *uid = g_ptr_array_index (job->uids, job->next++);
+
+        job->loading++;
+        translate_content_load_uid_async (job->folder, uid, job->cancellable,
+                                          on_message_loaded, job);
+    }
+
+    if (g_cancellable_is_cancelled (job->cancellable)) {
+        job->queued -= job->batch->len;
+        g_ptr_array_set_size (job->batch, 0);
+    } else if (job->loading == 0 && job->batch->len > 0) {
+        bulk_job_flush_batch (job);
+    }
+
+    bulk_job_maybe_finish (job);
+}
+
+static GPtrArray *
+collect_uids (EMailReader *reader,
+              CamelFolder *folder,
+              gboolean     whole_folder)
+{
+    GPtrArray *uids = g_ptr_array_new_with_free_func (g_free);
+
+    if (whole_folder) {
+        GPtrArray *all = camel_folder_get_uids (folder);
+
+        for (guint i = 0; all && i < all->len; i++)
+            g_ptr_array_add (uids, g_strdup (g_ptr_array_index (all, i)));
+        if (all)
+            camel_folder_free_uids (folder, all);
+    } else {
+        g_autoptr(GPtrArray) selected = e_mail_reader_get_selected_uids (reader);
+
+        for (guint i = 0; selected && i < selected->len; i++)
+            g_ptr_array_add (uids, g_strdup (g_ptr_array_index (selected, i)));
+    }
+
+    return uids;
+}
+
+void
+translate_bulk_start (EMailReader *reader,
+                      gboolean     whole_folder)
+{
+    g_autoptr(CamelFolder) folder = NULL;
+    g_autoptr(GPtrArray) uids = NULL;
+    TranslateProviderCapabilities caps;
+    TranslateProvider *provider;
+    BulkJob *job;
+
+    g_return_if_fail (E_IS_MAIL_READER (reader));
+
+    folder = e_mail_reader_ref_folder (reader);
+    if (!folder)
+        return;
+
+    provider = translate_provider_get_active ();
+    if (!provider)
+        return;
+
+    uids = collect_uids (reader, folder, whole_folder);
+    if (uids->len == 0)
+        return;
+
+    job = g_new0 (BulkJob, 1);
+    job->activity = e_mail_reader_new_activity (reader);
+    job->cancellable = g_object_ref (e_activity_get_cancellable (job->activity));
+    job->folder = g_steal_pointer (&folder);
+    job->uids = g_steal_pointer (&uids);
+    job->provider = g_object_ref (provider);
+    job->provider_id = g_strdup (translate_provider_get_id (provider));
+    job->target_lang = translate_utils_get_target_language ();
+    job->batch = g_ptr_array_new_with_free_func ((GDestroyNotify) bulk_message_free);
+
+    translate_provider_get_capabilities (provider, &caps);
+    job->native_batch = caps.native_batch;
+
+    g_debug ("[translate] Bulk translation of %u messages with %s (%s)",
+             job->uids->len, job->provider_id, job->native_batch ? "batched" : "per message");
+    s_jobs = g_list_prepend (s_jobs, job);
+    bulk_job_update_progress (job);
+    bulk_job_pump (job);
+}
+
+void
+translate_bulk_shutdown (void)
+{
+    /* Each job frees itself once its cancelled work has come back */
+    for (GList *l = s_jobs; l; l = l->next) {
+        BulkJob *job = l->data;
+        g_cancellable_cancel (job->cancellable);
+    }
+}
@@ -0,0 +1,39 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-bulk.h
+ * Background translation of many messages into the translation cache
+ */
+
+#ifndef TRANSLATE_BULK_H
+#define TRANSLATE_BULK_H
+
+#include <glib.h>
+#include <mail/e-mail-reader.h>
+
+G_BEGIN_DECLS
+
+/**
+ * translate_bulk_start:
+ * @reader: The reader whose messages to translate
+ * @whole_folder: %TRUE for every message of @reader's folder, %FALSE for
+ *   the selected ones
+ *
+ * Translates the messages in the background at background priority, so
+ * interactive translations always go first. Progress is shown as an
+ * #EActivity of @reader, which can also cancel the job. Results only go
+ * into the translation cache; opening one of the messages and translating
+ * it afterwards is answered from there.
+ */
+void translate_bulk_start (EMailReader *reader,
+                           gboolean     whole_folder);
+
+/**
+ * translate_bulk_shutdown:
+ *
+ * Cancels every running bulk job.
+ */
+void translate_bulk_shutdown (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_BULK_H */
@@ -0,0 +1,354 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-cache.c
+ * Two-tier (memory + disk) cache of whole-message translations
+ *
+ * Re-translating a message after "Show Original", or reopening it later,
+ * is answered from here without touching a provider. The memory tier is
+ * an LRU bounded by "cache-memory-size"; the disk tier keeps one file per
+ * entry under $XDG_CACHE_HOME/evolution-translate/messages and is pruned
+ * oldest first (by mtime, refreshed on every hit) down to
+ * "cache-disk-size". The helpers keep their own files (translation
+ * memory, device probe, install locks) in the parent directory, so
+ * pruning only ever counts and deletes files named like a cache key.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <gio/gio.h>
+
+#include "translate-cache.h"
+#include "translate-stats.h"
+#include "translate-utils.h"
+
+#define MIB (1024 * 1024)
+
+typedef struct {
+    gchar *key;
+    gchar *value;
+    gsize  size;
+    GList *link;   /* Node in s_lru, data == this entry */
+} CacheEntry;
+
+/* Memory tier: key → CacheEntry*, with s_lru ordered most recent first */
+static GHashTable *s_entries;
+static GQueue      s_lru = G_QUEUE_INIT;
+static gsize       s_memory_bytes;
+
+/* Serializes disk writes and pruning across worker threads */
+static GMutex s_disk_lock;
+
+static void
+cache_entry_free (CacheEntry *entry)
+{
+    g_free (entry->key);
+    g_free (entry->value);
+    g_free (entry);
+}
+
+static const gchar *
+cache_dir (void)
+{
+    static gchar *dir;
+
+    if (g_once_init_enter (&dir)) {
+        gchar *path = g_build_filename (g_get_user_cache_dir (), "evolution-translate", "messages", NULL);
+        g_once_init_leave (&dir, path);
+    }
+    return dir;
+}
+
+/* ============================================================================
+ * MEMORY TIER
+ * ============================================================================ */
+
+static void
+memory_evict_to (gsize limit)
+{
+    while (s_memory_bytes > limit && !g_queue_is_empty (&s_lru)) {
+        CacheEntry *oldest = g_queue_pop_tail (&s_lru);
+        s_memory_bytes -= oldest->size;
+        g_hash_table_remove (s_entries, oldest->key);
+    }
+}
+
+static void
+memory_insert (const gchar *key,
+               const gchar *value)
+{
+    gsize limit = (gsize) translate_utils_get_cache_memory_size () * MIB;
+    gsize size = strlen (value) + 1;
+    CacheEntry *entry;
+
+    if (size > limit)
+        return;
+
+    if (!s_entries)
+        s_entries = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify) cache_entry_free);
+
+    entry = g_hash_table_lookup (s_entries, key);
+    if (entry) {
+        g_queue_unlink (&s_lru, entry->link);
+        g_list_free (entry->link);
+        s_memory_bytes -= entry->size;
+        g_hash_table_remove (s_entries, key);
+    }
+
+    memory_evict_to (limit - size);
+
+    entry = g_new0 (CacheEntry, 1);
+    entry->key = g_strdup (key);
+    entry->value = g_strdup (value);
+    entry->size = size;
+    g_queue_push_head (&s_lru, entry);
+    entry->link = s_lru.head;
+    s_memory_bytes += size;
+    g_hash_table_insert (s_entries, entry->key, entry);
+}
+
+static gchar *
+memory_lookup (const gchar *key)
+{
+    CacheEntry *entry = s_entries ? g_hash_table_lookup (s_entries, key) : NULL;
+
+    if (!entry)
+        return NULL;
+
+    /* Mark as most recently used */
+    g_queue_unlink (&s_lru, entry->link);
+    g_queue_push_head_link (&s_lru, entry->link);
+    return g_strdup (entry->value);
+}
+
+/* ============================================================================
+ * DISK TIER
+ * ============================================================================ */
+
+typedef struct {
+    gchar  *path;
+    gint64  mtime;
+    goffset size;
+} DiskEntry;
+
+static gint
+disk_entry_cmp_mtime (gconstpointer a,
+                      gconstpointer b)
+{
+    const DiskEntry *ea = *(DiskEntry * const *) a;
+    const DiskEntry *eb = *(DiskEntry * const *) b;
+    return (ea->mtime > eb->mtime) - (ea->mtime < eb->mtime);
+}
+
+static void
+disk_entry_free (DiskEntry *entry)
+{
+    g_free (entry->path);
+    g_free (entry);
+}
+
+/* Whether @name is an entry of the disk tier, i.e. a key from
+ * translate_cache_make_key(); anything else in the directory is left
+ * alone, including g_file_set_contents() temporaries */
+static gboolean
+disk_is_entry_name (const gchar *name)
+{
+    gsize len = 0;
+
+    for (; name[len]; len++) {
+        if (!g_ascii_isxdigit (name[len]))
+            return FALSE;
+    }
+    return len == (gsize) g_checksum_type_get_length (G_CHECKSUM_SHA256) * 2;
+}
+
+/* Deletes the least recently used entries until the tier fits in @limit */
+static void
+disk_prune (goffset limit)
+{
+    g_autoptr(GDir) dir = g_dir_open (cache_dir (), 0, NULL);
+    g_autoptr(GPtrArray) entries = g_ptr_array_new_with_free_func ((GDestroyNotify) disk_entry_free);
+    const gchar *name;
+    goffset total = 0;
+
+    if (!dir)
+        return;
+
+    while ((name = g_dir_read_name (dir))) {
+        GStatBuf st;
+        DiskEntry *entry;
+        gchar *path;
+
+        if (!disk_is_entry_name (name))
+            continue;
+
+        path = g_build_filename (cache_dir (), name, NULL);
+        if (g_stat (path, &st) != 0 || !S_ISREG (st.st_mode)) {
+            g_free (path);
+            continue;
+        }
+
+        entry = g_new0 (DiskEntry, 1);
+        entry->path = path;
+        entry->mtime = st.st_mtime;
+        entry->size = st.st_size;
+        total += st.st_size;
+        g_ptr_array_add (entries, entry);
+    }
+
+    if (total <= limit)
+        return;
+
+    g_ptr_array_sort (entries, disk_entry_cmp_mtime);
+    for (guint i = 0; i < entries->len && total > limit; i++) {
+        DiskEntry *entry = g_ptr_array_index (entries, i);
+        if (g_unlink (entry->path) == 0)
+            total -= entry->size;
+    }
+}
+
+typedef struct {
+    gchar  *key;
+    gchar  *value;
+    goffset limit;
+} DiskWrite;
+
+static void
+disk_write_free (DiskWrite *write)
+{
+    g_free (write->key);
+    g_free (write->value);
+    g_free (write);
+}
+
+static void
+disk_store_thread (GTask        *task,
+                   gpointer      source_object,
+                   gpointer      task_data,
+                   GCancellable *cancellable)
+{
+    DiskWrite *write = task_data;
+    g_autofree gchar *path = g_build_filename (cache_dir (), write->key, NULL);
+    g_autoptr(GError) error = NULL;
+
+    (void)source_object;
+    (void)cancellable;
+
+    g_mutex_lock (&s_disk_lock);
+    if (g_mkdir_with_parents (cache_dir (), 0700) != 0 ||
+        !g_file_set_contents (path, write->value, -1, &error)) {
+        g_debug ("[translate] Could not write cache entry: %s",
+                 error ? error->message : g_strerror (errno));
+    } else {
+        disk_prune (write->limit);
+    }
+    g_mutex_unlock (&s_disk_lock);
+
+    g_task_return_boolean (task, TRUE);
+}
+
+static gchar *
+disk_lookup (const gchar *key)
+{
+    g_autofree gchar *path = g_build_filename (cache_dir (), key, NULL);
+    gchar *contents = NULL;
+
+    if (!g_file_get_contents (path, &contents, NULL, NULL))
+        return NULL;
+
+    /* Refresh mtime so pruning sees this entry as recently used */
+    g_utime (path, NULL);
+    return contents;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+gchar *
+translate_cache_make_key (const gchar *message_key,
+                          const gchar *body,
+                          const gchar *provider_id,
+                          const gchar *target_lang)
+{
+    g_autoptr(GChecksum) checksum = g_checksum_new (G_CHECKSUM_SHA256);
+    g_autofree gchar *body_hash = NULL;
+
+    g_return_val_if_fail (body != NULL, NULL);
+
+    body_hash = g_compute_checksum_for_string (G_CHECKSUM_SHA256, body, -1);
+
+    /* NUL separators keep ("ab", "c") and ("a", "bc") apart */
+    const gchar *parts[] = { message_key ? message_key : "", body_hash,
+                             provider_id ? provider_id : "", target_lang ? target_lang : "" };
+    for (guint i = 0; i < G_N_ELEMENTS (parts); i++)
+        g_checksum_update (checksum, (const guchar *) parts[i], strlen (parts[i]) + 1);
+
+    return g_strdup (g_checksum_get_string (checksum));
+}
+
+gchar *
+translate_cache_peek (const gchar *key)
+{
+    gchar *value;
+
+    g_return_val_if_fail (key != NULL, NULL);
+
+    value = memory_lookup (key);
+    if (!value && translate_utils_get_cache_disk_size () > 0) {
+        value = disk_lookup (key);
+        if (value)
+            memory_insert (key, value);
+    }
+    return value;
+}
+
+gchar *
+translate_cache_lookup (const gchar *key)
+{
+    gchar *value;
+
+    g_return_val_if_fail (key != NULL, NULL);
+
+    value = translate_cache_peek (key);
+    translate_stats_add_cache_lookup (value != NULL);
+    return value;
+}
+
+void
+translate_cache_store (const gchar *key,
+                       const gchar *translated)
+{
+    g_return_if_fail (key != NULL);
+    g_return_if_fail (translated != NULL);
+
+    gint disk_size = translate_utils_get_cache_disk_size ();
+
+    memory_insert (key, translated);
+
+    if (disk_size <= 0)
+        return;
+
+    DiskWrite *write = g_new0 (DiskWrite, 1);
+    write->key = g_strdup (key);
+    write->value = g_strdup (translated);
+    write->limit = (goffset) disk_size * MIB;
+
+    g_autoptr(GTask) task = g_task_new (NULL, NULL, NULL, NULL);
+    g_task_set_source_tag (task, translate_cache_store);
+    g_task_set_task_data (task, write, (GDestroyNotify) disk_write_free);
+    g_task_run_in_thread (task, disk_store_thread);
+}
+
+void
+translate_cache_shutdown (void)
+{
+    g_queue_clear (&s_lru);
+    g_clear_pointer (&s_entries, g_hash_table_destroy);
+    s_memory_bytes = 0;
+}
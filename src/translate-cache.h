@@ -0,0 +1,77 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-cache.h
+ * Two-tier (memory + disk) cache of whole-message translations
+ */
+
+#ifndef TRANSLATE_CACHE_H
+#define TRANSLATE_CACHE_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * translate_cache_make_key:
+ * @message_key: (nullable): Message identity, e.g. folder URI + UID
+ * @body: The content that is about to be translated
+ * @provider_id: The provider that will translate it
+ * @target_lang: The target language code
+ *
+ * Builds the cache key for one translation. The body is hashed, so an
+ * edited draft or a re-downloaded message with different content never
+ * matches a stale entry.
+ *
+ * Returns: (transfer full): A hex SHA-256 digest. Free with g_free().
+ */
+gchar *translate_cache_make_key (const gchar *message_key,
+                                 const gchar *body,
+                                 const gchar *provider_id,
+                                 const gchar *target_lang);
+
+/**
+ * translate_cache_lookup:
+ * @key: A key from translate_cache_make_key()
+ *
+ * Looks @key up in memory, then on disk. A disk hit is promoted into
+ * the memory tier.
+ *
+ * Counts a hit or miss towards the cache statistics.
+ *
+ * Returns: (transfer full) (nullable): The cached translation, or %NULL
+ */
+gchar *translate_cache_lookup (const gchar *key);
+
+/**
+ * translate_cache_peek:
+ * @key: A key from translate_cache_make_key()
+ *
+ * Like translate_cache_lookup(), but not counted in the cache
+ * statistics: for records the cache keeps beside the translations, such
+ * as the segments translate-thread.c probes for every parent of a reply.
+ *
+ * Returns: (transfer full) (nullable): The cached value, or %NULL
+ */
+gchar *translate_cache_peek (const gchar *key);
+
+/**
+ * translate_cache_store:
+ * @key: A key from translate_cache_make_key()
+ * @translated: The translated content
+ *
+ * Stores a translation in both tiers. The disk write and any pruning of
+ * the disk tier happen on a worker thread.
+ */
+void translate_cache_store (const gchar *key,
+                            const gchar *translated);
+
+/**
+ * translate_cache_shutdown:
+ *
+ * Drops the memory tier. The disk tier is kept for the next session.
+ */
+void translate_cache_shutdown (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_CACHE_H */
@@ -5,79 +5,1008 @@
  *
  * This module centralizes the translation request logic that was previously
  * duplicated in translate-mail-ui.c and translate-browser-extension.c.
+ *
+ * Documents larger than the "window-size" setting are translated window
+ * by window (see translate_segments_split_windows()), one provider job
+ * after the other, so neither the provider nor its helper ever holds more
+ * than one window. The windows' streamed segments are renumbered into one
+ * skeleton for the whole document. Past "max-translate-size" only the
+ * windows up to the limit are translated: the rest of the document follows
+ * untranslated below a notice, and the translated head is cached on its
+ * own so that translate_common_translate_whole_async() carries on from
+ * there instead of starting over.
+ *
+ * Replies are answered partly from the thread (see translate-thread.c):
+ * quoted segments that an earlier message's translation covers are
+ * reused, and only the other segments are translated, as a document of
+ * one marked paragraph each. That document takes the place of the body
+ * from then on: it is windowed, cut at "max-translate-size" and shared by
+ * identical requests like any other, and its stream is renumbered into
+ * the reply's segments.
+ *
+ * With a "hedge-provider" set, interactive jobs are raced against it
+ * (see translate-hedge.c) once the active provider has taken longer than
+ * it usually does. Messages of private accounts are never given to an
+ * online hedge or model fallback.
  */
 
 #ifdef HAVE_CONFIG_H
 #include "config.h"
 #endif
 
+#include <string.h>
 #include <glib.h>
+#include <glib/gi18n-lib.h>
 #include "translate-common.h"
 #include "translate-utils.h"
+#include "translate-scheduler.h"
+#include "translate-cache.h"
+#include "translate-langid.h"
+#include "translate-segment.h"
+#include "translate-thread.h"
+#include "translate-hedge.h"
+#include "translate-stats.h"
 #include "providers/translate-provider.h"
+#include "providers/translate-worker.h"
+
+/* Marks the paragraphs of the document sent for the segments of a reply
+ * that its thread does not cover */
+#define THREAD_FRESH_ATTR "data-translate-fresh"
+
+/* A reply being translated partly from its thread */
+typedef struct {
+    TranslateSegments *segments;
+    GPtrArray         *translations;  /* Reused ones; NULL entries are fresh */
+    GArray            *fresh;         /* guint: the segment of each paragraph sent */
+} ThreadReply;
+
+static void
+thread_reply_free (ThreadReply *reply)
+{
+    translate_segments_free (reply->segments);
+    g_ptr_array_unref (reply->translations);
+    g_array_unref (reply->fresh);
+    g_free (reply);
+}
+
+/*
+ * Identical requests (same cache key) that arrive while the first one is
+ * still running share one provider job. Each caller keeps its own GTask
+ * and may cancel independently; the job itself is only cancelled once
+ * every caller has gone away. Streamed partial output is kept so that a
+ * caller joining late still sees the whole document build up.
+ */
+typedef struct {
+    gchar            *key;
+    gchar            *message_key;  /* For translate_thread_remember(), or NULL */
+    GList            *waiters;      /* Waiter* */
+    GCancellable     *cancellable;  /* Cancels the shared provider job */
+    TranslatePriority priority;
+    gchar            *body_html;    /* Kept for the model fallback */
+    const gchar      *source_lang;  /* Static (translate-langid), or NULL */
+    gchar            *target_lang;
+    gboolean          provisional;  /* Handed to the model fallback; not cached */
+    TranslateProvider *provider;    /* Serves the jobs; the fallback once handed over */
+    gboolean          keep_local;   /* A private account's; no online fallbacks */
+    gboolean          hedged;       /* The running job is raced against "hedge-provider" */
+    gboolean          hedge_won;    /* A window is the hedge's; not cached */
+    ThreadReply      *thread;       /* A reply's, whose fresh part is @body_html; or NULL */
+
+    gchar            *skeleton;     /* Last streamed skeleton, or NULL */
+    guint             n_segments;
+    GPtrArray        *segments;     /* gchar*, streamed segments by index */
+
+    /* Windowed documents: one provider job per window, in order */
+    GArray           *windows;      /* TranslateWindow, NULL if sent whole */
+    guint             window;       /* The window being translated */
+    guint             first_window; /* The first one this request translates */
+    guint             end_window;   /* Stop before this one */
+    GString          *done;         /* Translation of the windows before @window */
+    gchar            *window_skeleton; /* Skeleton of the windows, sent with the first segment */
+    guint             window_n_segments;
+} Inflight;
+
+typedef struct {
+    Inflight           *inflight;
+    GTask              *task;
+    GSource            *cancel_source;  /* Watches the caller's cancellable */
+    TranslateStreamFunc stream_func;
+    gpointer            stream_data;
+} Waiter;
+
+/* cache key → Inflight* */
+static GHashTable *s_inflight;
+
+/* Task data of a successful request: what kind of translation it got */
+#define RESULT_PARTIAL  (1 << 0)  /* Stops at "max-translate-size" */
+
+static void
+waiter_free (Waiter *waiter)
+{
+    if (waiter->cancel_source) {
+        g_source_destroy (waiter->cancel_source);
+        g_source_unref (waiter->cancel_source);
+    }
+    g_clear_object (&waiter->task);
+    g_free (waiter);
+}
+
+static void
+inflight_free (Inflight *inflight)
+{
+    g_list_free_full (inflight->waiters, (GDestroyNotify) waiter_free);
+    g_clear_object (&inflight->cancellable);
+    g_clear_object (&inflight->provider);
+    g_clear_pointer (&inflight->segments, g_ptr_array_unref);
+    g_clear_pointer (&inflight->windows, g_array_unref);
+    g_clear_pointer (&inflight->thread, thread_reply_free);
+    if (inflight->done)
+        g_string_free (inflight->done, TRUE);
+    g_free (inflight->window_skeleton);
+    g_free (inflight->skeleton);
+    g_free (inflight->body_html);
+    g_free (inflight->target_lang);
+    g_free (inflight->message_key);
+    g_free (inflight->key);
+    g_free (inflight);
+}
+
+static gboolean
+on_waiter_cancelled (GCancellable *cancellable,
+                     gpointer      user_data)
+{
+    Waiter *waiter = user_data;
+    Inflight *inflight = waiter->inflight;
+
+    (void)cancellable;
+
+    inflight->waiters = g_list_remove (inflight->waiters, waiter);
+    g_task_return_error_if_cancelled (waiter->task);
+    waiter_free (waiter);
+
+    if (!inflight->waiters) {
+        /* Nobody wants the result any more; stop the provider job. Its
+         * completion callback still owns @inflight and frees it. */
+        g_debug ("[translate] All requests for a translation were cancelled");
+        g_hash_table_remove (s_inflight, inflight->key);
+        g_cancellable_cancel (inflight->cancellable);
+    }
+
+    return G_SOURCE_REMOVE;
+}
+
+/* Brings a newly joined waiter up to date with what was streamed so far */
+static void
+inflight_replay_stream (Inflight *inflight,
+                        Waiter   *waiter)
+{
+    TranslateStreamEvent ev = { 0 };
+
+    if (!waiter->stream_func || !inflight->skeleton)
+        return;
+
+    ev.type = TRANSLATE_STREAM_SKELETON;
+    ev.text = inflight->skeleton;
+    ev.n_segments = inflight->n_segments;
+    waiter->stream_func (&ev, waiter->stream_data);
+
+    ev.type = TRANSLATE_STREAM_SEGMENT;
+    for (guint i = 0; i < inflight->segments->len; i++) {
+        ev.index = i;
+        ev.text = g_ptr_array_index (inflight->segments, i);
+        if (ev.text)
+            waiter->stream_func (&ev, waiter->stream_data);
+    }
+}
+
+static void
+inflight_dispatch_stream (Inflight                   *inflight,
+                          const TranslateStreamEvent *event)
+{
+    if (event->type == TRANSLATE_STREAM_SKELETON) {
+        g_free (inflight->skeleton);
+        inflight->skeleton = g_strdup (event->text);
+        inflight->n_segments = event->n_segments;
+        g_ptr_array_set_size (inflight->segments, 0);
+    } else if (inflight->skeleton) {
+        if (event->index >= inflight->segments->len)
+            g_ptr_array_set_size (inflight->segments, event->index + 1);
+        g_free (g_ptr_array_index (inflight->segments, event->index));
+        g_ptr_array_index (inflight->segments, event->index) = g_strdup (event->text);
+    }
+
+    for (GList *l = inflight->waiters; l; l = l->next) {
+        Waiter *waiter = l->data;
+        if (waiter->stream_func)
+            waiter->stream_func (event, waiter->stream_data);
+    }
+}
+
+/* Passes an event about the document sent on to the waiters. For a reply
+ * the document is its fresh part: callers get the reply's skeleton, with
+ * the reused segments right away, and each fresh segment under its index
+ * in the reply. */
+static void
+inflight_emit_stream (Inflight                   *inflight,
+                      const TranslateStreamEvent *event)
+{
+    ThreadReply *reply = inflight->thread;
+    TranslateStreamEvent ev;
+
+    if (!reply) {
+        inflight_dispatch_stream (inflight, event);
+        return;
+    }
+
+    if (event->type == TRANSLATE_STREAM_SKELETON) {
+        g_autofree gchar *skeleton = translate_segments_build_skeleton (reply->segments);
+
+        ev = (TranslateStreamEvent) {
+            .type = TRANSLATE_STREAM_SKELETON,
+            .text = skeleton,
+            .n_segments = reply->translations->len,
+        };
+        inflight_dispatch_stream (inflight, &ev);
+
+        ev.type = TRANSLATE_STREAM_SEGMENT;
+        for (guint i = 0; i < reply->translations->len; i++) {
+            ev.index = i;
+            ev.text = g_ptr_array_index (reply->translations, i);
+            if (ev.text)
+                inflight_dispatch_stream (inflight, &ev);
+        }
+        return;
+    }
+
+    if (event->index >= reply->fresh->len)
+        return;
+    ev = *event;
+    ev.index = g_array_index (reply->fresh, guint, event->index);
+    inflight_dispatch_stream (inflight, &ev);
+}
+
+static void
+on_inflight_stream (const TranslateStreamEvent *event,
+                    gpointer                    user_data)
+{
+    Inflight *inflight = user_data;
+    const TranslateWindow *window, *first;
+    TranslateStreamEvent ev;
+
+    if (!inflight->windows) {
+        inflight_emit_stream (inflight, event);
+        return;
+    }
+
+    /* Each window's job streams its own skeleton and numbering; callers
+     * get one skeleton for all windows instead, once there is something
+     * translated to show in it */
+    window = &g_array_index (inflight->windows, TranslateWindow, inflight->window);
+    if (event->type == TRANSLATE_STREAM_SKELETON || event->index >= window->n_segments)
+        return;
+
+    if (inflight->window_skeleton) {
+        g_autofree gchar *skeleton = g_steal_pointer (&inflight->window_skeleton);
+
+        ev = (TranslateStreamEvent) {
+            .type = TRANSLATE_STREAM_SKELETON,
+            .text = skeleton,
+            .n_segments = inflight->window_n_segments,
+        };
+        inflight_emit_stream (inflight, &ev);
+    }
+
+    /* A reply's paragraphs are numbered from the start of its fresh part */
+    first = &g_array_index (inflight->windows, TranslateWindow, inflight->thread ? 0 : inflight->first_window);
+    ev = *event;
+    ev.index += window->first_segment - first->first_segment;
+    inflight_emit_stream (inflight, &ev);
+}
+
+static void
+inflight_add_waiter (Inflight           *inflight,
+                     GTask              *task,
+                     TranslateStreamFunc stream_func,
+                     gpointer            stream_data)
+{
+    Waiter *waiter = g_new0 (Waiter, 1);
+    GCancellable *cancellable = g_task_get_cancellable (task);
+
+    waiter->inflight = inflight;
+    waiter->task = task;
+    waiter->stream_func = stream_func;
+    waiter->stream_data = stream_data;
+    if (cancellable) {
+        waiter->cancel_source = g_cancellable_source_new (cancellable);
+        g_source_set_callback (waiter->cancel_source, (GSourceFunc) on_waiter_cancelled, waiter, NULL);
+        g_source_attach (waiter->cancel_source, NULL);
+    }
+    inflight->waiters = g_list_append (inflight->waiters, waiter);
+    inflight_replay_stream (inflight, waiter);
+}
+
+static void on_scheduled_done (GObject      *source,
+                               GAsyncResult *res,
+                               gpointer      user_data);
+
+/* Bounds of the automatic "hedge-delay", and the delay before the
+ * provider was timed at all */
+#define HEDGE_MIN_DELAY_MS      300
+#define HEDGE_MAX_DELAY_MS      10000
+#define HEDGE_DEFAULT_DELAY_MS  2000
+
+/* Whether @provider keeps the text on this machine, and may therefore
+ * stand in for the active one on a private account's message */
+static gboolean
+provider_is_offline (TranslateProvider *provider)
+{
+    TranslateProviderCapabilities caps = { 0 };
+
+    translate_provider_get_capabilities (provider, &caps);
+    return caps.offline;
+}
+
+/* The "hedge-provider" to race the job against, or NULL. Background jobs
+ * are not worth twice the work, and the model fallback stays alone. */
+static TranslateProvider *
+inflight_hedge_provider (Inflight *inflight)
+{
+    g_autofree gchar *hedge_id = NULL;
+    TranslateProvider *hedge;
+
+    if (inflight->priority != TRANSLATE_PRIORITY_INTERACTIVE || inflight->provisional)
+        return NULL;
+
+    hedge_id = translate_utils_get_hedge_provider ();
+    if (!*hedge_id || g_strcmp0 (hedge_id, translate_provider_get_id (inflight->provider)) == 0 ||
+        !(hedge = translate_provider_get_shared (hedge_id)))
+        return NULL;
+
+    if (inflight->keep_local && !provider_is_offline (hedge))
+        return NULL;
+    return hedge;
+}
+
+/* "hedge-delay", or the time @provider usually answers within */
+static guint
+hedge_delay_ms (TranslateProvider *provider)
+{
+    gint delay = translate_utils_get_hedge_delay ();
+    gint64 estimate;
+
+    if (delay > 0)
+        return delay;
+
+    estimate = translate_stats_get_latency_estimate (translate_provider_get_id (provider));
+    if (estimate <= 0)
+        return HEDGE_DEFAULT_DELAY_MS;
+    return CLAMP (estimate / 1000, HEDGE_MIN_DELAY_MS, HEDGE_MAX_DELAY_MS);
+}
+
+/* Queues the job for the current window, or for the whole document */
+static void
+inflight_submit (Inflight *inflight)
+{
+    g_autofree gchar *window_html = NULL;
+    const gchar *input = inflight->body_html;
+    TranslateProvider *hedge = inflight_hedge_provider (inflight);
+
+    if (inflight->windows) {
+        const TranslateWindow *window = &g_array_index (inflight->windows, TranslateWindow, inflight->window);
+        input = window_html = g_strndup (inflight->body_html + window->offset, window->length);
+    }
+
+    /* The scheduler keeps its own references to the provider and copies
+     * of the strings until the job completes */
+    inflight->hedged = hedge != NULL;
+    if (hedge) {
+        translate_hedge_submit_async (inflight->provider,
+                                      hedge,
+                                      hedge_delay_ms (inflight->provider),
+                                      input,
+                                      TRUE,  /* is_html */
+                                      inflight->source_lang,
+                                      inflight->target_lang,
+                                      inflight->priority,
+                                      on_inflight_stream,
+                                      inflight,
+                                      inflight->cancellable,
+                                      on_scheduled_done,
+                                      inflight);
+        return;
+    }
+
+    translate_scheduler_submit_async (inflight->provider,
+                                      input,
+                                      TRUE,  /* is_html */
+                                      inflight->source_lang,
+                                      inflight->target_lang,
+                                      inflight->priority,
+                                      on_inflight_stream,
+                                      inflight,
+                                      inflight->cancellable,
+                                      on_scheduled_done,
+                                      inflight);
+}
+
+/* The provider's model for this document is still downloading: hand the
+ * job to the "model-fallback" provider, if one is set. Its translation
+ * stands in until the model is there and is not cached, so the next
+ * request gets the real one; later windows go to it too. Returns FALSE
+ * if there is no fallback, or it is online and the account private. */
+static gboolean
+inflight_submit_fallback (Inflight *inflight)
+{
+    g_autofree gchar *fallback_id = translate_utils_get_model_fallback ();
+    TranslateProvider *fallback;
+
+    if (inflight->provisional || !*fallback_id ||
+        g_cancellable_is_cancelled (inflight->cancellable) ||
+        !(fallback = translate_provider_get_shared (fallback_id)) ||
+        (inflight->keep_local && !provider_is_offline (fallback)))
+        return FALSE;
+
+    g_debug ("[translate] Model still downloading, translating with %s meanwhile", fallback_id);
+    inflight->provisional = TRUE;
+    g_set_object (&inflight->provider, fallback);
+    inflight_submit (inflight);
+    return TRUE;
+}
+
+/* Whether the request stops at "max-translate-size", before the last window */
+static gboolean
+inflight_is_partial (Inflight *inflight)
+{
+    return inflight->windows && inflight->end_window < inflight->windows->len;
+}
+
+/* Returns (transfer full) the notice that translation stopped after
+ * @translated bytes */
+static gchar *
+partial_notice (gsize translated)
+{
+    g_autofree gchar *size = g_format_size (translated);
+    g_autofree gchar *text = g_strdup_printf (_("Only the first %s of this message have been translated. "
+                                                "Choose Translate Message again to translate the rest."), size);
+    g_autofree gchar *escaped = g_markup_escape_text (text, -1);
+
+    return g_strconcat ("<div style=\"margin: 1em 0; padding: 0.5em 1em; border: 1px solid #c8b560;"
+                        " background: #fff8d6; color: #000;\">", escaped, "</div>", NULL);
+}
+
+/* The translated head of a document, a notice, and the rest of the
+ * document from @rest on as it is */
+static gchar *
+compose_partial (const gchar           *body_html,
+                 const TranslateWindow *rest,
+                 const gchar           *head)
+{
+    g_autofree gchar *notice = partial_notice (rest->offset);
+
+    return g_strconcat (head, notice, body_html + rest->offset, NULL);
+}
+
+/* Takes the paragraphs of @translated, the fresh part of @reply or the
+ * head of it, into the translations of their segments. A paragraph the
+ * provider mangled keeps its original text. */
+static void
+thread_reply_fill (ThreadReply *reply,
+                   const gchar *translated)
+{
+    const gchar *p = translated;
+
+    while ((p = strstr (p, THREAD_FRESH_ATTR "=\""))) {
+        const gchar *text = strchr (p, '>');
+        const gchar *end = text ? strstr (text, "</p>") : NULL;
+        guint64 index = g_ascii_strtoull (p + strlen (THREAD_FRESH_ATTR "=\""), NULL, 10);
+        g_autofree gchar *paragraph = NULL;
+        g_autoptr(TranslateSegments) parsed = NULL;
+
+        if (!end)
+            break;
+        p = end;
+        if (index >= reply->translations->len || g_ptr_array_index (reply->translations, index))
+            continue;
+
+        paragraph = g_strndup (text + 1, end - text - 1);
+        parsed = translate_segments_parse (paragraph);
+        if (translate_segments_get_count (parsed) == 1)
+            g_ptr_array_index (reply->translations, index) = g_strdup (translate_segments_get_text (parsed, 0));
+    }
+}
+
+/* Returns (transfer full) the reply with every segment that has a
+ * translation replaced by it. With @rest, where "max-translate-size" cut
+ * its fresh part, the segments from there on keep their text and the
+ * notice follows. */
+static gchar *
+thread_reply_compose (ThreadReply           *reply,
+                      const TranslateWindow *rest)
+{
+    g_autofree gchar *translated = translate_segments_rebuild (reply->segments,
+                                                               (const gchar * const *) reply->translations->pdata,
+                                                               reply->translations->len);
+    g_autofree gchar *notice = NULL;
+
+    if (!rest)
+        return g_steal_pointer (&translated);
+    notice = partial_notice (rest->offset);
+    return g_strconcat (translated, notice, NULL);
+}
+
+static void
+on_scheduled_done (GObject      *source,
+                   GAsyncResult *res,
+                   gpointer      user_data)
+{
+    Inflight *inflight = user_data;
+    g_autoptr(GError) error = NULL;
+    g_autofree gchar *translated = NULL;
+    gboolean ok, partial, by_hedge = FALSE;
+
+    (void)source;
+
+    if (inflight->hedged)
+        ok = translate_hedge_submit_finish (res, &translated, &by_hedge, &error);
+    else
+        ok = translate_scheduler_submit_finish (res, &translated, &error);
+
+    /* Like the model fallback's, the hedge's translation is not cached
+     * under the active provider's name */
+    if (by_hedge)
+        inflight->hedge_won = TRUE;
+    if (!ok && g_error_matches (error, TRANSLATE_WORKER_ERROR, TRANSLATE_WORKER_ERROR_MODEL_PENDING) &&
+        inflight_submit_fallback (inflight))
+        return;
+
+    if (ok && inflight->windows) {
+        g_string_append (inflight->done, translated);
+        g_clear_pointer (&translated, g_free);
+
+        if (++inflight->window < inflight->end_window &&
+            !g_cancellable_set_error_if_cancelled (inflight->cancellable, &error)) {
+            inflight_submit (inflight);
+            return;
+        }
+        ok = error == NULL;
+    }
+
+    /* Still registered unless every waiter cancelled */
+    if (s_inflight && g_hash_table_lookup (s_inflight, inflight->key) == inflight)
+        g_hash_table_steal (s_inflight, inflight->key);
+
+    partial = inflight_is_partial (inflight);
+    if (ok && inflight->thread) {
+        thread_reply_fill (inflight->thread, inflight->windows ? inflight->done->str : translated);
+        g_free (translated);
+        translated = thread_reply_compose (inflight->thread,
+                                           partial ? &g_array_index (inflight->windows, TranslateWindow,
+                                                                     inflight->end_window) : NULL);
+    } else if (ok && inflight->windows) {
+        if (partial)
+            translated = compose_partial (inflight->body_html,
+                                          &g_array_index (inflight->windows, TranslateWindow, inflight->end_window),
+                                          inflight->done->str);
+        else
+            translated = g_strdup (inflight->done->str);
+    }
+
+    /* A partial translation is cached as its head, for the whole request
+     * to carry on from */
+    if (ok && !inflight->provisional && !inflight->hedge_won) {
+        translate_cache_store (inflight->key, partial ? inflight->done->str : translated);
+        if (!partial && inflight->thread)
+            translate_thread_remember (inflight->message_key, translate_provider_get_id (inflight->provider),
+                                       inflight->target_lang, inflight->thread->segments,
+                                       (const gchar * const *) inflight->thread->translations->pdata);
+        else if (!partial)
+            translate_thread_remember_html (inflight->message_key,
+                                            translate_provider_get_id (inflight->provider),
+                                            inflight->target_lang, inflight->body_html, translated);
+    }
+
+    for (GList *l = inflight->waiters; l; l = l->next) {
+        Waiter *waiter = l->data;
+        if (error) {
+            g_task_return_error (waiter->task, g_error_copy (error));
+        } else {
+            g_task_set_task_data (waiter->task, GINT_TO_POINTER (partial ? RESULT_PARTIAL : 0), NULL);
+            g_task_return_pointer (waiter->task, g_strdup (translated), g_free);
+        }
+    }
+
+    inflight_free (inflight);
+}
+
+/* Looks up the quotes of the reply @body_html in what @parent_keys kept.
+ * Returns NULL if none are covered, otherwise the reply along with the
+ * document of its other segments, to be sent instead, in @out_fresh
+ * (empty if every segment is covered). */
+static ThreadReply *
+thread_reply_new (const gchar         *body_html,
+                  const gchar         *message_key,
+                  const gchar * const *parent_keys,
+                  const gchar         *provider_id,
+                  const gchar         *target_lang,
+                  gchar              **out_fresh)
+{
+    TranslateSegments *segments = translate_segments_parse (body_html);
+    GPtrArray *translations;
+    ThreadReply *reply;
+    GString *fresh;
+    guint reused;
+
+    translations = translate_thread_reuse (parent_keys, provider_id, target_lang, segments, &reused);
+    if (!translations) {
+        translate_segments_free (segments);
+        return NULL;
+    }
+
+    reply = g_new0 (ThreadReply, 1);
+    reply->segments = segments;
+    reply->translations = translations;
+    reply->fresh = g_array_new (FALSE, FALSE, sizeof (guint));
+
+    fresh = g_string_new (NULL);
+    for (guint i = 0; i < translations->len; i++) {
+        g_autofree gchar *escaped = NULL;
+
+        if (g_ptr_array_index (translations, i))
+            continue;
+        escaped = g_markup_escape_text (translate_segments_get_text (segments, i), -1);
+        g_string_append_printf (fresh, "<p " THREAD_FRESH_ATTR "=\"%u\">%s</p>\n", i, escaped);
+        g_array_append_val (reply->fresh, i);
+    }
+
+    g_debug ("[translate] Reusing %u of %u segments of %s from its thread",
+             reused, translations->len, message_key ? message_key : "(unknown message)");
+
+    *out_fresh = g_string_free (fresh, FALSE);
+    return reply;
+}
+
+/* Number of @windows that start before @limit; at least the first */
+static guint
+windows_before (GArray *windows,
+                gsize   limit)
+{
+    guint n = 1;
+
+    while (n < windows->len && g_array_index (windows, TranslateWindow, n).offset < limit)
+        n++;
+    return n;
+}
+
+static void
+common_translate (const gchar         *body_html,
+                  const gchar         *message_key,
+                  const gchar * const *parent_keys,
+                  const gchar         *source_lang,
+                  TranslatePriority    priority,
+                  TranslateRequestFlags flags,
+                  gboolean             whole,
+                  TranslateStreamFunc  stream_func,
+                  gpointer             stream_data,
+                  GCancellable        *cancellable,
+                  GAsyncReadyCallback  callback,
+                  gpointer             user_data,
+                  gpointer             source_tag)
+{
+    g_return_if_fail (body_html != NULL);
+    g_return_if_fail (*body_html != '\0');
+    g_return_if_fail (callback != NULL);
+
+    GTask *task = g_task_new (NULL, cancellable, callback, user_data);
+    g_task_set_source_tag (task, source_tag);
+
+    /* Get target language from settings - properly managed memory */
+    g_autofree gchar *target_lang = translate_utils_get_target_language ();
+
+    /* Nothing to translate: no provider, helper or network needed */
+    if (source_lang && translate_langid_same_language (source_lang, target_lang)) {
+        g_debug ("[translate] %s is already in %s", message_key ? message_key : "Message", target_lang);
+        g_task_return_pointer (task, g_strdup (body_html), g_free);
+        g_object_unref (task);
+        return;
+    }
+
+    /* The shared provider instance named by the settings */
+    TranslateProvider *provider = translate_provider_get_active ();
+    if (!provider) {
+        g_autofree gchar *provider_id = translate_utils_get_provider_id ();
+        g_task_return_new_error (task, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                                 "No translation provider named '%s'", provider_id);
+        g_object_unref (task);
+        return;
+    }
+    const gchar *provider_id = translate_provider_get_id (provider);
+
+    if (g_task_return_error_if_cancelled (task)) {
+        g_object_unref (task);
+        return;
+    }
+
+    /* A cache hit never reaches the provider (no helper, no network) */
+    g_autofree gchar *cache_key = translate_cache_make_key (message_key, body_html, provider_id, target_lang);
+
+    gchar *cached = translate_cache_lookup (cache_key);
+    if (cached) {
+        g_debug ("[translate] Cache hit for %s", message_key ? message_key : "(unknown message)");
+        g_task_return_pointer (task, cached, g_free);
+        g_object_unref (task);
+        return;
+    }
+
+    /* Quotes the thread already translated are not sent again: what is
+     * left goes through the rest of the way in place of @body_html */
+    g_autofree gchar *fresh_html = NULL;
+    ThreadReply *reply = parent_keys ?
+        thread_reply_new (body_html, message_key, parent_keys, provider_id, target_lang, &fresh_html) : NULL;
+    if (reply && !*fresh_html) {
+        gchar *translated = thread_reply_compose (reply, NULL);
+
+        translate_cache_store (cache_key, translated);
+        translate_thread_remember (message_key, provider_id, target_lang, reply->segments,
+                                   (const gchar * const *) reply->translations->pdata);
+        thread_reply_free (reply);
+        g_task_return_pointer (task, translated, g_free);
+        g_object_unref (task);
+        return;
+    }
+    if (reply)
+        body_html = fresh_html;
+
+    /* Windows never exceed the limit, so the cut falls between two */
+    gsize length = strlen (body_html);
+    gsize limit = translate_utils_get_max_translate_size ();
+    gsize window_size = translate_utils_get_window_size ();
+    if (limit > 0)
+        window_size = window_size > 0 ? MIN (window_size, limit) : limit;
+
+    g_autoptr(GArray) windows = NULL;
+    g_autofree gchar *head = NULL;
+    g_autofree gchar *window_skeleton = NULL;
+    guint first_window = 0, end_window = 0, window_n_segments = 0;
+
+    if (window_size > 0 && length > window_size) {
+        g_autoptr(TranslateSegments) segments = translate_segments_parse (body_html);
+        guint cut;
+
+        windows = translate_segments_split_windows (segments, window_size);
+        end_window = windows->len;
+        cut = limit > 0 && length > limit ? windows_before (windows, limit) : windows->len;
+
+        if (cut < windows->len) {
+            /* The head up to the cut, as translated by an earlier request;
+             * the window size decides where the cut falls, so it is part
+             * of the key */
+            g_autofree gchar *head_key = g_strdup_printf ("%s-head-%" G_GSIZE_FORMAT "-%" G_GSIZE_FORMAT,
+                                                          cache_key, window_size, limit);
+
+            head = translate_cache_lookup (head_key);
+            /* The reply's skeleton shows the head's segments from the start */
+            if (head && reply)
+                thread_reply_fill (reply, head);
+            if (!whole) {
+                end_window = cut;
+                if (head) {
+                    const TranslateWindow *rest = &g_array_index (windows, TranslateWindow, cut);
+
+                    g_debug ("[translate] Cache hit for the first part of %s",
+                             message_key ? message_key : "(unknown message)");
+                    g_task_set_task_data (task, GINT_TO_POINTER (RESULT_PARTIAL), NULL);
+                    g_task_return_pointer (task,
+                                           reply ? thread_reply_compose (reply, rest) :
+                                                   compose_partial (body_html, rest, head),
+                                           g_free);
+                    g_clear_pointer (&reply, thread_reply_free);
+                    g_object_unref (task);
+                    return;
+                }
+                g_free (cache_key);
+                cache_key = g_steal_pointer (&head_key);
+            } else if (head) {
+                first_window = cut;
+            }
+        }
+
+        /* Streaming callers get one skeleton for the windows still to do,
+         * after the translated head */
+        if (stream_func) {
+            g_autofree gchar *skeleton = NULL;
+
+            if (first_window > 0) {
+                g_clear_pointer (&segments, translate_segments_free);
+                segments = translate_segments_parse (body_html + g_array_index (windows, TranslateWindow, first_window).offset);
+            }
+            skeleton = translate_segments_build_skeleton (segments);
+            window_skeleton = g_strconcat (head ? head : "", skeleton, NULL);
+            window_n_segments = translate_segments_get_count (segments);
+        }
+
+        g_debug ("[translate] Translating %s in windows %u to %u of %u",
+                 message_key ? message_key : "(unknown message)", first_window + 1, end_window, windows->len);
+    }
+
+    if (!s_inflight)
+        s_inflight = g_hash_table_new (g_str_hash, g_str_equal);
+
+    Inflight *inflight = g_hash_table_lookup (s_inflight, cache_key);
+    if (inflight) {
+        g_debug ("[translate] Joining running translation of %s",
+                 message_key ? message_key : "(unknown message)");
+        g_clear_pointer (&reply, thread_reply_free);
+        inflight_add_waiter (inflight, task, stream_func, stream_data);
+        /* The windows still to come stay on this machine */
+        if (flags & TRANSLATE_REQUEST_PRIVATE)
+            inflight->keep_local = TRUE;
+        if (priority < inflight->priority) {
+            /* Someone is now waiting for a prefetch: move it up */
+            inflight->priority = priority;
+            translate_scheduler_promote (inflight->cancellable);
+        }
+        return;
+    }
+
+    inflight = g_new0 (Inflight, 1);
+    inflight->key = g_steal_pointer (&cache_key);
+    inflight->message_key = g_strdup (message_key);
+    inflight->cancellable = g_cancellable_new ();
+    inflight->priority = priority;
+    inflight->body_html = g_strdup (body_html);
+    inflight->source_lang = source_lang;
+    inflight->target_lang = g_strdup (target_lang);
+    inflight->provider = g_object_ref (provider);
+    inflight->keep_local = (flags & TRANSLATE_REQUEST_PRIVATE) != 0;
+    inflight->thread = reply;
+    inflight->segments = g_ptr_array_new_with_free_func (g_free);
+    if (windows) {
+        inflight->windows = g_steal_pointer (&windows);
+        inflight->window = inflight->first_window = first_window;
+        inflight->end_window = end_window;
+        inflight->done = g_string_new (head);
+        inflight->window_skeleton = g_steal_pointer (&window_skeleton);
+        inflight->window_n_segments = window_n_segments;
+    }
+    inflight_add_waiter (inflight, task, stream_func, stream_data);
+    g_hash_table_insert (s_inflight, inflight->key, inflight);
+
+    inflight_submit (inflight);
+}
 
 /**
  * translate_common_translate_async:
  * @body_html: The HTML content to translate
+ * @message_key: (nullable): Stable identity of the message, for caching
+ * @parent_keys: (nullable) (array zero-terminated=1): Keys of the messages
+ *   this one replies to, nearest first, whose translations its quotes reuse
+ * @source_lang: (nullable): Language of @body_html if known (see
+ *   translate_langid_detect()), or %NULL to let the provider detect it
+ * @priority: Scheduling priority of the request
+ * @flags: Restrictions on where @body_html may be sent
+ * @stream_func: (nullable): Receives partial output while the provider works
+ * @stream_data: User data for @stream_func; must stay valid until @callback runs
+ * @cancellable: (nullable): Cancels this request
  * @callback: (scope async): Callback to invoke when translation completes
  * @user_data: User data to pass to the callback
  *
  * Initiates an asynchronous translation of the provided HTML content.
+ * Cache hits are returned without any partial output.
  *
  * This is the centralized translation request function that handles:
  * 1. Validating input
  * 2. Retrieving target language from settings (via translate_utils)
- * 3. Creating the translation provider ("argos" by default)
- * 4. Initiating the async translation with proper parameters
- * 5. Proper memory management (no leaks!)
+ * 3. Answering a document already in the target language with itself
+ * 4. Answering from the translation cache when possible
+ * 5. Splitting large documents into windows, and stopping at
+ *    "max-translate-size" (see translate_common_translate_is_partial())
+ * 6. Joining an identical request that is already running
+ * 7. Using the shared instance of the configured provider ("google" by default)
+ * 8. Queueing the request with the scheduler at @priority, racing a slow
+ *    interactive one against "hedge-provider" unless @flags forbid it
+ * 9. Proper memory management (no leaks!)
  *
  * The callback signature should be:
  *   void callback (GObject *source_object, GAsyncResult *result, gpointer user_data)
  *
- * In your callback, use translate_provider_translate_finish() to retrieve
+ * In your callback, use translate_common_translate_finish() to retrieve
  * the translated text.
  */
 void
 translate_common_translate_async (const gchar         *body_html,
+                                  const gchar         *message_key,
+                                  const gchar * const *parent_keys,
+                                  const gchar         *source_lang,
+                                  TranslatePriority    priority,
+                                  TranslateRequestFlags flags,
+                                  TranslateStreamFunc  stream_func,
+                                  gpointer             stream_data,
+                                  GCancellable        *cancellable,
                                   GAsyncReadyCallback  callback,
                                   gpointer             user_data)
 {
-    g_return_if_fail (body_html != NULL);
-    g_return_if_fail (*body_html != '\0');
-    g_return_if_fail (callback != NULL);
+    common_translate (body_html, message_key, parent_keys, source_lang, priority, flags, FALSE,
+                      stream_func, stream_data, cancellable, callback, user_data,
+                      translate_common_translate_async);
+}
 
-    /* Get target language from settings - properly managed memory */
-    g_autofree gchar *target_lang = translate_utils_get_target_language ();
+/**
+ * translate_common_translate_whole_async:
+ * @body_html: The HTML content to translate
+ * @message_key: (nullable): Stable identity of the message, for caching
+ * @parent_keys: (nullable) (array zero-terminated=1): Keys of the messages
+ *   this one replies to
+ * @source_lang: (nullable): Language of @body_html if known
+ * @priority: Scheduling priority of the request
+ * @flags: Restrictions on where @body_html may be sent
+ * @stream_func: (nullable): Receives partial output while the provider works
+ * @stream_data: User data for @stream_func; must stay valid until @callback runs
+ * @cancellable: (nullable): Cancels this request
+ * @callback: (scope async): Callback to invoke when translation completes
+ * @user_data: User data to pass to the callback
+ *
+ * Like translate_common_translate_async(), but translates all of a
+ * document larger than "max-translate-size". If its head was translated
+ * by an earlier partial request, only the rest is sent to the provider.
+ */
+void
+translate_common_translate_whole_async (const gchar         *body_html,
+                                        const gchar         *message_key,
+                                        const gchar * const *parent_keys,
+                                        const gchar         *source_lang,
+                                        TranslatePriority    priority,
+                                        TranslateRequestFlags flags,
+                                        TranslateStreamFunc  stream_func,
+                                        gpointer             stream_data,
+                                        GCancellable        *cancellable,
+                                        GAsyncReadyCallback  callback,
+                                        gpointer             user_data)
+{
+    common_translate (body_html, message_key, parent_keys, source_lang, priority, flags, TRUE,
+                      stream_func, stream_data, cancellable, callback, user_data,
+                      translate_common_translate_whole_async);
+}
 
-    /* Get provider ID from settings */
-    g_autofree gchar *provider_id = translate_utils_get_provider_id ();
-    if (!provider_id || !*provider_id) {
-        provider_id = g_strdup ("google");  /* Default to google if not set */
-    }
+/**
+ * translate_common_translate_finish:
+ * @res: The #GAsyncResult passed to the callback
+ * @out_translated: (out) (transfer full): The translated HTML
+ * @error: Return location for a #GError
+ *
+ * Finishes a request started with translate_common_translate_async().
+ *
+ * Returns: TRUE on success, FALSE on error
+ */
+gboolean
+translate_common_translate_finish (GAsyncResult *res,
+                                   gchar       **out_translated,
+                                   GError      **error)
+{
+    g_return_val_if_fail (g_task_is_valid (res, NULL), FALSE);
 
-    /* Create the translation provider */
-    g_autoptr(GObject) provider_obj = translate_provider_new_by_id (provider_id);
-    if (!provider_obj) {
-        g_warning ("[translate] No provider found for '%s'", provider_id);
-        return;
-    }
+    gchar *ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_translated)
+        *out_translated = ret;
+    else
+        g_free (ret);
+    return ret != NULL;
+}
+
+/**
+ * translate_common_translate_is_partial:
+ * @res: The #GAsyncResult passed to the callback
+ *
+ * After a successful translate_common_translate_finish(): whether the
+ * document was only translated up to "max-translate-size". The rest
+ * follows untranslated below a notice; translate it with
+ * translate_common_translate_whole_async().
+ *
+ * Returns: TRUE if only the start of the document was translated
+ */
+gboolean
+translate_common_translate_is_partial (GAsyncResult *res)
+{
+    g_return_val_if_fail (g_task_is_valid (res, NULL), FALSE);
 
-    /* Initiate async translation
-     * Note: The provider will copy the target_lang internally, so we don't leak it.
-     * Our g_autofree will clean it up when this function exits.
-     */
-    translate_provider_translate_async ((TranslateProvider*)provider_obj,
-                                        body_html,
-                                        TRUE,  /* is_html */
-                                        NULL,  /* source (auto-detect) */
-                                        target_lang,
-                                        NULL,  /* cancellable */
-                                        callback,
-                                        user_data);
-
-    /* Note: provider_obj stays alive during the async operation because
-     * translate_provider_translate_async takes a reference to it internally.
-     * Our g_autoptr will release our reference when this function exits,
-     * but the async operation holds its own reference until completion.
-     */
+    return (GPOINTER_TO_INT (g_task_get_task_data (G_TASK (res))) & RESULT_PARTIAL) != 0;
 }
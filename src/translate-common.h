@@ -10,28 +10,111 @@
 #include <glib.h>
 #include <gio/gio.h>
 #include "providers/translate-provider.h"
+#include "translate-scheduler.h"
 
 G_BEGIN_DECLS
 
+/**
+ * TranslateRequestFlags:
+ * @TRANSLATE_REQUEST_NONE: No restrictions
+ * @TRANSLATE_REQUEST_PRIVATE: The message is from a private account (see
+ *   translate_utils_is_private_account()): besides the active provider,
+ *   only offline ones may see it
+ */
+typedef enum {
+    TRANSLATE_REQUEST_NONE    = 0,
+    TRANSLATE_REQUEST_PRIVATE = 1 << 0
+} TranslateRequestFlags;
+
 /**
  * translate_common_translate_async:
  * @body_html: The HTML content to translate
+ * @message_key: (nullable): Stable identity of the message, for caching
+ * @parent_keys: (nullable) (array zero-terminated=1): Keys of the messages
+ *   this one replies to, nearest first (see #TranslateContent)
+ * @source_lang: (nullable): Language of @body_html if known (see
+ *   translate_langid_detect()), or %NULL to let the provider detect it
+ * @priority: Scheduling priority of the request
+ * @flags: Restrictions on where @body_html may be sent
+ * @stream_func: (nullable): Receives partial output while the provider works
+ * @stream_data: User data for @stream_func; must stay valid until @callback runs
+ * @cancellable: (nullable): Cancels this request
  * @callback: (scope async): Callback to invoke when translation completes
  * @user_data: User data to pass to the callback
  *
  * Initiates an asynchronous translation of the provided HTML content.
  * This function handles:
  * - Retrieving the target language from settings
+ * - Answering a document already in the target language with itself
+ * - Answering repeat requests from the translation cache
+ * - Reusing the translations of earlier messages in the thread for the
+ *   quotes of a reply, so only its new text is sent
+ * - Translating documents larger than "window-size" window by window, and
+ *   only up to "max-translate-size" (see translate_common_translate_is_partial())
+ * - Sharing one provider job between identical concurrent requests; the
+ *   job is cancelled once all of them are
+ * - Forwarding streamed partial output to @stream_func
  * - Creating the appropriate translation provider
- * - Initiating the async translation operation
+ * - Queueing the request with the scheduler at @priority
+ * - Asking "hedge-provider" too when an interactive request is slow,
+ *   unless @flags forbid sending it there
  * - Proper memory management (fixes the target_lang_copy leak)
  *
  * The callback will be invoked with the translation results.
- * Use translate_provider_translate_finish() in your callback to get the results.
+ * Use translate_common_translate_finish() in your callback to get the results.
  */
-void translate_common_translate_async (const gchar     *body_html,
+void translate_common_translate_async (const gchar        *body_html,
+                                       const gchar        *message_key,
+                                       const gchar * const *parent_keys,
+                                       const gchar        *source_lang,
+                                       TranslatePriority   priority,
+                                       TranslateRequestFlags flags,
+                                       TranslateStreamFunc stream_func,
+                                       gpointer            stream_data,
+                                       GCancellable       *cancellable,
                                        GAsyncReadyCallback callback,
-                                       gpointer         user_data);
+                                       gpointer            user_data);
+
+/**
+ * translate_common_translate_whole_async:
+ *
+ * Like translate_common_translate_async(), but translates all of a
+ * document larger than "max-translate-size", carrying on after the head
+ * an earlier partial translation left in the cache.
+ */
+void translate_common_translate_whole_async (const gchar        *body_html,
+                                             const gchar        *message_key,
+                                             const gchar * const *parent_keys,
+                                             const gchar        *source_lang,
+                                             TranslatePriority   priority,
+                                             TranslateRequestFlags flags,
+                                             TranslateStreamFunc stream_func,
+                                             gpointer            stream_data,
+                                             GCancellable       *cancellable,
+                                             GAsyncReadyCallback callback,
+                                             gpointer            user_data);
+
+/**
+ * translate_common_translate_finish:
+ * @res: The #GAsyncResult passed to the callback
+ * @out_translated: (out) (transfer full): The translated HTML
+ * @error: Return location for a #GError
+ *
+ * Returns: TRUE on success, FALSE on error
+ */
+gboolean translate_common_translate_finish (GAsyncResult *res,
+                                            gchar       **out_translated,
+                                            GError      **error);
+
+/**
+ * translate_common_translate_is_partial:
+ * @res: The #GAsyncResult passed to the callback
+ *
+ * Returns: TRUE if only the start of the document, up to
+ *   "max-translate-size", was translated; the rest follows untranslated
+ *   below a notice
+ */
+gboolean translate_common_translate_is_partial (GAsyncResult *res);
 
 G_END_DECLS
 
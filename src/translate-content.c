@@ -11,143 +11,169 @@
 #include <mail/e-mail-view.h>
 #include <mail/e-mail-paned-view.h>
 #include <mail/message-list.h>
+#include <libemail-engine/libemail-engine.h>
 
 #include "translate-content.h"
+#include "translate-stats.h"
+#include "translate-utils.h"
 
-static gboolean
-content_type_is (CamelMimePart *part, const gchar *type, const gchar *subtype)
+/* Without a Message-ID, folder URI + UID identify the message */
+static gchar *
+make_fallback_key (CamelFolder *folder,
+                   const gchar *uid)
 {
-    CamelContentType *ct = camel_mime_part_get_content_type (part);
-    return ct && camel_content_type_is (ct, type, subtype);
+    g_autofree gchar *folder_uri = e_mail_folder_uri_from_folder (folder);
+    return g_strconcat (folder_uri ? folder_uri : "", "#", uid, NULL);
 }
 
-static gboolean
-is_attachment (CamelMimePart *part, const CamelContentType *parent_ct)
+typedef struct {
+    CamelFolder          *folder;
+    gchar                *uid;
+    TranslateRequestFlags flags;
+} LoadData;
+
+static void
+load_data_free (LoadData *data)
 {
-    const CamelContentDisposition *cd = camel_mime_part_get_content_disposition (part);
-    CamelContentType *ct = camel_mime_part_get_content_type (part);
-    return camel_content_disposition_is_attachment_ex (cd, ct, parent_ct);
+    g_clear_object (&data->folder);
+    g_free (data->uid);
+    g_free (data);
 }
 
+/* Runs in a GTask worker thread: may block on IMAP fetches and decoding */
 static void
-find_body_parts (CamelMimePart *part,
-                 CamelMimePart **best_html,
-                 CamelMimePart **best_plain,
-                 const CamelContentType *parent_ct)
+load_content_thread (GTask        *task,
+                     gpointer      source_object,
+                     gpointer      task_data,
+                     GCancellable *cancellable)
 {
-    CamelDataWrapper *dw = camel_medium_get_content (CAMEL_MEDIUM (part));
-    if (CAMEL_IS_MULTIPART (dw)) {
-        CamelMultipart *mp = (CamelMultipart*)dw;
-        gint n = camel_multipart_get_number (mp);
-        for (gint i = 0; i < n; i++) {
-            CamelMimePart *child = camel_multipart_get_part (mp, i);
-            find_body_parts (child, best_html, best_plain,
-                             camel_mime_part_get_content_type (part));
-        }
-        return;
-    }
+    LoadData *data = task_data;
+    GError *error = NULL;
+    gint64 begin = g_get_monotonic_time ();
 
-    if (is_attachment (part, parent_ct))
-        return;
+    (void)source_object;
 
-    if (content_type_is (part, "text", "html")) {
-        if (!*best_html)
-            *best_html = part;
+    g_autoptr(CamelMimeMessage) msg = camel_folder_get_message_sync (data->folder, data->uid, cancellable, &error);
+    if (!msg) {
+        g_task_return_error (task, error);
         return;
     }
-    if (content_type_is (part, "text", "plain")) {
-        if (!*best_plain)
-            *best_plain = part;
+    translate_stats_add_stage ("fetch", begin);
+
+    g_autofree gchar *fallback_key = make_fallback_key (data->folder, data->uid);
+    TranslateContent *content = translate_extract_message (msg, fallback_key, cancellable);
+    content->flags = data->flags;
+
+    if (g_task_return_error_if_cancelled (task)) {
+        translate_content_free (content);
         return;
     }
+
+    g_task_return_pointer (task, content, (GDestroyNotify) translate_content_free);
 }
 
-static gchar *
-decode_part_to_utf8 (CamelMimePart *part)
+/* Starts the worker thread that loads @uid from @folder into @task */
+static void
+content_load_start (GTask       *task,
+                    CamelFolder *folder,
+                    const gchar *uid)
 {
-    CamelDataWrapper *dw = camel_medium_get_content (CAMEL_MEDIUM (part));
-    g_autoptr(CamelStreamMem) mem = (CamelStreamMem*)camel_stream_mem_new ();
-    g_autoptr(GError) error = NULL;
-    camel_data_wrapper_decode_to_stream_sync (dw, (CamelStream*)mem, NULL, &error);
-    if (error) return NULL;
-    GByteArray *arr = camel_stream_mem_get_byte_array (mem);
-    if (!arr || !arr->data) return NULL;
-    CamelContentType *ct = camel_mime_part_get_content_type (part);
-    const gchar *charset = ct ? camel_content_type_param (ct, "charset") : NULL;
-    if (charset && *charset && g_ascii_strcasecmp (charset, "utf-8") != 0) {
-        g_autoptr(GError) conv_err = NULL;
-        gsize written = 0;
-        gchar *out = g_convert ((const gchar*)arr->data, arr->len, "UTF-8", charset, NULL, &written, &conv_err);
-        if (out)
-            return out;
-    }
-    return g_strndup ((const gchar*)arr->data, arr->len);
+    LoadData *data = g_new0 (LoadData, 1);
+    data->folder = g_object_ref (folder);
+    data->uid = g_strdup (uid);
+    data->flags = translate_content_flags_for_folder (folder);
+    g_task_set_task_data (task, data, (GDestroyNotify) load_data_free);
+
+    g_task_run_in_thread (task, load_content_thread);
 }
 
-static gchar *
-plain_to_html (const gchar *text)
+TranslateRequestFlags
+translate_content_flags_for_folder (CamelFolder *folder)
 {
-    if (!text) return NULL;
-    g_autofree gchar *esc = g_markup_escape_text (text, -1);
-    GString *s = g_string_new (NULL);
-    for (const gchar *p = esc; *p; p++) {
-        if (*p == '\n') g_string_append (s, "<br>");
-        else g_string_append_c (s, *p);
-    }
-    return g_string_free (s, FALSE);
+    CamelStore *store;
+
+    g_return_val_if_fail (CAMEL_IS_FOLDER (folder), TRANSLATE_REQUEST_NONE);
+
+    store = camel_folder_get_parent_store (folder);
+    if (store && translate_utils_is_private_account (camel_service_get_uid (CAMEL_SERVICE (store))))
+        return TRANSLATE_REQUEST_PRIVATE;
+    return TRANSLATE_REQUEST_NONE;
 }
 
-gchar *
-translate_get_selected_message_body_html_from_reader (EMailReader *reader)
+void
+translate_content_load_async (EMailReader        *reader,
+                              GCancellable       *cancellable,
+                              GAsyncReadyCallback callback,
+                              gpointer            user_data)
 {
-    EMailView *mail_view = NULL;
     g_autoptr(CamelFolder) folder = NULL;
     g_autoptr(GPtrArray) selected_uids = NULL;
 
-    g_return_val_if_fail (E_IS_MAIL_READER (reader), NULL);
+    g_return_if_fail (E_IS_MAIL_READER (reader));
 
-    /* For EMailBrowser, reader itself owns selection; for EMailPanedView, get from view */
-    if (E_IS_MAIL_PANED_VIEW (reader)) {
-        mail_view = E_MAIL_VIEW (reader);
-        selected_uids = e_mail_reader_get_selected_uids (reader);
-        folder = e_mail_reader_ref_folder (reader);
-    } else {
-        selected_uids = e_mail_reader_get_selected_uids (reader);
-        folder = e_mail_reader_ref_folder (reader);
-    }
+    GTask *task = g_task_new (reader, cancellable, callback, user_data);
+    g_task_set_source_tag (task, translate_content_load_async);
 
-    if (!folder || !selected_uids || selected_uids->len == 0)
-        return NULL;
+    /* Selection and folder are read here, on the main thread; only the
+     * message fetch and decoding run in the worker thread. */
+    selected_uids = e_mail_reader_get_selected_uids (reader);
+    folder = e_mail_reader_ref_folder (reader);
 
-    const gchar *uid = (const gchar*)g_ptr_array_index (selected_uids, 0);
-    g_autoptr(GError) error = NULL;
-    CamelMimeMessage *msg = camel_folder_get_message_sync (folder, uid, NULL, &error);
-    if (!msg)
-        return NULL;
+    if (!folder || !selected_uids || selected_uids->len == 0) {
+        g_task_return_new_error (task, G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                                 "No message selected");
+        g_object_unref (task);
+        return;
+    }
 
-    CamelMimePart *top = CAMEL_MIME_PART (msg);
-    CamelMimePart *best_html = NULL, *best_plain = NULL;
-    find_body_parts (top, &best_html, &best_plain, camel_mime_part_get_content_type (top));
+    content_load_start (task, folder, g_ptr_array_index (selected_uids, 0));
+    g_object_unref (task);
+}
 
-    if (best_html) {
-        return decode_part_to_utf8 (best_html);
-    } else if (best_plain) {
-        g_autofree gchar *plain = decode_part_to_utf8 (best_plain);
-        return plain_to_html (plain);
-    }
-    return NULL;
+void
+translate_content_load_uid_async (CamelFolder        *folder,
+                                  const gchar        *uid,
+                                  GCancellable       *cancellable,
+                                  GAsyncReadyCallback callback,
+                                  gpointer            user_data)
+{
+    g_return_if_fail (CAMEL_IS_FOLDER (folder));
+    g_return_if_fail (uid != NULL);
+
+    GTask *task = g_task_new (folder, cancellable, callback, user_data);
+    g_task_set_source_tag (task, translate_content_load_uid_async);
+    content_load_start (task, folder, uid);
+    g_object_unref (task);
 }
 
-gchar *
-translate_get_selected_message_body_html_from_shell_view (EShellView *shell_view)
+void
+translate_content_load_from_shell_view_async (EShellView         *shell_view,
+                                              GCancellable       *cancellable,
+                                              GAsyncReadyCallback callback,
+                                              gpointer            user_data)
 {
     EShellContent *shell_content;
     EMailView *mail_view = NULL;
+
+    g_return_if_fail (E_IS_SHELL_VIEW (shell_view));
+
     shell_content = e_shell_view_get_shell_content (shell_view);
     g_object_get (shell_content, "mail-view", &mail_view, NULL);
-    if (!mail_view)
-        return NULL;
-    gchar *html = translate_get_selected_message_body_html_from_reader (E_MAIL_READER (mail_view));
+    if (!mail_view) {
+        g_task_report_new_error (shell_view, callback, user_data,
+                                 translate_content_load_async,
+                                 G_IO_ERROR, G_IO_ERROR_NOT_FOUND,
+                                 "No mail view available");
+        return;
+    }
+    translate_content_load_async (E_MAIL_READER (mail_view), cancellable, callback, user_data);
     g_object_unref (mail_view);
-    return html;
+}
+
+TranslateContent *
+translate_content_load_finish (GAsyncResult *res,
+                               GError      **error)
+{
+    g_return_val_if_fail (G_IS_TASK (res), NULL);
+    return g_task_propagate_pointer (G_TASK (res), error);
 }
@@ -7,13 +7,38 @@
 #include <shell/e-shell-view.h>
 #include <mail/e-mail-reader.h>
 
+#include "translate-extract.h"
+
 G_BEGIN_DECLS
 
-/* Returns newly allocated HTML for the selected message body in a reader. */
-gchar * translate_get_selected_message_body_html_from_reader (EMailReader *reader);
+/* Fetches the selected message of @reader and extracts its body as HTML.
+ * The fetch (which may hit the network on IMAP), the MIME walk and charset
+ * conversion all run in a worker thread; @callback runs on the main thread. */
+void translate_content_load_async (EMailReader        *reader,
+                                   GCancellable       *cancellable,
+                                   GAsyncReadyCallback callback,
+                                   gpointer            user_data);
+
+/* Same, for the shell view's current mail view reader. */
+void translate_content_load_from_shell_view_async (EShellView         *shell_view,
+                                                   GCancellable       *cancellable,
+                                                   GAsyncReadyCallback callback,
+                                                   gpointer            user_data);
+
+/* Same, for message @uid of @folder, whether or not it is selected. */
+void translate_content_load_uid_async (CamelFolder        *folder,
+                                       const gchar        *uid,
+                                       GCancellable       *cancellable,
+                                       GAsyncReadyCallback callback,
+                                       gpointer            user_data);
+
+/* The flags for translating messages of @folder: TRANSLATE_REQUEST_PRIVATE
+ * if its account is listed in "private-accounts". */
+TranslateRequestFlags translate_content_flags_for_folder (CamelFolder *folder);
 
-/* Convenience wrapper to fetch from shell view's current mail view reader. */
-gchar * translate_get_selected_message_body_html_from_shell_view (EShellView *shell_view);
+/* Returns (transfer full) the loaded content, or NULL with @error set. */
+TranslateContent *translate_content_load_finish (GAsyncResult *res,
+                                                 GError      **error);
 
 G_END_DECLS
 
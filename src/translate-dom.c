@@ -6,6 +6,19 @@
  * - Applying translated HTML to the display
  * - Restoring original messages
  * - Detecting message changes to clear stale translations
+ * - Owning the GCancellable of the translation in flight for each display,
+ *   so moving to another message cancels it (and stops its helper)
+ * - Showing the translation in a frame added to Evolution's own rendering
+ *   of the message, whose content is hidden meanwhile. Both stay in the
+ *   page, so toggling between original and translation is a script call
+ *   each way, without loading anything or asking a provider again. At
+ *   most DOM_MAX_STATES displays keep a translation; the least recently
+ *   used one is dropped.
+ * - Showing streamed translations progressively: the skeleton document is
+ *   put into the frame first and each finished segment is patched into it
+ *   with a small script, so long messages fill in instead of staying blank
+ * - Handing displays to translate-inplace.c when "translate-in-place" is
+ *   set, which rewrites the displayed text instead of replacing it
  *
  * Note: All duplication has been eliminated using helper functions.
  * Public functions come in pairs (_shell_view and _reader variants)
@@ -25,16 +38,118 @@
 #include <e-util/e-util.h>
 
 #include "translate-dom.h"
+#include "translate-inplace.h"
+#include "translate-stats.h"
+
+/* Displays that keep their renderings; each holds a translated
+ * document, so a handful of browser windows is plenty */
+#define DOM_MAX_STATES 4
+
+#define DOM_HANDLER "translateDom"
+
+/* Installs window.__evoTranslation once per document. load (html) puts a
+ * document into the translation frame and shows it; patch (index, text)
+ * replaces a segment of it, and queues the segment while the frame is
+ * still loading; show (on) switches between the frame and the message;
+ * clear () drops the frame. The frame is sandboxed without scripts, but
+ * shares the page's origin so the segments can be patched in, and grows
+ * with its content so the page scrolls as a whole. */
+static const gchar dom_script[] =
+    "(function () {"
+    "  if (window.__evoTranslation)"
+    "    return;"
+    "  var T = window.__evoTranslation = { frame: null, ready: false, pending: [] };"
+    "  var style = document.createElement ('style');"
+    "  style.textContent ="
+    "    'body.evo-translation-shown > :not(.evo-translation) { display: none !important; }'"
+    "    + '.evo-translation { display: none; border: 0; width: 100%; margin: 0; }'"
+    "    + 'body.evo-translation-shown > .evo-translation { display: block; }';"
+    "  (document.head || document.documentElement).appendChild (style);"
+    "  function fit () {"
+    "    var doc = T.frame && T.frame.contentDocument;"
+    "    if (doc && doc.documentElement)"
+    "      T.frame.style.height = doc.documentElement.scrollHeight + 'px';"
+    "  }"
+    "  function patch (index, text) {"
+    "    var e = T.frame.contentDocument.querySelector ('span[" TRANSLATE_STREAM_SEGMENT_ATTR "=\"' + index + '\"]');"
+    "    if (e)"
+    "      e.textContent = text;"
+    "  }"
+    "  T.clear = function () {"
+    "    if (T.frame)"
+    "      T.frame.remove ();"
+    "    T.frame = null;"
+    "    T.ready = false;"
+    "    T.pending = [];"
+    "    T.show (false);"
+    "  };"
+    "  T.load = function (html) {"
+    "    T.clear ();"
+    "    var f = T.frame = document.createElement ('iframe');"
+    "    f.className = 'evo-translation';"
+    "    f.setAttribute ('sandbox', 'allow-same-origin');"
+    "    f.addEventListener ('load', function () {"
+    "      if (T.frame !== f)"
+    "        return;"
+    "      T.ready = true;"
+    "      T.pending.forEach (function (p) { patch (p[0], p[1]); });"
+    "      T.pending = [];"
+    "      new ResizeObserver (fit).observe (f.contentDocument.documentElement);"
+    "      fit ();"
+    "      if (window.webkit && window.webkit.messageHandlers." DOM_HANDLER ")"
+    "        window.webkit.messageHandlers." DOM_HANDLER ".postMessage ('loaded');"
+    "    });"
+    "    f.srcdoc = html;"
+    "    document.body.appendChild (f);"
+    "    T.show (true);"
+    "  };"
+    "  T.patch = function (index, text) {"
+    "    if (T.ready)"
+    "      patch (index, text);"
+    "    else if (T.frame)"
+    "      T.pending.push ([index, text]);"
+    "  };"
+    "  T.show = function (on) {"
+    "    if (document.body)"
+    "      document.body.classList.toggle ('evo-translation-shown', on && !!T.frame);"
+    "  };"
+    "})();";
 
 /* Internal state structure to track original message */
 typedef struct {
-    EMailPartList *original_part_list;
+    EMailDisplay *display;      /* Weak; NULL once finalized */
     CamelMimeMessage *original_message;
     gchar *original_message_uid;
+    GCancellable *cancellable;  /* Translation in flight, NULL when idle */
+    gchar *translated_html;     /* Last translation, kept for the toggle */
+    gboolean translated;        /* A translation is currently displayed */
+    gboolean partial;           /* ...of only the start of the message */
+    gboolean in_page;           /* The page's frame holds translated_html */
+
+    /* Streaming progress of the request in flight */
+    gboolean streaming;         /* The frame holds its skeleton */
+    guint n_segments;
+    guint n_patched;
+
+    gint64 render_started;      /* Document handed to the frame, 0 once loaded */
 } DomState;
 
 /* Global state table: EMailDisplay* → DomState* */
 static GHashTable *s_states;
+/* The displays of s_states, most recently used first */
+static GQueue s_lru = G_QUEUE_INIT;
+
+static void on_display_finalized (gpointer data,
+                                  GObject *where_the_object_was);
+
+/* Forget any streamed progress, e.g. before loading a full document */
+static void
+reset_stream_state (DomState *st)
+{
+    st->streaming = FALSE;
+    st->n_segments = 0;
+    st->n_patched = 0;
+}
 
 /* Free a DomState structure */
 static void
@@ -42,9 +157,18 @@ free_dom_state (gpointer data)
 {
     DomState *st = data;
     if (st) {
-        g_clear_object (&st->original_part_list);
+        reset_stream_state (st);
+        /* Dropping the state abandons any translation still running */
+        if (st->cancellable)
+            g_cancellable_cancel (st->cancellable);
+        g_clear_object (&st->cancellable);
         g_clear_object (&st->original_message);
         g_free (st->original_message_uid);
+        g_free (st->translated_html);
+        if (st->display) {
+            g_object_weak_unref (G_OBJECT (st->display), on_display_finalized, NULL);
+            g_queue_remove (&s_lru, st->display);
+        }
         g_free (st);
     }
 }
@@ -58,6 +182,102 @@ ensure_state_table (void)
     }
 }
 
+/* A closed browser window takes its state with it */
+static void
+on_display_finalized (gpointer data,
+                      GObject *where_the_object_was)
+{
+    DomState *st = s_states ? g_hash_table_lookup (s_states, where_the_object_was) : NULL;
+
+    (void)data;
+
+    if (!st)
+        return;
+    st->display = NULL;
+    g_queue_remove (&s_lru, where_the_object_was);
+    g_hash_table_remove (s_states, where_the_object_was);
+}
+
+/* Marks the state of @display as the most recently used */
+static void
+touch_state (EMailDisplay *display)
+{
+    g_queue_remove (&s_lru, display);
+    g_queue_push_head (&s_lru, display);
+}
+
+static void on_display_load_changed (WebKitWebView  *web_view,
+                                     WebKitLoadEvent load_event,
+                                     gpointer        user_data);
+
+static void on_dom_script_message (WebKitUserContentManager *manager,
+                                   WebKitJavascriptResult   *js_result,
+                                   gpointer                  user_data);
+
+/* Makes sure the page script is installed in the displayed document */
+static void
+dom_install (EMailDisplay *display)
+{
+    /* Connect once per display; the handlers look the state up themselves */
+    if (!g_object_get_data (G_OBJECT (display), "translate-load-hooked")) {
+        WebKitUserContentManager *manager =
+            webkit_web_view_get_user_content_manager (WEBKIT_WEB_VIEW (display));
+
+        webkit_user_content_manager_register_script_message_handler (manager, DOM_HANDLER);
+        g_signal_connect_object (manager, "script-message-received::" DOM_HANDLER,
+                                 G_CALLBACK (on_dom_script_message), display, 0);
+        g_signal_connect (display, "load-changed",
+                          G_CALLBACK (on_display_load_changed), NULL);
+        g_object_set_data (G_OBJECT (display), "translate-load-hooked", GINT_TO_POINTER (1));
+    }
+
+    webkit_web_view_evaluate_javascript (WEBKIT_WEB_VIEW (display), dom_script, -1, NULL, NULL,
+                                         NULL, NULL, NULL);
+}
+
+/* Shows Evolution's own rendering of the message again; the translation
+ * stays in the page for show_translation_internal() */
+static void
+show_original (EMailDisplay *display)
+{
+    dom_install (display);
+    e_web_view_jsc_run_script (WEBKIT_WEB_VIEW (display), NULL, "window.__evoTranslation.show (false);");
+}
+
+/* Drops the translation frame from the page of a display whose state
+ * goes away */
+static void
+clear_translation (EMailDisplay *display)
+{
+    dom_install (display);
+    e_web_view_jsc_run_script (WEBKIT_WEB_VIEW (display), NULL, "window.__evoTranslation.clear ();");
+}
+
+/* Creates the state of @display, dropping the least recently used
+ * state beyond DOM_MAX_STATES; a display that was showing a translation
+ * returns to its original then */
+static DomState *
+add_state (EMailDisplay *display)
+{
+    DomState *st = g_new0 (DomState, 1);
+
+    st->display = display;
+    g_object_weak_ref (G_OBJECT (display), on_display_finalized, NULL);
+    g_hash_table_insert (s_states, display, st);
+    touch_state (display);
+
+    while (g_queue_get_length (&s_lru) > DOM_MAX_STATES) {
+        EMailDisplay *oldest = g_queue_peek_tail (&s_lru);
+        DomState *old = g_hash_table_lookup (s_states, oldest);
+
+        if (old && (old->in_page || old->streaming))
+            clear_translation (oldest);
+        g_queue_pop_tail (&s_lru);
+        g_hash_table_remove (s_states, oldest);
+    }
+    return st;
+}
+
 /* Extract EMailDisplay from EShellView */
 static EMailDisplay *
 get_display_from_shell_view (EShellView *shell_view)
@@ -85,69 +305,225 @@ get_display_from_reader (EMailReader *reader)
  * These functions work with EMailDisplay* directly
  * ============================================================================ */
 
+/* Current message UID shown by @display, or NULL */
+static const gchar *
+get_display_uid (EMailDisplay *display)
+{
+    EMailPartList *part_list = e_mail_display_get_part_list (display);
+    return part_list ? e_mail_part_list_get_message_uid (part_list) : NULL;
+}
+
+/**
+ * begin_request_internal:
+ * @display: The EMailDisplay a translation is requested for
+ *
+ * Internal helper that records a new translation request for the message
+ * currently shown in @display. State left over from a different message
+ * is dropped first (cancelling its request).
+ *
+ * Returns: (transfer full) (nullable): The request's cancellable, or %NULL
+ *          if a request for this message is already in flight
+ */
+static GCancellable *
+begin_request_internal (EMailDisplay *display)
+{
+    ensure_state_table ();
+    if (!display) return NULL;
+
+    const gchar *current_uid = get_display_uid (display);
+
+    DomState *st = g_hash_table_lookup (s_states, display);
+    if (st && g_strcmp0 (current_uid, st->original_message_uid) != 0) {
+        g_hash_table_remove (s_states, display);
+        st = NULL;
+    }
+
+    if (!st) {
+        st = add_state (display);
+        st->original_message_uid = g_strdup (current_uid);
+    } else {
+        touch_state (display);
+    }
+
+    /* Repeated clicks while the first request runs share its result */
+    if (st->cancellable && !g_cancellable_is_cancelled (st->cancellable))
+        return NULL;
+
+    g_clear_object (&st->cancellable);
+    st->cancellable = g_cancellable_new ();
+    return g_object_ref (st->cancellable);
+}
+
+/* Returns the state of @display if a request for its current message is
+ * still in flight, otherwise NULL */
+static DomState *
+lookup_live_request (EMailDisplay *display)
+{
+    DomState *st = g_hash_table_lookup (s_states, display);
+
+    if (!st || !st->cancellable || g_cancellable_is_cancelled (st->cancellable) ||
+        g_strcmp0 (get_display_uid (display), st->original_message_uid) != 0)
+        return NULL;
+    return st;
+}
+
+/* Replaces the text of one marked segment in the skeleton; the page
+ * queues it while the frame is loading. The jsc printf quotes and escapes
+ * %s as a JavaScript string. */
+static void
+patch_segment (EMailDisplay *display,
+               DomState     *st,
+               guint         index,
+               const gchar  *text)
+{
+    e_web_view_jsc_run_script (WEBKIT_WEB_VIEW (display), NULL,
+                               "if (window.__evoTranslation) window.__evoTranslation.patch (%d, %s);",
+                               (gint) index, text);
+    st->n_patched++;
+}
+
+/* Another document, or the message rendered again: the frame is gone and
+ * the original is what shows */
+static void
+on_display_load_changed (WebKitWebView  *web_view,
+                         WebKitLoadEvent load_event,
+                         gpointer        user_data)
+{
+    DomState *st;
+
+    (void)user_data;
+
+    if (load_event != WEBKIT_LOAD_STARTED || !s_states)
+        return;
+
+    st = g_hash_table_lookup (s_states, E_MAIL_DISPLAY (web_view));
+    if (!st)
+        return;
+
+    /* A translation still in flight lands in the new page in full */
+    reset_stream_state (st);
+    st->in_page = FALSE;
+    st->translated = FALSE;
+    st->render_started = 0;
+}
+
+/* The frame finished loading the document last handed to it */
+static void
+on_dom_script_message (WebKitUserContentManager *manager,
+                       WebKitJavascriptResult   *js_result,
+                       gpointer                  user_data)
+{
+    DomState *st = s_states ? g_hash_table_lookup (s_states, user_data) : NULL;
+
+    (void)manager;
+    (void)js_result;
+
+    if (st && st->render_started) {
+        translate_stats_add_stage ("render", st->render_started);
+        st->render_started = 0;
+    }
+}
+
+/* Puts @html into the translation frame of @display and shows it, timing
+ * it until the frame has loaded it */
+static void
+load_document (EMailDisplay *display,
+               DomState     *st,
+               const gchar  *html)
+{
+    dom_install (display);
+    st->render_started = g_get_monotonic_time ();
+    e_web_view_jsc_run_script (WEBKIT_WEB_VIEW (display), NULL, "window.__evoTranslation.load (%s);", html);
+}
+
+/**
+ * stream_event_internal:
+ * @display: The EMailDisplay the translation is shown in
+ * @event: Partial output of the translation in flight
+ *
+ * Internal helper that shows streamed output. A skeleton replaces the
+ * translation frame's document and is shown; segments are patched into
+ * it, and queued by the page until it has loaded.
+ */
+static void
+stream_event_internal (EMailDisplay               *display,
+                       const TranslateStreamEvent *event)
+{
+    ensure_state_table ();
+    if (!display || !event) return;
+
+    DomState *st = lookup_live_request (display);
+    if (!st)
+        return;
+
+    if (event->type == TRANSLATE_STREAM_SKELETON) {
+        reset_stream_state (st);
+        st->n_segments = event->n_segments;
+        st->streaming = TRUE;
+        st->in_page = FALSE;
+        load_document (display, st, event->text);
+        return;
+    }
+
+    if (st->streaming)
+        patch_segment (display, st, event->index, event->text);
+}
+
 /**
  * apply_translation_internal:
  * @display: The EMailDisplay to apply translation to
  * @translated_html: The translated HTML content
+ * @partial: Whether only the start of the message was translated
  * @verbose_logging: Whether to log detailed messages
  *
  * Internal helper that applies translated HTML to a display.
- * Handles state management, message change detection, and content loading.
+ * Results are only applied while their request is still the display's
+ * current one; anything else belongs to a message that is no longer shown.
+ * A document that was fully streamed in is left as it is.
  * This is the single source of truth for apply logic.
  */
 static void
 apply_translation_internal (EMailDisplay *display,
                             const gchar *translated_html,
+                            gboolean partial,
                             gboolean verbose_logging)
 {
     ensure_state_table ();
     if (!display) return;
 
-    /* Get current message UID */
-    EMailPartList *current_part_list = e_mail_display_get_part_list (display);
-    const gchar *current_uid = NULL;
-    if (current_part_list) {
-        current_uid = e_mail_part_list_get_message_uid (current_part_list);
-    }
+    const gchar *current_uid = get_display_uid (display);
+    DomState *st = lookup_live_request (display);
 
-    /* Check if we already have state for this display */
-    DomState *existing_state = g_hash_table_lookup (s_states, display);
+    if (!st) {
+        g_message ("[translate] Dropping translation result for a message that is no longer displayed");
+        return;
+    }
 
-    /* If state exists but it's for a different message, clear it first */
-    if (existing_state) {
-        gboolean is_same_message = FALSE;
-        if (current_uid && existing_state->original_message_uid) {
-            is_same_message = (g_strcmp0 (current_uid, existing_state->original_message_uid) == 0);
-        }
+    /* The request is done; keep the state and the translation for
+     * toggling between original and translated */
+    g_clear_object (&st->cancellable);
+    st->translated = TRUE;
+    st->partial = partial;
+    g_free (st->translated_html);
+    st->translated_html = g_strdup (translated_html ? translated_html : "");
 
-        if (!is_same_message) {
-            /* Different message - remove old state */
-            g_message ("[translate] Clearing old translation state for different message");
-            g_hash_table_remove (s_states, display);
-            existing_state = NULL;
-        }
+    if (verbose_logging) {
+        g_message ("[translate] Applying translation state for message UID: %s",
+                   current_uid ? current_uid : "(none)");
     }
 
-    /* Create new state if needed */
-    if (!existing_state) {
-        DomState *st = g_new0 (DomState, 1);
-        st->original_part_list = current_part_list;
-        if (st->original_part_list) {
-            g_object_ref (st->original_part_list);
-            if (current_uid) {
-                st->original_message_uid = g_strdup (current_uid);
-            }
-        }
-        g_hash_table_insert (s_states, display, st);
-
-        if (verbose_logging) {
-            g_message ("[translate] Created new translation state for message UID: %s",
-                       current_uid ? current_uid : "(none)");
-        }
+    /* Every segment was streamed in already: reloading would only flicker
+     * and lose the scroll position */
+    gboolean complete = st->streaming && st->n_patched >= st->n_segments;
+    reset_stream_state (st);
+    st->in_page = TRUE;
+    if (complete) {
+        if (verbose_logging)
+            g_message ("[translate] Streamed translation complete, keeping the patched document");
+        return;
     }
 
-    /* Load translated HTML directly into the web view */
-    e_web_view_load_string (E_WEB_VIEW (display), translated_html ? translated_html : "");
+    load_document (display, st, st->translated_html);
 
     if (verbose_logging) {
         g_message ("[translate] Applied translated content (%zu bytes) to preview",
@@ -158,51 +534,64 @@ apply_translation_internal (EMailDisplay *display,
 /**
  * restore_original_internal:
  * @display: The EMailDisplay to restore
- * @reader: Optional EMailReader for reload (can be NULL)
- * @shell_view: Optional EShellView for reload (can be NULL)
  *
- * Internal helper that restores the original message.
+ * Internal helper that shows the original message again. The translation
+ * is kept, so show_translation_internal() can switch back to it.
  * This is the single source of truth for restore logic.
- * Either reader or shell_view should be provided for reload functionality.
  */
 static void
-restore_original_internal (EMailDisplay *display,
-                           EMailReader *reader,
-                           EShellView *shell_view)
+restore_original_internal (EMailDisplay *display)
 {
     ensure_state_table ();
     if (!display) return;
 
-    DomState *st = g_hash_table_lookup (s_states, display);
-    if (!st) return;
-
-    /* Force reload of the original message */
-    if (st->original_part_list) {
-        /* Set the part list back and force a complete reload */
-        e_mail_display_set_part_list (display, st->original_part_list);
-        e_mail_display_load (display, NULL);
-
-        /* Reload using appropriate method */
-        if (reader) {
-            /* Direct reader reload */
-            e_mail_reader_reload (reader);
-        } else if (shell_view) {
-            /* Get reader from shell view and reload */
-            EShellContent *shell_content = e_shell_view_get_shell_content (shell_view);
-            EMailView *mail_view = NULL;
-            g_object_get (shell_content, "mail-view", &mail_view, NULL);
-            if (mail_view && E_IS_MAIL_READER (mail_view)) {
-                e_mail_reader_reload (E_MAIL_READER (mail_view));
-            }
-            if (mail_view)
-                g_object_unref (mail_view);
-        }
+    if (translate_inplace_is_shown (display)) {
+        translate_inplace_hide (display);
+        return;
     }
 
-    g_hash_table_remove (s_states, display);
+    DomState *st = g_hash_table_lookup (s_states, display);
+    if (!st || !st->translated) return;
+
+    show_original (display);
+    st->translated = FALSE;
+    touch_state (display);
     g_message ("[translate] Restored original content");
 }
 
+/**
+ * show_translation_internal:
+ * @display: The EMailDisplay to show the translation in
+ *
+ * Internal helper that switches back to the translation kept from the
+ * last request for the displayed message, without asking any provider.
+ *
+ * Returns: TRUE if a kept translation is shown now, FALSE if there is
+ *          none and the message has to be translated
+ */
+static gboolean
+show_translation_internal (EMailDisplay *display)
+{
+    ensure_state_table ();
+    if (!display) return FALSE;
+
+    DomState *st = g_hash_table_lookup (s_states, display);
+    if (!st || st->translated || !st->translated_html || lookup_live_request (display) ||
+        g_strcmp0 (get_display_uid (display), st->original_message_uid) != 0)
+        return FALSE;
+
+    st->translated = TRUE;
+    touch_state (display);
+    if (st->in_page) {
+        e_web_view_jsc_run_script (WEBKIT_WEB_VIEW (display), NULL, "window.__evoTranslation.show (true);");
+    } else {
+        /* The message was rendered again since; put the translation back */
+        load_document (display, st, st->translated_html);
+        st->in_page = TRUE;
+    }
+    return TRUE;
+}
+
 /**
  * is_translated_internal:
  * @display: The EMailDisplay to check
@@ -217,7 +606,19 @@ is_translated_internal (EMailDisplay *display)
 {
     ensure_state_table ();
     if (!display) return FALSE;
-    return g_hash_table_contains (s_states, display);
+    DomState *st = g_hash_table_lookup (s_states, display);
+    return (st && st->translated) || translate_inplace_is_shown (display);
+}
+
+/* Whether @display shows a translation of only the start of its message */
+static gboolean
+is_partial_internal (EMailDisplay *display)
+{
+    ensure_state_table ();
+    if (!display) return FALSE;
+    DomState *st = g_hash_table_lookup (s_states, display);
+    return st && st->translated && st->partial &&
+           g_strcmp0 (get_display_uid (display), st->original_message_uid) == 0;
 }
 
 /**
@@ -225,6 +626,7 @@ is_translated_internal (EMailDisplay *display)
  * @display: The EMailDisplay to check
  *
  * Internal helper that clears translation state if the message has changed.
+ * Clearing cancels a translation still in flight for the old message.
  * This is the single source of truth for message change detection logic.
  */
 static void
@@ -238,11 +640,7 @@ clear_if_message_changed_internal (EMailDisplay *display)
     if (!existing_state) return;
 
     /* Get the current message UID from the display */
-    EMailPartList *current_part_list = e_mail_display_get_part_list (display);
-    const gchar *current_uid = NULL;
-    if (current_part_list) {
-        current_uid = e_mail_part_list_get_message_uid (current_part_list);
-    }
+    const gchar *current_uid = get_display_uid (display);
 
     /* Check if the stored UID matches the current UID */
     gboolean is_same_message = FALSE;
@@ -268,29 +666,93 @@ clear_if_message_changed_internal (EMailDisplay *display)
  * translate_dom_apply_to_shell_view:
  * @shell_view: The EShellView containing the message
  * @translated_html: The translated HTML to display
+ * @partial: Whether only the start of the message was translated
  *
  * Applies translated HTML to the mail display in a shell view.
  * Stores state to enable restoration of the original message.
  */
 void
 translate_dom_apply_to_shell_view (EShellView *shell_view,
-                                   const gchar *translated_html)
+                                   const gchar *translated_html,
+                                   gboolean partial)
+{
+    EMailDisplay *display = get_display_from_shell_view (shell_view);
+    apply_translation_internal (display, translated_html, partial, TRUE);
+}
+
+/**
+ * translate_dom_stream_to_shell_view:
+ * @shell_view: The EShellView containing the message
+ * @event: Partial output of the translation in flight
+ *
+ * Shows streamed translation output in the mail display of a shell view.
+ */
+void
+translate_dom_stream_to_shell_view (EShellView                 *shell_view,
+                                    const TranslateStreamEvent *event)
 {
     EMailDisplay *display = get_display_from_shell_view (shell_view);
-    apply_translation_internal (display, translated_html, TRUE);
+    stream_event_internal (display, event);
+}
+
+/**
+ * translate_dom_begin_request:
+ * @shell_view: The EShellView containing the message
+ *
+ * Registers a translation request for the displayed message.
+ *
+ * Returns: (transfer full) (nullable): Cancellable for the request, or
+ *          %NULL if one is already running for this message
+ */
+GCancellable *
+translate_dom_begin_request (EShellView *shell_view)
+{
+    EMailDisplay *display = get_display_from_shell_view (shell_view);
+    return begin_request_internal (display);
 }
 
 /**
  * translate_dom_restore_original:
  * @shell_view: The EShellView containing the message
  *
- * Restores the original message in a shell view, removing translation.
+ * Shows the original message in a shell view again, keeping the
+ * translation for translate_dom_show_translation().
  */
 void
 translate_dom_restore_original (EShellView *shell_view)
 {
     EMailDisplay *display = get_display_from_shell_view (shell_view);
-    restore_original_internal (display, NULL, shell_view);
+    restore_original_internal (display);
+}
+
+/**
+ * translate_dom_show_translation:
+ * @shell_view: The EShellView containing the message
+ *
+ * Switches back to the translation of the displayed message, if one is
+ * kept from an earlier request.
+ *
+ * Returns: TRUE if the kept translation is shown, FALSE otherwise
+ */
+gboolean
+translate_dom_show_translation (EShellView *shell_view)
+{
+    EMailDisplay *display = get_display_from_shell_view (shell_view);
+    return show_translation_internal (display);
+}
+
+/**
+ * translate_dom_translate_in_place:
+ * @shell_view: The EShellView containing the message
+ *
+ * Translates the displayed message in place; see translate_inplace_show().
+ */
+void
+translate_dom_translate_in_place (EShellView *shell_view)
+{
+    EMailDisplay *display = get_display_from_shell_view (shell_view);
+    if (display)
+        translate_inplace_show (display);
 }
 
 /**
@@ -308,6 +770,22 @@ translate_dom_is_translated (EShellView *shell_view)
     return is_translated_internal (display);
 }
 
+/**
+ * translate_dom_is_partial:
+ * @shell_view: The EShellView to check
+ *
+ * Checks if the message in a shell view shows a translation of only its
+ * start, which translating again completes.
+ *
+ * Returns: TRUE if partially translated, FALSE otherwise
+ */
+gboolean
+translate_dom_is_partial (EShellView *shell_view)
+{
+    EMailDisplay *display = get_display_from_shell_view (shell_view);
+    return is_partial_internal (display);
+}
+
 /**
  * translate_dom_clear_if_message_changed:
  * @shell_view: The EShellView to check
@@ -331,29 +809,91 @@ translate_dom_clear_if_message_changed (EShellView *shell_view)
  * translate_dom_apply_to_reader:
  * @reader: The EMailReader containing the message
  * @translated_html: The translated HTML to display
+ * @partial: Whether only the start of the message was translated
  *
  * Applies translated HTML to the mail display in a reader.
  * Stores state to enable restoration of the original message.
  */
 void
 translate_dom_apply_to_reader (EMailReader *reader,
-                                const gchar *translated_html)
+                                const gchar *translated_html,
+                                gboolean partial)
 {
     EMailDisplay *display = get_display_from_reader (reader);
-    apply_translation_internal (display, translated_html, FALSE);
+    apply_translation_internal (display, translated_html, partial, FALSE);
+}
+
+/**
+ * translate_dom_stream_to_reader:
+ * @reader: The EMailReader containing the message
+ * @event: Partial output of the translation in flight
+ *
+ * Shows streamed translation output in the mail display of a reader.
+ */
+void
+translate_dom_stream_to_reader (EMailReader                *reader,
+                                const TranslateStreamEvent *event)
+{
+    EMailDisplay *display = get_display_from_reader (reader);
+    stream_event_internal (display, event);
+}
+
+/**
+ * translate_dom_begin_request_reader:
+ * @reader: The EMailReader containing the message
+ *
+ * Registers a translation request for the displayed message.
+ *
+ * Returns: (transfer full) (nullable): Cancellable for the request, or
+ *          %NULL if one is already running for this message
+ */
+GCancellable *
+translate_dom_begin_request_reader (EMailReader *reader)
+{
+    EMailDisplay *display = get_display_from_reader (reader);
+    return begin_request_internal (display);
 }
 
 /**
  * translate_dom_restore_original_reader:
  * @reader: The EMailReader containing the message
  *
- * Restores the original message in a reader, removing translation.
+ * Shows the original message in a reader again, keeping the translation.
  */
 void
 translate_dom_restore_original_reader (EMailReader *reader)
 {
     EMailDisplay *display = get_display_from_reader (reader);
-    restore_original_internal (display, reader, NULL);
+    restore_original_internal (display);
+}
+
+/**
+ * translate_dom_show_translation_reader:
+ * @reader: The EMailReader containing the message
+ *
+ * Switches back to the kept translation of the displayed message.
+ *
+ * Returns: TRUE if the kept translation is shown, FALSE otherwise
+ */
+gboolean
+translate_dom_show_translation_reader (EMailReader *reader)
+{
+    EMailDisplay *display = get_display_from_reader (reader);
+    return show_translation_internal (display);
+}
+
+/**
+ * translate_dom_translate_in_place_reader:
+ * @reader: The EMailReader containing the message
+ *
+ * Translates the displayed message in place; see translate_inplace_show().
+ */
+void
+translate_dom_translate_in_place_reader (EMailReader *reader)
+{
+    EMailDisplay *display = get_display_from_reader (reader);
+    if (display)
+        translate_inplace_show (display);
 }
 
 /**
@@ -371,6 +911,21 @@ translate_dom_is_translated_reader (EMailReader *reader)
     return is_translated_internal (display);
 }
 
+/**
+ * translate_dom_is_partial_reader:
+ * @reader: The EMailReader to check
+ *
+ * Checks if the message in a reader shows a translation of only its start.
+ *
+ * Returns: TRUE if partially translated, FALSE otherwise
+ */
+gboolean
+translate_dom_is_partial_reader (EMailReader *reader)
+{
+    EMailDisplay *display = get_display_from_reader (reader);
+    return is_partial_internal (display);
+}
+
 /**
  * translate_dom_clear_if_message_changed_reader:
  * @reader: The EMailReader to check
@@ -5,23 +5,55 @@
 #define TRANSLATE_DOM_H
 
 #include <shell/e-shell-view.h>
+#include <mail/e-mail-reader.h>
+
+#include "providers/translate-provider.h"
 
 G_BEGIN_DECLS
 
-/* Apply translated HTML into the current preview pane. Placeholder implementation. */
+/* Apply translated HTML into the current preview pane; @partial if only
+ * the start of the message was translated (see translate_dom_is_partial). */
 void translate_dom_apply_to_shell_view (EShellView *shell_view,
-                                        const gchar *translated_html);
+                                        const gchar *translated_html,
+                                        gboolean partial);
+
+/* Show partial output of the translation in flight; see TranslateStreamEvent. */
+void translate_dom_stream_to_shell_view (EShellView                 *shell_view,
+                                         const TranslateStreamEvent *event);
+
+/* Start tracking a translation of the displayed message. Returns a new
+ * cancellable (free with g_object_unref()) that is cancelled when the
+ * display moves to another message, or NULL if a translation of this
+ * message is already running. */
+GCancellable *translate_dom_begin_request (EShellView *shell_view);
 
-/* Toggle back to original content (placeholder). */
+/* Show the original message again; the translation is kept. */
 void translate_dom_restore_original (EShellView *shell_view);
 
+/* Switch back to the kept translation of the displayed message without
+ * translating it again. Returns FALSE if there is none. */
+gboolean translate_dom_show_translation (EShellView *shell_view);
+
+/* Translate the displayed text where it stands, the visible part first,
+ * instead of loading a translated copy ("translate-in-place"). */
+void translate_dom_translate_in_place (EShellView *shell_view);
+
 /* Returns TRUE if the current preview is showing a translated version. */
 gboolean translate_dom_is_translated (EShellView *shell_view);
 
+/* Returns TRUE if the preview shows a translation of only the start of the
+ * message; translating again should then translate the rest. */
+gboolean translate_dom_is_partial (EShellView *shell_view);
+
 /* Reader variants for browser windows */
-void     translate_dom_apply_to_reader   (EMailReader *reader, const gchar *translated_html);
+GCancellable *translate_dom_begin_request_reader (EMailReader *reader);
+void     translate_dom_apply_to_reader   (EMailReader *reader, const gchar *translated_html, gboolean partial);
+void     translate_dom_stream_to_reader  (EMailReader *reader, const TranslateStreamEvent *event);
 void     translate_dom_restore_original_reader (EMailReader *reader);
+gboolean translate_dom_show_translation_reader (EMailReader *reader);
+void     translate_dom_translate_in_place_reader (EMailReader *reader);
 gboolean translate_dom_is_translated_reader (EMailReader *reader);
+gboolean translate_dom_is_partial_reader (EMailReader *reader);
 
 /* Clear translation state if the displayed message has changed */
 void     translate_dom_clear_if_message_changed (EShellView *shell_view);
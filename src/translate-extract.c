@@ -0,0 +1,202 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate extraction - the translatable body of a CamelMimeMessage */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <glib.h>
+#include <camel/camel.h>
+
+#include "translate-extract.h"
+#include "translate-langid.h"
+#include "translate-stats.h"
+
+static gboolean
+content_type_is (CamelMimePart *part, const gchar *type, const gchar *subtype)
+{
+    CamelContentType *ct = camel_mime_part_get_content_type (part);
+    return ct && camel_content_type_is (ct, type, subtype);
+}
+
+static gboolean
+is_attachment (CamelMimePart *part, const CamelContentType *parent_ct)
+{
+    const CamelContentDisposition *cd = camel_mime_part_get_content_disposition (part);
+    CamelContentType *ct = camel_mime_part_get_content_type (part);
+    return camel_content_disposition_is_attachment_ex (cd, ct, parent_ct);
+}
+
+static void
+find_body_parts (CamelMimePart *part,
+                 CamelMimePart **best_html,
+                 CamelMimePart **best_plain,
+                 const CamelContentType *parent_ct)
+{
+    CamelDataWrapper *dw = camel_medium_get_content (CAMEL_MEDIUM (part));
+    if (CAMEL_IS_MULTIPART (dw)) {
+        CamelMultipart *mp = (CamelMultipart*)dw;
+        gint n = camel_multipart_get_number (mp);
+        for (gint i = 0; i < n; i++) {
+            CamelMimePart *child = camel_multipart_get_part (mp, i);
+            find_body_parts (child, best_html, best_plain,
+                             camel_mime_part_get_content_type (part));
+        }
+        return;
+    }
+
+    if (is_attachment (part, parent_ct))
+        return;
+
+    if (content_type_is (part, "text", "html")) {
+        if (!*best_html)
+            *best_html = part;
+        return;
+    }
+    if (content_type_is (part, "text", "plain")) {
+        if (!*best_plain)
+            *best_plain = part;
+        return;
+    }
+}
+
+/* Decodes @part in a single pass into one buffer, which becomes the
+ * returned string: the data wrapper undoes the transfer encoding, and
+ * filters on the way into the buffer convert the charset to UTF-8 and,
+ * with @to_html, plain text to HTML. The buffer is sized from the encoded
+ * part, which is at least as large as the decoded text. */
+static gchar *
+decode_part (CamelMimePart *part, gboolean to_html, GCancellable *cancellable)
+{
+    CamelDataWrapper *dw = camel_medium_get_content (CAMEL_MEDIUM (part));
+    CamelContentType *ct = camel_mime_part_get_content_type (part);
+    const gchar *charset = ct ? camel_content_type_param (ct, "charset") : NULL;
+    GByteArray *encoded = camel_data_wrapper_get_byte_array (dw);
+    gsize expected = encoded ? encoded->len : 0;
+    g_autoptr(GError) error = NULL;
+
+    /* Line breaks become "<br>" and a few characters entities */
+    if (to_html)
+        expected += expected / 8;
+
+    GByteArray *buffer = g_byte_array_sized_new (expected + 1);
+    CamelStream *mem = camel_stream_mem_new ();
+    CamelStream *filtered = camel_stream_filter_new (mem);
+    camel_stream_mem_set_byte_array (CAMEL_STREAM_MEM (mem), buffer);
+
+    if (charset && *charset && g_ascii_strcasecmp (charset, "utf-8") != 0) {
+        /* Unknown charsets get no filter and pass through as they are */
+        CamelMimeFilter *filter = camel_mime_filter_charset_new (charset, "UTF-8");
+        if (filter) {
+            camel_stream_filter_add (CAMEL_STREAM_FILTER (filtered), filter);
+            g_object_unref (filter);
+        }
+    }
+    if (to_html) {
+        CamelMimeFilter *filter = camel_mime_filter_tohtml_new (CAMEL_MIME_FILTER_TOHTML_CONVERT_NL, 0);
+        camel_stream_filter_add (CAMEL_STREAM_FILTER (filtered), filter);
+        g_object_unref (filter);
+    }
+
+    /* Flushing pushes out what the filters still hold back */
+    if (camel_data_wrapper_decode_to_stream_sync (dw, filtered, cancellable, &error) < 0 ||
+        camel_stream_flush (filtered, cancellable, &error) < 0) {
+        g_object_unref (filtered);
+        g_object_unref (mem);
+        g_byte_array_unref (buffer);
+        return NULL;
+    }
+    g_object_unref (filtered);
+    g_object_unref (mem);
+
+    g_byte_array_append (buffer, (const guint8 *) "", 1);
+    return (gchar *) g_byte_array_free (buffer, FALSE);
+}
+
+void
+translate_content_free (TranslateContent *content)
+{
+    if (!content)
+        return;
+    g_free (content->body_html);
+    g_free (content->message_key);
+    g_strfreev (content->parent_keys);
+    g_free (content);
+}
+
+/* Keys of the messages @message answers: In-Reply-To, then References
+ * from the last (the parent) back to the thread's start */
+static gchar **
+parent_keys_of (CamelMimeMessage *message)
+{
+    CamelMedium *medium = CAMEL_MEDIUM (message);
+    GPtrArray *keys = g_ptr_array_new ();
+    const gchar * const headers[] = { "In-Reply-To", "References" };
+
+    for (guint h = 0; h < G_N_ELEMENTS (headers); h++) {
+        const gchar *value = camel_medium_get_header (medium, headers[h]);
+        GSList *ids = value ? camel_header_references_decode (value) : NULL;
+
+        /* Decoded in header order, oldest first */
+        ids = g_slist_reverse (ids);
+        for (GSList *l = ids; l; l = l->next) {
+            g_autofree gchar *key = g_strconcat ("mid:", (const gchar *) l->data, NULL);
+            gboolean seen = FALSE;
+
+            for (guint i = 0; i < keys->len && !seen; i++)
+                seen = g_str_equal (g_ptr_array_index (keys, i), key);
+            if (!seen)
+                g_ptr_array_add (keys, g_steal_pointer (&key));
+        }
+        g_slist_free_full (ids, g_free);
+    }
+
+    if (keys->len == 0) {
+        g_ptr_array_free (keys, TRUE);
+        return NULL;
+    }
+    g_ptr_array_add (keys, NULL);
+    return (gchar **) g_ptr_array_free (keys, FALSE);
+}
+
+TranslateContent *
+translate_extract_message (CamelMimeMessage *message,
+                           const gchar      *fallback_key,
+                           GCancellable     *cancellable)
+{
+    CamelMimePart *top = CAMEL_MIME_PART (message);
+    CamelMimePart *best_html = NULL, *best_plain = NULL;
+    const gchar *message_id;
+    TranslateContent *content;
+    gint64 begin;
+
+    g_return_val_if_fail (CAMEL_IS_MIME_MESSAGE (message), NULL);
+
+    find_body_parts (top, &best_html, &best_plain, camel_mime_part_get_content_type (top));
+
+    content = g_new0 (TranslateContent, 1);
+    begin = g_get_monotonic_time ();
+    if (best_html) {
+        content->body_html = decode_part (best_html, FALSE, cancellable);
+        translate_stats_add_stage ("decode", begin);
+        begin = g_get_monotonic_time ();
+        content->source_lang = translate_langid_detect_html (content->body_html);
+        translate_stats_add_stage ("detect", begin);
+    } else if (best_plain) {
+        content->body_html = decode_part (best_plain, TRUE, cancellable);
+        translate_stats_add_stage ("decode", begin);
+        begin = g_get_monotonic_time ();
+        content->source_lang = translate_langid_detect_html (content->body_html);
+        translate_stats_add_stage ("detect", begin);
+    }
+
+    /* Stable identity for the translation cache: the Message-ID when
+     * there is one (survives moves between folders) */
+    message_id = camel_mime_message_get_message_id (message);
+    if (message_id && *message_id)
+        content->message_key = g_strconcat ("mid:", message_id, NULL);
+    else
+        content->message_key = g_strdup (fallback_key);
+    content->parent_keys = parent_keys_of (message);
+    return content;
+}
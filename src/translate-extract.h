@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate extraction - the translatable body of a CamelMimeMessage
+ *
+ * Only needs Camel, so tools without a mail window (the benchmark) go
+ * through the same MIME walk, decoding and language detection as the
+ * extension; translate-content.h adds fetching from folders and readers. */
+
+#ifndef TRANSLATE_EXTRACT_H
+#define TRANSLATE_EXTRACT_H
+
+#include <glib.h>
+#include <gio/gio.h>
+#include <camel/camel.h>
+
+#include "translate-common.h"
+
+G_BEGIN_DECLS
+
+/* The body of a message, ready to hand to translate_common_translate_async(). */
+typedef struct {
+    gchar *body_html;    /* Body as HTML (plain text is escaped); NULL if none */
+    gchar *message_key;  /* Stable identity (Message-ID, or folder URI + UID) */
+    gchar **parent_keys; /* Keys of the messages it replies to, nearest first; NULL if none */
+    const gchar *source_lang;  /* Detected language (static), or NULL if unsure */
+    TranslateRequestFlags flags;  /* Set from the folder by translate-content.h */
+} TranslateContent;
+
+void translate_content_free (TranslateContent *content);
+
+/* Extracts the first HTML (else plain-text) body part of @message that is
+ * not an attachment, converted to UTF-8, and detects its language. The key
+ * is the Message-ID, or @fallback_key for messages without one; the parent
+ * keys come from In-Reply-To and References. Blocks on
+ * decoding: call it from a worker thread. Returns (transfer full) the
+ * content; its body is NULL if @message has no text part. */
+TranslateContent *translate_extract_message (CamelMimeMessage *message,
+                                             const gchar      *fallback_key,
+                                             GCancellable     *cancellable);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC (TranslateContent, translate_content_free)
+
+G_END_DECLS
+
+#endif /* TRANSLATE_EXTRACT_H */
@@ -0,0 +1,327 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-hedge.c
+ * Racing a second provider against a slow one
+ *
+ * A provider is sometimes much slower than usual: Google rate-limits a
+ * burst of requests, the network stalls, or an Argos model is loaded
+ * from disk on first use. Instead of waiting it out, the job is also
+ * given to a second provider once the first has had its usual time, and
+ * whichever answers first is used. Both jobs go through the scheduler,
+ * each with a cancellable of its own chained to the caller's. A loser
+ * still waiting in the queue is withdrawn; one that is already running
+ * is left to finish and its answer dropped, because cancelling a helper
+ * call stops the helper too, and a cold Argos helper would then never
+ * get to warm up.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <glib.h>
+#include "translate-hedge.h"
+#include "translate-stats.h"
+
+typedef struct {
+    TranslateProvider  *primary;
+    TranslateProvider  *secondary;
+    gchar              *input;
+    gboolean            is_html;
+    gchar              *source_lang;
+    gchar              *target_lang;
+    TranslatePriority   priority;
+    TranslateStreamFunc stream_func;
+    gpointer            stream_data;
+
+    GCancellable       *cancellable;  /* The caller's, or NULL */
+    gulong              cancel_id;
+    GCancellable       *primary_cancellable;
+    GCancellable       *secondary_cancellable;
+    GSource            *timer;        /* Starts @secondary; NULL once it ran */
+
+    gboolean            primary_running;
+    gboolean            secondary_started;
+    gboolean            secondary_running;
+    gboolean            returned;     /* The task has its result */
+    gboolean            secondary_won;
+    GError             *primary_error;
+} HedgeData;
+
+static void
+hedge_data_free (HedgeData *data)
+{
+    if (data->timer) {
+        g_source_destroy (data->timer);
+        g_source_unref (data->timer);
+    }
+    if (data->cancellable) {
+        g_cancellable_disconnect (data->cancellable, data->cancel_id);
+        g_object_unref (data->cancellable);
+    }
+    g_clear_object (&data->primary_cancellable);
+    g_clear_object (&data->secondary_cancellable);
+    g_clear_object (&data->primary);
+    g_clear_object (&data->secondary);
+    g_clear_error (&data->primary_error);
+    g_free (data->input);
+    g_free (data->source_lang);
+    g_free (data->target_lang);
+    g_free (data);
+}
+
+static void
+on_caller_cancelled (GCancellable *cancellable,
+                     gpointer      user_data)
+{
+    HedgeData *data = user_data;
+
+    (void)cancellable;
+
+    /* Past the answer, only the running loser is left; see hedge_return() */
+    if (data->returned)
+        return;
+    g_cancellable_cancel (data->primary_cancellable);
+    g_cancellable_cancel (data->secondary_cancellable);
+}
+
+static void
+hedge_stop_timer (HedgeData *data)
+{
+    if (data->timer) {
+        g_source_destroy (data->timer);
+        g_clear_pointer (&data->timer, g_source_unref);
+    }
+}
+
+/* The loser may stream or finish after the task returned; it calls
+ * nobody's code any more */
+static void
+on_primary_stream (const TranslateStreamEvent *event,
+                   gpointer                    user_data)
+{
+    HedgeData *data = g_task_get_task_data (G_TASK (user_data));
+
+    if (!data->returned)
+        data->stream_func (event, data->stream_data);
+}
+
+static void
+hedge_return (GTask    *task,
+              gchar    *translated,
+              gboolean  secondary,
+              GError   *error)
+{
+    HedgeData *data = g_task_get_task_data (task);
+
+    data->returned = TRUE;
+    hedge_stop_timer (data);
+    if (data->secondary_started)
+        translate_stats_add_hedge (secondary);
+
+    if (error) {
+        g_task_return_error (task, error);
+        return;
+    }
+    data->secondary_won = secondary;
+    if ((secondary ? data->primary_running : data->secondary_running) &&
+        !translate_scheduler_withdraw (secondary ? data->primary_cancellable : data->secondary_cancellable))
+        g_debug ("[translate] Letting %s finish unused",
+                 translate_provider_get_id (secondary ? data->primary : data->secondary));
+    g_task_return_pointer (task, translated, g_free);
+}
+
+static void on_secondary_done (GObject      *source,
+                               GAsyncResult *res,
+                               gpointer      user_data);
+
+static void
+hedge_start_secondary (GTask *task)
+{
+    HedgeData *data = g_task_get_task_data (task);
+
+    hedge_stop_timer (data);
+    if (data->secondary_started)
+        return;
+
+    g_debug ("[translate] Asking %s too", translate_provider_get_id (data->secondary));
+    data->secondary_started = data->secondary_running = TRUE;
+    translate_scheduler_submit_async (data->secondary,
+                                      data->input,
+                                      data->is_html,
+                                      data->source_lang,
+                                      data->target_lang,
+                                      data->priority,
+                                      NULL, NULL,
+                                      data->secondary_cancellable,
+                                      on_secondary_done,
+                                      g_object_ref (task));
+}
+
+static gboolean
+on_hedge_timeout (gpointer user_data)
+{
+    hedge_start_secondary (user_data);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+on_primary_done (GObject      *source,
+                 GAsyncResult *res,
+                 gpointer      user_data)
+{
+    GTask *task = user_data;
+    HedgeData *data = g_task_get_task_data (task);
+    GError *error = NULL;
+    gchar *translated = NULL;
+    gboolean ok;
+
+    (void)source;
+
+    ok = translate_scheduler_submit_finish (res, &translated, &error);
+    data->primary_running = FALSE;
+
+    if (data->returned) {
+        g_free (translated);
+        g_clear_error (&error);
+    } else if (ok) {
+        hedge_return (task, translated, FALSE, NULL);
+    } else if (g_cancellable_is_cancelled (data->cancellable)) {
+        hedge_return (task, NULL, FALSE, error);
+    } else {
+        /* A failure is the slowest answer of all: do not wait for the
+         * deadline */
+        g_debug ("[translate] %s failed: %s", translate_provider_get_id (data->primary), error->message);
+        data->primary_error = error;
+        if (!data->secondary_started)
+            hedge_start_secondary (task);
+        else if (!data->secondary_running)
+            hedge_return (task, NULL, FALSE, g_steal_pointer (&data->primary_error));
+    }
+
+    g_object_unref (task);
+}
+
+static void
+on_secondary_done (GObject      *source,
+                   GAsyncResult *res,
+                   gpointer      user_data)
+{
+    GTask *task = user_data;
+    HedgeData *data = g_task_get_task_data (task);
+    GError *error = NULL;
+    gchar *translated = NULL;
+    gboolean ok;
+
+    (void)source;
+
+    ok = translate_scheduler_submit_finish (res, &translated, &error);
+    data->secondary_running = FALSE;
+
+    if (data->returned) {
+        g_free (translated);
+        g_clear_error (&error);
+    } else if (ok) {
+        hedge_return (task, translated, TRUE, NULL);
+    } else if (data->primary_running) {
+        g_debug ("[translate] %s failed, still waiting for %s: %s",
+                 translate_provider_get_id (data->secondary),
+                 translate_provider_get_id (data->primary), error->message);
+        g_clear_error (&error);
+    } else {
+        if (data->primary_error) {
+            g_clear_error (&error);
+            error = g_steal_pointer (&data->primary_error);
+        }
+        hedge_return (task, NULL, FALSE, error);
+    }
+
+    g_object_unref (task);
+}
+
+void
+translate_hedge_submit_async (TranslateProvider  *primary,
+                              TranslateProvider  *secondary,
+                              guint               delay_ms,
+                              const gchar        *input,
+                              gboolean            is_html,
+                              const gchar        *source_lang_opt,
+                              const gchar        *target_lang,
+                              TranslatePriority   priority,
+                              TranslateStreamFunc stream_func,
+                              gpointer            stream_data,
+                              GCancellable       *cancellable,
+                              GAsyncReadyCallback callback,
+                              gpointer            user_data)
+{
+    HedgeData *data;
+    GTask *task;
+
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (primary));
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (secondary));
+    g_return_if_fail (input != NULL);
+    g_return_if_fail (target_lang != NULL);
+
+    task = g_task_new (NULL, cancellable, callback, user_data);
+    g_task_set_source_tag (task, translate_hedge_submit_async);
+
+    data = g_new0 (HedgeData, 1);
+    data->primary = g_object_ref (primary);
+    data->secondary = g_object_ref (secondary);
+    data->input = g_strdup (input);
+    data->is_html = is_html;
+    data->source_lang = g_strdup (source_lang_opt);
+    data->target_lang = g_strdup (target_lang);
+    data->priority = priority;
+    data->stream_func = stream_func;
+    data->stream_data = stream_data;
+    data->primary_cancellable = g_cancellable_new ();
+    data->secondary_cancellable = g_cancellable_new ();
+    g_task_set_task_data (task, data, (GDestroyNotify) hedge_data_free);
+
+    if (cancellable) {
+        data->cancellable = g_object_ref (cancellable);
+        data->cancel_id = g_cancellable_connect (cancellable, G_CALLBACK (on_caller_cancelled), data, NULL);
+    }
+
+    /* Each job holds a reference on @task, so @data outlives both */
+    data->timer = g_timeout_source_new (delay_ms);
+    g_source_set_callback (data->timer, on_hedge_timeout, task, NULL);
+    g_source_attach (data->timer, NULL);
+
+    data->primary_running = TRUE;
+    translate_scheduler_submit_async (primary,
+                                      input,
+                                      is_html,
+                                      source_lang_opt,
+                                      target_lang,
+                                      priority,
+                                      stream_func ? on_primary_stream : NULL,
+                                      task,
+                                      data->primary_cancellable,
+                                      on_primary_done,
+                                      g_object_ref (task));
+    g_object_unref (task);
+}
+
+gboolean
+translate_hedge_submit_finish (GAsyncResult *res,
+                               gchar       **out_translated,
+                               gboolean     *out_secondary,
+                               GError      **error)
+{
+    HedgeData *data;
+    gchar *ret;
+
+    g_return_val_if_fail (g_task_is_valid (res, NULL), FALSE);
+
+    data = g_task_get_task_data (G_TASK (res));
+    ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_secondary)
+        *out_secondary = ret && data->secondary_won;
+    if (out_translated)
+        *out_translated = ret;
+    else
+        g_free (ret);
+    return ret != NULL;
+}
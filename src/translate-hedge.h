@@ -0,0 +1,72 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-hedge.h
+ * Racing a second provider against a slow one
+ */
+
+#ifndef TRANSLATE_HEDGE_H
+#define TRANSLATE_HEDGE_H
+
+#include <glib.h>
+#include <gio/gio.h>
+#include "providers/translate-provider.h"
+#include "translate-scheduler.h"
+
+G_BEGIN_DECLS
+
+/**
+ * translate_hedge_submit_async:
+ * @primary: The provider asked first
+ * @secondary: The provider started if @primary is slow or fails
+ * @delay_ms: How long @primary gets on its own
+ * @input: Text or HTML to translate
+ * @is_html: Whether @input is HTML
+ * @source_lang_opt: (nullable): Source language, or %NULL to auto-detect
+ * @target_lang: Target language code
+ * @priority: Queue to place the jobs in
+ * @stream_func: (nullable): Receives the partial output of @primary
+ * @stream_data: User data for @stream_func; must stay valid until @callback runs
+ * @cancellable: (nullable): Cancels both jobs
+ * @callback: Callback to invoke with the first translation
+ * @user_data: User data for @callback
+ *
+ * Like translate_scheduler_submit_async(), but if @primary has not
+ * answered after @delay_ms, or fails before, the same job is submitted
+ * to @secondary too. The first translation wins; the other job is
+ * withdrawn if still queued, or else runs to the end unused. The request
+ * fails only if both jobs do, with the error of @primary. Only @primary
+ * streams.
+ */
+void translate_hedge_submit_async (TranslateProvider  *primary,
+                                   TranslateProvider  *secondary,
+                                   guint               delay_ms,
+                                   const gchar        *input,
+                                   gboolean            is_html,
+                                   const gchar        *source_lang_opt,
+                                   const gchar        *target_lang,
+                                   TranslatePriority   priority,
+                                   TranslateStreamFunc stream_func,
+                                   gpointer            stream_data,
+                                   GCancellable       *cancellable,
+                                   GAsyncReadyCallback callback,
+                                   gpointer            user_data);
+
+/**
+ * translate_hedge_submit_finish:
+ * @res: The #GAsyncResult passed to the callback
+ * @out_translated: (out) (transfer full): The translated text
+ * @out_secondary: (out) (optional): Whether the secondary provider's
+ *   translation won
+ * @error: Return location for a #GError
+ *
+ * Returns: TRUE on success, FALSE if both providers failed or the
+ *   request was cancelled
+ */
+gboolean translate_hedge_submit_finish (GAsyncResult *res,
+                                        gchar       **out_translated,
+                                        gboolean     *out_secondary,
+                                        GError      **error);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_HEDGE_H */
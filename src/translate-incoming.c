@@ -0,0 +1,408 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-incoming.c
+ * Background translation of new mail from chosen folders and senders
+ *
+ * With "pretranslate-enabled" set, messages arriving in one of the
+ * "pretranslate-folders" (folder URIs), or from one of the
+ * "pretranslate-senders" (addresses, or domains written "@example.org"),
+ * are translated as they come in, at background priority, so translating
+ * one later is answered from the cache. The scheduler's queues and rate
+ * limits apply as to any other background work.
+ *
+ * New mail is noticed through CamelFolder::changed. The listed folders are
+ * opened and watched from the start; any other folder is watched from the
+ * first time MailFolderCache reports new mail in it, as long as there are
+ * sender rules to check, and the message of that report is looked at too.
+ * Only unread messages that are not junk or deleted are taken, and only
+ * INCOMING_MAX_RUNNING at a time, so the first sync of a large folder
+ * does not flood the scheduler; at most INCOMING_MAX_QUEUED wait.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <glib.h>
+#include <camel/camel.h>
+#include <e-util/e-util.h>
+#include <shell/e-shell.h>
+#include <mail/e-mail-backend.h>
+#include <libemail-engine/libemail-engine.h>
+
+#include "translate-incoming.h"
+#include "translate-common.h"
+#include "translate-content.h"
+#include "translate-utils.h"
+
+/* Messages loaded or translated at the same time */
+#define INCOMING_MAX_RUNNING 2
+/* Messages waiting beyond that; later arrivals are dropped */
+#define INCOMING_MAX_QUEUED  200
+
+typedef struct {
+    CamelFolder *folder;
+    gchar       *uid;
+} IncomingJob;
+
+typedef struct {
+    CamelFolder *folder;
+    gulong       changed_id;
+} WatchedFolder;
+
+static MailFolderCache *s_folder_cache;
+static gulong s_folder_changed_id;
+static GCancellable *s_cancellable;
+/* Folder URI → WatchedFolder*, or NULL while the folder is being opened */
+static GHashTable *s_folders;
+static GQueue s_queue = G_QUEUE_INIT;  /* IncomingJob* */
+static guint s_running;
+
+static void incoming_pump (void);
+
+static void
+incoming_job_free (IncomingJob *job)
+{
+    g_object_unref (job->folder);
+    g_free (job->uid);
+    g_free (job);
+}
+
+static void
+watched_folder_free (WatchedFolder *watched)
+{
+    if (!watched)
+        return;
+    g_signal_handler_disconnect (watched->folder, watched->changed_id);
+    g_object_unref (watched->folder);
+    g_free (watched);
+}
+
+static gboolean
+incoming_folder_is_listed (const gchar *folder_uri)
+{
+    GSettings *settings = translate_utils_get_settings ();
+    g_auto(GStrv) folders = NULL;
+
+    if (!settings)
+        return FALSE;
+
+    folders = g_settings_get_strv (settings, "pretranslate-folders");
+    return g_strv_contains ((const gchar * const *) folders, folder_uri);
+}
+
+/* Whether the sender of @from (an address header) matches a rule */
+static gboolean
+incoming_sender_is_listed (const gchar *from)
+{
+    GSettings *settings = translate_utils_get_settings ();
+    g_auto(GStrv) senders = NULL;
+    g_autoptr(CamelInternetAddress) address = NULL;
+    const gchar *email = NULL;
+
+    if (!settings || !from || !*from)
+        return FALSE;
+
+    senders = g_settings_get_strv (settings, "pretranslate-senders");
+    if (!senders[0])
+        return FALSE;
+
+    address = camel_internet_address_new ();
+    if (camel_address_decode (CAMEL_ADDRESS (address), from) <= 0 ||
+        !camel_internet_address_get (address, 0, NULL, &email) || !email)
+        return FALSE;
+
+    for (guint i = 0; senders[i]; i++) {
+        const gchar *rule = senders[i];
+
+        if (!*rule)
+            continue;
+        if (rule[0] == '@') {
+            gsize email_len = strlen (email), rule_len = strlen (rule);
+
+            if (email_len > rule_len && g_ascii_strcasecmp (email + email_len - rule_len, rule) == 0)
+                return TRUE;
+        } else if (g_ascii_strcasecmp (email, rule) == 0) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static gboolean
+incoming_has_sender_rules (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+    g_auto(GStrv) senders = NULL;
+
+    if (!settings)
+        return FALSE;
+
+    senders = g_settings_get_strv (settings, "pretranslate-senders");
+    return senders[0] != NULL;
+}
+
+static void
+incoming_consider (CamelFolder *folder,
+                   const gchar *uid,
+                   gboolean     folder_listed)
+{
+    g_autoptr(CamelMessageInfo) info = NULL;
+    guint32 flags;
+
+    if (g_queue_get_length (&s_queue) >= INCOMING_MAX_QUEUED)
+        return;
+
+    info = camel_folder_get_message_info (folder, uid);
+    if (!info)
+        return;
+
+    flags = camel_message_info_get_flags (info);
+    if (flags & (CAMEL_MESSAGE_SEEN | CAMEL_MESSAGE_JUNK | CAMEL_MESSAGE_DELETED))
+        return;
+    if (!folder_listed && !incoming_sender_is_listed (camel_message_info_get_from (info)))
+        return;
+
+    IncomingJob *job = g_new0 (IncomingJob, 1);
+    job->folder = g_object_ref (folder);
+    job->uid = g_strdup (uid);
+    g_queue_push_tail (&s_queue, job);
+}
+
+static void
+on_folder_changed (CamelFolder           *folder,
+                   CamelFolderChangeInfo *changes,
+                   gpointer               user_data)
+{
+    g_autofree gchar *folder_uri = NULL;
+    gboolean folder_listed;
+
+    (void)user_data;
+
+    if (!translate_utils_get_pretranslate_enabled () ||
+        !changes || !changes->uid_added || changes->uid_added->len == 0)
+        return;
+
+    folder_uri = e_mail_folder_uri_from_folder (folder);
+    folder_listed = incoming_folder_is_listed (folder_uri);
+    if (!folder_listed && !incoming_has_sender_rules ())
+        return;
+
+    for (guint i = 0; i < changes->uid_added->len; i++)
+        incoming_consider (folder, g_ptr_array_index (changes->uid_added, i), folder_listed);
+    incoming_pump ();
+}
+
+typedef struct {
+    gchar *folder_uri;
+    gchar *uid;  /* The message MailFolderCache reported, or NULL */
+} OpenData;
+
+static void
+open_data_free (OpenData *data)
+{
+    g_free (data->folder_uri);
+    g_free (data->uid);
+    g_free (data);
+}
+
+static void
+on_folder_opened (GObject      *source_object,
+                  GAsyncResult *res,
+                  gpointer      user_data)
+{
+    OpenData *data = user_data;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(CamelFolder) folder = camel_store_get_folder_finish (CAMEL_STORE (source_object), res, &error);
+    WatchedFolder *watched;
+
+    if (!s_folders) {
+        /* Shut down meanwhile */
+        open_data_free (data);
+        return;
+    }
+
+    if (!folder) {
+        if (!g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED)) {
+            g_debug ("[translate] Cannot watch %s for new mail: %s",
+                     data->folder_uri, error ? error->message : "unknown error");
+            g_hash_table_remove (s_folders, data->folder_uri);
+        }
+        open_data_free (data);
+        return;
+    }
+
+    watched = g_new0 (WatchedFolder, 1);
+    watched->folder = g_object_ref (folder);
+    watched->changed_id = g_signal_connect (folder, "changed", G_CALLBACK (on_folder_changed), NULL);
+    g_hash_table_replace (s_folders, g_strdup (data->folder_uri), watched);
+    g_debug ("[translate] Watching %s for new mail", data->folder_uri);
+
+    if (data->uid && translate_utils_get_pretranslate_enabled ()) {
+        incoming_consider (folder, data->uid, incoming_folder_is_listed (data->folder_uri));
+        incoming_pump ();
+    }
+    open_data_free (data);
+}
+
+static void
+incoming_watch (CamelStore  *store,
+                const gchar *folder_name,
+                const gchar *uid)
+{
+    g_autofree gchar *folder_uri = e_mail_folder_uri_build (store, folder_name);
+    OpenData *data;
+
+    if (g_hash_table_contains (s_folders, folder_uri))
+        return;
+
+    /* Claimed now, so a second report does not open it again */
+    g_hash_table_insert (s_folders, g_strdup (folder_uri), NULL);
+
+    data = g_new0 (OpenData, 1);
+    data->folder_uri = g_steal_pointer (&folder_uri);
+    data->uid = g_strdup (uid);
+    camel_store_get_folder (store, folder_name, 0, G_PRIORITY_LOW, s_cancellable, on_folder_opened, data);
+}
+
+static void
+on_cache_folder_changed (MailFolderCache *cache,
+                         CamelStore      *store,
+                         const gchar     *folder_name,
+                         gint             new_messages,
+                         const gchar     *msg_uid,
+                         const gchar     *msg_sender,
+                         const gchar     *msg_subject,
+                         gpointer         user_data)
+{
+    g_autofree gchar *folder_uri = NULL;
+
+    (void)cache;
+    (void)msg_sender;
+    (void)msg_subject;
+    (void)user_data;
+
+    if (new_messages <= 0 || !translate_utils_get_pretranslate_enabled ())
+        return;
+
+    folder_uri = e_mail_folder_uri_build (store, folder_name);
+    if (incoming_has_sender_rules () || incoming_folder_is_listed (folder_uri))
+        incoming_watch (store, folder_name, msg_uid);
+}
+
+static void
+on_incoming_translated (GObject      *source_object,
+                        GAsyncResult *res,
+                        gpointer      user_data)
+{
+    g_autoptr(GError) error = NULL;
+
+    (void)source_object;
+    (void)user_data;
+
+    /* translate-common has already put the result in the cache */
+    if (!translate_common_translate_finish (res, NULL, &error) &&
+        !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        g_debug ("[translate] Pre-translation failed: %s", error ? error->message : "unknown error");
+
+    s_running--;
+    incoming_pump ();
+}
+
+static void
+on_incoming_loaded (GObject      *source_object,
+                    GAsyncResult *res,
+                    gpointer      user_data)
+{
+    g_autoptr(GError) error = NULL;
+    g_autoptr(TranslateContent) content = translate_content_load_finish (res, &error);
+
+    (void)source_object;
+    (void)user_data;
+
+    if (!content || !content->body_html || !*content->body_html ||
+        !s_cancellable || g_cancellable_is_cancelled (s_cancellable)) {
+        if (error && !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+            g_debug ("[translate] Cannot pre-translate a new message: %s", error->message);
+        s_running--;
+        incoming_pump ();
+        return;
+    }
+
+    translate_common_translate_async (content->body_html,
+                                      content->message_key,
+                                      (const gchar * const *) content->parent_keys,
+                                      content->source_lang,
+                                      TRANSLATE_PRIORITY_BACKGROUND,
+                                      content->flags,
+                                      NULL, NULL,  /* no partial output */
+                                      s_cancellable,
+                                      on_incoming_translated,
+                                      NULL);
+}
+
+static void
+incoming_pump (void)
+{
+    IncomingJob *job;
+
+    while (s_cancellable && s_running < INCOMING_MAX_RUNNING && (job = g_queue_pop_head (&s_queue))) {
+        g_debug ("[translate] Pre-translating new message %s in %s",
+                 job->uid, camel_folder_get_full_name (job->folder));
+        s_running++;
+        translate_content_load_uid_async (job->folder, job->uid, s_cancellable, on_incoming_loaded, NULL);
+        incoming_job_free (job);
+    }
+}
+
+void
+translate_incoming_start (void)
+{
+    EShell *shell = e_shell_get_default ();
+    EShellBackend *backend = shell ? e_shell_get_backend_by_name (shell, "mail") : NULL;
+    GSettings *settings = translate_utils_get_settings ();
+    g_auto(GStrv) folders = NULL;
+    EMailSession *session;
+
+    if (s_folder_cache || !E_IS_MAIL_BACKEND (backend))
+        return;
+
+    session = e_mail_backend_get_session (E_MAIL_BACKEND (backend));
+    s_folder_cache = g_object_ref (e_mail_session_get_folder_cache (session));
+    s_folder_changed_id = g_signal_connect (s_folder_cache, "folder-changed",
+                                            G_CALLBACK (on_cache_folder_changed), NULL);
+    s_cancellable = g_cancellable_new ();
+    s_folders = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) watched_folder_free);
+
+    if (!translate_utils_get_pretranslate_enabled () || !settings)
+        return;
+
+    /* The listed folders from the start, so nothing arriving in them is missed */
+    folders = g_settings_get_strv (settings, "pretranslate-folders");
+    for (guint i = 0; folders[i]; i++) {
+        g_autoptr(GError) error = NULL;
+        g_autoptr(CamelStore) store = NULL;
+        g_autofree gchar *folder_name = NULL;
+
+        if (!e_mail_folder_uri_parse (CAMEL_SESSION (session), folders[i], &store, &folder_name, &error)) {
+            g_debug ("[translate] Not pre-translating %s: %s", folders[i], error->message);
+            continue;
+        }
+        incoming_watch (store, folder_name, NULL);
+    }
+}
+
+void
+translate_incoming_shutdown (void)
+{
+    if (!s_folder_cache)
+        return;
+
+    g_cancellable_cancel (s_cancellable);
+    g_clear_object (&s_cancellable);
+    g_signal_handler_disconnect (s_folder_cache, s_folder_changed_id);
+    g_clear_object (&s_folder_cache);
+    g_clear_pointer (&s_folders, g_hash_table_destroy);
+    g_queue_clear_full (&s_queue, (GDestroyNotify) incoming_job_free);
+}
@@ -0,0 +1,34 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-incoming.h
+ * Background translation of new mail from chosen folders and senders
+ */
+
+#ifndef TRANSLATE_INCOMING_H
+#define TRANSLATE_INCOMING_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * translate_incoming_start:
+ *
+ * Starts watching the mail session for new messages. Those that arrive in
+ * a folder listed in "pretranslate-folders", or from an address listed in
+ * "pretranslate-senders", are translated in the background into the
+ * translation cache while "pretranslate-enabled" is set. Does nothing
+ * before the mail backend exists or if already started.
+ */
+void translate_incoming_start (void);
+
+/**
+ * translate_incoming_shutdown:
+ *
+ * Stops watching and cancels every queued and running pre-translation.
+ */
+void translate_incoming_shutdown (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_INCOMING_H */
@@ -0,0 +1,456 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-inplace.c
+ * Translates the text of the displayed message where it stands
+ *
+ * With "translate-in-place" set, the message is not replaced by a
+ * translated copy of its body: the text nodes of Evolution's own
+ * rendering are rewritten, so headers, the attachment bar and the layout
+ * stay as they are. A script in the page collects the text on screen and
+ * one screen below it, grouped by paragraph, as one small HTML document
+ * that goes through translate_common_translate_async() like any other
+ * message; the result is mapped back onto the same nodes. Scrolling
+ * posts a message to the "translateInPlace" script handler, which
+ * collects and translates what came into view, so parts of a long
+ * message that are never looked at are never translated.
+ *
+ * The page keeps both texts of every node, so hiding and showing the
+ * translation swaps them without asking a provider. Loading another
+ * document drops the session and cancels its batch.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <glib.h>
+#include <e-util/e-util.h>
+#include <mail/e-mail-display.h>
+
+#include "translate-inplace.h"
+#include "translate-common.h"
+#include "translate-content.h"
+#include "translate-langid.h"
+
+#define INPLACE_HANDLER "translateInPlace"
+#define INPLACE_SESSION "translate-inplace-session"
+
+/* Installs window.__evoTranslate once per document. collect (margin)
+ * returns the text not sent yet within @margin pixels of the viewport,
+ * as <p data-evo-unit> paragraphs of <span data-evo-n> nodes; apply ()
+ * takes the translation of such a document. Text marked translate="no"
+ * or .notranslate, header labels and addresses are left alone. */
+static const gchar inplace_script[] =
+    "(function () {"
+    "  if (window.__evoTranslate)"
+    "    return;"
+    "  var SKIP = 'script,style,noscript,textarea,select,button,title,th,"
+              "a[href^=\"mailto:\"],[translate=\"no\"],.notranslate';"
+    "  var BLOCK = /^(ADDRESS|ARTICLE|ASIDE|BLOCKQUOTE|BODY|CAPTION|DD|DIV|DL|DT|FIELDSET|"
+                  "FIGCAPTION|FIGURE|FOOTER|FORM|H[1-6]|HEADER|LI|MAIN|NAV|OL|P|PRE|SECTION|"
+                  "TABLE|TBODY|TD|TFOOT|TH|THEAD|TR|UL)$/;"
+    "  var T = window.__evoTranslate = { units: [], seen: new WeakSet (), shown: false, timer: 0 };"
+    "  function blockOf (node) {"
+    "    for (var e = node.parentElement; e; e = e.parentElement)"
+    "      if (BLOCK.test (e.tagName))"
+    "        return e;"
+    "    return null;"
+    "  }"
+    /* Message parts render in iframes; rectangles are relative to each */
+    "  function frameTop (doc) {"
+    "    var y = 0;"
+    "    for (var w = doc.defaultView; w && w.frameElement; w = w.parent)"
+    "      y += w.frameElement.getBoundingClientRect ().top;"
+    "    return y;"
+    "  }"
+    "  function documents (doc, out) {"
+    "    out.push (doc);"
+    "    var frames = doc.querySelectorAll ('iframe');"
+    "    for (var i = 0; i < frames.length; i++) {"
+    "      try {"
+    "        if (frames[i].contentDocument)"
+    "          documents (frames[i].contentDocument, out);"
+    "      } catch (e) {}"
+    "    }"
+    "    return out;"
+    "  }"
+    "  function escape (s) {"
+    "    return s.replace (/&/g, '&amp;').replace (/</g, '&lt;').replace (/>/g, '&gt;');"
+    "  }"
+    "  function show (unit) {"
+    "    if (!unit.translated)"
+    "      return;"
+    "    var texts = T.shown ? unit.translated : unit.original;"
+    "    for (var k = 0; k < unit.nodes.length; k++)"
+    "      if (unit.nodes[k].data !== texts[k])"
+    "        unit.nodes[k].data = texts[k];"
+    "  }"
+    "  T.collect = function (margin) {"
+    "    var top = -margin, bottom = window.innerHeight + margin, first = T.units.length;"
+    "    var docs = documents (document, []), html = [];"
+    "    for (var d = 0; d < docs.length; d++) {"
+    "      var doc = docs[d], dy = frameTop (doc), unit = null, node;"
+    "      if (!doc.body)"
+    "        continue;"
+    "      var walker = doc.createTreeWalker (doc.body, NodeFilter.SHOW_TEXT), range = doc.createRange ();"
+    "      while ((node = walker.nextNode ())) {"
+    "        if (T.seen.has (node) || !/\\S/.test (node.data) || !node.parentElement ||"
+    "            node.parentElement.closest (SKIP))"
+    "          continue;"
+    "        range.selectNodeContents (node);"
+    "        var r = range.getBoundingClientRect ();"
+    "        if ((r.width == 0 && r.height == 0) || r.bottom + dy < top || r.top + dy > bottom) {"
+    "          unit = null;"
+    "          continue;"
+    "        }"
+    "        var block = blockOf (node);"
+    "        if (!unit || unit.block !== block) {"
+    "          unit = { block: block, nodes: [], original: [], translated: null };"
+    "          T.units.push (unit);"
+    "        }"
+    "        T.seen.add (node);"
+    "        unit.nodes.push (node);"
+    "        unit.original.push (node.data);"
+    "      }"
+    "    }"
+    "    for (var u = first; u < T.units.length; u++) {"
+    "      var text = '', prev = '';"
+    "      T.units[u].original.forEach (function (data, k) {"
+    "        if (k > 0 && (/\\s$/.test (prev) || /^\\s/.test (data)))"
+    "          text += ' ';"
+    "        text += '<span data-evo-n=\"' + k + '\">' + escape (data.trim ()) + '</span>';"
+    "        prev = data;"
+    "      });"
+    "      html.push ('<p data-evo-unit=\"' + u + '\">' + text + '</p>');"
+    "    }"
+    "    return html.join ('\\n');"
+    "  };"
+    /* A provider may merge or drop spans; their text then goes to the
+     * nearest node that survived, or to the first node of the paragraph */
+    "  T.apply = function (html) {"
+    "    var tpl = document.createElement ('template');"
+    "    tpl.innerHTML = html;"
+    "    var paras = tpl.content.querySelectorAll ('[data-evo-unit]');"
+    "    for (var i = 0; i < paras.length; i++) {"
+    "      var unit = T.units[+paras[i].getAttribute ('data-evo-unit')];"
+    "      if (!unit || unit.nodes.length == 0)"
+    "        continue;"
+    "      var texts = unit.original.map (function () { return ''; });"
+    "      var spans = paras[i].querySelectorAll ('[data-evo-n]');"
+    "      if (spans.length == 0)"
+    "        texts[0] = paras[i].textContent.trim ();"
+    "      for (var j = 0; j < spans.length; j++) {"
+    "        var k = +spans[j].getAttribute ('data-evo-n');"
+    "        if (k >= 0 && k < texts.length)"
+    "          texts[k] += (texts[k] ? ' ' : '') + spans[j].textContent.trim ();"
+    "      }"
+    "      unit.translated = texts.map (function (text, k) {"
+    "        return unit.original[k].match (/^\\s*/)[0] + text + unit.original[k].match (/\\s*$/)[0];"
+    "      });"
+    "      show (unit);"
+    "    }"
+    "  };"
+    "  T.show = function (on) {"
+    "    T.shown = on;"
+    "    T.units.forEach (show);"
+    "  };"
+    /* After a failed batch: collect its text again next time */
+    "  T.forget = function () {"
+    "    T.units.forEach (function (unit) {"
+    "      if (unit.translated)"
+    "        return;"
+    "      unit.nodes.forEach (function (node) { T.seen.delete (node); });"
+    "      unit.nodes = [];"
+    "      unit.original = [];"
+    "    });"
+    "  };"
+    "  function onScroll () {"
+    "    clearTimeout (T.timer);"
+    "    T.timer = setTimeout (function () {"
+    "      if (T.shown && window.webkit && window.webkit.messageHandlers." INPLACE_HANDLER ")"
+    "        window.webkit.messageHandlers." INPLACE_HANDLER ".postMessage ('scroll');"
+    "    }, 150);"
+    "  }"
+    "  window.addEventListener ('scroll', onScroll, { passive: true });"
+    "  window.addEventListener ('resize', onScroll);"
+    "})();";
+
+typedef struct {
+    GCancellable *cancellable;  /* Cancelled when the document goes away */
+    gchar        *source_lang;  /* Detected on the first batch, may stay NULL */
+    gboolean      detected;
+    gboolean      shown;        /* Translations are displayed */
+    gboolean      busy;         /* A batch is being collected or translated */
+    gboolean      rescan;       /* The view scrolled while busy */
+} InPlaceSession;
+
+/* One collect-translate-apply round of a session */
+typedef struct {
+    EMailDisplay *display;
+    GCancellable *cancellable;  /* The session's */
+} InPlaceBatch;
+
+static void inplace_scan (EMailDisplay *display);
+
+static void
+inplace_session_free (gpointer data)
+{
+    InPlaceSession *session = data;
+
+    g_cancellable_cancel (session->cancellable);
+    g_object_unref (session->cancellable);
+    g_free (session->source_lang);
+    g_free (session);
+}
+
+static InPlaceBatch *
+inplace_batch_new (EMailDisplay   *display,
+                   InPlaceSession *session)
+{
+    InPlaceBatch *batch = g_new0 (InPlaceBatch, 1);
+
+    batch->display = g_object_ref (display);
+    batch->cancellable = g_object_ref (session->cancellable);
+    return batch;
+}
+
+static void
+inplace_batch_free (InPlaceBatch *batch)
+{
+    g_object_unref (batch->cancellable);
+    g_object_unref (batch->display);
+    g_free (batch);
+}
+
+/* The session @batch belongs to, or NULL if that document is gone */
+static InPlaceSession *
+inplace_batch_session (InPlaceBatch *batch)
+{
+    if (g_cancellable_is_cancelled (batch->cancellable))
+        return NULL;
+    return g_object_get_data (G_OBJECT (batch->display), INPLACE_SESSION);
+}
+
+/* Runs @call after making sure the page script is installed */
+static void
+inplace_run (EMailDisplay       *display,
+             const gchar        *call,
+             GCancellable       *cancellable,
+             GAsyncReadyCallback callback,
+             gpointer            user_data)
+{
+    g_autofree gchar *script = g_strconcat (inplace_script, call, NULL);
+
+    webkit_web_view_evaluate_javascript (WEBKIT_WEB_VIEW (display), script, -1, NULL, NULL,
+                                         cancellable, callback, user_data);
+}
+
+/* The batch is done: collect again if the view moved meanwhile */
+static void
+inplace_batch_done (InPlaceBatch   *batch,
+                    InPlaceSession *session)
+{
+    session->busy = FALSE;
+    if (session->rescan && session->shown) {
+        session->rescan = FALSE;
+        inplace_scan (batch->display);
+    }
+    inplace_batch_free (batch);
+}
+
+static void
+on_inplace_translated (GObject      *source_object,
+                       GAsyncResult *res,
+                       gpointer      user_data)
+{
+    InPlaceBatch *batch = user_data;
+    InPlaceSession *session;
+    g_autofree gchar *translated = NULL;
+    g_autoptr(GError) error = NULL;
+    gboolean ok;
+
+    (void)source_object;
+
+    ok = translate_common_translate_finish (res, &translated, &error);
+    session = inplace_batch_session (batch);
+    if (!session) {
+        inplace_batch_free (batch);
+        return;
+    }
+
+    if (ok) {
+        /* The jsc printf quotes %s as a JavaScript string */
+        e_web_view_jsc_run_script (WEBKIT_WEB_VIEW (batch->display), session->cancellable,
+                                   "window.__evoTranslate.apply (%s);", translated);
+    } else {
+        g_warning ("[translate] In-place translation failed: %s",
+                   error ? error->message : "unknown error");
+        e_web_view_jsc_run_script (WEBKIT_WEB_VIEW (batch->display), session->cancellable,
+                                   "window.__evoTranslate.forget ();");
+    }
+    inplace_batch_done (batch, session);
+}
+
+/* Whether the displayed message may go to online fallbacks */
+static TranslateRequestFlags
+inplace_request_flags (EMailDisplay *display)
+{
+    EMailPartList *part_list = e_mail_display_get_part_list (display);
+    CamelFolder *folder = part_list ? e_mail_part_list_get_folder (part_list) : NULL;
+
+    return folder ? translate_content_flags_for_folder (folder) : TRANSLATE_REQUEST_NONE;
+}
+
+static void
+on_inplace_collected (GObject      *source_object,
+                      GAsyncResult *res,
+                      gpointer      user_data)
+{
+    InPlaceBatch *batch = user_data;
+    InPlaceSession *session;
+    g_autoptr(JSCValue) value = NULL;
+    g_autofree gchar *html = NULL;
+    g_autoptr(GError) error = NULL;
+
+    value = webkit_web_view_evaluate_javascript_finish (WEBKIT_WEB_VIEW (source_object), res, &error);
+    session = inplace_batch_session (batch);
+    if (!session) {
+        inplace_batch_free (batch);
+        return;
+    }
+
+    if (value && jsc_value_is_string (value))
+        html = jsc_value_to_string (value);
+    else if (error)
+        g_warning ("[translate] Could not collect the message text: %s", error->message);
+
+    if (!html || !*html) {
+        inplace_batch_done (batch, session);
+        return;
+    }
+
+    /* A screenful is too little text to tell languages apart reliably,
+     * so the first batch decides for the whole message */
+    if (!session->detected) {
+        session->source_lang = g_strdup (translate_langid_detect_html (html));
+        session->detected = TRUE;
+    }
+
+    translate_common_translate_async (html, NULL, NULL, session->source_lang,
+                                      TRANSLATE_PRIORITY_INTERACTIVE,
+                                      inplace_request_flags (batch->display), NULL, NULL,
+                                      session->cancellable, on_inplace_translated, batch);
+}
+
+/* Translates what is in view now, or once the batch in flight is done */
+static void
+inplace_scan (EMailDisplay *display)
+{
+    InPlaceSession *session = g_object_get_data (G_OBJECT (display), INPLACE_SESSION);
+
+    if (!session || !session->shown)
+        return;
+    if (session->busy) {
+        session->rescan = TRUE;
+        return;
+    }
+
+    session->busy = TRUE;
+    /* One screen of look-ahead, so scrolling rarely reveals untranslated text */
+    inplace_run (display, "window.__evoTranslate.collect (window.innerHeight);",
+                 session->cancellable, on_inplace_collected, inplace_batch_new (display, session));
+}
+
+static void
+on_inplace_script_message (WebKitUserContentManager *manager,
+                           WebKitJavascriptResult   *js_result,
+                           gpointer                  user_data)
+{
+    (void)manager;
+    (void)js_result;
+
+    inplace_scan (E_MAIL_DISPLAY (user_data));
+}
+
+/* The page script and its state die with the document */
+static void
+on_inplace_load_changed (WebKitWebView  *web_view,
+                         WebKitLoadEvent load_event,
+                         gpointer        user_data)
+{
+    (void)user_data;
+
+    if (load_event == WEBKIT_LOAD_STARTED)
+        g_object_set_data (G_OBJECT (web_view), INPLACE_SESSION, NULL);
+}
+
+static InPlaceSession *
+inplace_ensure_session (EMailDisplay *display)
+{
+    InPlaceSession *session = g_object_get_data (G_OBJECT (display), INPLACE_SESSION);
+
+    if (session)
+        return session;
+
+    /* Connect once per display; the handlers look the session up themselves */
+    if (!g_object_get_data (G_OBJECT (display), "translate-inplace-hooked")) {
+        WebKitUserContentManager *manager =
+            webkit_web_view_get_user_content_manager (WEBKIT_WEB_VIEW (display));
+
+        webkit_user_content_manager_register_script_message_handler (manager, INPLACE_HANDLER);
+        g_signal_connect_object (manager, "script-message-received::" INPLACE_HANDLER,
+                                 G_CALLBACK (on_inplace_script_message), display, 0);
+        g_signal_connect (display, "load-changed",
+                          G_CALLBACK (on_inplace_load_changed), NULL);
+        g_object_set_data (G_OBJECT (display), "translate-inplace-hooked", GINT_TO_POINTER (1));
+    }
+
+    session = g_new0 (InPlaceSession, 1);
+    session->cancellable = g_cancellable_new ();
+    g_object_set_data_full (G_OBJECT (display), INPLACE_SESSION, session, inplace_session_free);
+    return session;
+}
+
+void
+translate_inplace_show (EMailDisplay *display)
+{
+    InPlaceSession *session;
+
+    g_return_if_fail (E_IS_MAIL_DISPLAY (display));
+
+    session = inplace_ensure_session (display);
+    if (session->shown)
+        return;
+
+    session->shown = TRUE;
+    inplace_run (display, "window.__evoTranslate.show (true);", session->cancellable, NULL, NULL);
+    inplace_scan (display);
+}
+
+void
+translate_inplace_hide (EMailDisplay *display)
+{
+    InPlaceSession *session;
+
+    g_return_if_fail (E_IS_MAIL_DISPLAY (display));
+
+    session = g_object_get_data (G_OBJECT (display), INPLACE_SESSION);
+    if (!session || !session->shown)
+        return;
+
+    /* A batch still in flight lands hidden, ready for the next show */
+    session->shown = FALSE;
+    inplace_run (display, "window.__evoTranslate.show (false);", session->cancellable, NULL, NULL);
+}
+
+gboolean
+translate_inplace_is_shown (EMailDisplay *display)
+{
+    InPlaceSession *session;
+
+    if (!display)
+        return FALSE;
+
+    session = g_object_get_data (G_OBJECT (display), INPLACE_SESSION);
+    return session && session->shown;
+}
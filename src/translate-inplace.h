@@ -0,0 +1,39 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-inplace.h
+ * Translates the text of the displayed message where it stands
+ */
+
+#ifndef TRANSLATE_INPLACE_H
+#define TRANSLATE_INPLACE_H
+
+#include <glib.h>
+#include <mail/e-mail-display.h>
+
+G_BEGIN_DECLS
+
+/**
+ * translate_inplace_show:
+ * @display: The display showing the message
+ *
+ * Shows the translation of @display's message in place: the text on
+ * screen (and one screen beyond) is translated first, and the rest as it
+ * is scrolled into view. Text translated earlier is shown again at once.
+ */
+void translate_inplace_show (EMailDisplay *display);
+
+/**
+ * translate_inplace_hide:
+ * @display: The display showing the message
+ *
+ * Puts the original text back. The translations are kept for
+ * translate_inplace_show() until another document is loaded.
+ */
+void translate_inplace_hide (EMailDisplay *display);
+
+/* Whether @display shows in-place translations */
+gboolean translate_inplace_is_shown (EMailDisplay *display);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_INPLACE_H */
@@ -0,0 +1,1782 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Generated by scripts/make-langid-profiles.py; do not edit.
+ * The most frequent trigrams of each language, most frequent first,
+ * separated by '|'; a space marks a word boundary. */
+
+#ifndef TRANSLATE_LANGID_PROFILES_H
+#define TRANSLATE_LANGID_PROFILES_H
+
+static const struct {
+    const gchar *code;
+    const gchar *trigrams;
+} langid_profiles[] = {
+    { "en",
+      "ed | th| in|ing|ng | re|the|le | co| to|on |or |ile|ion| no|he |to |es |"
+      "er |not|ot | fi|tio| fo|for|is |fil|ent|nd |te |in | pa|ect| is| of|ate|"
+      "se | se| a |of | pr|nt |ter|and|re | de| us| an|ati|it | ca| un|con|ted|"
+      " di|me |rea| st|ge | ex|ame|val|st |th | li|com|ry |id |use|al |ut | wi|"
+      " ma| ch|ble|ess|res|ver|nam| op| be|tin| ar|ali|rec|an |et |sta|ead|ith|"
+      "age|ail|all| on|abl|can|err|lin|ve |ack|tor| al|wit|ch |ly |ce |ist|en |"
+      "ts |int|at | ke| su|ire| or|key|as |lid|led| do|ll |ne |ad | lo|out| na|"
+      "ns |ers| fa|cha| er|rro|ine|cat|ror| en|pec|no |pti| si|rin|mat|omm| me|"
+      "ld |pro|nte|dat|ive|ser|pac|opt|dir| gi|ort|ory|men|ign|ste|pre|inv| sp|"
+      "ons|be |sio| wh|fai|ann|han|che| va|nva|ont| sh|de |ica| tr|nno| mo|thi|"
+      "ss |orm|str|ifi|set| ha|les|ey |nge| fr|ang|cte|om |cti|red|his|ins|rom|"
+      "ase|are|exp| ne|ssi|emo|rt |por|ct |sin| so| wa|put|ck | as|ran| by|spe|"
+      "man|ren|rit|loc|par|git|rem|eci|rd |ow |enc|you|rma| cr| nu| ou|tch|rs |"
+      "act|arg|ore| yo|fro|cre| sy|pat|fie|ume|tri|ove|cto|cou|pri|ult| da|ces|"
+      "lis|end|din| ba|ure|oul|uld| ad|lic|ber|sig|wor| ve|ind| he|num|ope|ass|"
+      " ta|per|ere|one|rac|rat|tur|ref|mit| bu|ode|mod|rsi|ite|low|ty |nal|ue |"
+      "eat|oun|ic |nst|est|equ|ara|mes|ord|pe |add|llo|ain|mbe|our| s |cif|omp|"
+      "own|sup|mma|ay |tra|whi| t | up|nde|her|upp|tes|tat|sho|iti|chi|nin|alu|"
+      "ele|ple|dis|unk|ach| at|pen| mu|ize|nat| mi|onf|har|lue|ern|by |sh |tem|"
+      "war|atc|rep|ata|ds |ext|up |tab|nly|qui| ge|cka|exi|atu|ert|typ|ype|nab|"
+      " po|onl|kag|req|umb|nti|tre|ou |mov|rge|sed|def|ust| ap|nta|nce|era| le|"
+      "rce| it|ntr|ori|ied|hen|lt |arc|wri|get|inc|ote|cur|us |eco|und|app|ock|"
+      "hil|sag| la|lea|ppo|cal|utp|tpu|ide| ty|der|una|em |jec| ac| if|oca|ges|"
+      " wr|ime|tar| gr|tim| au|tic|if |fic|ten|tha|rch|mer| ti| te|mmi|ete|pla|"
+      " bi|pos| n |ina|has|ee |hel|pas|wn |new|gna|rou|tal|rti| br|nk | cl|nor|"
+      "lat|now|but|cke|bas|rte|unt| ob|how|fer|inf|eve|nfo|rgu|gum|aut| wo|tai|"
+      "mis|cor|anc|aul|min|ze |iss|fau|ill|rre|ree|emp|erv|bje|efa|kno|oes|pli|"
+      "ena|sub| im|doe|nch|tte|des|ath|bra|art|ies|ace|ard|hin|sec|nts|xpe| ra|"
+      "obj|ded|fin|sou| id|ial|urc|tiv|let|ta |pt |edi|ini|ex |sti|eas|ar |gno|"
+      "uir| ru|cod|att|ast|erm|am |eck|ls |nkn|dif|hec|eri|reg|nfi|osi|rev|med|"
+      "roc|pda| pl|non|do |gs |del|upd|gro|gra|kin|rna|ork| ig|tru|sys|ues|mus|"
+      "ari|met|try|hea|fig|whe|run|hat|any|erg|sel|ink|ner|rie|xis|ew |siz|ars|"
+      "len|oce| pi| sa|ary| ho|mor|gin|yst|oup|sit|too|oll|epo|mpl|que|ppl|ol |"
+      "den|rve|fou|arn|ger|el |its|tif|dex|col|tia| pe| em|nes|inp|log|ret|ave|"
+      "ven|oth|ssa|tho|ian|ecu|npu|ice|nit|sse|sto|ke |lle|ese|ade|rni|ny |lti|"
+      "xt |gen|mpo|mpt|rse|ks |ett|ssw|acc|uth|ys |spa|ify|ule|ose|oo | cu|rmi|"
+      "lon|ndi| ab|ity|ked|elp|sen|lay|tag| sc| ro|usi|ria|ned|cac|swo| qu|eld|"
+      "bad|ix |eed|ash|hou|evi|yte|urr|sym|cer|byt|ram|cce|ake|ddr|ost|tex|ute|"
+      " ce|iel|adi|hiv|ip |tti|efe|usa|ong|eme| ov| du| fu|she|mul|win|las|ito|"
+      "fol|lly|giv| pu|bac|ict|pon|tro|fy |nco|iff|hun| hu|nds|ses|odu|igu|een|"
+      "um |rig|eta|mai|spl|lem|dia|eac|lp |fix|bin|ur |lab|owe|dre|lec|scr|bit|"
+      "cts|uns|mot|nse|mon|ir |mem|lar|ged|hav|un |ene|eys|ket| c |dul|mal|ppe|"
+      "ema|tus|dit|pin|egi|was|imp|loa|ima|ig |ull| d |tan|ild|clo|ffe|rn |nsi|"
+      "nda| sk|dd |cip|dy |xit|ell|ff |pty|clu|may|isa|efi|rl | bl| af|cri|uil|"
+      "wil|eam|nci|ogr|uri|oke| e |ear|dep|oad|rip|unc|rol| ea|als|det|orr|oli|"
+      "nne|ish| x |cks|mag|iat|ant|bui| f |gur|ful|teg|ski|mak|dec|var|ede| bo|"
+      "eng|aft|top|tea|kip|ens|odi| ur|mar|sol|rog|syn|irs|fte|vin|mbo|vel|wer|"
+      "tec|ual| av|eso|ps |sts|hed|isp|lud|bol|lie|ude|sam|see|ved|net|ila|fli|"
+      "oin|ady|off|vic|epa|fo | l |ymb|uff| m | fl|deb|gis|eal|op |hes|mme|ric|"
+      "uct|lit|ome|ava|ndl|abo|ffi|wed|esp|dow|sum|ero| r |mpr|aba|lte| we|ubm|"
+      "alt|ato|uti| i |itt|pal|blo|std|lre|rst|nfl| p |iab|ft |ap |alr|don|bmo|"
+      "hem|ege| vi|ond|exe|ax |esc|xpr|exc|vai|gni|hor|il |ruc|fir|hic|ag |nex|"
+      "ook| fe|nec|dle|ovi|sor|dar|imi|old|ec |inu|epe|ipa|emb|une|liz|ece|rib|"
+      "rk |ctu|ipt|tip|rel|urn|nen|igh|cum|og | hi|sab|ean|efo|sha|cy |gor|uni|"
+      "ous|oft|ona|eli|ncr|nto| v |ipl|yin|cop|nee|soc|ron|doc|hos|vid|ans|eti|"
+      "ncl|ula|nre|sof|rus|xte|nks|lac|xec|ili" },
+    { "de",
+      "en |er |ich|ein| de|sch|der|cht|ung|den|te | be|ht |ver| au| da| ni|che|"
+      "nic|nde|es |ie | un| di|ate|in | ei|dat|gen| ve|on |die| in|ben|ert|ch |"
+      "ten|nte|ier|zei| we|ist|ter|rde|tei|ng |it |ine|rt | an|ion|ers|wer| vo|"
+      "ste|ere|eic| si| ge|end|st |nge|ent| zu|ehl|feh|ren|nen| er| ko|ige| fe|"
+      "aus|ne |sse|tio|hen|ei | is|eit| re|nd |le |erd| fü|mit|chl|men|et |sie|"
+      "ber| pa|für|ür |auf|ann|bei|und| wi|hle|ell|tig|von|sta| sc| ke|nn |ebe|"
+      "des|abe|rei|kan|ese|kei|ges| st|len|de |rte|ern| ze|nnt|ge |geb| mi|ler|"
+      "kon|sen|im |ang|lle|ame| se| al|lti|erz|isc|run|and|erw|wen|sel|hre| en|"
+      "rze|rd | ka| pr|ült|gül|ode|for|nam|ind|lte|her|ati|üss|uf | ar|wir|chn|"
+      "nis|lis|em | na|nt | op|zu |eru| co|tze|das|se |lüs|el |hlü|ege|ite|pti|"
+      "ird|as | ab|ile|gab|chr|ls |tel|all|rst|ies|esc|opt|um |usg|us |ngü|unt|"
+      " le|re |me | od|eil|eim|ach|ket|war|lic|one|alt|vor|ger|ing|lt | me|ur |"
+      "rwe|tzt|ass|onn|he | nu|hni|ort|nut|utz|enn|pro|is |fer|orm| gi|omm|ner|"
+      "mat|zen|akt|at |ign|enu| bi|int|etz|übe|ess|ien|efe|age| fo|als|art|spe|"
+      "set|tet|hl | üb|hal|ens|be | um| ak|ser|mer|git|mme|ene|eig|nst|its|rma|"
+      "lge|anz| ha|tie|geg|wei|rie| so|gt |tte|änd|ete|les|ekt|kom|al |lie|ngs|"
+      " ma|tes|gef|fun| im|zt |res|uch| no|ll |rch|ts |ume|ake| gr|ins|zer|nze|"
+      " sp| sy|wur| wu| li|tat|urd|rsc| ta|era|pak|est|gel|erh|chi|erf|ali|sio|"
+      "tor| wa|sge|ss |com|eib|sig|rsi|ran| ne|ktu|or |ck |rbe| ex|det|erg|erl|"
+      "eie|nac|ig |ech|ele|itt|err|tra|lag|kti|ahl|str|nne|sti|fen|atu|ühr|kt |"
+      "oll|arg|rge|füh|ord|eld|lau|ori|dar|rha| es|rti|tan|ede|rne|mmi|wor|isi|"
+      "rn |zie| hi|nun| he|zah|mod|onf|bef|ifi|uel|nfo|tiv|sin|rec|ini|pas|neu|"
+      "an |erb|tem|dem|nur|hla|arb|pri|sei|lei|ütz|nal|erk|ale|nbe|cke| ob|amm|"
+      "wie| su|ons|iti|iel|dun|ück|inf|ard|ref|stü|ken|rgu|typ|gum|odu|rüc| fi|"
+      " mu|pei|per|enz|nga|id |tur|bek| n |nda|ble|urc| br|ast| te|zum|tre|ibe|"
+      "fol|bes|mus|sga|tüt|rat|hlg|eme| lo|pat|lun|rea|lös|ric|rla|bit|llt|olg|"
+      "egi| fa|tfe|ntf|han|tas|erv|nor|ext|unb|äng|omp|lin|gli|rwa|ont|ad |hne|"
+      "hte|ar | tr|ack|ina|hin|eue|tri|ntr|spr|rag|bra|arc|bin|bje|eis|gna|nat|"
+      "zur| s |ruf|eka|reg| ad|tch| än|are|obj|bar|nie|fal|jek|cha|uss|sic|ide|"
+      "con|tim|chs|sit|net| du|nch|ive|elt| qu|att|igu|efu|pos| la|gra|aut|ppe|"
+      " mo|sam|füg|tab|par|num|ade|zus|ehe|leg|prü|bun|dur|ndu|tif|vie|tal|rve|"
+      "anc|hri|mal|pfa|gno|kat|zug|suc|ika|rin|ssw|ock|atc|dig|tar|osi|sys|rna|"
+      "fig|aub|ram|igt|eri| do|que|ns |ld |ehr|yp |rse|ual|nfi|ndi|fil|hei| ig|"
+      "gru|kte|abl|bt | bl|ce |yst|iff|nes|ry |umm|nit|pe |swo| sh|ve |ex |eer|"
+      "ied|tun| ba|nwe|exi|hel|tua|nzu|rüf|zwi|pac|met|ag |arn|rer|lee|ore|ope|"
+      "ösc|fik|rnu|ead|om | kö|am |fin|rfo|ett|meh|zeu|eug|öff|och|kön|önn|upp|"
+      "dir|tex|rs |por|dre|fad|ari|uge|lem| gü|gur| id|nta|lat| mö|ust|loc|sym|"
+      "wäh|dex|ft |nth|il | ch|nti|sh |rep|gew|epo|geh|nem|hat|unk| po|lli|oze|"
+      "hie|ruc|gis|bel|rit|ffe|pen|rem| zw|pre| zi|mma|ed |rup|enb|ito|emp|min|"
+      "nk |tag|man|erm|zte|mel|zes|ieb| ho|xis| ty|yte|ink|mög|ögl|adr|byt|ufe|"
+      " pf|hes|lls|ote|eln|inz|hlt|mbo|fli|roz|mpo|sol|emo|bge|zun|ute|hiv|ild|"
+      "xt |wis|ibu|ymb|dus|nkt|imm|bol|iv |tis|pal|gin|no |äre|fel| pi|abg| us|"
+      " a |ogr|lsc|uer| ro|rau|ut |iss|etr|blo|rek| by|hli|ufr|org|alb|fne| lö|"
+      "bas|rre| je|sve| ih|kop|izi|eta|ffn|eut|ena|ßer|ses|ähl|fra|rig|get|gs |"
+      "usf|tt |ase|hän|beg|let|tzu|ält|ezi|lan|fru|imi|llu|ndo|not|use|grö|sfü|"
+      "nke|inn|röß| d |bee|hr |nts|anw|lde| vi| oh|rog|een|lb |erp|tue|ivi|öße|"
+      "nza|ire| c |ln |ela|usa|cod|mie|ohn|tro|dul|tli|eng|oni|nsp| za|sub| e |"
+      "ke |gem|ail|inc|las|enk|gle|pie|var|spa|rif|uße|tsc|ria|log|ura|rsp|uck|"
+      "auß|ash|dru|hab|ssi|ank| or|aft|ihr|ue |bil|gun|ban| ur|gan|auc| ap|ze |"
+      "elp| fr|ory|pt |häl|jed|urü|pel|ubt|ff |orh|zuf|tsp| f |edi|rbi|ara|tst|"
+      "itu| wo|tus|inh|usd|ise|ema|ima|del|rpr|rhe| x |nba|ato|ufg|rnt|kal|twe|"
+      "tsv|rda| l |ial|gri|ars| r | m |ull|ix |she| b |sdr|üge|the|out|fe |uto|"
+      "els| kl|bre|gro|haf|umb|une|ße | gl| va|eck|rsu| t |ect|ieß|ebu|efü|anf|"
+      "abs|cks|iab|rli|hea|nsc|sis|oka|ßen|nnu|uen|nöt|öti| ti|sst|syn|thä|eda|"
+      "nul|rl |sda|lok| öf|mot| to|ewe|elb|kze| em| p |hol|hrt|bmo|ubm|lad| pu|"
+      "ibt|bis|mpr| ga|fte|rom|nz |cip|gre|nha" },
+    { "fr",
+      " de|de |es |le |ion|er |on | le|tio|re |ur | co|ent| pa|nt | in| la|ne |"
+      "la |les|ns |fic| un| no|te |our| d | l |eur|ich|que| re|ble|ier|ati| en|"
+      " po|chi| fi|men|pas|con| dé|est|as | es|lis|res|cti|st |tre|che|ect|des|"
+      "hie|un |ue |pou|et | li| su|ssi|ans|com|dan|ire| se| ré|du | pr|ge |ibl|"
+      "rs |en |uti| da|ant| à |ess|par| im|pos|onn|ts | du|age|ée |ons|eme| n |"
+      "ver|ili| au|it |til|se |val|mpo|nte|ign| ch|imp|ist|ter| so| ut| ma|rre|"
+      "ce |une|ont|ali|iqu| op|ers|sib| ne|cha|nom|sio| ex|ise|ec |oss|us |ten|"
+      "omm|str| av| mo|ut |me |nde|and|ide|lle|ser|ifi| tr|ort|ert| ou| va| ar|"
+      "ave|is |err|ar |tte|non| a | sy| pe|ure|aut| qu| ve| si| et| do| fo|act|"
+      " éc|rti|sse| lo|rée|ive|ran|sec|ntr|inc| ce| er|sta|rec|man|nti|per|pti|"
+      "nco|ale|int|cor|for| di|pro|cat|ite|té |ou |vec|end|opt|ir |ins|tur|nce|"
+      "abl|omp|ées|déf|ode| ca|sup|reu|ie |ffi| ta|isa|att|at |ill|ica|arg|om |"
+      "ind|ren|ez |ouv|orm|pre|anc|lid|êtr|oir|au | êt|fin|mat|ous|ate|mod|upp|"
+      " af|ini|por|dre|tif|teu|nst|aff|her|sym|rou| st|pe |ssa|lig|air|tie|orr|"
+      " at|ces|éch|gne|al |pri|tro|mme|enc|reg|ien| ét|mbo|tra|he |tai|tes|rma|"
+      "ymb|bol| ap|ére|tan|leu|ara|nne|és |ais| pl|peu|ve |ule|son|sat|ett|egi|"
+      "rép| al|aqu|in |inv| ac| cl|sur|tiv|gis|rer|tou|épe|ste|iti|uet|min|ail|"
+      "adr|cod|rai|cte| to|ass| te|urs| bi|ole|pér| ob|ère|sag|sou|ell|ors|rch|"
+      "nnu|nts|éfi| vo|tat|rsi|ux | sa|née|ctu|out|uve|don|qui| s |éra|cal|typ|"
+      "nva|ace|ype|rem|el |éci|tru|eut|pré|erm|app| gr|toi|all| b |tré|nu |loc|"
+      "ine|nné|rat|bre|uct| cr|cri| sp|isé|dif| ty|nda| gi|arc|sig|ina|san|rto|"
+      "mma|ets|nat|éri|ruc|jou| me|hec|paq|rge|lie|emp|mpl| vi|git|exp|rac|oit|"
+      "si |lus|ndu|onf|nor|ute|car|ait|pon|ext|il | ad|ond|mit|ume|dép|cré|sor|"
+      "écu|rit|esp|nd |nal|auc|rop|rt |ité|fér|den|fau|oca|jet|gno|tab|réa|pla|"
+      "spé|cer| id| fa|rgu|uis|péc|inf|har|ern|écr| ba|lon|lor| mi|lec|mis|seu|"
+      "ppo|rce|tiq|plu|dis|ppr| ig|nit|ndi| nu|nfo|opé|sem|ens|ré |mbr|spo|its|"
+      "déc|lem|ang|rés|cun|tem|nta|cle|op |sé | sé|doi|vou|pli|ucu|rmi|cif|omb|"
+      "ori|exi|art|obj|ile|ram|éfa|rel| an|bje|gra|ase|mai|emi|qua|ris|dat|éta|"
+      "réf| br|mer| il|dex|ef |gna|nch|iff|été|eau|rie| gé|ls |réc|iss|nir|bit|"
+      "ala|tri|bas|dir| oc|num|lef|uan|id |ex |mot|fil|cou|ime|uer|ner|usi|liq|"
+      " x |ieu|édi|eco|ues|bra|ll |imi|erv|ème|tèr|rte|lat|ore|oin|uel|nes|gro|"
+      "oup|aux|uil|lag|ctè|lit|nue|ult|ct |mes|met|nfi|tal|sui|gum|nqu|urc|rim|"
+      "pac|oct| he|rro|der|vai|ttr|éro|lac|roc|ès |ach|hor|han|umé|dit|éme|ava|"
+      "ro |uiv|ong|veu| ho|amp| jo|if |ête|exé|cet|van|upe| mé|éad|tet|fie|sée|"
+      "lim| pi|éné|odi|xte|ord|gén|uto|ui |atu|pen| ab|nér|eul|nge|ple|anq|hem|"
+      "pui|ron|onc|rne|mér|sys|qué|ima|equ|sti|cut|tor|pu |ch |ot |oré|ué |fix|"
+      "éfé|mp |rté|no |tée|rd |né | ra|rni|ni |rip| sh|cho|fon|xéc|lic|emb|ps |"
+      "req|moi|mal|hiv|acc|ard|ppl|tag| as|yst|tec|déb|rir|ges|xe |ler|ham|dés|"
+      " fu|éer|ain|ari|hel|pat|fig|fus|sit|mar|ven|ses|tin|mpr|vid|xis|ial|uni|"
+      "tue| pu|igu|xpr|dep|gue|ian|mul|but|mpa|spa|lin|aîn|îne|log|tex|haî|urn|"
+      "rme|lé |ote|tis|vea|iel|rve|ura|auv| aj|arr|odu|dia|ms |ref|tit|itu|stè|"
+      "tèm|nou|éte|ger| r |isi|fié|oce|mon|bli|elo|mmi|nct|nam|ajo|épa|ièr|lan|"
+      " ci|rès| em|uva|lab|env|lém|lez|ela|scr|oni|prè| ni|ret|era|poi| c |sol|"
+      "ssu|lir| mu|ois| sc|diq|têt|var|uch|voi|gur|cie|col|epu|mag|nsi|qu |nai|"
+      "set|ead|fai|apr|vir|pte|ed |uvé|ng |eux| él|mau|tir|ata|ema| né|osi|mmé|"
+      "not|bin|ié |rap|ici|iva|sen|vé |éti|rom|rta|ame|riq| tê|ck | bl|enu|émo|"
+      "rea|utr|ésa|oms|lti|tia|mbl|rif|dét|eni|fs |dem|ria|pil|sus|nse|nie|llé|"
+      "cop|élé|squ| fl|dev|ngu| t |éle|isp|clu|nem|eui|ixe|ouc|vez|vér|ipt|dul|"
+      " vé| or|sto|iat|éce|mém|rde|inu|due|rôl|tés|syn| v |ic | m |ète|vis|ock|"
+      "sez|sac|nve|cur|off|méd|rév|ech|ppe|éca|ogr|ana|ôle|ffé|use|mac| bo|rib|"
+      "éré|deb|nel|ôt |uvr|sél|oli|rog|sau|nre|ack| us|pt |lai|ibu| on|amm|gem|"
+      "trô|hit|ivi|enr|éga| e |hou|nul|nvo|mèt|ètr| f |eu |erc|blo|céd|niq|tar|"
+      "amè|iab|mé |dar|are|eto|uss|olu|ff | fe|imm|os |cem|cib|uée| am|vra|ani|"
+      "ad |fia|oué|rep|an |ême|vri|ix |ébo| mê|mêm|ul |tch|hes| o | y |cac|ing|"
+      "ora|ami|opr|eff|deu|gul|ése| éd|fou| el|red|vée| ai|abi|the|fer|esc|rig|"
+      "haq|lt |obt|bte|éma| p |rav|fo |ogi|exe" },
+    { "es",
+      " de|de |do | no| se|el | co|no |os |ón |es |ión| el| es| en| la|se |ar |"
+      " re|la |ent|con|ció|en |ado|ra | in| pa|or | un|te |to |as |est|par|da |"
+      "nte|ro |al |fic|ara|ica|tra|aci|ero|com|ta | pu|que| fi|ido|er |des|str|"
+      "ion|sta|era|un | ca|per|ada| pr|rec|men| di|cio| al| si|na | lo|on |cci|"
+      "ede|ist|ida|lid|res|che| ar|ndo|ntr|ien|re |esp|nto|pue|ect|ued|and| op|"
+      "lo |del| a |por|los|rad|nes|her|ivo|one|ter|ich|esc| po|arc|ont|io |cad|"
+      " qu|ue |enc|ali|den|car|ecc|rio|ble|bre| ex|ene|mit|ten|err|vo |pro|una|"
+      "dir|tro|spe|dos| us|áli|rch| so|vál|omb| ha|mbr|rma| fa|le |ma |ifi|tos|"
+      "nci|it |nom|ori| ti| er|pre|ina|ver|chi|reg|sec| ma| y |ire|tor|hiv|ran|"
+      "las| va|all|sió|cto|ce |ir |rro|po |ste|act|omp|cia|pci|for|tar|fal|ura|"
+      "ror| mo|iza| su|cac|int|stá|tad| ta|opc| o |rea|tiv|rar|orm|abl|so |ato|"
+      "ere|liz|olo|qui| ac|ia |ser|tes|mo |cer| ve|ite|ama|ona| ob|dor| fu|ant|"
+      "cla|lic|inv| me| pe|ari|in |nst|cid|ins|ca |egi|arg|les|nta|ea |mie|val|"
+      "nal| li|eci|ndi| te|bol|ici|ctu|git|mer|ece|nvá|rta|eta| lí|sin|tie|tá |"
+      "ual|ne |end|ces|ers| bi|emp|mpo|usa|nea|ete|rac|ema|min|pos|ve |inc|nti|"
+      "ope| tr| sa|nco| fo|ort|tip|ace|tab|ecu|ini|lec|amb|erm|ono|ave|cam|scr|"
+      "gis| le| ad|alo| cr|cre|cri|lor|deb| cl|uet|ros|fin|iva|pec|rmi| ra|def|"
+      "noc|mbo|ami| gi|go |dad|mbi|ner|lav|ras|ubi|ume|odo|tam|sal|sol|tru|mod|"
+      "bic|ase|cti|ili|til|mpl|ref|esi| sí|ert|co |rsi|ibl|oci|igu|jet|dat|oca|"
+      "ipo|onf| da|ico|ram|ren|obj|aba|sím|das|sco|ímb|bje|uta|omo|ple|dic|an |"
+      "cif|gen| mu|tal|orr|ad |tua| au|exp|cor|lín|udo|íne|nde| nú|aqu|dis|ord|"
+      "ext|reu|jo |tan|tec|rab|ore| an|uer| gr|sca| im|ier|nar|efe|equ|ing|rib|"
+      "va |ita| st| cu|ame|ebe| to|imi|eto|osi|eub|tur|pud|mas|art|núm| mi|paq|"
+      "uie|mac|be |lar| ap|ena| ab|lla|ale|ruc|efi| vá|rde| s | nu|mat| ni|úme|"
+      " or|ade|ios|ati|fue|sar|imp|zar|ucc|ine|vis|man|ha |lis|sit|ria|uti|inf|"
+      "nic|nad|fer|sa | ej|ens|ues|pri|ló | ut|tic|edi|seg|uar| em|nid|ice|nfo|"
+      "lló|mpa| ba|gra| ce| má|si |jec|eje|dif|alt|nfi|oce|iad|ará|emo|zad|ind|"
+      "aza| ge|unt|eri|red|gur|ile|ele|iso|mue|omm|loc|año|laz|tre|ign|rti|egu|"
+      "esa|iti|asi|ño |ead|ide|bas|ito|ons|ost|tem|lad|ora|eso|cal|dmi|adm|ern|"
+      "dig|pla|tri|eco| có|pli|exi|lta|pac|uen|ear|bit| x |mañ| av|rra|pon| id|"
+      "rep|tid|sen|sti|lem|cód|igo|ay |tas|tin|sig|eti|ota|id |nla|xis|hay| he|"
+      "rgu|enl| ne|rel|mpr|ódi|gum|are|bor|za |mmi|rre|mar|fec|lin|lac|ala|rim|"
+      "roc|cte|uto|lim| pi|nsa|lee|ese|avi|ll |rup|tod| do|ibi|gar|fig|pat| n |"
+      "sub|vos|cut|eli|cab|cua|ol |opo|ás |irm|llo|tif|eme|ima|sua|rev|var|eo |"
+      "fra|fir|aut|gun|fil|usu|unc|itu|der|isp|det|dem|abe|nec|rit|ba | sh|nin|"
+      "ias|nue|cue|omi|ía |nca|spa|ega| bl|mos| ru|nor|lti|iar|cas| as|ula|mis|"
+      "oma|uci|hac|erv|bla|índ| fr|anc|atr|más|rem|baj|dia|xpr|ajo| ín|eer|sia|"
+      "rop|uev|abr|ial|me |voc|rte|sis|ate|et |rda|can|odi|rga|ime|req|sio|yte|"
+      "bra|byt|bia|cta|ata|son|és |sto|evo|cha|ch |mal|eña|spo|use|ult|eno|age|"
+      "sim|blo| at|señ|let| by|fun|rca|ech|obt| ig|alm|gru|nda|med|dep|hel|ian|"
+      "ts |obr|ela|ecl|spl|pen| bo|eni|aje|sob|ral|tex|upo|rut|gui|ún |iem|ulo|"
+      "apl|sh |ogr|ote|gme|oni|gno|met|zam|ólo|rno|ck |dar|ell|rse| ll| só|sól|"
+      "vid|lam|opi|dul|abi|lon|mad|war|bri|col|ack| bu|tán|sel| eq|lan|ibu| ch|"
+      "je |áct|ed |rid|ola|tim|ya |ími|usi|rog|etr|lím|últ| ár|ang|uso|bio|und|"
+      "cen|oin|amp|sac|oto| ag|nam| r |clu|evi|sop|nos|uan|bin| ya|rir|ars|loq|"
+      "epo|rbo|sib|ret|ond|xte|isi|st |bte|din|bir|nsi|gua| fl|erd|bli|dec|gre|"
+      "mem|ree|duc|iqu|ive|rvi|uiv|mot|rqu|olu|apa|su |fus|ga |pun|mpi|ge |rob|"
+      "ron|sad|saj|odu|eda| hi|acc|coi|uel|rác|at |tac|án |uit|ila| fe|pil|ber|"
+      "nt |did|ría|ino|tró|mor| c |mód|ódu|rl |ong|oba| et|not|ff | pl| lu|rol|"
+      "vac|ngu|rt |cur|aus|lve| d |rón|gin|ijo|nen| du|oqu|orc|mon| om|rna|rip|"
+      "lug|pia|iab|ngo|cap|árb|ced|ana|ng |adi|cod|ior|eza|mic|eva|vor|eal|imo|"
+      "epa|uni|spu|ic |nd |tag|sde|ard|lat|eas|ast|am |tiq|tir|cop|lt |lit| e |"
+      " vi|rig|mag|lme|xto|lea|tat|ls |rá |óli|epe|imb|ee |ute|gún|tio|esd|ric|"
+      " ur|ut |sup|num|mbó|ból|otr|uga|nza|rod|ací|vad|zac|rso| ot|sos| ci|ocu|"
+      "its|nme|iat|exc|smo|log|inu|ano|sum|ef |ill|len|ict|esu|leg| v |tib|rd |"
+      "nac|ash| m |rat|rci|ña |eam|agr| f | ho" },
+    { "it",
+      "to |le | di|re | co|ion| no|on |ne |di | de|ile|zio|one| in|non|ent|ta |"
+      " ri|con|la |ato|il |del| il| fi|te |ti |nte|per|pos|sta|ell| un|are|er |"
+      "fil|men|mpo|bil| pe|ssi| im| es|azi|ica|ess|un |imp| se| è |com| la|ibi|"
+      "el | st|ali| pr|chi| re| ne|oss|est| al|lo |ett|lla| da|ere| l |sib|ore|"
+      " so|ll |tat|che|ver|no |in |so |ome|ter|all|nti|do |fic|ati|ifi|me |val|"
+      " ch| pa| va| su|ten|ro | si| le|ni |na |ra |ata|oni|tto|att|nto|ese|li |"
+      "it |io |sci|ire|err| i |ina|tor|seg|se |pre|ita|cor|sio|tro|tte| sc|nel|"
+      "cat| ma| mo|ura|ono|ma | ca| a | us|ost|ont| er|ca | op| tr|str|and|rat|"
+      "ric| qu|izz|ame|da |rma|ve |int|ito|for|nom|zza|eri|ist|he |ggi|car|rro|"
+      "ndi|mod| me|rim|ran|za |pro| e |tra| ar| sp|ser|po |dir|lid|llo|acc| ve|"
+      "rec| gi|ce |por|agg|ror|usc|man|egu|ri | nu|tti|cit|uto|hia| po|ius|una|"
+      "ndo|enz|ia |tes|rea|usa|res| el|ale|que|sto|ero|liz|sa |ort|mer|ste|ind|"
+      " fo|opz|ry |ini|era|ari|pzi|anc|ori|ich|ei |min|sti|git| o |spe|iav|ppo|"
+      "ili|orm|ime|ris| vi|ass| at|gge|sse|ora|ers|si |ave|sso|pac|ect|ut |loc|"
+      " cr|ele|olo|riu|lle|pri|rsi|ice|lit|ume|ory|eci| lo|cri|spo| ap|dei|gui|"
+      "mit|dif|dal|rit|ene|odi|co |mat| li| te|rta|omp|gli| ta|nde|cif|cch|al |"
+      " pu|gio|pec|ine|fin|rig|scr|dat|ede|ues| ag|ant|lic|tri|nat|vis|nes|ual|"
+      "ivi|ido|de |sol| ut|ch |sen|upp|tur|son|put|ara|ezi|izi|tiv|cre|ces|orr|"
+      "ga |ing|nit|ssa|oma|sim|omm|nal|isp|nta|pon|tar|ott|col|dic|fer|cto|ors|"
+      "uti|den|num|ntr|par|mmi| pi|ond|oll|ert|ute|ova|orn|ive|sco|lor|nza|iut|"
+      " og|oca|dis|ttu|ico|get| au|ien|ate| du|onf|sis|sun|het| ha|rif|abi|uov|"
+      "raz|efi|tic|arg| an|arc|leg|ssu|app|erc|itt|tà |hie|tem|sup|nzi|vo |ge |"
+      "let|taz|bol|mbo|alo|rov|rch|out|gra| do|pli|end|def|erv|erm|ior|rge|tal|"
+      "ase|tam|nos|ack| ti| ge|rso|alt|rd |nch|ung|nar|cer|ità|inf|et |len|osi|"
+      "sul|aut|nsi|sar|gin|ogg|ema|ria|nfo|enc|imb|osc|tta|mes|tip|nor|st |rio|"
+      " gr|tre|vi |uir|amp|ult|ign|cam|emo|mpa|der|iat|imi|bas|ciu|rgo|caz|nca|"
+      "ima|rna|ins|nam|irm|ull|nco|til|gen|ren|oli|sez|reg|gno|pat|ida|id |fir|"
+      "isu|lin|sh | ba|ide|tas|fig|des|sua|egg|rti|ghe|lim| he|ona|ove|cce|vat|"
+      " bi|esp|ger|sec|imo|unt|ci |ram|ipo| ce|rol|rin|esi| br| gl|ck |bra|ord|"
+      "vio|omi|iga| fa|ola|igu|iso|tin|ern|cod|cia|sot|ies|rop|ha |hiv|ui |giu|"
+      "dur| n |lat| tu|tit|ens|uzi|rre|riz|mo |iun|sca|opp|nfi| ou|mma|tag|met|"
+      "ivo| sa|gom| id|ber|rri|ons|cal|eli|var|mi |sat|eme|rem|isc|maz|ecu|utp|"
+      "tpu| ac|lar| or|red|dev|ner|ece| ig|erg|rar|blo|es |egn| fu|emp|agi|ead|"
+      "ast|rip|mbi|esc|tif|ad |su |ite|tan| s |va |sit|zia|oto|oce|lem| av|rev|"
+      "gna|lti|eta|utt| bl|ope|tab|rco|ife|qua|gur|ega|ret|ue |esa|inc|ed |inp|"
+      "zar| ci|hel|ial|voc|pas|niz|npu|lli|tut|set|can|reb|riv|eve|ppl| mu| vo|"
+      "spa|imm|tim|rmi|art|ode|uso|nse|ltr| x |ard|lta|gol| mi|nuo| sh|eco|zo |"
+      "ota|amb|vor|sag|oro|pa |nk |ras|iva|rep|ref|nut| as|ana|opo|sce|tch|imu|"
+      "dim|può|uò |alc|ici|muo|tom|ann|mot|nne|mpl|gue|avv|not|roc|ng |ash| ra|"
+      "mag|ag |iri|sor|ogr|nst|lun|iet|rve|sin|zzo| lu|din|mpr|occ|rl |alb|ezz|"
+      "mos|tie|eso|enu|ole|più|iù |nda|isi|odo|edi|siz| d |isa|pen|ano|vie|inv|"
+      "iti|nt |ges|odu|tru|avo|vuo|lav|lbe|iar|nga|uta|spr|rac| by|yte|rni|ze |"
+      "byt| vu|uit| to|naz|rra|amm|zat|at |dul|ote|ple|via|hea|lme|pt |rca|evi|"
+      "ea | cu| ad|ngh|cur|rie|qui|tua|pe |eam|ach|vvi| c |ai |egi|cco|mem|cun|"
+      "rt |div|am |upe|ear|epo|mai|rno|nen|itu|dop|uot|deb|uni|rva|rir|mul|uen|"
+      "lib|ril|ipe|rog|sel|ino|bug|iff|rup|eno|atc|raf|nul|olt|clu|ied|fra|ron|"
+      " am|mal|ble|asc| bu|dar|ian|ami|log|gru|onn|les|vec|war|cop|lcu|wor|ul |"
+      " ur|ego|gam|or |apr|lis|nge|inu|nve|sal|mme|mpi|sia|ane|oda|cci|alm|bin|"
+      "uan|ecc| fr|tio|rme|off|elp|evo|ff |sem|bia|fo |gis| ab|unk|mor| hu|ure|"
+      " ex|hun|dec|vel|cuz|bbe|pia|ffe|aiu|fun|omo|sch|ngo|sic|dia|bit|cum|rot|"
+      " ob|mar|pi |nze|lte| ho|ebb|ttr|gni|avi|ovo|ced|ie |rid|ebu|bre|siv|sab|"
+      "igh|doc|ocu|hez| cl|già|ià |cac|rto|nib|lez|nis|ow |rom|ock|unz|cui|egl|"
+      "cup|bac| ai|nec|gi |ug |ade|uno| fl| en|ela|opr|soc|ink|org|lus| ed| ul|"
+      "rob|rse|mut|liv|laz|bie|eo |ete| ot|lia|url|be | of|pun|ct |top|rib|ffi|"
+      "iss| sy|ssw|ovr|rà |cke|vol| f |uel|toc|emb|eba|neg| az|ilo|gia|ibu|nce|"
+      "nno|igi|paz|ulo|cen|rer|swo|itm|las|sig" },
+    { "pt",
+      " de|de |ão |do | co|os | pa|da |ra | se|ado|ent|ção| in|ar |es | a |as |"
+      " o |com| re|par|não| nã|ara|ro | es|em |te |nte|to |con|fic| no|er |or |"
+      " po| um| do| ar| fo|ada|men| fi| pr|ica| li|ter|ido|tra|ta |açã| ca|um |"
+      "sta|eir|est|qui|ma | ex|ivo|pos|el |rad|dos|ont|iro|vel|vo |for|res|che|"
+      " em|ndo|al |ist|des| en|por| di|ver| da| é |rqu|arq|ich|que|and|nto|no |"
+      "íve|esp|ou |uiv|hei|ome| te|ess|io |eci| us|me | e | fa| ma|ntr| op|ida|"
+      "ia | qu|om |se |ões|oss|lid|mpo| ou|nom| ta|rio|so |pro| si|spe|man|err|"
+      "lin|era|esc| su|pre|são| im|ina|ser| er|sív|cad|ha |ifi|ssí| ve|alh|ir |"
+      "rro|çõe|per|po |iza|fin| ao| al|int|liz|rma|áli|ini|mo |ali|orm|efi| me|"
+      "uma|ura| mo|ao |vál|car|imp|loc|tad|ste|is |inv|str|dad| va|tes|fal|omp|"
+      "ue |def|na |rec|opç|lo |tem|ere|ria|ort|ion|tar|nvá|cia|ve |ho |nha|ces|"
+      "re |inh| ne| pe|cri| ap| lo| as|dor| sa|ame|dir|tiv|oca|ode|end|ade|val|"
+      "ári|ume|ten|oi |foi|alo|tam|usa|pec|nde|pri|arg|ers|ama|act|pac|ema|lho|"
+      "ran|upo|ote|lha|nta|alt|óri|nal|ros|ire|das|ora|co | os| so|ito|ita|ant|"
+      "tos|aco|sem|ca |ili| na|ero|ais|ect|lis|nci|ual|scr|lic| ch|oma|ati|til|"
+      " st|cha|sso|tip|rem|cid|enc|ret| gr| ti|rgu|nho|pon| tr|erm| at| b |mit|"
+      "rta|mer|tro|reg|cot|roc|rar|pçã|ico|cio|cif|omo|ecu|cal|le |ext|pod|lor|"
+      " to|mat|min|la |rmi|eve|sco|ece|nti|ona|caç|age|tór|tal|ída| le| nú|tri|"
+      " ac|sin|cor|aíd|núm|ite|ine|hec|ass|saí|tua|ime|sa |ici| cr| an|exp| ba|"
+      "egu|sec|nco|olo|pad|inf|açõ|atu|nfo|der|gra|eri|nor|mbo|rim|adr|mes| s |"
+      "dis|sup|tur|ore|tic|seg|eta|ins|fer|ipo|pas|anh|emo|id |nen|úme|ula|enh|"
+      "tec|rão|ce |ost|elo|fil|inc|mas|raç|nec|gum|sti|tor|abe|nhe|bol|ref|spo|"
+      " ob|exi|ela|onh|pen|gem|ign|mpr|qua|gur|ind| n |am |iva|exe|rel|içã|mai|"
+      "cam|cte|ala|rac|mov|drã|stá|on |mod|orr|ndi| ig|vis|tá |ile|zad|ata| av|"
+      "oce|red|onf|va |uti|rte|ato| au|rsã|ram|odo|ave|rup|zaç| ut|ima|dic|ert|"
+      "nst|las|ing|vos|lar| bi|dev|pçõ| ab|rea| x |ne |ove|rre|emp|nic|den|ênc|"
+      "iso|iar| sí|avi|imi| nu|erv|xec|ena|cçã|ele|nid|tid|sím|ern|ecç|áve|pli|"
+      "ll |ímb|ens|aut|iti|mos|sis|uto|cre|ede|tex|sen|mpa|dif|iga|osi|gno|lta|"
+      " ge|eit|lti|hum| id|gru|yte|var|byt|tab| mu|rit|lte|ço |hav|are|mpl| by|"
+      "nar|cla|equ|one|ast|ssã|bre|lem|tas|rep|hou|lig| ad|cur|eto|isp|cti|ons|"
+      "nhu|maç|ori|sar|ari|lit|spa|ras|etó|et |ren|ape|in |art|sad|uan|nov|ace|"
+      "rev|obr|orn| or|tim|ope|ssi|tod|uer|zer|let|vid| sh|ios|eça|ns | sã|nas|"
+      "dei|edi|ém | un|out|sim|ias|igu|tin|dem|ese|ocu|go |cut|sob|col|atr|egi|"
+      "has|efe|nça|rti|sto|tat|num|lim|eno|ssa|ota|ça |sol|xo | fu|ecl|ger|amp|"
+      "ng |xis|ond| la|fon|nfi| ho|fix|lad|isa|dia|xto|imo|nad|mem|uta|nes|clu|"
+      "uso|últ|los|us |dep|ple|tio|nív| he|hel| pi|iad|sse|fun|cas|ink|obt|itu|"
+      "xpr|ilh| má|ch |dat|ase|ord|ctu|ino|uit|ogr|use|ês |arr|sit|met|nir|rig|"
+      "sub|exc|eme|ble|amb|tan|ult|rne|ute|rir|gis|ial|pel|eco| el|rib|pe |tre|"
+      "arc|ate|squ|ssá|ixo|nat|ibu|rra|ira|ler|sár|nam|igo|cab|ed |rin| t |abi|"
+      "cap|ega| vi|ead|ide|eja|nt |rna|eis|esm|tru|apl|mag|reç|pal|lat|vei|bri|"
+      "mal|uni|iáv|st | c |anç|mad| mi|faz|rno|vez|cum|gar|ian|epo|ez |smo|bas|"
+      "blo|gin|nos|beç|abr|odi|it |bil|taç|fig|bin| l |laç|adi|war|cat|sel| bl|"
+      "çal|ice|ock|riá|uçã| ro|dig|aze|ive|oco|del| có|ova|rom|rog|usu|eço|esq|"
+      "pid|ts |epa|ior| fl|pil|pla|ck |ric|unt| vo|suá|uár|cul|doc| d |bte|mpi|"
+      " sy|uin| p |vio|aço|all|eli|gen|apa|ava|deb|cod| só|niç| am|gaç| is|rol|"
+      "só |zar|lme|hor|he |cen|paç|eia|ja | du|tém|cta|cos| fe|tif|vor|at |can|"
+      "les|lav|rip|ano|sep|mon| ha|bit| f |ami|ack|log|urs|im |sca|cer|bel|uda|"
+      "rên|rva|ls | m |esa|ham|avr|pt |esv| r |mar|pós|imb|nk |ós |vra|ps |did|"
+      "rif|rid| bu|ana|ize|had|nve|vaz|azi|ss |rsi| vá|pat|svi| fr|ell|din|etr|"
+      "gui|olu|lt |anc|ain|tir|ech|nda|not|apó|tag|rt |rat|req|und|rvi|sio|gul|"
+      "ole|det|ui |nté|unc|ix |ila|fo |unç|erd|but| úl|emi|rso|nsa| v |mei|voc|"
+      "sag|mui|suf| ze|rei|il |dec|be |cód|alv|ará|via| th|ola|nçã|ulo|ut |iss|"
+      "ódi|óli|uir|hos|gua|she|ale|erê|rá |har|aba|lon|ete|mbi|ber| i |bal|mbó|"
+      "ból| ra|gid|ze | wi|ong|epe| ní|sos|lec|set|alm|rda|ncl|soc|siç|ge |seu|"
+      "ot |cto|up |ype|utr|flu|nd |ic |sym| pl|sig|typ|ans|eu |top|mul|bli|rav|"
+      "rár|obj|ipl| ví|emó|mór|plo|an |emb|lan" },
+    { "nl",
+      "en |et |de |an | ge| de|sta|ver|and| be| va|een| in|van|est| op|er |nde|"
+      " ve|nie| ni|tan|bes| he|ing|iet|aar|ken|is |tie| is|ie |ere|oor| on|nd |"
+      "te |den|ege| ee|gel| vo|sch|der|het| te|nge|aan|rde|gen|or | al|in |ste|"
+      "ten|ren|erd|uit|ord|ng |ers|eld| to|eer|rd |voo| ma|naa| me|eke|men|cht|"
+      " re|geb| st|eve|ls |ent|gev|ven|dig|rui| wo|ebr|es |el |ter|wor|ar |lle|"
+      " aa| ka| co|ati|bru|kan|uik| pa|met| ui| en|gee|voe| na|len|ard| wa|ige|"
+      "ond|ge |ach|end|al |opt|nt |ele|tek|eli| di|als| do|st | bi|waa|kt |pti|"
+      "ldi|nen|at | ar|oer|lij|le |erw|it |tal| of|of |con|out|all|ens|kke|ind|"
+      "ont|ong|ijd| pr|reg|am |op |toe|wij|ns |pro|dt | fo|fou|pak|aam|chi|geg|"
+      "lin|aat|tel|nte|nst|one|akk|rdt|ree|slu|ut | da|bij|ket|map|ges|ove| ko|"
+      "re | le|on |sie|ike|ijn|eze|wer| om|pen|ij | zi|ap |lee|taa|tte|ig |ist|"
+      "maa|ume|ell|ijk| sy| mo|ake|gro| af|ert| mi|rei|zij|erk|ht | ov|ld |ies|"
+      "ang|ite|jde|ins|dat|jn | gr|om |ker|gin|ts |esc| we|isc|daa|rwi|kop|oet|"
+      "ngs|id |din|arg|ode|ppe|rij|tee|hte|aal|wac|res|eel|tij|del|ch |cti|nda|"
+      "oeg|che|tvo|ame|com|laa|itv|sen|tro|nta|ze |rsi|ik |ton| li|mis|rs |ron|"
+      " sc|erv|nds|doo|eri|eid|vol|ke |chr|rt |arc| er|die|ukt| no|roo| ta|pre|"
+      "evo| la| zo| se|rst|ief|ett|luk|rgu|gum|oep|rac|ect|aak|mak|mer| ex|int|"
+      "isl|rch|ess|orm|dit| wi|pel|us |bre|mma|rec|ede| sl|dra|eme|ale|nvo|ica|"
+      "ssi|ort|app|ene| s |rsc|bel|hee|ber|for|ets|uid| br|ef |erg|typ|ant|rte|"
+      "euw|roe|get|ft |mme|bro|ser| ti|ieu| el|str|cha|rin|ern|oon|eks|kel|mat|"
+      "hie|ope|idi| si|dez|ein|ype|ijz|lui|nbe|sys|ndi|eis|omm|opd|epa| au|cat|"
+      "ll |ats|nti| ho| ac|zen|ete|ute|cod|opp|erb|era|yst|eek|ger|pdr|pe |ate|"
+      "em |els|num|age|hel| nu|eem|ne |rge|ide| sh| so|onb|ech|eta|ran| hu|tat|"
+      "ot |per|opg|sse|rma|gra|ces|bev|pge|inv|oud|jzi|ijv| lo|her|woo| ei|oot|"
+      " n |aut|mee|ien|ign|kom|bin|ve |hri|pat|exp| u |eva|unt|han|par|nfo| po|"
+      "ion|jk |roc|omp|dan|abe|inf|sel|ram|eft|ars|doe|zig|sle|eef|ikt|rol| ap|"
+      "nne|ks | vi|ine|ak |enk|se |pt |ntr|olg|eco|oce|rwa|onf|tar|tse|rke|ole|"
+      "atu|ina|are|ext|tge|bek|win|yte|itg|ag |lat|ijs|byt|elk|he |ifi|vel|umm|"
+      "min|ari| by|sla|ara|tor|sym|pla|ive|lez|onv|tes|jst| ty|eng|eed|ema|sna|"
+      "tus|jke|sig|let|egi|uwe| su|mbo|vat|its|afs|man|ymb| an|tem| sp|sti|lge|"
+      "ep |alt| ha|ce |lis|hei|ged|tra|ogr|nam|rat|moe|var|mod|the|ehe|twa|ndo|"
+      "act|wee|teu|anm|ass|zon|odu|mel|ile|neg|na | ne|fsl|akt| bu|lde|uw |raa|"
+      "ria|dee|eni| fi|rek| pl|beh|tbr|ude|rve|she|ore|lem|ad | tr|iti|eun|gem|"
+      "jve|beg|leu|lei|ali|ijf|tri|geh|tic|gew|iab|lic|ade|nke|gna|und|ma |gaa|"
+      "fil|iev|igi|fic|deb|fer|tre|vin|eut|doc|tio|ome| p |dui| sa|lt |rog|ds |"
+      "baa|gge|ori|tot|amm|eci|nma|chu| ze|rig|tst| ba|erp|ok |xpr|hal|gd | fu|"
+      "hen|ack|nfi|fig|von|epe|bol|two|nve|oek|rea|kba|hui|pos|unc|elf|iek|htw|"
+      "dus|zel|spe|nin|igu|ero|ier|edi|hak|ler|lan|ich|vor|pli|nct|fun|me | i |"
+      "gep|pas|hik|gur|loc| v |gre|huw|art|enr|nre|tab|uwi|um |uur| pi|sin|kin|"
+      "uth|eik|tex|ed |oge|gst|kon|ol | t |ikb|tis|blo| c |erl|bee| bo|nco|nat|"
+      "oel| ca| du|xt |ouw|lok|dir|dsn|ans|top| id|ese|pri|sto| l |sam|val|ntb|"
+      "log|ock|war|lig|ook|lec|kst|hou|nul|ili|rna|bui|geï|ena|ini|ct | e |hoo|"
+      "ire|fde|opm|ek |stu|rva|ble|og |hre| ga|kte|eïn|ck |mag| un|ewe|ure|ott|"
+      "rip|too| ro|tin|erm|we |oli|dow|loo|lie| pe| d |jd |mog|scr|do | a |max|"
+      "rbe|tuu|lte| ad| bl|elp|opi|igd|eig|rob|ice|pec|pma|zoe|én |zet|att|ric|"
+      "ref| ke|itw|syn|ijg|efi|ebe|eau|cte|lke|ela|ees|onc|cum| f |tec|ner|twe|"
+      "osi|led| oo|uni|nli|ocu|leg|rne|des|bou| ch|eha|rou| x |vra|spa|les|ata|"
+      "ill|cer|lag| r |ast|pad| kl|rag|rti|één|slo|niv|cri|eko|no | éé|ote|lfd|"
+      "por|esl|fin|afg|nko|ase|ipt| m |kun|tru|net|lp |och|rvo|af |eg |ura|vea|"
+      "ïns|atr|las|acc|vee|jge|mac|set|rwe|sit|ost| b |eeg|dss|def|ega| fr|nee|"
+      "sh |ima|weg|oll|oen|ppa|zie|opn|pte|sub|axi|ix |nal|dec|nis|tze|ink|afb|"
+      "kri|bbe|ia |nel|tur|ofd|fge| ou|ank|dru|ruk|hul|ulp|uto|oof|rev|rki|mpl|"
+      "eil|rce|ur |oev|rbi| gi|gec|sof|zin|ijp|pij|err|ffe|bas|ple|odi|boo|ime|"
+      "mge|lli|ail|au |ip |pie|erh| or|lk |th |oft| it|ops|rgr|onl| up|bep|tif|"
+      "ir |etz|rie|ull|uss|io | ku|vei|bar|ctu|nor| tw|ngt|egs|ul |apt|iee|uis|"
+      "air|ace|rlo|ald|pun|red|old|ry | vr|rm " },
+    { "sv",
+      " in|en |er |nte|ing|för|te | fö|int|era|ter|ör |et |ar |de | an| st|ra |"
+      "nde|ng |tt | de|ion|ll |änd|nin|fil|ill|an | ti|ta |ler|til| fi| en|and|"
+      " me|vän|ver| i |sta|ade| ko|om |är | av|tio|kti| re| ka|lle|med|att| är|"
+      "on | sk|ste| ut|nda|gen|anv|nvä|rad|rin|ed | at|tig|yck|ell|fel|av |nge|"
+      "ent|ad |eri|var|kan|den|es |ata|nd | so|tal|ist|nt |el | fe| vi|ekt| va|"
+      "tan|nam| om|som|at |der|des|ig |men|ch | lä|kom| på|ett|ile|cke|str|as |"
+      "und|ati|nst|ser|mma| ar| se|lag|all|ort|amn|på |lti|det|na |ngs| ta|dat|"
+      "ska|ilt|ga | oc| el|gt | fl| mi|ers|mat|nta|nga|och|il | pr|ara|agg|tta|"
+      "igt| sy|rt |re |gil|id |akt|st | pa|eck|skr|kat|ela|tar|for|ins|cka|kri|"
+      "lis| sa| et|upp|fla|mn |ren|la |ang|kon|log|tor| fr|sa |inn|pro|one| ha|"
+      "ogi|dar|stä|riv|orm|man|ner|len| vä|mer|gar|or |omm| og|are|ärd|ns |äll|"
+      "al |änt|ant|reg| gi|ons|rma|ka |rde|end| al| ma|lig|lla|rat|tad|iv |ind|"
+      "kad|ive|öve|ran| be|lut|tet|ut |kun|ess|rer|sym| ny|tiv|ket|it |vär| ve|"
+      " si|mis|uta|isk|kal| ku|del|rar|slu|frå|sto|ens|ck |sk |ign|ån |alo|sek|"
+      "ssl|mme|lyc| öv|bol| na|äng|mbo|tat|ymb|iss|vis|kt |har|ken| up| gr|rån|"
+      " än| bi|fin|rd |sio|ark|in |res|che|ndr| li|ern| ra| no|gga|kän| te|sly|"
+      " må|kni|per|egi| bo| di|gra|gis|ge |isa|sig| ok|typ| op|da |vid| ex|amm|"
+      "ere|bor|rsi|ts |ume|sam|git|kod|ali|ten|let|lt |lok|ätt|täl|rna|stö|erv|"
+      "sök|nne|ise|ast| du|ras|läg| un|ate|okä|tec|tru|val|par| po| to|nen|ram|"
+      " fo|ake|dra|bar|pos|ard|avs|arn|län| by|inf| x |rki|läs|nna|arg|atu|gor|"
+      "sen|ope|oll|oka|kap|ger|nfo|ont|das|itt|nyc|töd|lak|hål| ge|byt|ukt|tur|"
+      " sp|åll|ruk|kel| sl| he| tr|pak|ref|dni|apa|omp|ds |nat|rän|ite|ans|ndo|"
+      "ier|ord|red|han|kna| hi|art| lo|nor|ifi|örs|min|se |tni|pa |ma |tag|ets|"
+      "lan|ker|tra|yte| ob|du | co|sät|iga|rva|ttr| sä|ete|lat|ggo|fte|örv|åst|"
+      " ef|rle|efi|hec|trä| da|ost|ehå|od |num|ore|og |orl|opp| n |ss |rgu|obj|"
+      " s |gum| kr|gre|rvä|mås|bje|kiv|rst|het| ty|rni|tab|ckn|ert| ba|ot |gna|"
+      " mo|ika|lek|sak|ick|nti|le |jek|eft|dex|spe|dre|bel|yp |nar|por|dan|när|"
+      "dig|tid|onf|rte|sse|try|met|hit| ad|ogr|ext|ång|akn|neh| hä|bit|ack|cer|"
+      "krä|umm|ble|tis|ntr|kar|mlo|låt|ski|tem|oml|äge|alt|ek | nä|tch|sty|fer|"
+      "ars|pre|giv|änk|ina|lin| ig|tro|get|dir|rog|bas|ppa|rek|els|def|gru| åt|"
+      "utt|nch|eci|oge|nns|ini|llå|ven|åte|inc|sti|rol|hop|lös|vet|ari|ene|ita|"
+      "ute|mal|mod|abe|eme|ktu| kö|pat|eda|adr|vs |tre|loc|roc|ryc| bl|app|ngi|"
+      "ige|väg|lem|öds|pec|räv|tom|rs |ex |ide| ak| kä|efe|us |ock|iva|exe|atc|"
+      "enn|fäl|äns|ats|pp |ase|yst|gno|sys|sin| nu|ol |lls|tsk|est|bet|tus| sö|"
+      "kor|pen|fik|ndn|år |hel|lna|unk|net| au|iti|kör|ivn|gni|anf|öre|ur | fä|"
+      "stå|sni|am |lte|rup|ägg|tin|lik|aut|nkt|ytt|nsk|gan|nfi|ass|va |vil|rel|"
+      "oce|ölj| fu|no |edd|ält|ces|vsl|ämt| id|pri|beh|ote|mot|nal|pla|tri|häm|"
+      "nsl|mpo|lar|tek|föl|em |nse|lic| ho|agn|fun|pda|öra|pac|gg |tas| is|ild|"
+      "dri|sla|lko| ch|ke |ice|bin|ne |ire|fix|fig|ode|kvä|kte|ect|lja|dde| a |"
+      " lå|eln|nfö|käl|ix |ime| nå|ld |pli|op |ori|nit|ale|ber|ökv| t |gst|odu|"
+      "nas| or|rbe|än |mta|erm|ame|lit| r | lö|ret|ppn|mpl|llk|rsk|eno|ink|jär|"
+      "eta|äve|huv|uvu|vud|ull|tes|sfi|ärr|ndi|ria|tex|äsa|oli|mne|ppd|ena|rec|"
+      "ce | ne|uel|rve|do |cha| pi| la|tda|con|ult|igu| su|run|erk| hu|grä|nsa|"
+      "utd|gur|lta|sko| d |skt|ude|syn|ånd|ag |någ|arb|ole|ato|ikt|tån|öpp|sh |"
+      "kla|ala|dul|rit|pps|tif| ap|ure| e | ov|nka|ann| öp|kop|lse|rta|lba| gå|"
+      "rti|rea|mar|ede|ead|ngd|ype|tst|iff|ine|utf|tte|sst|iln|bli|nds|lln|jan|"
+      "bil|pna|je |exp|gör|rig|ej | v |rre|llt|ges|set|ule|pad|tue| er|mul| m |"
+      "lni|imp|erh| ic|urs|spa| as| c |dif|cif|ökn|ln |ppl|ekv|ele|fra|olk| f |"
+      " ur| pl|sor|mål|vst|elt| im|uts| tv|nol|ngl|me |rnt|gsf| bu|ff |tol|kve|"
+      "deb|ls |nad|edi|din| ej|ple|igh|age|nie|ågo|als|lp |ust|rim| pe| do| br|"
+      "iab|ps |nli| få|rn |lst|inl|xt |sid|lka|ävs|gli| ab|rl |osi|arj| l |ero|"
+      "rje|blo|llo|asi|ome|fly|ppe|gd |pu | gö|rli|ils|nsn|lyt|gss|ovä|ve |sar|"
+      "nk |fjä|cpu|ttn| fj|add|tän|mpa|täm|fle| ca|rib|sva|säk|ema|öse|sna|ift|"
+      "ash|ic |com|top|nan| sh|mpr|elb|kit|öns|ibu|rsö|fie|esk|avb|elp|pas| mö|"
+      "ldr| ro|eti| p |vni|enh|nhe|lad|väl|jäl|ry |nom|pt |rdn|opi|uto|dd |äke|"
+      "sit|jus| fa|ud |rop|abi|cks|tna|rot|don" },
+    { "da",
+      "er |et |en |kke|ke |for|ikk| fo| ik|ing|ere|til|il |nde| ti| de|de |ter|"
+      " in|or |fil| af|der|ler| fi| er|lle|ed |es |ver| me|re |ind| st|ng |ne |"
+      "end| en| i | ud|ste|ent| ka|te | ko|sta|den|af |and|ret|ion|ive|ger|nte|"
+      "tte|se |nge|at |bru|ede| br|rug|an |gen|med|kan|ers| re|ang|els|men| sk|"
+      " ve|om |tal|dig|und|skr|al |lse|og |le |rin|nin|ell|lin|det|mme|tio|ejl|"
+      "eri|fej| so|ker|ata|lig| fe|on |kri| an|sk | op| at| un|ig |nne|del|ile|"
+      "ati|yld| og|el |dat| li|st |kun|kom| el|ldi|gyl|nav| pr|gt |avn| ku|str|"
+      " ma|ren| ad|tet|som|gle|jl | pa|ern|ge |uge| sy|all| vi|rer|ken|ngs|ndt|"
+      "giv|pro| ug|eks| ar| fr| se|dt |ugy| et|res|riv|vis|ser|ven|isk|mat| på|"
+      "des|ort|man|pe | al|kal|ved| si|iv |ill| fl|igt|vær|ska|på |val| be|kon|"
+      "lde|len|ett|nd |mer|rel|var|orm|ove|nt |vet| ta|ngi|nøg|øgl|is |dre|egn|"
+      "age| te|lag|nst|fra|ner|tan|omm|unn|kat|ige|afs|vn | nø|jer|int| hv|sti|"
+      " mi|teg|sel|ens|ist|rma|tre|log|rt |ar | bl| væ|kti|fin|id |pak|rst|dsk|"
+      "red| ge|ra |akk|inj|nje|ske|typ|sym|lt |ppe|ype|lok|ert|ug |ode|alg| he|"
+      "rne|lem| da|ve |hed|sse|ont| læ| sa|amm|rdi|sni|rsk|ign|ess| na| ha|gn |"
+      "stø|ndr|one|ark|fla|lut|ag |bol|ekt|rse|ume|mbo|ble|pre|ymb|let|slu|dst|"
+      "sen|mma|ude|tat|elt|ore|ide|tem| nu| gr|get|rsi|ram|nta| ov|sio|eli|ift|"
+      "gra| di|ons|tor|me |ndo| lo|sam| om|opr|rki|ars|ins|tiv| bi| ek|dva|uds|"
+      " n |ard|old|ta |rte|reg|met|est| x |cer|it | uk|omp|kod|tid|nda|tek|nsk|"
+      "ate|lad| s | no|hol| kr|adv|vne|fik|ils|ns |eme|ast|rre|em | ty|uke|gan|"
+      "mel|arg|ifi|dar|tes|fte|erv|alo|sæt|gru|nds|nke|un |min| sl|ærd|rd |ten|"
+      "læs| po|alt|elo|in |por|num|ndl|rog|før|oke| mo|kiv|hvi|app| du|æng|kst|"
+      "tab|gst|esk|sko|enn|rif|ogr|ted| fu|eng|tag|try|lis|nfo|fje|har|sek|nit|"
+      " fj|ele|per| va|sys|mod|ut |rve|ked|ænd| to|ære|gel|efi|yst|lg |par|tas|"
+      " id|ski|net|mis|ryk|fer| sp|lst|kræ|bel|upp|ene|ine|nor|nen| fø|abe|dga|"
+      "fsl|tar|ses|akt|ft |dda|æve|ant|inf| la|ræv|læn|tro|rup| l | tr|eho| by|"
+      "tni|lva|sig|lge| gi|byt|kil|pos|du |ves|vil|ilv|led|eve|ks |nal| co|di |"
+      "nkt|ykk|ol |ato| ef|ges|unk|fun|atu|yte|ér | r |sto|ela|tør|lev|pri|lat|"
+      "tur|sid|art| æn|pen|hen|bli|lli|us | ig|lla| su| ny|ids|eft|efe|ade| må|"
+      "era|adg|je |rat|rke|ase|ord|ors|def|ite|adr|yk |kt |ces|nli|han|eds|kel|"
+      "ame|ild|ør | p | do|ika|ntr|rol|udt|are| f |rgu|gum|tis|lyk|dte|æse|bes|"
+      "ans|utt|ket|tel|isl|ref|lan|øre|dli|ll |tøt|bin|igh|øtt|roc|umm|ink|rti|"
+      "sly|mpo|gno|spe| v |gge|fsn|ce | ki|ørr|ale|onf|ost|ime| ne|ld |dtr|ghe|"
+      "sik| go|ran|oce|fle|ivn|dle|die|am | t |ete|tri|nce|ara|rn |deh|gna|nul|"
+      "udl|ave|hve|emm|enl|ald|lsk|hel|eci|lna|oge|gsk|æt |vid|dde|ali| ap|dir|"
+      "rva|ass|tom|do |tig|iln|tra|map| ba|ngl|tru|ørs|yde|sis|enc|lba|dis|tif|"
+      "bas|les|bag|um |pec|tus|opd|kor|mal|god|imp|lte|jek|år |dlø|nse|ilb|bil|"
+      "ndd|søg|iti| im|ema|edi|ier|eta|fre|ev |ina|tak|ærk|ari| us|to |pda|ege|"
+      "hån|ånd|ogs|løb|oku|ice|sst|ope|kum|mul|odk|kab|att|dke|gni|beh|ktu|ad |"
+      "syn|orv|nfi|lon|kte|ols|pun|tin| pi|rea|enh| kø|kør|sfi|dok| fa|kif|så |"
+      "ilf|nes|pt | sæ|nat|rem|loc|føl|set|rek|fel|ænk|ndi|aks| ro|ølg|rit|gde|"
+      "doe|op | gy|eti|fig| m |erh|bne| au|dta|din|off|kse| ga|gne|liv| c |ori|"
+      "udf|vel|bet|igu| ca|od |gur|che|kre|agt| ak|blo|mål|hov|ul |top| ho|ngd|"
+      " så|rhe|dni|ini|rev|ilg|gis|ple|con|øns|nhe|spo|ffe|kop|opi|øde|dri|sin|"
+      "mak|afi|ck | hj| d |lta|obj|ur | hu|utn|erl|aut| nå|ult|bar|vor|rs |cif|"
+      "sle|bje|spr|ksi|dek|rim|mpl|ock|udd|nam|ts |uve|oka| ob|out| åb| uv|orb|"
+      "pon| tt|beg|ny |ole|åbn|ruk|ise|bit|uel|ect|ætt|ria|rig|præ| b | ra|rip|"
+      "ire| bo| mu|ekv|uff|oll|kve|pla|adt|ien|fic|niv|nve| ex|nti| a |lp |ber|"
+      "jen| e |ogi|ukt|egi|edd| hå|når| pl|vir|gsf|ese|ris|igs| pe|ri | rd|eau|"
+      "tch|nu |ned|mær|put|irk|uto| ch|nog|oer|ryd|ud |rli|lti|vea|ork|erf|olk|"
+      "kni|sor|ls |dvi|tol|ima|føj|ffi|ksp|atc|æns|rg |løs|ytt|run|rl |gin|war|"
+      "kla|lgt|gss|øje|ure|tim|enu| wi| g | or|ak |ndh|rib|æld|ful|rna|pli|abi|"
+      "ena|olo|gte|obl|sty|lic|iks|luk|lyd| ce|græ|lke|hæn| le|må | ub|rts|mt |"
+      " bu|ibu|pil|eha|rbi|pat|ote| ni|rom|ix |ets|pte|mon|kol|bog|rde|ops|lfø|"
+      "omd|ust|iab|ch |ræn|lit|ik |rce|nsf|mpr|ry |dan|ead|ært| ke|sh |tad|ura|"
+      "rk |ipt| ur|ct |udv|abl|ty |dfø|tty|spu" },
+    { "nb",
+      "er |kke|en |et |ke |il |ikk|for|ing| ik|te | fo| er|ter|til|ler| ti|or |"
+      "fil| fi| av|ng | in|re | en| st|ver| me|ent|lle| de|bru|ruk|de | br|av |"
+      " ut| ko|ed |es | i |tte|ig |om |rte| va|alg|val|ere| ve| sk|ste|opp|ett|"
+      " å |all|ell|sta|ert|and|dig| so|nde| op|end|inn|art|tt |nne|nge|ker|ne |"
+      "der|men|og |nte|skr|rt |som|lin|med|ldi| og| kl| si|lar|kla|eil|fei| på|"
+      "ll |nt |dat|ser|på | fe|rin|se | ma|vis|avn|yld|kri|el |gyl|det|nav|den|"
+      " el|tal|rer| li|mme|uke| se| et|sjo|kel|jon|gen|ata| re| le|nøk|is |le |"
+      "ppe| pa|tet| pr|var| ug|kom|ugy|len|man| nø|vn | ka|økk|riv|ger| hv|lde|"
+      "an |res|ign|ren|kan| vi|ge |on |dre|pe |jen| du|utt| ar|ner|egn|at |ist|"
+      "eks|ar |pro|app|iv |gt |ers| un|str|nda|lg |teg| te| la|uk |are|omm|mer|"
+      " fr|lge| mi|lgt|ta |ndr|du |lag|und|ngs|eri|ern|lig|ile| an|sig| al|ten|"
+      "fra|inj|ene|ang|ede|mma|id |ele|al |ant|orm|map|jer|nje|kon|ndo|ont| he|"
+      "eng|ill|gn | na|st |rma|els|tre|ort| ta|ume|før|ret|atu| be|ut |kal|rd |"
+      "ska|hvi|lse|nta|ra | sl|arg|ove|ord|lut|ive|enn|ess| ha|tat|fik|ved|met|"
+      "ass|les| bl|rdi|nin|slu| sa|set| n |tes|ate|gna|sel| ad|ven| gr|sti|nst|"
+      "erd|del|gje|sse|rti|ram| ov| sy| da|tan| fø|ens|ard|tid| to|age|kst|ore|"
+      "gra|sen|us |vel|lt |asj|stø|mel|eve|per|amm|kk |ode|het|lis|ifi|let|elt|"
+      "old| ny|ild|att|rse|mat|pre|tar|eli|nn |get|sam|dar|hol|kje| ba|tor|net|"
+      "fin|akk| gj|sor|pak|ykk|kat|ika|ull|avs|ble|jør|one|gru|ør |ide|red|min|"
+      " kj|eld|pas|itt|esi|nen|ses|har|nes|rgu|me |gum|sva|ige|kre| må|est|bar|"
+      "ttr|vsl| ek|ogr| di|tab|ytt|nfo| om|ier|nke| by|fje|rog|bli|enk|tur| fj|"
+      " ne| fu|tin|lat| no|ils|las|ete|år | id|kte|lik|nat|kes|tiv|eme|sk |byt|"
+      "kt |ese|la |oll| nu|ref|ski|ars|tem|kjø|di |lyk|hen|typ|ype| at|tro|ark|"
+      "ute|nal|øre|try|ila| fl| po|lem|sso|kil|sis|rne|upp|gre| mo|ntr| sp|unn|"
+      "rup|tif|yte|ket|ise|tek|rol|ks |era|pps|rst| bi|isk|elg|num|ets| fa|mis|"
+      "je |jel|ast|reg|ve |pos|log|din|tus|nnd|rek|rel|bel|abe|dva|ted|ift|ase|"
+      "adv|nse|han|kod|pes|føl|ølg|ind|spe|ins|ryk|doe|umm|ppr|isl|må | kr|kun|"
+      " ig|sly|rre|mod|tel|do |vid|esk|ir |rev|inf|tør|sto|ndl|vil|rsj|mas|vet|"
+      "unk| lo|por| s |par| uk|erk|sik|rki|nti|øri|sin|gge|nor|gne|ørr|ken|lok|"
+      " ho|vær|sys| gi|ari|eho|orv|rve|ose|omp|slå|egg|ati|tda|dir|ato|odu|tig|"
+      "ori|utd|hel| e |in |yst| f |sko|fun| nå|obl|alt| tr|llo|to |øtt|ns |aks|"
+      "ons|dle|gno|ære|tis|hve|tøt| co|git|rit|ukj|ros| væ|kiv|fer|ss |int|dus|"
+      "ksj|lla|ran|leg|gle|gg | do|tri|rn | ty|oen|tsk|ykt|pp |pri|adr|dli|ske|"
+      "sst|nul|ids| su| ku|ag |ekt|ine|nli|neh|ful|fan|des|tom|mal|bin|sym|nd |"
+      "pen|lna|dri|rsk|pte|fle|ppg|tje|lls|søk|lsv|efe|kti| ki|ria|efi|die|kor|"
+      "ørs|akt|lli|lan|ame|beh|osi| åp|emm|kop|ime| c |ngl|gss|fel|bol|nyt|tti|"
+      "okk|dde| ga|ymb|mbo|ft |rs |ppf|elp|åpn|iln|ekk|ale|em |ned|syn| p |lsk|"
+      "ur |tni|tak|pgi| t |lom|ngi|ite|opi|igh|pfø|ndi| au|sle|pt |sek|fte|bas|"
+      "enh|ema|iab|erm|ans|nks|ce | gy|pse|lst|gel|ilg|eta|rea|oer|gan|ilk|sni|"
+      "dok|kle|når|lit|ina|ld | ra|rke|agr|ått|oku|lir|kum|eha|aut|erf|tra|ksi|"
+      " hu|vin|pet|ffe|iks|eti| x |ake|it | hj|hje|vne|ghe|kry|rhe|ny |mål|ryp|"
+      "ypt|ali|uts|ela|tvi| l |ope|sif| pe|øns|lte| d | r |ara|hev|kif|pne|gi |"
+      "erh|dek|pph|con|ols|ure|ion|ors|rif| jo|uff|edi| ro|obb|ike| ge|ffi|ost|"
+      " a |pli|sit|idi|job|blo|tas|urt|mpo|phe|utl|urs|rk |rip|bil| pi|ppa|lp |"
+      "pa |bes|rg |bak|imp|økl|ras|utn|top|rom|iti|pda|rde|ien|gst|ann|am |jek|"
+      "led|sid|nye| im|sum|kin|run|nhe| cr|rib|pie|lta|sty|utf|ima|så |gde|mak|"
+      "kas|ibu|kob|sim|rig| sø|møn|hop|ppd|ukt|utg|pst|ink|tlø|utv|mpl|suf|nsk|"
+      "use|sfi|ilb|bet| ap| u | bo|tol|lfi|nkt| m |ber| pl|kol|tme| or|sfe|enf|"
+      "rdf|ege|ndt|rat|dag|ap |tst|rna|hem|lå |mul|gin|ff |um |ave|van|nho|pla|"
+      "edl|åde|ect|lba|kev|ipt|ukk|rim|avb|itm|hur| mø|stå|uli|def|etr|eg |llf|"
+      "ix |mti|gla|rl |olo|eku|olk|kni|dis|ngd|ts |rts|ivi|tyr| mu|no |off|ade|"
+      "but|rem|løs|omr|onv|alo|lko|ogg|lås|elv|tru|rsi|ena|ire|evi|fre|ri |ye |"
+      "erv|nve|skj|pun|eko|pin| ei|spo|ust|tta|igl| ex|ynt|sky|nnl|gte|oka|lon|"
+      "ple|ekr|eie|loc| b |ip |noe|kap|kse|inu|pon|tli|vbr| tj|ams|ial| us|tod|"
+      "jem| lu|amt|nns|tad|eto| ak|lgj|ssu|beg|lke|trø|røm| j |lyt| ht| of|anl|"
+      "afi|dd |spu|tsf| lå|ilt|ikn|nit|mar|tts" },
+    { "pl",
+      "nie|ie | ni| po|ani|na | pr| wy|ia | za| na|wan|nia|eni| do|owa|sta|lik|"
+      "pli|ch | pl| je|rze|ny |prz|go |ne | mo|ego|ów |moż|st | w |est|ści|pod|"
+      "pis|ych| ko|jes|any|wie|awi|żna|ożn|ji |zna|ku |ać |ej |do |rzy| od| li|"
+      "ki |raw|uży| op| st|ost|cze| z |ane| si|cji|dan| uż|czy| pa|ien|pra| bł|"
+      "cie|cza|je | us|nyc|ier|ent|la |no | in|ika|kat| re|ię |tu |iku|pro|się|"
+      "owy| i |zen|wy |kon| ro|naz|azw|ja |wa |owe|em |nik|ik |yć |kie|kow|ka |"
+      "oda|neg|cja|acj| se|czn|zmi|za | zn| ty|ami|zy |bra| ka|ci |pow|pcj|opc|"
+      "mie| ma|owi|dzi|era|ym | kl|tal| ob|ywa|ale|mia|dło|su |zyt|men|orz|for|"
+      "war| ar|alo|bie|icz|ak |ty |ole|iet|zas| wi|ucz|luc|klu| sy| sk|yst|ini|"
+      "ko | zm| te|jąc|ist|ło | dl|dla|log|pol| we|ony|le |aln|roz| cz|ust|tan|"
+      "api|ion|taw|dow|tor|zap|ume|łow| al|ków|str|lic|orm|zon|ąd |błą|row|łąd|"
+      "jśc|wor|art|rma|ata|it |ez |ić |ośc| lu|two| gi|ian|ocz|ano| sp|rto|ść |"
+      "res|ub |lub|ran|one|aki|ako|szy|ers|git|rak|zan|acz|to |kcj|ra |cen|ana|"
+      "li | wa|wym|odc|lec|poz|tów|gra|isa|nal|wid|ącz|łąc|fik|nak|wyk|dcz|iep|"
+      " br|ość| ja| ta|yfi| co|wer|lin|ece|toś|mi |by |pak|dni|obi|ięc|ter| no|"
+      " to| da|sek|tow|trz| ws|ze |ram|jak|nej|iej|ski|wej|ast|uni|błę|łęd|yma|"
+      "idł|ste|ące|wni|sze|iel|uje|wyp|ce |now|we |ają| zo|zys|ona|zyć|ędn|zie|"
+      "bez|ogr|zos|zek|iwa|eks|ach|ono|nym|zwa|że |ług| be|ktu| de|stę|iem| fo|"
+      "nię|lne|ikó|arg|mac|eśl|nan| o |ta |wać|usu|er |ont|odp|ekt|ypi|żyt|epr|"
+      "mat| tr|aga|ież|tko|tyl|omi|ęci|cje| bi|adn|wyj|zer|rac|own|ali|pie|wsz|"
+      "lny|nt |oka|zwy| by|tni|ekc|tęp|at |san|arc|ii |oże|kom|ład|iu |dom|ma |"
+      " ze|um |tem|ują|cia|zak|lko|zez|iek|lon|yjś|zaw| ba|ało|isu|weg|sun|inf|"
+      "et |nfo|lni| n |nic|lok|od |ący|sow| ur|wio|nac|dpi|ylk|iow|edn|kła|akt|"
+      "tyf|es |yta|cho|ato|rgu|gum|rog|czo| mi|skr|ek |ero|pom|ry |łów|iez|opr|"
+      "tki|żen|ind|zne| pi|lis|eń |cz |koń|ońc|czb| ab|uch|sz |jed|ją |tał|as |"
+      "zam|gu |erz|sym|typ|tar|mag|enc|nte|erw| lo|nty|try|stk|noś|sty|sto| ad|"
+      "ytk|mu |świ|te |ros|wią| gr|ska|en | ut|tat|tek|rsj|ycz|któ| os|min| ud|"
+      "tro|ła |iąz| uw| pu|dek|ga |pre| sz|tyc|słu|zes|onf|yci|mod|yko|zio|uda|"
+      "aby|nde|być|ref|mię|zny|odz|kod|ele|is |awd|kiw|rów|iec|ejś|atu| nu|wyc|"
+      "yśl|mer|wys|cy |chi|ogu|ual|den| a |kre|sys|raz|odn|dał|wia| zw|niu|etl|"
+      "lem|eki|zac|odu|myś|epo|życ|omy|wyś|rch|aj |roc| s |śln|uwa|tua|drz|ces|"
+      "eże|yśw|dna| ak|ada|dny|oce|aso|ną |tra|rob|dod|ert| sc|oni|ba |teg|śli|"
+      "isz|dy |zni| id|cio|yte|nii|iki|tór|odł|id |głó|ozw|obs|ewa|ryb|utw|spr|"
+      " są|są |rty|liz|pas|low| is|and| ce|ies|nio|uj |sza|ał |ni |ide|dos|pac|"
+      " ła|każ| fi|ori|po |mbo|ign|isy|ezn|gno|ugi|nor|iew|ora| dz|ąza| wł|wis|"
+      "kac|omp|jeś|bol|ied|bsł|yto| śc|esz|ncj|ymb|iod|sów|ere|dat| ot|blo|par|"
+      "skł| ga|ńcz|eli|an |fil|arz|dne|sji|zaj|suj|aty|ard|por|pop|adr| el| dr|"
+      " he|or |elo|ser|ała| me|asu|stn|num|ren|int|ile|len|re |mus|oli|ort|on |"
+      "waż|am |oto|opi|owo| ch|met|ozy|ięt| oc|zew|ich|odo|ecz|gał|łan|awa|wię|"
+      "awn|zed|pus|nag|zeg|zwi|iał|obr|ame|ten|con|ed |pot|leż|kry|nda|ias|żni|"
+      "efe|hiw|tla|dar|naj| mu|oku|cal| wp|ówn|ins|wyb|ozn|pam|zcz|tyw|zym|omo|"
+      "dre|esu|rep| un|fer|kaz|osz|wyr|dza|ozm| an| kt|sie|pon|ezi|iar|syw|mow|"
+      "szc|nfi|lez|enn|ar |zec|se |pob|okr|fig|ara|nst|ąć |agł|tać| su| ró|eje|"
+      "żyw|gru|usz|aci|wol|ły |zia|oro|ca |dłu|aku| ok|ope|eżk|rza|ala|sca|kla|"
+      "twa| wz| di|pok|ryt|dno|rsz|ruc|unk|ntu|ceg|etu|cej|nąć|rup|az |iwu|wum|"
+      "wdz|ina|dze|og |kol|edz|pos|tym|ite|reg|uru| że|rdo|in |oko|cer|tos|sko|"
+      "otw|ate|eme|lan|rod|tab|wka|nu |ory|ymi| ca|inn| zd|che|ędz|żyć|zba|yj |"
+      "kra|zyn|amo|ron|igu| bl|wła|per|pu |yjn|spo|gur|ec |zet|gan|ntr|baj|odr|"
+      "ain|bli|dok|żyj|si |ysk|wny|ję |etw|reś|ród|ck |obo| ha|atn|ępn|nad|ajt|"
+      " au|ack|ver|rzo|alb|bo | t |dop|olo|kuj|ad |co |yłą|wył|tac|dzo| dł|ówk|"
+      "wne|how|stą|kty|om |kal|śni|rl | sa|aut|gna|usi|ażd|nap|oln| źr|źró|da |"
+      "ura|zi |sam| up|wal| tw|szu|gi |ażn| d |lbo| ra|tel|eln|ntó|ewn|kan|ódł|"
+      "du |ium|nas|lu |atr|ępu|ead|ozp|poł|ygn|łu |róż|wag|ień|cyj|śle|óżn|set|"
+      "ety|wpi|zow|riu|aże|nar| ig|cha|kst|yra|raż|ods|dal| zł|omu|zda|rt |poc|"
+      "zyw|łaś|zad|law|man|aż |sło| c |rea|zę |syg|rol|emo|osi|ieo|emu|eta|niż|"
+      "zal| sh| zb|ży |atk|zai|nał|ll |daj| ża" },
+    { "cs",
+      " ne|ní | po| př| pr|je |sou| na| so|pro| se|oub|ení|bor|ubo|na | je| vy|"
+      "sta|pře|ze |ová|ný | za|ván|né | ch|se |ova|ání|at |chy|hyb|ch | od|ce |"
+      "uje|or |rov|it | do|vat|pou|zna|no |ro | st|při| v |ho |uži|ou |neb|ost|"
+      "pod|lze|pří| a | kl|ent|lo |nel|kon|ru |elz|stu| ná|oru| ko|ké | ve|res|"
+      "te |le |lat| s |líč|ná |ouž|men| vý|nep|to |ba |cí |em |nen|kaz|nač|klí|"
+      "en |ast| ba|atn|ky |tel|ých| ad|ate|tav|pla|ku |ový|adr| ar|ebo| zn|tup|"
+      "slo|yba|dre|řep| re|bo | ob| ro|vol|vyp|odp|ři |zen| in|pis|ny |str|tu |"
+      "ína|ské| sp|pín|ého|ter|epí| zá|ové|byl|nak|ver|nov|et |hod| ja|dno|van|"
+      "vý |ek |st |prá|lov|ka | sy|nam|dat|odn|bal|če |řen|tí |for|ako|ím |řád|"
+      "měn| pa| al|ta |jak|ty |sel|sti|řík|íka| da|oče| li|esá|pov|ist|por| řá|"
+      "ak |epl|raz|ume|čís|náz|áze|orm|ace|lož|alí|án |nas| no|ko |mu |ick|iva|"
+      "sář|dpo| už| ce|led|az |živ| ma|pra|ně |zad|ící| sk|tov|ry |ově|nt |la |"
+      "ezn|li |poč|alo| de|ran|íst| by|eno|ale| ho|roz|not|oku|ten|že | fo|dov|"
+      "ech| čí|řed|ráv|nos|áno|kov|mén|ač |lic|arg|vyt| to|žit|ti |aný| si|de |"
+      "tný|dní|do |lík|ytv|vé |ven| zp| z |jíc|čen|edn|pos|elh|čas|pol|ísl|sah|"
+      "id |tra| jm|še |by |ign|zí |ont| n |ave|ele|ci |lha| ta|hal|nou|vá |žád|"
+      " te|tní|cho|ali|oro|sle|nez|ovo|er |len|ifi| mo|ert|čet|jmé| zm|ádk|odk|"
+      "íč |změ| o |ací|am |eze|tor|est|nýc| me|rac|obr| sl| žá|oto| k |ev |dán|"
+      "klá|zev|žad|íče|ují|ače|mi | bu|fik|rgu|gum|bud|lní|poz|lik|ího| he|bra|"
+      "es |spo|ádn|jed| lo|obs|tvo|pok| op|ena|ces| co|ste| ka|ění|ít |nte|tif|"
+      "yst|ve |sku| vo|ec |up |áln|kte|zná|ích|voř|výs|ins| ty|kód|typ|pin|tuj|"
+      "poj|výc|nám|su |vní|ním|oli|sto| ak|íše|sys|kát|cké|píš|onč|akt|ený|ite|"
+      "jso| sh|ktu| be|bez|tro|áva|yl |ram|ané|ves|arc|ros|tal|ček|mís|át |ode|"
+      "ede|olo|tů |ati| ur|rav|ovn|den|ém |ne |ečn|ypí|ým |ods|řet|iká|epo|avi|"
+      " kt| ex|nit|sig|nal|bsa|ář |erz| js| kó|ává|ory|vu |rom|ata|mát|dka|jen|"
+      "lu |tém|čte|el |ků |dst|ame|ené|ýst|ší |rch|pu |něn|eby|zpr|pli|eli| vs|"
+      "ude| bý| ji|stn|upn|ýt |cer|ada|ser|být|vst|sté|nst|kup| pl|ole|věř|láv|"
+      " ov|and|uží|esl|hel|adá|upi|mac|tar|néh|ud |chi|áve|žij|rmá|éno|má | ře|"
+      "vyž| di|ybn|sez|met|rti|ext|níh|ají|oje|vel| ča| id|dný|exi|ráz|lou|ožn|"
+      "náv|zov|sov|isu|aze|ato|yža|int| hl|rou|jí |ota|nut|řes|eln|is |áře|dek|"
+      "ahu|ožk| va|iko|xis|ití| ap|duj|nu |roj|roc|ouz|nor|eká|oce|rů |mus|du |"
+      "azu|mez|gra|dro|etě|těz|kom|výr|tab|ard|ejn|ému|rve| ot|žen|tex|ční|sko|"
+      "hla|aci|inf|ado|liz|aro|tat| čt|ici|děl|ed |nfo|kud|tiv|dpi|tic|lok|cov|"
+      " zo|al |rma|hoz|mož|ačn|tan|azy|orů|hes|vac|va |rát| mí|dné|tře|dy |ove|"
+      "káv|ód | sm|uze| zd|nem|ut |erv|neo|rit|lez|omp|liš| vš|psa|baj|ajt|dvo|"
+      "vše|teč|hov|rat|jte|hiv|od | ze| fi|olb|ště|nes|var|ell|ije|esk| ig|nto|"
+      "tné|zob|tit|ote|one|ozí|obn|ozn| nu| i |onf|zac|uto|ným|gno|huj|zor|ete|"
+      "omo|on |she|sí |ylo|mat|nic|rán|tri|tom|dos|nál|ví |íli|ara|sob|in |lin|"
+      "ože|ly | mu|říz|nda|kaž|ažd|ogr|nás|dan| au|ře | u |zu |řit|dí |véh|zap|"
+      "pre|nec|ina|usí|las| uk|šec|ísk|osl|fil|ntr| vl| zí|ilo|rní|rze|zís| mi|"
+      "šen|dar|aví|nej|ll |ýra|dku|dok|imp|zi |říl|rol|iš |par|ile|zy |ást|mov|"
+      "aut|ori|lad| ke|upu|můž|ůže|tev|ika|lán|rob|ruj|urč|ope|pri|ez | vz|ala|"
+      "ern|áto|pom|lit|per|lem|lsk|oho|aco|sla|tná|ěře|ká |rl |rdn|ík |net|out|"
+      "sa |des|rog|ved|iza|nul|re |prv|řil|íku|omě|pam|amu|ána| sc| má|ázv|nfi|"
+      "kos|oko|níc| čá|con|ket|vra|oře|áde| fu| bi|ouč|fig|rot|ivn|dle|ort|inu|"
+      "ore|oři|ány|isk| im|kce|ušt|blo|iv |sym|dař|ázd|zdn|odd|čí |esu|chn|fun|"
+      "etr|těn|átu|eré|vit| su|era|pot|asn|ký |zec|spu| an|aři|pon|xt |ust|tua|"
+      "ice|cíl|hle|ual|zdr| cí|ock|da |ěze|čás|čů |igu|ěnn|kac|azí|us |moc|mpl|"
+      "ji |kem|nti|žív|cit|po |dir|rip|esa|adu|oda|me |nap|edo| dv|gur|lby|nsk|"
+      "bí |árn|bol|lav| zk|aní|eru|fro|evř|iso|mbo|ám |tno|ese|víc|vou|ide|ymb|"
+      "řip|rý |gná| ví|ura| kd| vr| us|amě|chá|ekt|kou|kdy|yp |ávr|pt |íce| t |"
+      "bný|íze|il |řít|ré |pat|ezp|aná|dá | c |pní|nat|iž |ack|ném|ačí|vy | uv|"
+      "loh|hra|spr|kum|dlo|unk|eži|loc|lné|hu |itn|ddě| x | p |ybí|min|nee|záp|"
+      "zav|nkc|nta|sat|eex|ená|šíř|tej|ami|ion|ah | d |ani|vyb| pi| mů|ska|ulo|"
+      "tis|cel| e |odl|ome|sch|aně|kol|dou|ere|nce|za |erý|sy |vla|war|ind|tak|"
+      "vač|ned| ca|dná|stí|hny|již|zas|zak|peč" },
+    { "sk",
+      " pr|ie | po| ne|je |nie| na|ova|ný | sú| je|né |pre|bor|súb|úbo| sa|sa |"
+      "van|na |ov |iť | vy|ať | ni|eni|ia | ch|ba |pri|or |men|lo |rov|sta|uje|"
+      "nep| v | za|re | ná|pod|kon| od|ná |zna|chy|ver|hyb|ani|ho |te | do| ak|"
+      "pou|ch |ouž| al|res|ent|ožn| re|ost|stu| in| ko| ve|áci| zo|bol|om | mo|"
+      "ne | sp|iad| ba|ru |mož|ka |oru| sy|lat|aný|ebo|zov| st|ale|atn|prí|ast|"
+      "pla|sti| ob|ky |str|kaz| s |cie|tor|to |náz| se|ri |yba|vať| a |tav|pro|"
+      "nam| ad|ázo| vo|ého| sk|ený|ní |tov|adr|den|odp|bal|tup|hod|íka|žné|epo|"
+      " zá|ané|dre|áva| ar|alo| vý|alí|teľ|ako|lík|ta | ho|for|nen|ist|oro|uži|"
+      "raz|ate|bo |epl|orm|odn|leb|dno|slo|nov|tvo|por| čí|kci| to|dar|ých|ove|"
+      "nas|čas|obr|ny |voľ| ro|ti |vor|ria|nia|ozn|cia|rmá|ari| zn|aní|šta| pa|"
+      "ou | zl|kov|prá|ku |íva|len|er |dpo|ok | de|ko |ené|not|oľb|pis|arc|žív|"
+      "tu | me|lov|čít|ový|uží|vý | ma|íta| no|nos|az |by |tný|kľú|ľúč|olo| kľ|"
+      "red|rzi|typ|ilo|oda|la |am |ej |est|vat|bra|sť |kto|erz|ak |rík|ume|ned|"
+      "nt |ada|sym|nak|ril|sah|spr|ali|ori|le |tal| bo| ri|esá|ick|rch| ty|tan|"
+      "ren|oča|avi|et |sár|pís|žia|zly|lož|lyh|ce |vyp|mie|yha|sek|ore|inf|ame|"
+      " he|poz|néh|ite|hal|ráv|nfo|no |pra|roz|tie|va |mi |odk| te|dok|mu |ram|"
+      "čen|ové|ry |žit|obs|nez|áln|vyt|dka|ods|pos|ymb| fo|sku|mbo|kom|ra |iu |"
+      "tre|dá | op| so| ex| ča|met|nšt|nač|ten|ami|aká|tuj|ytv|iká|adn|dst|akt|"
+      "riť| o |inš|ter|ísa|ol |júc|že | ži|do | kt|ies|čak|čís| z |ajú|ven|oku|"
+      " by|vol|roj| zm|bsa|nem|upn| ce|nut|ekc|dia| zd|pov|oli|aná|dro|ľa |veľ|"
+      "iac|edá|zob|nýc|ujú|tri|daj|oto|ete|ave|jú | be|eno| ur|ísl|zor|ec |rán|"
+      "dov|kup|zoz| di|ifi|áto|trá|ota|dan|orn|rip|osť|stn|ede|rne|zad|li |pol|"
+      "en |sle|led|ráz|sys|ty |yp |eme|mát|lad|ovn|al | ta|ktu|ená|ste|exi|tro|"
+      "poč|me |duj|niť|chí|hív|ahu|mov|ím |yst|ont|ign|káv|id | si|pin|lic|žno|"
+      "sú |mác|ii |onč|neb|eľa|hla| vs|ová| mi|zná|ran|zdr|nám|upi|on |vst|omo|"
+      "xis|výs|my |ekt|de |sté|bez|fik| co|vu |tra|ere|vé |ár |ciu| vi|tém|zme|"
+      "esl| up|pom|cov|edn|eho|gra|sko|eľk|dne|jov|ýst|nu | lo| pl| ot|hel|neo|"
+      "tab|kác|kum| n |hes|nej|žad|ľby|liz|rie|rac|ces|ík |vá |tar|ext|ved|výr|"
+      "ča |ade|ato|jed|za |ope|byť|yť |sov|ára| už|es |and|ory|se |arg|adi| ap|"
+      "ypí| li|náv| št|obn|ké |ve |ole|ovo|úča| hl|up |dos|su |poj|rem| tr| mu|"
+      "mus| sh|ara|ero|môž|otv|lav|cii|yko|ezn|onf|per|azy|ení|náj|rob|lok|tom|"
+      "omp|vyk|nto|viť|ázv|moc|iti|pli|má |rom|kla|huj|ogr|kód|ser|nte|adk|reť|"
+      "eťa| zv|dat|upo| kó| ov|ed |lu |rát|nic|pu |žiť|adu|pot|ajt|ťaz|vyž|loc|"
+      " id|ska| sl|lne|tat|sať| ib|oje|azi| ka|vo |par|nom|azu|ona|sla|tné|zy |"
+      "ľba|ačn|pec|rav|tif|ion|iba|hov|rep|is |tex| bu|ina|ain|ena|ýra| bi|ci |"
+      " x |yža|aze|ým |ene| má|ros| fi|ll |tná|ozo|dát|át |chý|árn|ado|edo|ust|"
+      "úč |ziť|aco|rog|ern| da|ard|ôže|las|ly |ola|eľn|ort|áni|fun|vič|ký |ind|"
+      "ľko|tiť|vše|ma |kát| k |sto|eľ |tož|ual|tať|kos| vš|tot|dis|liš|ačí| dá|"
+      "ože|ičk|ek |ret|ace|už |ati|vac|ca |baj|pok|int|lik|amu|hýb|ybn|nai|urč|"
+      "tua|ell|aci|ide|pný|reb|nan|ríl|nap|ata|úda|pam|ez |orý|ojo|brá|čné|nor|"
+      "zu |pus| sc|fil|íli|iš |nee|rt |rea|rek|nes|zia|spo| uk|usí| fu|rev|ert|"
+      "ile|ode|čet|rat|dy |ník|ruj|fig|ožk|zvu|esk|reg|oče| úd|in |bud|nú |ýba|"
+      "vne|emo|nfi|zok|čiť|vy |uko|bin|tia|nda|tvá|vár|čov|rol|she|lin|úci|erá|"
+      "ock|tok|ele|jen|erv|eto|deb|eex|con|oži|uto|čia|véh|edi|unk|jto|ber|eda|"
+      "zís|ísk|azo|šet|zie|dny|apí|oko|rý |rid|def|as |tno|dať|roc|otr| zí|ebu|"
+      "eoč| vl|set|dný|ice|med| au|ním|rad|ntu|eci|etk|sig|sí |ií |sch| ti| vz|"
+      "cké|nci|via|spu|igu|gur|nút|rgu|gum|ner|tic|ino|vis|rve|cou|gno|záp|esu|"
+      "ach| va|ív |los|nkc|och|sky|čný| šp|em |zác|ému|exp|amä|ným|tý |ava|zap|"
+      "ito|jde|žka| ig|ká |it |del|ah |izá|ntr|rel|osl|imo|úce|iek|oni|dné|tne|"
+      "tky|ečn|asn|bný|ájd|íky| c |odu|zo |ect|enc|aut|lny| či|dpi|ína|oco|xt |"
+      " nu|zdn|sob|úto|špe|pt |ipo|záv|us |ré |aho|nál|té |fin|ázd| mô|hu |etr|"
+      " an|nti|era|ávi|rač|cer|eta|ači|ers|eľo|edz|dvo|zač|apl|tív|imp|isl|íko|"
+      "efi|žen|ine| la|áve|ude|ing|val|ech|fo |púš|úšť|sof|oft| dĺ|dĺž|prv|eži|"
+      " oč|vov|od |ala|log| of|zis|il |syn|ĺžk|uál|loh|oce|hra|še |elo|mo |oré|"
+      "po |dom|asl|šťa|kyt|skr| as|st |ché|com|du |nul|iná| zi|rdn|ámy|spú|jek|"
+      " um|báz|iet|iso|ial|nta|áte|aso|súč|uti" },
+    { "tr",
+      " bi|lan|eri|ir |in |en | de|lar|ama| do| ya|bir|ler|anı| ge| ve| iç|an |"
+      "ile|er |yor|arı|dos|sya|osy|içi| ba|or | ol|ası|len|ya |lam| ka|ara|çin|"
+      "eçe|dı |ak | ku|değ| se|eği|sı |ini| sa|kle|le |ıla|ar |lla|ri |lem|ull|"
+      "ili|ene|ste|ma |kul|alı|de |ekl| ha|çer|nde|bil|adı|eme| ye|şle| be|nda|"
+      "si |ind|ni |ını|geç| di|ır | ta| pa|esi|da |ala|ayı| al| gi|iz |rı | ko|"
+      "eti| ar| bu|rin|rak|iyo|eni|den|lir|lı | il|mad|ata|di |tir|nı |tır|dır|"
+      "ın |eli|yen|li |ola|ter|me |iri|ana| iş|ek |baş|yaz|siz|işl|ne | so| ad|"
+      "ik |rsi|ve |ers|hat| ay| yo|uru|aya|tar|ınd| gö|izi|sın|ıyo|sin|bel|ki |"
+      "ist|ver|ere| da|seç|it |ırı|tan|lma|la |say|ine|edi| he| i |ok |ril|ğiş|"
+      "and| si| an|yar|yal|diz|lik|yas|şti|ılı|rın|çık|son|dan|nam|leş|ket|ele|"
+      "rla|ısı|rma|rıl|emi|atı|ula|nım| ça|dir|amı|nın|çen|zin|rle| ön| çı|ürü|"
+      "bu |ldı|mi |isi|kar|yok|ta |eye| ki|man|mey|yer| bo|al |et |ış |nme|olu|"
+      " in|erl|ğer|eya|rul|vey|ger|par|eğe| sı|kte|ken|ndı|yap|ği |lin| sü|enm|"
+      " re| uy| te|onu|rme|lle|nek|git|mas|unu|ndi|il |nin|ilm|bağ|end|num| li|"
+      " tü|nce|azı| ek|na |mak|ake|çal|ıml|nıl|ce |sat|ulu|iği|abi|pak|lış|miy|"
+      "el |yan| ne|ca |ız |iş |ell|tek|olm|iml|ird|sür|ştı|tur|nla|ağl|aşa|cı |"
+      "alt|arl|eks|med|tem|gir|may|üm |üze|kay|mış| st|mıy|una|aht|hta|ut |des|"
+      "apı|rek|ede| et|irt|nah|ına|akt|miş|rti|im |ğil|işi| is|eki|dek|kal|nız|"
+      "aki|ölü|ırm|içe|sız|ıcı|re |tal|luş|ğla| no|lis|imi|irm|şar| fa|mbo|ışt|"
+      "est|irl|se |bol|nes|ikl| bö|mle|mut|gör|dur|uşt|ştu|rdi|un |til|em |emb|"
+      "kom|yı |ktı|omu|kla|ılm|nu |ıkt|sem|bul|du |on |rli|ayn|res|tür|az |mal|"
+      "te |sta|böl|am |pıl|işt| gü|mla|rde|tik|eşt| co|rum|ığı|lme|kon|ada| ma|"
+      "lgi| va|lun|mel|ide|ci |ilg|var|ol | n |anm|ağı|tı |mes|nle|dil|ık | dü|"
+      " uz|mlı|bek|oku|eyi|lüm|tle|tla|arg|ti | du|ğin|kli| me|ald|esn|gös|öst|"
+      "ral|ece|und|ıld|ard| aç|rıs|ım |şim|ade|rke|mli| ok|kil|ışı|aşl|sne|cak|"
+      "lık|ksi|zma|inm|nma|bit|niz|ras|zıl|kış|anl| at|yi |biç|rel|ges|ici|ümü|"
+      "art| öz|mek|rgü|arş|nen|şma|umu| eş| en|azm|ayr| im|es |ten|düz|etl|maz|"
+      "yük|ük |şla|um |aca|der|tıl|rt |uma| ço|rüm|tam|ild|neğ| nu|yıl| iz|boş|"
+      "açı| ed|dal|aşı|let|nmi| za|ekt|uya| pr|gün|her|liğ|doğ|kim|zca|oğr|tas|"
+      "aln|ıra|çok|tin|lab| e |min|lnı|gi |lu |bay|dak|güm|üma|enl|dış|erd|lın|"
+      "nır|acı|ran|rça|ur |ğı |yol|ızc|eşl|ırl|rir|arç|ldi|mam|mar|ip |ye |ra |"
+      "lay|nta| dı|ğru|zam|önt|kod|uk | su|nid|mı |nak|tel|ldu|nel|ari|ıkl|yna|"
+      "ati| tu|cel|zer|çim| ke|fad|akı|lıy|sa |nem|at |yrı|iki|oru|def|uyg|sun|"
+      "nra|net|izl|rün|onl|tme|onr|ygu|dla|zle|gen|üre| bü|dre| s |eçi|gul|anc|"
+      "nca|ğın| mi|ışm|üst| gr| x |kta|lır|ıkı|blo|nıc|tab|önc|ad |tif|old|lmı|"
+      "aç |adr|ort|öne| hi|st |boy|kip|met| dö|riy|niy|zla|tes|all|sis|kur|uğu|"
+      "ley|ram|utu| a | ik| yö|yön|gel|rda|ayt|raf|rsa|tim|azl|ate|ge | fi|kun|"
+      "ımı| üz|lmi| on|ez |mod|vur|mza|kap|rşi| çe|kin|oyu|bi |aşv|şvu|unl|faz|"
+      "uzu| if|şiv|sil| yü|zdı|örü|lü |ame|ang|rec|ike|öre|ün |zel|sik|ağa|sim|"
+      " üs|cek|ünü|azd|zun|lt |adl|nun|mez|ünc|zi |yle|pro|dön|şı |fil| m |inl|"
+      "tki|ck |rge|ef |ert| kı|oş |rdı| ağ|etk|tüm| şu|liy|dar|apa|ars|pla|üyü|"
+      "ll |ser|şın|mü |imz|ifa|ite|büy|ipi|uza|kti|epo|con|run|evi|yin|rol|abl|"
+      "san|şik|hed|şen| aş|dep|ntı|mu |şıl|mem|luk| or|ür | fo| po|ğu |ltm|ıda|"
+      "rim|ret|nli|eşe|rü |maç|ucu|ça |öze|sor|gra|iye|sır| er|ynı|nlu|idi|ren|"
+      "ark|gis|ru |ksa|bas|sağ|gil|dah|ed |ant|lığ|lat| c |ead|lac|imd|pat|su |"
+      "get| le|yıs|çıl|ka |no |izg|ha |din|zak|ion|dis|diğ|laş|işk|ntü|ect|ünt|"
+      "ref|erg|afı| ög|öge|mac| şe|erm|ıfı|ack|mat| ti|tre|kab| to|har|sel|rta|"
+      "tuş|ord| op|str| lo| sh| kü|ebi|fın|tu |nıy|arm| şi|mın|for|ent| es|yt |"
+      "ven|mde|mun|irs|odu|oll|ner|atl|ngi| d | zi|rit|zen| un|pos|orm|nan|yut|"
+      "oks|ali|dik| çö|com|yla|men| ap|are|ahi| sö|çek|lge|nte|ski| çi|ibi|üve|"
+      "abu|ırk|ch |inc|rea|tma|önd|fır|int|klı|zal|ura|akl|aha|evr| ak|sıf|rar|"
+      "dığ|loc|sh |mün|lek|güv|üml|ifi|pac|gru|ika| f |utl|one|up |lım|pi |çev|"
+      "odü|dül|söz|elg|han|uml|fen|if |kıl|ğac|lid|asa| eğ|riş|eci| ex|tun|lüt|"
+      "ütf|tfe|ayd|osu|yic|set|kıs|ans|nmı|zır|lec|ont|yıc| şl|çöz|ıdı|esk|rdu|"
+      "dım|nt | t |nit|nuc|dın| p |iç |haz| lü|ff |ire|bun|şke|rl |aml| ur|tmo|"
+      " r |ikt|şlı|niş|gib| ra|nal|sah|che|ükl" },
+    { "fi",
+      "en |ist|on |ta |nen|ine| ei|ei |ett| va|in |sto|ell|ost|le |tie| kä| ko|"
+      "oit|sta| vi|lin|lli|tet|sa | ti|edo|ied|ssa|dos| tu|äyt|an |itt|vir|lle|"
+      "rhe|irh|tta| ol|tä |ste| ta| si|ttu|ole|käy| on|een|ite|ton|tu |lit|eel|"
+      "tus|ali|tee|taa|itu|ja |ain|tti|us | li|ise|tel|to |ent|men|ttä|aa |val|"
+      " ar|tte|nni| sy| lo|hee|nis|la |ess|ia |tun|lla|et |mat|mis|aan|ksi|sti|"
+      "all|mer|ime| lu|rit|ava|stu|koh| pa|kis|lis| mu|hte|imi|its|ytt|set|enn|"
+      "käs| sa|mää|sen|sym|tsi|äär|tää|ato|nim|si |joi|vai|än |eri|utt|ään|tii|"
+      "oso|ivi|oli|soi|voi| la| as|tav| ku|bol|mbo|ymb|etu|min|ää | vo|loh|ohk|"
+      "hko|luk|ita|kki|ter|isä| su|tai| re|eta|rek|oll|sky|ill|äsk|ois|ake|ala|"
+      " ja| ka|int|oht|ti |aus|kir|irj|eki|est|ase|lä |lai|uut|erk|iin|va |sä |"
+      " se|per|ume|tul|onn|ust|te |ema|tam|nta|koo| po|var|ssä| al|sis|nte|ote|"
+      "uku| tä|arv|nne|kse|epä| jo| ep|sin| ha|att|rkk| me|stä|ark|ty |ees|he |"
+      "uot| nä|uet|aik|ata|iä |ais|äri|ko |ai | en| ni|dot|ri |tui|ran|sii|lue|"
+      "tin|ytä|ope| pi|ui |rvo|era|ama|oi |ses|sek| x |nti|rki|sim|elm|odo|oa |"
+      " ty|ami| ki|at |ulo|tue|uks| op|ood|tyy|ot |net|unt|ros|ijo|ver| jä|iss|"
+      "ila| ve|vaa|tty| ri|llä|isi|ori|til|päo|äon| to|toi|oko|uva|kti|sij|los|"
+      "na |it |odi|kem| ma|vat| yh|mi |alu|lii|sia| oh|use|ndi| mä|suo|li |eks|"
+      "un |and|tio|ast|iir|unn|ity|rja|lau|ota| os|poi| ke| vä|päi|kok|ude|iet|"
+      "kan|jen|ut |aat| ot|tem|sit|ien| bi|kai|met|kom|tuu|del|ian|kon| no|oss|"
+      "hde|yyp|ass|sal| pu| od|itä|ika|äin|ero|tuk|ttö| av|täm|kit|rjo|ers|sio|"
+      "den|ink|ikk|tar|muo|ohj|iit|emi|ypp|see|oon|uor|ome|aks|dat|rsi|roi|äis|"
+      "num|ntt|ulk|omi|ppi|di | pr|ati|tau|aki|riv|ulu|pi |yte|tys|ämä|iiv|muu|"
+      " n |nto|aut|pal|ekt|lma|eis|hje|ina|vo |toj|ppu|arg| ra|uri| in|yht|irr|"
+      "elo|ärä|hak|oja|toa|uud|las|ott|aro| mi|pro|kee|ara| yl|uis|ans|ket|yks|"
+      "uus|bit|ka |säl|tot|se |jä |ki |ens|jäl|os |mui| di|tei|ele| pä|lop|pak|"
+      "äll|oto|väl| uu|rin|oin|ion|uol|jel|io |pit|tos|iti|rro|ua |lei|lem|ön |"
+      "äli|let|tas|luo|ana|ida|mä |uur|jär|jes|oni| mo|raa|vii| de|lee| st|nnu|"
+      "ohd|etä|tit|da |maa|tis|dia|ärj|rje|ken|täs|kke|kop|eit|det|ris|aam|oid|"
+      "lev|sää|ke |ont|ios|ten|uke|kio|kuv|man|uom|puu|ind|mät|suu| co|elt|avu|"
+      "yöt|sel| et|van|vak|ire|ys |tö |nss|näy|aih|saa|rgu|gum|ari|arm|nde|opu|"
+      "dir| te|aal|mal|lta|älä|ssi|uod|tuo|nna|ma |tom|ann|asa|syö|eti|opi|uin|"
+      "oje|utu|nus|uee|aul|no |ose|er |ue |naa|kua|uss|kin|hto|kka|kos|löy| hu|"
+      "yli|eto|iia|ilm|kui|dis|kaa| s |laa|eet|kko|loc| lö|ro |dek|eht|kal| ai|"
+      "san|täj|tia|tak|ant|lmä|puo|ku |tor|vie|ese|ode| er| an|män|rä |tal|rel|"
+      "eke|ppä|rii|lia|dit|opp|kel|ike|ntä|isk|eli|nki|tto|esi|änn|huo|pai|näp|"
+      "äpp|täv|vel|sak|oka|mon|lko| ul|ert|vit| pe| äl|ske|ial|ora| so|tum| nu|"
+      "yty|säi|sty| es|ask|par|oma|lel|äjä|asi|isu|ätt|vis|iot|pää|ame|ein|ide|"
+      "yt |lki|oim|lke|kun|nee|lat|ält|läh|ots|sar|mas|ltä|pu |kut|ual|aja| il|"
+      "uja| da|irt|mio|tuj|adi|vää|jon|tön|nut| lä|äen|din|smä|ska|nno|vin|nai|"
+      "ävä|älk|ono|ivu|näi|kor|tae|aad|äsi|inn|tsa|ril|ile|ete|one|es | he|jos|"
+      "iht|oc |unk|ne |vi |uu |nnä|iva| le|aes|ker|teh|kea|vas|ät |kij|ytö|mit|"
+      " us|jau|tuv|kä |olt|obj|de |osi|raj|nsi|akk|jek|end| sä|pis|kää|htu|ätö|"
+      "alk|avi|fun|ll |kil|aar|bje|nä |ova|öte|yn |sos|fil|sem|lim| r | ob|äsm|"
+      "ee |tös|umi|luu|äiv|via|öyt|skä|tek|tse|kot|ioi|äim|lku|hta|kul|yhd|sam|"
+      "tol| eh|ima|yst|eja|tod|inu|des|unu|koi|oti|ipp| ed|lus|aka|oik|ajo|kyk|"
+      "tok|ely|iko|oda|ioo|ect|ini|ämi|kur| un|uun| fu|abi|mmä| ab|rta|mel|imm|"
+      "lip|auk|ic |ii |ea |aaj|tan|usa|anh|ky |ede|yä | el| fi|tua|ute|yko|put|"
+      "rak|kat|kak|non|loi|ona|hen|iak|ait|aim|lan|lil|nkt|lmi|tri|ign|yle|mpi|"
+      "ene|atu|lek|sse|iuk|jok|liu|siv|syn|ryh|yhm|kie|len|ble|sop|ija|re |not|"
+      "äss|uts|tim|ore|hdo|otu|emä|hin|kas|atk|tka|typ|ura|jit| yk|mut| t |uto|"
+      "ynt|is |tyk|oks|töm| ex|too|inä|ino|tsu|nol|ivä|hit|rat|rik|ed | ne|eni|"
+      "ria|pin|jas|ukk| fo|sil|pre|alv|apa| hy|eva|täe|nt |vil| ov|hmä|ove|moi|"
+      "ilu|emp|uta|sko|alt|vät|äät|älj|rva|dyn|ohi|rea|hdi|ehd|lty|iri|usk|nyt|"
+      "mak|olu|lve| dy|vuo|sol|koa|yna|aje|kum|al |tym|ale|rty|nnö|kei|täy|emb|"
+      "def|yri|str|mäi|kes|sku|ort|uli|art|elp|yde|sp |ra |haa| sh|eko|ls |tyn|"
+      "aav|ekk|nkk|mia|elv|ntu|res|elu| ry|pos" },
+    { "hu",
+      " a | ne|em | me| az|az |en |nem|ele| sz| ki|len|fáj|ájl|tt |tel|meg|ása|"
+      "és | fá|sa |cso|tás|gy | ha|et | el| le| ka| be|egy|ara|asz|nál|ek | ér|"
+      "ok |men| va| eg|tés| hi|ncs|es |ak |has|agy| kö| cs|ás |sze|szn|ssz|ény|"
+      "jl |hat|an |ése|zná|sít|lt |ent|ett|ítá|fel|ter|se | fe|ért|sol| al|ott|"
+      "at |lít| fo|tal|rás|kap| ta|tó | pa|for|áll|cs |hoz|vén|al |apc|pcs|ene|"
+      " mi|jel|tum| és|ere|ató|ran| re|or |par| ke|szá| z |net|hib|het|int|sza|"
+      "ker|ja |zet|zés|tár|rvé|vag|oló|érv|eze|min|rak|el |kez|ált| ad|anc|kor|"
+      "nt |lat|ála|akt|llí|íté|zám|re |gye|sor|lha|mez|ba |si | ar|zás|er |szt|"
+      "kar|let|rte|yte|lás|va |ely|írá|ik |nyt|elm|iba|ló |os |ány|nak|ező|vál|"
+      "ni | he|um |zer|hel|ség|lis|lle|ra |lme|us |ren| ho|eg | vá| so|alá|tar|"
+      "lye|is | si|ind|nek| tö|kte| ni|orm|ez |end|név|ato|ala|tet|inc|nyv|kön|"
+      "les|rt | te|nin|szi|art|sik|öny| bi|oz | né| li|eál|dat|on |ete|yvt|vtá|"
+      " je|ume|ti | ké|ban|ve |ntu|sak|rmá|rté| fi|mag|sok|ell| in| pr|esz|tot|"
+      "ezé|ta |öve|ték|oma|ár |csa|ver|ike|iss|ada|ha |gad|ega|beá|áso|ége|eti|"
+      "atá| lé|év | vi|elő|ert|nde|ozá|alm|öss|vet| ma|ont|ész|som| ál|val|elt|"
+      "ző |ben|lap|rül|nye|ot |tre|arg|ehe|ül |áló|ára|res|át |lva| ös|elh|leh|"
+      "eme|pro|erü|lét| is|yel|köz|ók |ite|lcs|osí| de| ve|ret|lma|ill|ll |eje|"
+      "ási|ető|tő |lok|nyo|nev|olá| ut|tat|ásá| ku|nos|ime|rta|st |ció|kií|iír|"
+      "fej|maz|köv|els|yez|ges| ez| ol|eté|ort| tá|olv|ist|vis|rés|tke|kel|lép|"
+      "lto| ko| má|toz|ata|sz |ulc|eve|kat| id|bb |ési|fig|kul|vas|lem|elé|szo|"
+      "mer|etk|lés|lin|ult|kén|lta|dsz| n | es|rek|hez|leg|nte|ámo| új|vég| ír|"
+      "nds|reh|van|mat|zó |mód|tör| vé|zik|esí|ól |tok|tle|ono|oly|igy|por|oro|"
+      "ket|ána|fol|etl|le |éte|átu|iku|kus|las|ént|ván|szü|yes|azo|rgu|gum|egh|"
+      " mó|kim|álh|zab|kül|ság| po|áci|án |bil|met|ére|orr|kil|ító|den|ölt|áli|"
+      "zon| át|ám |arc|jlo|más| en|táv|tol|cím|ült|kér|kép|vel|oga|olg|dás|am |"
+      "ako|pus|kód|pít|lál|oss|lya|étr|ál |ne |ord|hív|bem|rlá|típ|yos|ípu|ess|"
+      "ag |lté|rat|vol|mát| ak|lók|épé|yam|ésé|gat|de |ink|ati| co| mé|ese| cí|"
+      "dot|zto|sul|li |ado|ék |kal|hag|sta|ítv|oka|zük|üks|ksé|ism|ram| se|zár|"
+      "yet| fr|túl|áro| do|pés|per|ől | bá|ten|tja|eng|gra|ódo|nty|ilé|rrá|tén|"
+      "ia |osz|rol|rch|tyű|adv|ame|zin|ód | na|dva| mu|vár|éne|sek|lla|ris|tha|"
+      "hit|íte|be |jez|töl|ély|éke|mán|umo|lán|nge|inf|gál| tú|ltá|zol|zen|ég |"
+      " st|adá|apé|pér|ávo|tes|opo|nfo|mok|ma |fog|koz| er|mel|ago|lan|om |gje|"
+      "báj| nu| tí|lja|erz| ig|ign|szó|lep|ájt| t |jeg|tik|tán|tor|sme|tos|ang|"
+      "nél|ly |eke|egj|epí|kon|ai |te |kif|dít|idő|ny |tva|uto| ré|mér|ege| kó|"
+      "sop|dok| no|mog|sér|rzi|tám|zat|tan| ap|ák |ogy|tve|ép |eha|biz|zió|nyi|"
+      "gi |ánc|dik|chí|omá|ghi|hiú|iús|úsu|ét |cse|sra|stá|bvá|sen|asá|ívu|vum|"
+      "füg|ügg|son|ezt|eho|tek|ztá|edé|áho|rto|tér|unk|lső|abv|tko|za |ót | ro|"
+      "aló|ozó| s |mác|erl|ged|szl| tu|ul |ább|dol|err|set|tla|ból|sás|id |ion|"
+      "zte|ros|hos|álá|ide|jln|ke |nul|elv|ons| ny|von|oku|kum|ogr|kko|etö|ásr|"
+      "rog|gya|úl |éré|mun|hog| ba|ső |zel|olí|nc |ile|isz|ezi|blo|att| fü|fil|"
+      " e |izt|ama| op|ika|elü|nto|dő |atl|ajt| lo|jlt|már|ol |ki |ce |bet|gok|"
+      "ali|tom|and| kí|rre| di| ür|dél|lül|élk|it |gyz|ozz|gre|pon| ti|rít|ng |"
+      "oli|haj|rhe|zha|gyo|álj|kít|tri|rea|üre|in |alk|lkü|nsá|kés|ió |utá|ain|"
+      "ibá|ife|atk|ív |fri| fu|eko|én |okk|töb|öbb|lek|szk|jes|kív|sáh|enő|rok|"
+      "ull|lgá|ona|alo|tag|ad |onl|mbo|hiá|lak|erm|ezd|iók|vek|öz |nka|yzé|kis|"
+      "vül|lsz|nőr|lel|bel|str|ját| gy|ián|ssí|don|akk|nta|nté|zig|kiv|ímk|új |"
+      "égr|mén|gná|ern|ar | mű|nít|pe |nyz|lez|lát|ívü|aso|lik|íth|nal|azá|yűk|"
+      "ani|yen|ásk|enn|sat|ssé|tta|eri|egé|vő |han| c |ení|gyá|nag|íto|dos|tev|"
+      "evő|bej|ást|láí|áír|töm|eta|con|tív|épe|lő |rny|lal|lje|szí|del| am|szö|"
+      "ext|zim|yás| sp|zt |vez|lka|zes|zzá|rd |roz|tez|zot|me |efe|apo|ina|bol|"
+      "ton| jo|ser| sa|hiv|the|bbi|akí|hal| ug|get|elj|ri |gys|ldá|loc|kör|enc|"
+      "etr|tót|érh|nk | su|ols|iva|pt |rom|old|vid|ors|ajd|ope|tte|yit|ate|ge |"
+      "ola|ig |ejl|yan|zi |lgo|zta|lvá|vat| to|sho|imb|yom|szé|alt|gés|ock|kek|"
+      " kü|gos|lte|lsó| l |láb|fut|áto|áva|lot| da|ana|iná|rel| ex|ntá|jlb|ebb|"
+      "éhe|dés|elö|löl|őrz|éve|tex|lőt|üze|rán|bi |eké|újr|jra| an|egf|él |eli|"
+      "ash|etű|ába| x |só | f |ula| i |tab|tál" },
+    { "ro",
+      " de|de |te |re |are| nu|ul |ea | se|ent|rea| în|tă |le |nu | co| fi|iun|"
+      " in|ntr|ste|ate|est| a | pe|fiș|ier|at | re|tru|se |ză | es| ne| di|rul|"
+      "une|ie |în |iși|șie|ru |țiu|ui |oar|num|pen| pr|ază|men|car| po|la |lui|"
+      "eaz| la| ca|ile|ele|nea|ume|ulu|nte|ter|ere| un|ire| cu|int|val|ist|or |"
+      "ne |tat|ect| ex|ali|ați|con|sta|tor|nt | ac|che| ar| su|com|ată|cți|un |"
+      " li|er |ver|liz|ii | fo| op|cu |ica|ră | si| st|fic|ero|că |rec|iza|ri |"
+      "ces|ili|loc|ște| o | ma|pre|ifi|oat|eru|să | da|sec|uni| er|tul|it | al|"
+      "al | și|uri|til|pro| pa|alo|ți |roa|ut |uti|ecu| ut| va|str|poa|tar|ori|"
+      "ini|ia |au |id |imb|pți|și |oca|bil|in | s |ecț|ta |me | ti|tre| sa|act|"
+      "tur|for|ar |rma|opț|res|siu|ara|din|lid|orm|tra|rar|imp|lor|ace|lic|nec|"
+      "ici|lă |cat| ve|des|ei | mo|st |eri|cit|sim|lul| me|dat|sau|per| b | să|"
+      "ers|pri| sc|ce |mbo|bol|nă |ina|ato|zat|ept|ine| pu| af|ime| tr|par|abi|"
+      "omp| no| sp|ite|cut|pta|ca |chi|cte| ch|tri|eșt| im|rat|ril|șir|tiv|ion|"
+      "lin|înc|dir| ad|por| ci|ări| ta|tip|mul| au|scu|ive|mat|cri|oru|hei|țin|"
+      "put|tab|ert|rie|ită|ție|and|eva|ică|cun|ții|min|utu|scr|dă |esc|rsi|esa|"
+      "ort| ni| do|reg|pli|ast|eci|olu| ie|ale|nev|uno|cep|rel|eși|nal|spe|imi|"
+      "iți|cre|tea|stă| lo|afi|mpl|erm|het|mai|ebu|ins|ra |inf| ce|mod|eal|eta|"
+      "nos|nfo|rti|pec|et |ind|ai | lu| ap|cce|bui|cal|ni |cif|ide|ost|măr|ieș|"
+      "mel|sch|loa|nic|osc|ach|iti|rmi|pac|unt|nd |ita|tim| an|tel|cor|cto|rim|"
+      "ten|pul|pe |ult|inc|man|umă| el|pot|sun| bi|roc|tal|ont|exp| ur|ext|ctu|"
+      "era|unc|sem|cti| te|fi |sup| cr|sit|lis|mit|ona|ute|ip |lim|fos|ens|nde|"
+      "ant|ece|acc|ătu| câ|înt|nta|one|tif|fie|nsi| fu|arh|rhi|fer|ete|ct |ati|"
+      "nst|nți| ob|egi|on |fin|dec|olo|edi|tut|efi|ice|toa|șea|reb| vi|rac|arg|"
+      "ișe| le|ima|dar|sar|rgu|rup|emn|etu|ția|uie|căr|nar|mar|rit|vă |erv| at|"
+      "el |lat|oce|ic | eș|art|ol |dep|nti| gr|ern|elo|ută|ave|ura| ul|așt|es |"
+      "def| id|odu|eme|rta|nat|aut| av|dim| fa|ară|cur|caț|exi|elu|sti|esi|rii|"
+      " fă|nce|leg|dre| mu|ner|gis|maț|hiv|acă|nit|ot |ală|cer|ope|rca|oma|nii|"
+      "iec|nil|ll |ță |nda|atu| gă|cod|ize| x |tic|găs|ram|il |tep|tis|ură|tet|"
+      "ără|dac|uat|onț|ilo|ând|mpo|făr| ge|dul|ăsi| n | to|exe|tem|dis|zar|fol|"
+      "ref|arc| du| că|mem|ese|idă|ame| so|eți|tec|los|ore| sh|ivă|onf|mic| as|"
+      "adr|lur|gum|ric|rin|ism|dif|sme|ran|obi|efe|cea|tin|iva|iil|gra|urn|mpr|"
+      "ină|ual|cul|ede|ome|ibi|ple|osi|xis|ora|lem|gin|xec|rol|țio|eas|riv|red|"
+      "der|lar|tua|atr|mp |șit|eșu| mi|urs|zea|ăru|ula| ba|mpu|mă |cta|den|va |"
+      "ci |esu|alu|rez|tas|sel|inu|ung|emo|alt|ari|ocu|eli|lea|hel|ala|șua|esp|"
+      "met|lun|gur|rt |pon|egă|rte|sa |abe| or|pun|agi|ţi |na |fun|bel|enț|eca|"
+      "bli|găt|ndi|poz|epa|lte| oc|tan|uta|hid|eză|ogr|eia|ser|ntu|dup|rib|ana|"
+      "oct|igu|uma|ria|nor|ibu|tro|fil|mor|tio|ntă|io | en|ozi|gen|ote|eco|nie|"
+      "iu |rni|cum|ret|var|nco|dia|ăr |vir|war|dez|nzi| pi|eie| aș|nam|mer|otr|"
+      "ard|ene|ilă|mag|mes|ech|lti|mis|seș|spa|ips|oc |lit|sis|rog|iei|is |bie|"
+      "rva|sur|tir|ren|nță|pt |ruc|sin|nul|ncț|od |inv|him|tex|eti|urm|enz|ata|"
+      "zer|da |mna|blo|rd |iat|rip|gul|teț|ec |gru|lt |end|ge |lip|ell|xpr|cân|"
+      "det|năt|cop| d |ule|ami|set|tr |eze|uto|vat|ndă|med|ani|ign|nut|ons|us |"
+      "pă |aju| go|sub|ât |oni|âmp|rnă|ărc|mnă|ir |am |ma |za |ode|mpa|câm|opr|"
+      "reș|ipt|odi|she|upă|sul|ble|ciu|nia|let|rge|rne|pan| he|ns |doa|nou| ra|"
+      "deb|asc|ipu|eza| ab|ial|ro |aj |spr| ru|apl| am|iab|pse|tră|cio|dic|gre|"
+      "răr|ian|sc | e |upo|ex |eac|ure|ptă|but|ană| l |nre|erg|lec|spo|sie|rio|"
+      "cla|niz|nfi|iot|upr|apt|bin|fur|eaș|nve|ve | r |upu| bl|ls |ila|enu|afa|"
+      "far|pat|ivi|soc|col|ngi|fig|upt|cel|dex|isp|ade|ncă|vel|um |tit|opi|ăto|"
+      "uă |ema|ziț|mpi|saj|paț|rif|gno|cât|an |nch|lia|rem|vea| pl|non|bți|del|"
+      "ng |gă |înr|pid|asa|ain| c |rmă|vin|sto|rsă|ock|fra|xt |ing|biț|ree|ase|"
+      "etă|sor|und|ucț|uți|not|ti |ose|ger|ncr|lan| ig|im | ze|pil|unu|iru|em |"
+      " et|up |ucr|zi |nui|rc |rop|gnu|gim|epe|ega| șt|doc|clu|lel| sf|rep|obț|"
+      "eni|mac|taț|bă |rna|rev|ibl|rve|iv |ouă|ix |emu|leș|ich|exc| p |ead|ioa|"
+      "vec|nen|ps |scă| i |fac|sig|raț|op |niv|bib|păr|bug|aro|no |rl |amb|niț|"
+      "ada|ctă| v | fr|mea|ela|ed |ze |oli| t |ord|erc|luc|mba|imă|baz|pos|apa|"
+      "faț|nva|lio|pra|aţi|mon| bu|mal|zac| sy" },
+    { "id",
+      "an |kan| da|ak | di| me| ti|ida|dak|tid|ng |ang|si |men| pe|at | be|eng|"
+      " se|ah |ber|ala|ter|per|kas| ke|nga|ri |ika| in|ari|uk |asi| re|al | un|"
+      " te|as |ntu|ata|gan| ta|unt|tuk|da |pat|rka|apa| ba|ada|erk|yan|dal|lam|"
+      " ya|dap|ali| de|am |ama| ko|dar|er |mem|ran|aka|era|uka| pa|it |ing|tan|"
+      "ung|ar |eri|ma |nya|pen|ara|seb|han|lan|nam|una|gun| si|ai | ad|bua|emb|"
+      "ngg|and|ngk|is |den|id |ya |lah|nda|gal|aga| va|nta| sa| ga|ini| ma|nak|"
+      " bu| ha| st|val|ena|ent|dan| na|mba|ke |rin|ebu|int|lid|ila|or |et | op|"
+      " at|bol|eks|ela| ar|bar| su|ol |gka|tak| bi| ja|str|iha|pil|en |us |ni |"
+      "isi|di |ili|set|ta |tor|mas|sta|ist|on | co|elu|in |ka |mbo|mat|kom|ers|"
+      "lih|ste|erl|tau|dir|au |lik| no|dia|kun|uah|tar|lua| an| pr|ori|ipe|bag|"
+      "ket|ode|de |gag|aru|bah|ik |sim| la|lok|le |ver|uar|uku|lai|el |rsi|oka|"
+      "git|tik|kon|dik|ris|ind| ka|rek|end| gi|atu| pi|ati|ura|ire| al|uat|nal|"
+      "jan|ban|for|esi|aba|bel|ekt|tu | ca|tam|esa|har| lo|rma|es |ggu|ek |emu|"
+      "san|ti |nde|reg|alu|rel| le|any|ruk|ert|imb|hka| po|akt|uan|ksi|orm|eta|"
+      "mbu|ite|tem|did|buk|dit|asa| ak|amb|tah|ope|lka|dis|aik|te |ens|ut |aha|"
+      "aan|arg|pro|erb|tif|eba|nst|ole|pe |nti|pa |kel|ks |pre|res|pad|nsi|sik|"
+      " fo|eti|lis|pan|sal|ian|ant|rak|tas|ere|ike|idu|tip|rus|egi|ren|mod|asu|"
+      "isa|leh| ni| li|gis|kto|tka|pak|aca|dip|suk|duk| fi|mpa|ume|jal|ile|ed |"
+      "igu|ion|uru|ins|nil|nte|bun|ref|sa |bac|tel|lin|pem|tru|amp|elo|but|rah|"
+      " ve|dat|tri| x |ula| mo|ur | ob|ilk|na |mit|rik|obj|bje|dib|pes|gga|kar|"
+      "agi|tat|ra |ses|spe|man| gu|fik|bai|ele|pus|ia | ap|ifi|dae| sp|lat|dek|"
+      "apu|ap |eru|omp|tin|ema|kat|um |ih |enu|eh |omi|def|uks|aer|eny|eme|mpi|"
+      "ete|ga |jek| ek|nka|gat|lu |fil|ndi| he|err|ten|ken|ead| ku|uba|rla|if |"
+      "ong|fer|mer|emi| mu|rap|nja|utu|se |bal|il |onf|bit|emo|ngh|inf|gai|aks|"
+      "sin|unc|sis|nfo|ote|ana|efe|ca |tur|sar|nan|imp|re |emp|erj|ern|psi|ras|"
+      "kod|hir| to|mor|akh|kur|rti| er|khi|hap|dig|enc|ker| en|kti|tra|ima|rro|"
+      "ll |ror|nci|ene|car|muk|gab| ex|lal|rja| hi|sam|atk|ont|uga|uli|saa|sit|"
+      "ngu|ui |ir |edi|ack|anj|nt |efi|gur|nis|cab| s |sel|ita|rgu|por| sh|pli|"
+      "leb|lum|ina|ect|ink|lur|tio|up |ck |ars|rip|has|abe|aku|fin|nd |sec|din|"
+      "ok |ve |ame|aft|ign|sif|rna| ol|itu|ua |ebi|gha|sub|hon|ain|gum|li |dah|"
+      "ose|aat|eda|erd|gi |ip |mil|tab|ja | wa|kal|ktu|rea|ci |daf|fta|pos|con|"
+      "ahk|rup|mel|bat|sed|awa|ate|rba|rge|la | tu|pka|hil|sem|lak|iab|ake|ksp|"
+      "ros|dil|ebe|ibu|uh |apk|ank|bih|oho|dug|me |ngi|tuh|osi| pu|tek| mi|ive|"
+      "jik| ji|em |hat|rem|ngs|der|gia|hea|abu|ops|tal|oco| do|un |dih|aya|ad |"
+      "bil| ab|bin|ser|bis|nfi|cok|mul|coc|kin|ch | as|mbe|nom|rse|nul|mak|ki |"
+      " of|ipa|iki|par|ibe|min| uk|fig|sil|rlu|rep|gin| ru|erg|st |erp|kte|mun|"
+      "ul |all|nge| gr|pun|kau|tap|uta|ria|omo|eka|ore|ola|arc|dul|ksa|sum|ntr|"
+      "aua|tag|loc|npa| du|met|gra|bas|sh | ul| ch|sun|ega|ce |odu| n |che|anp|"
+      "ram|umb|les|epe|ase|ru |des|ag |ndu|bur|ons|pas| tr|lem|wal|tus|get|hel|"
+      "tom| id| sy|rub|ito| is|ise|iri|sua|erh| ju|las|rta|mbi|ult|ot |out|son|"
+      "kes|spr|pi |ble|ort|are|rch|rt |sia| by|gki|mpl|op |ahu| im|ade|api|sat|"
+      "sud|ark|ge |mot|ic |non|no |oba|nar|one|log|epa|rat|cat|kut|mua|dua|iny|"
+      "oso|poh|com|ide|yte|sep|byt|chi|enj|ine|kem|exp| ur|rai|lar|sio|ff |mpo|"
+      "und|das|ner|apl|pac|nye|uda|ry |spa|fse|dim| ot|epo|nju|eca|tim|ial|tia|"
+      "uhk|tun|ilu|rec|mpe|omb|ked| a |iti|kos|lit|ple|wak|bug| je|lt |gar|ben|"
+      "oto|rim| ra|luk|rd | lu|ct |tes|dif|bes|kum| it|th |ku | th|ps |ubm|bmo|"
+      " r |sen|nat|ona|rol|ewa|usi|rli| c |fo |red| sk|utk|mis|sek|jum|ord|cti|"
+      "war|tet|isp|deb|tre|sym|abi|naa|ifk|fka|lac|iku|kse|sig|ani|not|ove|erm|"
+      "cal|flo| bo|nca|put|age|off|hui|yak|hiv| ce|nem| nu|nen|gam| d |ash|uju|"
+      "ias|ami|rit|ow |kah| ge|rde|lew|wat|uml|lti|mla| us|adi|oku|fun|upa| aw|"
+      "dii|num|rbo|to |est|eni|cor| el|mes| ne|tul|bak|ese|nol| wi|om |rsa|var|"
+      "iks|low|ubu|pol|usa|cak|rut|ips|kuk|ne |abl|add|loa|sti|kst| m |kec|rha|"
+      "use| fu|dok|oni|gsu|mal|ts |oma|cod|fli|eam|eck|ail|art|iap| so|cob|sai|"
+      "ss |yal|hec|uti|edu|lob|ix |kri|anc|pel|ess| v | au| hu|ace|nfl| f |rl |"
+      "iba|ira|ls |pla|ral|mum|ogr|ns | bl|blo|lon|ba |rm |del|iff|olo|sto|aut|"
+      "nco| fl|pu |ust|ef |nor|ell|ld |ty |arm" },
+    { "ca",
+      " de|de | no|es | el|el |no | es|er | co|ió |la | s | a | la| un|per|ent|"
+      "at | ha| en| pe|que| re| l |ar |est|nt | ca| fi|ció|ha | po|en |da | d |"
+      " se|és |al | in|fit|xer|txe|ls |itx|un |con|com|des|sta|ra | pr|re |aci|"
+      "men|or |na |ect|ts |ta |del|tra|les|ica| di|nom|els|ut | al|ia |ion|eix|"
+      " és|pro| si|res|ada| ex|om | pa|it | qu|ns |gut|ers|ix |tor|esp|ter| am|"
+      "cte|aqu|rs |ist|ir |str| le|rec|amb|ri |eu |ot |for|ons|tat| ma|mb | i |"
+      "ina| ar| ll|et |ida| tr|tre|esc|ont|una| mo|ori| fo|sió|nci|ant|ue |pre|"
+      " op|lit|pot|car|era|cio|orm|ogu|stà|spe|pog|err| su|rma|te |int|omp|ntr|"
+      "ssi|dir|ca |nte| ac|ifi| o |ble|uet|fic|rro|pci|se | er|ver|tro|ari|git|"
+      "ten|ade| ob|ura|tà |sen|opc|lla|itz|ost|lid| so|act|ran|eta|tes|àli|ror|"
+      "egu|an |tza| or| gi|ues|all|bre|le |ona|ire|ma |rad|ort|cap| ve|vàl|dre|"
+      "paq|emp|cto|ord| us|ual|ste| va|cad|id |can|cri|mat|fer|us |par|ali|scr|"
+      "cia| te|abl|os | và|ame|ita|iu |met|mpr|den|eci|ess|min|val|is |nti|nvi|"
+      "lic|ctu|més|egi|pec|rea|dor|tar| lí|arà| mi|mis| fa|pos|one|nar|mos|seg|"
+      "nal|nat|si |íni|ènc| aq|ll |ser|nca|anc|efe|ssa|loc|ies|ode|anv|iss|lín|"
+      "ign|nts| me|ref|tur|als|sa |ge |ume|ria|ici|cac|pri|cam|rsi|arg|tua|inc|"
+      "erm|cci|imi|rti|st |cif|odu|lor|rdr|tal|mer| ta| to|cat|ins|ema| cr| da|"
+      "ap |ass|tem|ecu|rod|rob|rre| fe|nta|alt|va |inf|lat|ere|lli|tab|cre|onf|"
+      " ap|tip| em|ado|mpl| ad|nfo|via|man|alo|ara|nia|reg|tan|tge|cor| hi|ure|"
+      "ime| an|lle|ili|rac|ret|cla|tin|atg| ti| lo| gr|ome|sig|ol |nde|rim|fal|"
+      "ats|ora|lis|duï|til|igu| fu|fin|sti|ase|ert|obr|oba|por|ple| he| st| cl|"
+      "ic |té |rt |exe|dif|ït |ete|gur| im|def|rat|nse|uït|hi |leg|jec|ens|nst|"
+      "omi|ors|orr|ini|tic| n |ide|pli|pus|sio|omé|mac| ba|iva|rar|sit|lim|iqu|"
+      "ràc|sor|àct|obj|osi|bje|reb|ex |eli|xec|eny|gra|ecc|tec|oca|sub|exi|enc|"
+      "ipu|eme|eni|qui|lar| bi|neg|cal|sup|tid|ero|mod| do|ibl| br|tei|lem|bra|"
+      "nic|ext| ge|fil|ele| bl|riu|rep|unt|exp|lau|ing|rèn|rta|rgu|erè|dis|ro |"
+      "ena|nfi|sco|dex|usa|equ|rem|ati|xis|gum|laç|bas|tiv|uar|ind|on |han|au |"
+      "nya|ces|cti|odi|gir|ets|gui|dad|amp|pod| vo|arx|cie| bu|eba|pla|sua|sat|"
+      " ne|mpa|zar|ula|qua|vis|eri|nes|ès |iar| au|blo|gna|tot|edi|lec|ell|mpo|"
+      "rna|cut|ima|usu|ndi|erv|pat|fig|pon|ros|bli|fon|rme|índ|rei|ris|imp|nor|"
+      "ine| ín|rxi|sis|bat|in | li|aut|xiu|mbr|uit|art|rd |tri|ale|eti|omb|sec|"
+      "rip|mar|dic|dar|fec|ler|ote|ive|orn| ut| ab|ate|gen|var|uti|emo|ava| mé|"
+      "usi|arr|roc|rup|ren| ig|llo| af|obt|sob| nú|núm|ene|spo|ova|fus|uer|atu|"
+      "cta|uta|apl|mit|ial|cod|oc |ou |aç |end| av|tam|acc|afe|lti|ile|nir|ree|"
+      "mes|ege| té|nll|sol|bui| pu|enl| id|nen|dat|oni|det|rca|vol|up |its|ltr|"
+      "ana|úme|reu|mid|ram|aba|rov| ni|rit|etr| as|iur|pen|erò|rò |cer|bal|rmi|"
+      "ngu|cur|ern|efi|ja |ese|let|col|ixi|alm|tiu|feg|ota| ho|gru|nda|ça |seu|"
+      "pra|ul |arb|mot|mal|uda|red|tit|arc|il |isp|req|sel|sos|nac|sca|ogr|rbr|"
+      "ece| ce| nu|ard|sim|itu|ipt|ito|atr|mp |ear|rà |gin|ús |tiq|pte|ps |dul|"
+      "ms |bte|rog|gis|amí|aix|rop|rel|gno|ck |me |tex|ata|unc|lad|mí |ce |mem|"
+      "ner|tad|ole|din|ans|ecl|ead|ite|yal| ús| ja|rqu|rig|xt |cs |opi|nec|esa|"
+      "tim|nad| x |ang|lme|sh | et|lan|ult|ges|upr|fix|tàn|gei|iab|ni |apç|pça|"
+      "çal|eco|mas|mpt|lt |oin|rés|apa|lta| ch|che|abi| ei|sar|dep|zac|bin|spa|"
+      "bri|ope|rol|ch | at|bil|fun|rev|cid|xpr|urs|oms|nit|clo|ubm|spr|ots|tru|"
+      " om|ack|dia|lin|lac|nco| c |ove|use|ein|pré|ega|uci|ute| oc|epo|bol|rvi|"
+      "ng |rir|not|nou|ón |epa| p |iat|dei|exc|nté|òri|uan|cés|im | só|són|ama|"
+      "coi| f |ede|ed |ànd|rav|aul|eda|ad |sin|inv|nça|rpr|bar|uto|nie|lon|nve|"
+      "hel|mòd|di |lei|òdu|tac|hab|teu|adm|ocu|últ| mà|bé |ill|rra|vid|but| t |"
+      "iet|dit|rn | du|ff |oss|bit|ido|mbo|ped|inu|and|mps|cum|sic|cle|ixa|oct|"
+      "erc| sh| pl|tif|pac|ras|emò|tio|daç|bmò|mòr| pi|don|olu|pia|rte|doc|cep|"
+      "ept|squ|hea|imb|ral|ian|ig |lir|uid|nov| ur|are| vi|rom|ban|lte|xid|deb|"
+      "mei| ra| fl|num|ne | mu|adr|vos|epe|duc|rio|elp|nce|sum|za |vel|pie|ior|"
+      "aça|pt |ric|ore| aj|rl |aus|ís |iff|ict|rib|uri| sí|ux |ule|uin|bor|oce|"
+      "üen|ry |uei|leu|ron|ols|cop|nne|age|ixe|sep|ncl|ya |güe|set|ga |ibu|hor|"
+      "dec| v |aju|òli|cce|rer|ueu|zer|rce|um | sa|ve |mbò|bòl|cul|eso|dèn|maj|"
+      "egü|pun| r |uni|ds |pas|ego| m |fiq|aví" },
+    { "et",
+      "ne | ka| võ|ise|ud |uta|ail|fai|mis|ta |le |on |iga|ga |se | fa|da |sta|"
+      " ei|ei | on|tud| vi|kas|ili|us |atu| se|asu|sut|id |st | ko|end| vä|ine|"
+      "min|est|ti |ata|vig|imi|ja |ole| va| ku|ist|väl|te |tus|ami|ast| sa|võt|"
+      "li | si|eri|älj|el |või|nim|stu|ava|sel|eer| ni|tam| re|ada|ide|lis|ime|"
+      "ali| ja|ed |kui|ks | ol| ar|de |tat|ane|nda| sü| te|ui |ust|il |aja|si |"
+      "ald|lja|loo| pa| mi|nne|is |eta| su| nu| lo|õi |ita|tu |lt |use|gan|kir|"
+      " al|lik|ab | po| li|es |nes|ega|ndi|lda|ste|eks|tme| pr|it | mä|sis|num|"
+      "irj|er |ümb|emi|saa|jas|kon|und|mi |äär|ent|ik | ki|õnn| ta| lu|õtm|et |"
+      "kat|val|ad |süm|ead|ma |aks|bol|mbo| jä|sea|mat|ite|ära|tad|dat|eid|ema|"
+      "and|tav|õti|me |vii|men|sen|umb|tal|ing|di | kä|rit|rea|aad| st|oog|itu|"
+      "ade|sed|tee|ida|ont|dis| tu|al |eem|sti|ama|ri |ele| mu|pol| tü|lin| an|"
+      "gi |ase|ess|oll| ve|tak| in|ile|alo|as |tan|lid|oon|jär|sio|lem|nul|pro|"
+      "ahe|jut| ig|ate|inu|ge |arg|ver|see|kse|kor|ima| to|oli|tei|suu| n |ogi|"
+      "ete|aa |vai|eba|uud|mit|isi|mal|at | pi|iiv|lit|ood|uur|aal|lõp|ber|ndm|"
+      "käs|aat|rje| lõ| ba| la|tsi|ign|rgu|lju|vad|ioo|mbe|ati|rid|iku|mää|all|"
+      "ra |rju|ult|tab|uut|na |nd |sit| ee| pe|muu|ume| ho| eb|mas| pu|kus|lok|"
+      "ral|des|dus|res|lii| ma|sõn|sek|ter|sam|isa|ärg|gum|ain|era|ses|ssi|tte|"
+      "iki|nte|kim|tun|nti| õn| sõ|ea |ng | tä|taj|iks|jun|aga|orm|esi|itt|pea|"
+      "tor|ree|uba|sal|hen|nt | s | le|oet|vah|ivi|tek| de|oni|met| ke|ika|ser|"
+      "rol| ai|rmi|an |lli|bai|kaa|tse| av|ol |baõ|aõn|tim|sse|fik| es| as|tri|"
+      "aik|üst|iid| et|eva|eme|ara| er|iat|oma|dme| t |ntr|ldi|ub |süs| v |rin|"
+      "ikk|tro|vas|ute| vo|orr|blo|arv|par|ksi|ll |ina|uge|koo|tüh| üh|hoi|rus|"
+      "mär|rat|gu |rim|eis|rtu| bl|dam|ala| so|ku |ant|ni |tag|puu|vat|mel|eel|"
+      "ärt|udu|vää|aid|lub| aa|ee |med|ngu| ri| no|rsi|pet|ots|gus|etu|lla| au|"
+      "aeg|mes|ib |la |adr|str|ühi|eli|õne|eda|koh|tüü|det| uu|dre|mbr|ers|aar|"
+      "oia|ühe|ntu|lug|kee| nä|hel|sem|em |sig|age|loe|iit|ord|toe|ere|lei|laa|"
+      " gr|utu|rra|ori|naa|oot|ram|äit| oo|nud|ait|sim|inf|vaj|in |pre|ndu|bri|"
+      "adi|kst|ard|dub|aas|jad| ül|dar|pak|ake|iig|ell|taa|gem|vor|nfo| i |eld|"
+      "pik|kku| pä| om|ore| me|gno|ale|aut|uue|tii| co| fi|vit|lle| ju|näi|üüp|"
+      "täi|ss |ope|ten|ut |iti|tut|dma| ae|uru| l |õpe|egu|teg|evi|jal|eat|dad|"
+      "rgi|ini|mus|rek|av |ost|töö|nor|tel|man|tes|fil|lus|tit|ool|nev|eal|ka |"
+      "nam| ne| tõ| tö| är|arh|rhi|ba |odi|amm|ärj|gas|let|mee| ra|hii|asi|per|"
+      "var| aj|uti| en|adm|seg|gra|elt|õim| mo|kes|ude|alt| kõ|alg|del| di|sii|"
+      "bat|meg|ese|erv|oks|lki|ato|üle|od |rot|ref|gna|mev|jat|va |int|kom|ota|"
+      "iss|rve|ula|kõi|ran|äis|pos|äsk|sin|rup|dit|õik|ass|did|hte|tid|rge|moo|"
+      "dab| ro| k |sul|gru|nen|sid| p | d |rva|ang|eet| fo| c |ted| m |ind|eku|"
+      "tin|ena|dir|reg|tle|nta|maa| ti|ani|unk|llk|con|pi |ke |igu|kti|nkt|oke|"
+      "tea|idi|üp |kts|ifi| f |ki |sa |nna|nal|ule|okk|iht|suf|ul |eko|ert|set|"
+      "deg|gid|ege| bi|og |ce |rog|eab|käi|oo |kun|vee|for|nde| ag|ull|alu|hem|"
+      "tmi|täh| r |õib|ogr|umi|ats| lü|rt |anu|rv |iim|ekt| id|re | e |las|ev |"
+      "äsu|als|kud|lek|ve |iir|ode|mad|lse| is|gne|no |eav|äsi| op|efi|rda|nik|"
+      " na|fo |lai|uid|mil|uva|tar|kla|iri|roo|lat|ion|het|tas|ix |omi|his|ame|"
+      "voo|kuu|sil|pii|lev|pal|tif|sih| he| ot|osi|ill|iis|päi|or |mik|oom|ärk|"
+      "umm|eti| a |vea|lam|luu|rja|ril|äli|ien|out|ire|tet|rii|sei|ede|one|bin|"
+      "õpp| ha|ket|õig|net| x |its|pp |pid| un|uni|ene|ren|um |os |rti|ken|pri|"
+      "tur|hal|ure|ars|ot |sum| b |rds|ähe|erm|äiv|usi|iva| u |ufi|urv|dav|ana|"
+      " ip|hik|vi |rgn|red|gul|rec|ris|ar | ük|üks|ink|jao|he |lig|tem| ht| sh|"
+      "jes|les|itl|mei|tik|dmi|oka|ela|en |ivs|upp|etr|uua|mne| us|rg |rav|tis|"
+      "ldu|jät|ged|sk | kü|lil|poo|ett| do|uda|kk |oht| jo|rel|daj|ur |kod|omp|"
+      "kri|alv|ves|aok|uko|puh|are|päe|äev|õrg|pee|võr|enn|mma|oos|abe|ect|ht |"
+      "ort|ike|ees|mid|rk |ulg|lah|iv |kt |amu|der|dvä| tr|uma|dek|vus|oov|itm|"
+      "por|vse|ua | wa|rma|lne|ip |leh|lee|sün|juh|hos|ek |ck |ive|idu|agu|ovi|"
+      "oen|ia | kl|sus|jek|una|war|loc|nag|rc |lim| sk|up |õna|odu|kel|duv|oha|"
+      "aki|kut|kid|ööt|rvu|tul|onn| mõ|je |ask| da|du |kki| sp|lve|mme|rem|tuj|"
+      "uja|nee|fer|len|ry |rd |ari|onf|äid|uhu|tke|isü|ümn|lüh|arc| h |th |gen|"
+      "urs|hta|nit|mer|nu |un |git|üsi|küm|eeg" },
+    { "sl",
+      " pr| na|ka |ni | po|je |na |pre| iz| za|dat| da| ni|tek|ato|ote|anj|tot|"
+      "ti |no |ne | ne|nje| je|men|pri|sta| mo| do|ke | ko|ost|če |tev|red|za |"
+      "zna|ime| v |sti|ogo|pod| se|ja |por|oče|en |raz|lja|mog|nos| im|ga |eka|"
+      "goč|pak|ora|jen| st|lo |nik| vr|ran| ra|ov |ska|se |ega|ih |ki |vel|eni|"
+      "kov|jav| in|eve| od|ite| z |oda|pis|in |li | al|elj|ta | ob|ira|nap|ilo|"
+      "nak|avn| up|em |upo|ena| sp|ko |vil|ali|iti|apa|rab|šte|van|ave|te | pa|"
+      "aka| ve| ar|to |ika|ve |izb| si|eke|ri |ent|eno|va |nja|edn| vs|avi| zn|"
+      "zbi|bir|nam|oči| s |lik| ma| us|nev|rav|la |me |ot |ra | št|izp|pro|evi|"
+      "tav|dol|nas|jem|neg|kaz|sto|st |loč|str|ati|rst|ova| me|lje|ake|vrs|ove|"
+      " sk|ume|zpi| op|eva| br|pos|ako|ev | de|pra|čen|ame| ti|ek |lju| uk|vna|"
+      "mo |ast|nih|iko|ist|jan|ed |hod|dno|ik |kot|ezn| bi|var|est|olo| en|uka|"
+      "da |rem|izv|ma |an |nt |ani|jo |odp|klj|aj |vez|pov|juč|vni| če|tip|uje|"
+      "tra|ak |tre|kon|ede| re|enj|olj|ene|med|arg|ven|od |gra|om |lni|isa|er |"
+      "del|zap|piš|tan|spr|ica|ovn|ust|eme|ana|rez|den|ema|eza|ce |ved|vno|tic|"
+      "bit|az |eto| no| ta|led|vse|bra|ca |ina|eli|nav|rat| te|vre|ram| ki|ano|"
+      "zor| sl|ter|ket|am |ava|tov|spe|mi |elo|več|rej|naj| tr|pol|mes|rek|vor|"
+      "ovo|eti|ila|le |rit|et |ste|vit|ice|zav|čil| la|man| so|bre|tor|ajt|nov|"
+      "met| kl|ipk|ret|dan| lo|tve|re |nem|seb|aja|nal|pin|dar|ši |res| ka|pon|"
+      "amo|api| n |ine|či |vi |iz |ez |ren|tem|stn|tva|gum|eje|spo|rog|dni|rgu|"
+      "ogr|upi|izr|lji|usp|so |lov|vlj| is|ete|ore|pom|rip|stv|iča|nep|ji |iši|"
+      "nda|sle|edi|and|ari|avl|arh|rhi|nsk|bil|sez|iln|sku|dnj|itv|de | ba|odn|"
+      "nic|san|ba |hiv|obs|ju |čak|jiv|ver|dob|eri|pot|ičn|tni|zra|odo|arn|nad|"
+      "dpr|ode|asl|ate|nim|rev|obi|is |abi|vze|iva|nte|ar |one|eta| pi|di |slo|"
+      "zvo|dok| to|riv|oku|il |emo|skl|zak|atk|sa |ori|ard|oln| le|odi|nit|tne|"
+      "raj|log|dov|nan|pa |opo|kod|iri|rno| vi|obl|not|or |ic |al |epr|eko|zet|"
+      "niz|cij|mer|kum| sa|rne|oro|zho|žno|adn|bi |rič|roč|izh|kup|aln|akl|ivz|"
+      " ča|on | vh|čas|vho|bli|poz|baj|ela|ign|im | sh|nju|mor|mož|čna|ril|vo |"
+      "ese|ožn|zve| dv|kla|jsk|ajo|čni|išk| be|rja|vaj|el |dru|opi|do |vol|ec |"
+      "gna| di|sam|pel|dst|sig|poš|zah|map|ška|aza|ča |kra|isn| bo|ija|ere|hte|"
+      "lad|azl|bni|lka|vsa|aht|šir|ods|opr|zli|sis|int|prt|tar|tri|gle|tel|rik|"
+      "kan| gl|ami|vod|onč|čan|abn|iso|ome|lic|čit|ači| ur|bst|azn|nji| dr|lič|"
+      "kom|bo | ce|dme|dil| va|edm| om|ico|mni|sim|vne|jev|otr| co|omn|dod|tna|"
+      "kli|sli|rep|nač|lav|rin|aci|ont|ber|bin|reb|ose|eč |isk|rje|ane|ilk|sak|"
+      "rdn|šče|enu|ro |ros|orn|aba|ama|rni|zad|be |ile|vir|id |dne|ire|imi|let|"
+      "dpi|nča|ežn|nič| lu|ozn|pir|ino| fi|ada|dir|čne|oso|oka|apo|ip |mbo|bol|"
+      "eki|dvo| fo|lup|nil|zač|še |ošt|iše|ini|lat|abl|ilj|at |loc| o |mat| oz|"
+      "ku |žni|nez|ozo|aki|kat| že|po |blj|aze|gla|ije|ona|ele|iči|lne|per|len|"
+      "njk|jka|par|era|očn|tiv|rec|rea|atn|orj|nut|utn|cev|eji|tis|sov| ci|tu |"
+      "tit|nat|tič|net|pe |sni|čin| kr|aje|es | li|imb|ara|arj|ock|imo|tko|ivn|"
+      "ope|for|rt |kle| sm|omo|lah|ahk|kos| os| vz|žen|tno|rim|rež|sme|zno|oč |"
+      "dpo|oko|čic|iki| mr|nar|hko|ski|rug|sed|sla|že | bl|niš|ovi|las|ll |ala|"
+      "dna|lno|odr|jih|dle|tok|eks|dej|ces|ače|msk|nti|alo|ipo|emb|hem|taj|ono|"
+      "mrt|rtv|co |daj|reg| e | ši| mi|lok|mem|kol|ebu|rsk| c |fil| t |mej|ima|"
+      "ide|jto|lit|epi|cil|atu|ebi|dvi| ro| vo|she|buj|rg |tvo|bno|des|osi| su|"
+      "ck |pke|lin|epo|are|mu |osk|si |ern|zen|seg|dal|tro|esl| nu| un|sno|odl|"
+      "iro|jti|min|čno|blo|go |tat|obr|vrn| ok|sko|rel| a |eja|tab|joč|lep|obe|"
+      "ix |sne|zme|roc|oce|odv|ata|meš|oto|top|bes| zv| ub| f |ešč|sod|zan| at|"
+      "nto|alk|kst| wi| d |prv| ap| an|ike|apr|obn|ili|rid|atr|enl|nlj|ris|as |"
+      "ešk|zre|azp|edo|dis|erj|lop|alj|rak|osl|mac| fr|alt|end|evn|žin|uč |rib|"
+      "uni| he|čet|evo|oča|rmi|esn|ijo|klo|etv|vzo|ah |ula|val|epa|skr|kaž|iv |"
+      "vid| ca|emi|oje|ft | l |paj|ben|ži |dos|ins|adz|moč|ive| p |zvr|ade|uče|"
+      " on|sil| zg|jno|ibu|lom|cel|us |ški|eku| av|olž|mod|vov|ir | ke|uči|sre|"
+      "ivk|trd|ans|ang|pko|orm|con|unt|lži|nis|ze |dre|ido|ijs|edl|osn|ack|du |"
+      "ok |kci|dzo|ejo|pt |tvi| gr|kin| tu|but|ion|šev|zi |ord|ort|ape|kam| fu|"
+      "ng |rma|ch |mik|tol|pog|ure|azo|ilč|rad|adi|ici|iku|rij| x |azi|tin|sel|"
+      "ps | uj|tal|dit| vn|rov|ota|oti|ojn|lj " },
+    { "lt",
+      "as |ti | ne| pa|is |tas|os |ini|mas| pr|kla|lai| kl|pav| su| nu|sta|ai |"
+      "nep|ail| fa|fai| iš|int|tin|eik|ko |epa|us |ima|men|ama|vyk|io | ko| at|"
+      "aid|kai|mo |sti|yti|avy|ra |raš|ių |avi|ta |nau|din|ali| si|ma |ist| re|"
+      "da | ar| ta| ka|ant|ent|ės | ti|yko|nt |pri|rin| na| ra|per|nta|ida|nim|"
+      " ap|oma| vi|to |ja |net|aty|tik|lin|rei|tai|ram|iam|pak|lav|rod|ake|ame|"
+      " pe|viš|ver|imo|cij|pra|pro|ais|aud|uri|gal|ska|asi|kom|je |sis|ija|ust|"
+      "nti|aik|rti|iki| sk|nis|eta|pas|ras|ink| va|ia | la|dyt|vie|pat| ga|tra|"
+      "tyt|ait|eti|adi|es |eri|udo|las|nus|kia|inė|tat|jun|ung|oja|su |ket|uot|"
+      "ume|ara| ve|eis|aus|aci|tie|rak|kur|par|ori|ies|gra|ina| se|čia| tu|ėra|"
+      "lo |ran|ris| nė|nėr|lis| be| ma|ila|lau|lų |met|yra|and| da|mos|jos| yr|"
+      " di|auj| in|ers|pal|nų |ody|tur|te |ing| įr|var|ijo|iet|tų |mą |aša|ui |"
+      "ogr|lyg|er |oti|ir |jam| ir|vei|nka|arb|sij|vad|tar| an| po| de|nga|ite|"
+      "eli|ava|ala|iai|ste| už|išk|lei|ast|uro| į |tei|kli|eči|me |akt|įra|iks|"
+      "ert|yta|oro|ard|kas|duo| do|rog|lia|aut|šas|iko|for|ys | ly|nur|ngi|ank|"
+      "iti|ilo| tr|apl| no|kta|kel|oli|nor|dok|jim|iju|iau|ami|ria|orm|mac|bai|"
+      " st|dar|ba |nio|sim|auk|man|eši|jo | bū| ši| ke|ski|rba|irt|gia|tos| ku|"
+      "oku|ati|die|kit|dži|čių|nys|rsi|kum| ba|tem|eto|ri |rma| ja|bol|etr|mbo|"
+      "ika|nuo|lan|ele|imb|ius| me|kon|doj|kto|era|so |iša|nam|gas|ome|ang|kei|"
+      "amo|nė |str| sa|ikt|est|lim|nto|isi|kir|mai|lem|do |iš |ieg|rai|art|ip |"
+      "usi|emo|ilu|neg|ikė|ar |et |kam|ave|uoj|pla|atv|ieč|mat| gr|rie|min|toj|"
+      "ner| ki| bu|mi |kst|tip| le|ota|sen|uom|apa|das| sc|oje|ėli|kod|lio| te|"
+      " al| li|kin|ymo|ian|ją |būt|ksl|ega|išv|val|oto|tek|tri| są|idž|nas|log|"
+      "kti|ėta|alt|suk|gti| fo|ats|žin|ykl|ūti|ikš|ita|ter|kėt|ate|nom|ema|rau|"
+      "res|aug|yje| įv|tą |ie |ata|ias|rea|rij|ms |po |oki|tor|tan|nte|tim|oji|"
+      "arp|ngt|tis|ino| ei|au |jin|ena|aip|ka |dot|si |uji|one|vai|ga |tęs| el|"
+      "ale|tap|am |mų |nči|izd| du|nės|kšm|tyb| tę|utė|blo|ęst| lo|kų |aig|iči|"
+      " dv|eil|ves|ari|ašy|che|ato|nda|tna|omp|įdi|ybę|bę | ša|nfo|ios|edi|vim|"
+      "arg|rtu|vo |ška|inf|ind|slė|enų|isy|rib|ruo|uor|dos|ndo|api|liu|did|ser|"
+      "ity|ntr|ei |dų |tu |enk|atn|lut|šal|urt|iją|lėl|imu|ien|nko|šve|kci|ars|"
+      "hem|kal|jų |eni|lą |žym| įd|rio|žia|tal|eme|rit| op|ilų|sin|uti|vir|gau|"
+      "sch|ak |gin|abl|ekt|odo|egt| wi|oda|imą|lt |iri|ne |kos|iu |aja|sio|tės|"
+      "įve|tuo|erv|tre|nia| ad| sr|kie|ope|ald|syk|gum|tru|arc|spa| ru|tym|esa|"
+      "uto|mer|eny|nes|inį|ikr|be |pag|eng|tė |ilą|na |dre|win|alo|dor|šim|rso|"
+      "aiz|eži|eks|ieš|pil|uku|al | pi|idi|ype| co|aič|rad|num|šmė|lik|nį |kri|"
+      "vas|eit|omi|adr|išt|tam|rch|sek|bų |iek|neš|ojo|sus|gta|niu|bus|rus|šų |"
+      "uma|lės|ėti|rik|šai|gim|kat|typ|pe |nki| mi|gar|než|lti|mpi|kar|čio|ngl|"
+      "mui|ain|sų | ro|chy|hyv|eno|rve|šin|sių| sp|glų|isk|ili|pap|jav|cin|ana|"
+      "iny|rų |pin|buv|ros|ekl|ikl|etu|bet|rac|tvi|ora|in |deš|išų|len|mė |tab|"
+      "ty |rūk|yva|sąr|yma|ide| ur|tus|kan|li |sig|ąra| ge|uta|anč|ine|rda|aga|"
+      "egi|kyt| ty|nen|ški|nal|dom| ri| ju|lus|siu|id |se |uvo|gis|ble|ukt|šio|"
+      "apr|unk|nių|but|ose|ifi|nut|eid|ben|šva|atr| un|nin|air|sun|pt |jan|aiš|"
+      "ein|onf|ašo|ild|ik |šme|on |mis|kim|rgu|dis|ute|paš|ane|nei|nea| žy|ral|"
+      "ign|liz|apd|pdo|wer|ygy| fu|vor|un |jau|šte|tak|end|roj|spe|alb|dvo|ved|"
+      "der|gos|iuo|ask|nie|tro|lon|no |med|ioj|le |iky|sra|dym| vo|fon|tit|esk|"
+      "uos|ujo|neb|eka| bl|pau|sia|sau|nkl|ėji|fun|nkc|ašt|gyj|išu|dim|por|ort|"
+      "ško|ile|fik|šči|vis|vid|šo |šym|des|rta|ygi|esu|osi|riu|moj|ona|fig|eko|"
+      "iun|dal|tme|dau|sh |rty|vok|ipa| au|gru|šyt|gna|kab|ces|tom|trū|nfi|nar|"
+      " bi|ere|rdi|uni|ėje|ki |av |ld |ch | qw|qwe| il|pon|sug|išr|lių|stu|aba|"
+      "rat|šab|igū|gūr|ipo|err| br|san|jek| he|ndi| fi|ibu|sir|imi|ito|abd|tve|"
+      "ro |odu|rot|ime|nę |itm|dij|ldy|lot|čiu|ren|pie|enu|oni|nos|ykd|ogi|agr|"
+      "neį|sie| to|ack|yg |anc|ilg|sav|pai|sla|ką |oga|roc|tuš|etų| id|idė|ial|"
+      "tsi|ula|unt|ašm|mak|oce|eso|ūks| es|pli|eam| gs|gus|dės| jo|udi|zdo|ysi|"
+      "tva|cen|osh|oty|ont|myb|ybė|eal|ušč|sas|sty|imų|inę|fin|lie|mus|išj|šju|"
+      "pen|lat|tyn|del|gio|alu|ešk|uga| mo|kuo|kad|bdy|opi|rsk|jas|ną |ams| ob|"
+      "obj|bje|ll |ss | is|dž |alų|zų |nkt|gzi|nel|ntu|uso|pij|rek|uja|emą|ix |"
+      "bos|pan| pl|ce |tūr|muo|sul| že|ūra|sės" },
+    { "gl",
+      " de|de | no|do |on | co|non|ión|os |se |ro |ón | se|ar | o | es| a |ció|"
+      " un|ent|fic|da | pa| po| re|ra |as | in| fi|ado|con|un |to |eir|est|que|"
+      "aci|par|es |iro|te |che| do| pr|ich| ca|hei|men|ara|nte|ica|er |sta|en |"
+      "ta |or |res| en|ido|pro|des|ter|bel|el |com|no |rec| é |ect|ist|ou |nto|"
+      " te| fo|tra|al |pos|ndo| da|io |ina|err| di|ada|rro|rio| er| li| si|ha |"
+      "unh|nha|ont|per| ex|esc|car|ome|esp|íbe|ema|and|ma | ao|pre|ao | ma|ten|"
+      "rad|use| mo|ste| qu|ue |por|int|ura| us|me |ntr|ida|lo |cto|nom|tos|ato|"
+      "ete| pe| ou|síb| so|osí|po |eci| e |lid|ari|tor|act|ere|ns |ori|ode| fa|"
+      " me|nci|ali|uci|co |so |nal|uet|stá|str|for|cla|spe|cia|is |ifi|duc|iza|"
+      "omp|sió|tes| ar|paq|cha|aqu|sin|rod|cac|all|cad|odu|óns| os|ver|la | ch|"
+      " lo|dos|ume| as|nta|pod|scr|ir |dor|ros|dir| ac|llo|liz|lic|ici|tec|tar|"
+      " op|nti|ele|ia |cri|ave|vál|áli|axe|ese|tic| vá|tem|na |ece|ius|cor|orr|"
+      "xe |tro| su|inc| al|cer|end|tal|tiv|ase|ire|ciu|ve |ito|ran| ve|pec|ser|"
+      "cid|tad|lem|lec|arg|tá |rma|ico|ort|enc|orm|ca |egu|qui|ero|re |vo |tur|"
+      "ion|era|emp|sen|rea| at|ivo|nde|ers|exi|fal| or|oi |den|dis|ecl| gr|mo |"
+      " im|mit| va|rac|gar|foi|pci|ade|ord| ap|abe| na| ha|mpr|las|min|ona|equ|"
+      " le|oca|és |nst|cio|opc|uar| ba| an|dat|ins| sa|rre|ame|ras|erm|ita| el|"
+      "asi|ala|ima|ecu| ni|ant|nar|cif|dad|hav|spo|top| ti|mac|sua| au|mpo|rmi|"
+      "alo|le |usu|aut|rsi|tas|rar|eme|rta|reg|ing|ipo|ert|can|cre| tr| ob|gur|"
+      "deb|tab|lar|ace|iña|val|tip|imi|ctu|der|id |go |mer|eta|exp|ati|tua|cte|"
+      "req|sis|rde|onf|rib|sco|ual|cam|cal|ite|mat|ará|loc|xec|cci|ini|cti|isp|"
+      "seg|ind|ble|ora|lis|nco| cr|alt|mbi|mpa|xis|zac|iva|ren|za |esi|uír|ore|"
+      "bas|ce |amb|gra|rit|spa|lor|xa | nu|fer|sca|ira|quí|xo |ces|nic| du|atr|"
+      "ai |ocu|liñ| la|cum|son| má|var|ost|ios| ad|ama| pu|eo |pri|omo|nfi|doc|"
+      "ndi|tri|tid|lad|ute|ña |uto|zo |íre|cta|iti| ta|mor|ell|pli| n |ale|ibi|"
+      "tin|sti|ula|imp|erv| bl|unt|mai|rgu| em|saí|art|uta|ens|hai|usa|blo|be |"
+      "ern|rqu|nat| xe|loq|ous|rem| xa|nad|pat|man|oñe|exe|mas|inf|nfo|rup| id|"
+      "max|ebe|fon|mos|are|ata|nga|ais|mpl| cl|rda|fin|dif|ana| ru| nú|uiv|let|"
+      "iso|mod|eli|roc|eso|et | bu|fil|bal|gum|atu|upo|uid|dic|gru|rim|ive| ab|"
+      "tre|pen|ext|núm|das|ll |nov|in |edi|ard|efe|lla|ano|ear|nec|igu|bre|det|"
+      "an |lim|arq| s |mes|ple|rte|fac|ech|esq|squ|ria|ide|úme|avi|vel|apl|bus|"
+      "ign|ino|ref|eti|abr|oma|one|ian|ias|vis|zar|ábe| to|itu|iga|coñ|ñec|gad|"
+      "lou|les|iar|odo|tam|ret|uso|aga| av|hel|osi|ons|dun|niv|nda|obt|aba|sa |"
+      "red|rga|xpr|oce|adi| ag|rvi|sto|rso|mon|eri| só|só |rab|pe |ega|rob|anc|"
+      "ecc|nor|fig|olo|tir|ric|rne|rut|mái|áis|los|án |cas|opa|rác|áct|eit|fra|"
+      " bi|out|cur|lig|ede|ota|tan|ope|nes|rei| sh|ol |nse|ber|sim|emo|eno|esa|"
+      "xes|ída|ile|ili|opo|ram|rti|tax|ron|sol|nsa|oin|nex|bri|us | ne|lti|aíd|"
+      "uer|orn| am|rón|aiú|iús| ci|rra|lac|pol|sar|iad|ga | wi|tán|rep|coi| he|"
+      "lta|til|exa|nza|rex| ra|vid|mar|rir|dar|nin|tou|tru|igo|ea |oqu|odi|ult|"
+      "nun|ogr|lav|mal|vol|ía |mad|opi|tif|sax|ine|rom|vos|soc|eco|nos|pt |ler|"
+      "ak |sel|urs|va | pi|eng|ezo|sub| ce|nac|bte|ime|obr|bor|cut|rez|sig| fl|"
+      "pui|ves|tex|ock|cen|lle|poñ|vor|dep| fr|sit|ola| mi|uni|xit|epa|bia| bo|"
+      "bir|índ|win|omi|ype|acc|gaz|ral|med| có| ur|cab|uem|ús |ixo|gun|én |lei|"
+      "ila|ibu|del|col|cod|she|lan|byt|yte|azó|zón|sob|ial|cód|typ|uxo| by|gui|"
+      "mem|pac|sac|uri|elo|ill|adu|erd|lés|poi|ole|gul|adm|sof|oft|lon|ngo|rna|"
+      "tim|rix|cei|tró|rl |uin|dmi|tac|rog|utr|anz|ovo|lt |ngl|glé|bin|oto|ond|"
+      "rel|año|sec| ro| cu|sh |bec|ch |cke|gún|eu | br|ty |unc| dv|ibl| á | ho|"
+      "cap|ang|ráb|ába|ba |dig|etr|ee |log|oné|usc|dea|abl|olv| vi|ate|pou|dan|"
+      "úa |rus|cit|il |ría|lat|dow| ty|ice| ig|ún |war|apa|dia|obx|bxe|st |flu|"
+      "ánd|fol| st|ova| vo|sep|ódi|bli|ack|azo|arc|epe|bio|lux|wer|rak|ri |aro|"
+      "aín|erí|evo|alm|rol|did|ane|dem|arr|cop|ctr|sun| º |num| om|sic|imb|óli|"
+      "tén|cul|def|bra|lve|pun|paz|oni|nve|cou|rin|tod|rno| gi|nté|ose|but|cat|"
+      "rop|éti|sia|tio|bei|eis|riz|gan| fu|mul|dvo|nt |ena|mbó|ból|pil|ong|xió|"
+      "oa |eal|rca|ses|cos|eza|zad|pid|ulo|gna|xto|oll|ove|cro|amp|sup|ude|xer|"
+      "pia|ez |rou|ans|emá|rty|len|ket|gno|ngú|uir| is|mpi| sc|esd|sde|reo|nit|"
+      "rev|ifr| uu|ois|ño |seu|rto|rid|eam|vad" },
+    { "eo",
+      "as |la | la| de| ne|on |ro |de |ta |sta|oj |osi|ier| do| ma|dos|aj |sie|"
+      "est| es|ne |jn |to |ero| ko|ita| po|tas|mal| pr| en| se| el|ata|lo |mo |"
+      "ojn| re|igi| al|an |era| in|kon|ali|por| ka|ebl| no|aŭ |nom|is | li|do |"
+      "kom|or |ant|en |ent|val|nto|pro|ilo| si|man|aro|las|omo|bla|da |io |for|"
+      "men|lig| ar|tro|per|no | aŭ|ume|kaj|ist| ti|al |iu |taj| ku|ver| su|ten|"
+      "gi |sti| uz| tr| ki| fo| eb|and|eni|cio|igo|nta|ndi|ini| ĉi| er|kun|ri |"
+      " pa|ndo|pri|sig| nu|ran|lid|nte|ter| pe| an|ida|el |ajn|vas|ign|un |er |"
+      "rar| ĉe|lon| va|lin|eli|ont|toj| op| mo|ate|ron|iga| me|tat| di|roj|ori|"
+      "alo|ni |ti | fi|go |oma|mon|ra | du| da|ujo|int|erm|orm|end|dat|ona|ind|"
+      "tra|gra|ton|ko |arg|te |fin|ces|opc|pci|tan|num| pl|kce|se |pre|ifi|ado|"
+      "ekt|oro|sto|par| ni|ntr|eru| ap|als|ukc|na |str|tig|ara|eva|ova|omp|po |"
+      "blo|gno|nst|nat|suk|tri| ve|don|sis|rov|lis|eks|rib| ek|rig| lo|ruj|loj|"
+      "fer|dif|um |jo |hav|dik|taŭ| ŝa|kto| st|vo |ako|esi|sen|ato|ple|ong|lsu|"
+      "fil| ĝi|ala|kri| at|git|akt|skr|nen|ava|kie|lor|ika|moj|dum|ena|sub|abl|"
+      "emo|pon|ern|kti|mer| kr|nig|ord|mod|vi |ioj|so |pos|ele|eno| gr|ovi|met|"
+      "eko|pak|iel|enc|nek|ĉi |ert|kla|res|ers|rto|ari|ank|uza|elo|pli|tiu|alt|"
+      "ret| le|ati|sil|rgu| sk|gum|igu|ion|ort|ia | un|mes| te|mpo|rsi|leg|ser|"
+      "imo|am |ram|los|ma |nda|kst|eta|bli|ĉiu|reg|len|sek|til|le |niu|ora|gru|"
+      "tem|nio| ta| vi|ur |anĝ|rmo|odi|ka |ŝlo| ha|esp|rma|sim|ost|nev|uma|lan|"
+      "tip|ren|co |aĵo| ŝl|li |eti|tit| ri|ga |ino|eso| mi| sp|lva|tal|lav|ono|"
+      " kl|ete|tiv|eto|inf|efe|dis|nal|nur|ans|nfo|alv|art| ba|sa |esa|uzi|nka|"
+      "noj|ina| ak|va |ive|rea|unk|roc|ĝi |ogr|gas|iko|iuj|rak|sio|unu|kre|tis|"
+      "rmi|kur|nti| sa| co|one|lem|var|rme|in |ipo|oce|ana|egi|rim|ĝis|doj|nov|"
+      "gil|kas|pov|rog|ĉen|tek|omb|mbr|nor|avo|mar|mem|zi |atu|ste|iva| n |ŝan|"
+      "erv|ere|ĝas|ĉe |ldo|lok|rit|rol| bi| vo|ola|re |dev|st |dit|rat|olo| fu|"
+      "kit|cez|dek|ile|apa|gu |nan|rti|ins|ila|tab|raj|ite|rom|oni|zan|ega|bro|"
+      "ras|ajt|kci|spe|lir|tum|lek|iĝa|spr|nu |nha|lik|unt|ago|laj|con|iki| he|"
+      "enh|ria|ivo|ed |oko|kod|kiu|rki|ĝo |ing|ura|ias|oka|emp|enu|ide|voj|oku|"
+      "ref|baj|ol |gna|ngr|rek|os |nga|eri|ŝel|rno|tak|fun|ale|kta| ŝe|ezo|mpl|"
+      "uti| s |es |ame|ekz|tin|ave|tre|bol|goj|van|zo | or|ubt|bte|gan|ask|eme|"
+      "mbo|mit|nas|mis|ca |vit|nit|vor|mak|odo|lat|mi |gor|sed|jto| ag|mat|rec|"
+      "nkc| ol|aks|imb|kro|ond|sam|me |ĉef|iam|ark|pas|mor|rio|spo|iab|rei|tik|"
+      "dan|den|gon|cif|abo|kum|ama|vid|zis|ome|ula|ema|uto|ĵo |ons|tu |dig|lim|"
+      "olu|om |uj | ig|son|non|onv| a |elp|iun|pec|rdi|nul|ili|ble|kat|laŭ|ibo|"
+      "eci| av|ald|ult|lti|spa| ci|alp|aci|vol|etr|ast|vel|hel|kig|apo|id |eco|"
+      "ene|amo| fa|ens|ulo|jon|rvi|min|tor|ski|nca|ekv|ang|duk| so|tes|lab|egu|"
+      " ke|iĝi|eku|amp|imi| je|fia|fik|gul|iti|das|bor|kap|nco|maj|rna|alf|bon|"
+      "tad| id|tar|nt |cia|kop|lit|niv|dir|les|irs|pac| ad|di |opi| ru| ge|kis|"
+      "rua|enp|rac|loc|tio|kor|rem|et | et| us|rst|rup|us |ani|koj|ore|rip|all|"
+      "ris|nko|fon|vig|ŝab|kia|ukt|je |ua |lia|kso|dok|ner|umo|mig| be|lta|stu|"
+      "ar |ce |kzi|atr|iri|net|ivi| fr|aki|plu| ra|tur|iks|bel| t |zon|rdo|ope|"
+      "lfe| ca|ibu|ki | pu|red|suf|guj|mpa|let|npa|ujn| ja|pet|bo |lte|upo|isa|"
+      "zma|ior| bo|ici| p |kva|sin|nĝo|ubs|iaj|ela|arĥ| c |aĝo|nie|ota|obl|ock|"
+      " ro|mum|ink|dre|apl|isp|ei |erp| mu| bl| ce|ada|joj| e |sup|eat|sat|rg |"
+      "rĥi|nĝi|adr|idi|kam|ps |aŭi|gat|abe|ire|ke |ie |der|ose|lar| ho|bsk|ŝut|"
+      "paŝ|ĥiv|ine|ktu|eda|ime|vaj|rl |ll |rap| ok|aco|eca|imu|gis| fl|rik|nea|"
+      "sur|onf| hi|lt |eki|rin|nar|edi|nsi|det|mul| l | x |rad|poj|zu |kan|but|"
+      "tru|avi|pen|bil|ve |ufi|daj|ksi|ig | fe|ak |viz|cit|inu|lur|erk|alk|vat|"
+      "aŝa|ovo|uo |uzm|ira|rta|apr|isd|zas|gaj|nci|nve|bin|ure|uta|esk|uni|uzu|"
+      "ngo|si |fra|gad|nde| f |ĵoj|isi|kol|izi|izo|nse| wi| r |ian|ust|leb|flu|"
+      "ty |naj|erf|cel|ck |kaŭ|at |ril|ild|rob|ido|ŭig|evi|sas|poz|ibi|pun|mas|"
+      "elt| il|bit|ito|efi|def|ife|lpl|isk| sh|eam|his|rt |efa|aka|ven|oli| as|"
+      "neb|elŝ|ng |ix |reĝ|ĝim|sal|tim|anc|pe |liz|ru |lŝu|ŝa |gal|saĝ|ngl|du |"
+      "eĝi| pi|ltr|lu |vok|kiv| d |erĉ|zat|sda|ozi|kaĵ|gla|tul|ss |aln|ric|oda|"
+      "nkt|lp |niĝ|soj|kaz|nvo|lde|baz|ry |ice| ga|ĝin|mba|ksa|far|mpi|ska|lak|"
+      "pto| wa|com|ode|esu|put|log|ber|nia|nua" },
+    { "ga",
+      "ach|omh|an |ar | an|mha|ann|ir | le| co|ch |com|ith|id |hai|nn |le | ch|"
+      "had|amh|dh |na | ní| ar|the| a |ad |ha |il | ag|ear|tha|ail|áid|is |ain|"
+      "bha|nea|he | ai|in | na|ait|dir|as |tea|cht|eam|ní |idi|éid|aid|gha|ais|"
+      "eac| ne|air|ean|adh| ro|rea| ta|cho| bh|nna|us |tai|lan|gus|agu|idh| de|"
+      "ath|chu|inm| i | se|ta |igh|cha|arr|art|har|ion|hbh| th|mhb| in|hea|ogh|"
+      "áil|mh |rog| at|hom| ga|imh|ilí| fé|te |hta|int|sái|ana|tá |féi|gh | sc|"
+      " io|lí |rai|úsá|ead|ag |on | ea|áin|ire|och|abh| sa|rth|sta| so| ma|aig|"
+      "gan| ca| tá|th | ra| te| fh|hei|uim| ús|rái| st|de |iom|asc|ne |lea| fo|"
+      "río|agh|ord|nai| nó|eis|adl|ada|aí |inn|dla|thr|nío|seo|án | á |nó |car|"
+      "nm |onr|rrá|sc |tar|oir|lei| ha| as| ré|bai| is| ri|hái| or|nac|nt | am|"
+      "lac| go|onn|isc|eái|ile|go |eag|ite| gc|arg|scr|ocr|spe|peá| ná|rt |oin|"
+      " si| dh|eas|éan|ona|la | sh|aon|sca| li|ala|rú |ilt|che|ht |son|isp|cea|"
+      "rit| ba|aío|sho| cu|eo |íl |mar| n |ip |rac|bh |raí|réi| do|ná |íom| ia|"
+      "bhf|han|sa |íor|níl| ce|nra|mhá|aga|íoc|héa|hoi| sl|ola|ine| t |hui|úil|"
+      "ios|nta| ui|éis|aoi|éam|eip| ac| lí|sea|uac|ara|iú |uai|ur |rgó|gói|óin|"
+      "lín|héi|eol|irt| é |ála|ria| fa|hur|ra | di|oib|mba|dú |re |ost|ist|cái|"
+      "aim|mhi|sio|rbh|hsh|sch|hni|eoi|iar|lao|hoc|mhs|nas|iri|ide|hag|omb|tla|"
+      "ll |íte|crí|rtl|íon| sp|sai|bhr| lu|uir|aca|nad|all|cai|dai|ibr| dé|uil|"
+      "hir|rio|aít|lua|nch|se |ipé|slo|osc|tac|eid| cá|al |lai|uit|mhr|íos|sco|"
+      "éad|lte|os |eán|éir|cor| pa|réa|ghr| oi|ce |thn|bre|eit| lé|hre| ao| cr|"
+      "for|odh| re|eál|ise|orm|péi|gac| pr| lo|áip|tí |or |cra|rdú|ort|uth|lon|"
+      "cui|léa|mhn| id|stá|rut|rra|gai| tr|do |arc|nid|tas|nte| nu|ial|nne|atá|"
+      "eir|lta|chr|hra| ó |gco| ío| fi|nam| dt|pri|im |ims|lio|ama|ont|hrá|hfu|"
+      "fui|hró|hío|eor|riú| gh|isi|rab|iai|lái|cru| má|há |coi| ci|déa|cri|ant|"
+      "das|ód |has|soc|dhm|áda|onc|hio|obh| lá|tád|orb|fhé| mó|lad|áir|me |seá|"
+      "rói|hch|crú|eal|lán|nua|dei|áth| l |sce|mhí|ca |íne| to|rán|ste|ast|oc |"
+      "daí|rao|hrí| gn|reo|fil|áit|bla|imp|súi|hrú|nmn|eat|íod|hri|ois|cin| mh|"
+      "spr| éi|chó|niú|fei| be| gl|dhé|hla|tei|íob|léi|íni|bea|bhe|hne|un |con|"
+      "ás |éac|cs | s | d | ph| tu|hun|ora|óis| bl|am |oca| cl|tái| dí|eab|cal|"
+      "rí |ata| sú|ran|pa | có|roi|rr |laí| fe| br|mái|acs|éim|mhe|óra|hon|neá|"
+      " me|lin|nát|log|oim|atr|oth|fho|rmá|nan|er | no|má |ins|dui|bhl| fu|san|"
+      "nga|ill| po|en |ang|iúi|osa|hab|dea|fha|rte|ina|ntá| ei|lt |thú|nrú|mac|"
+      "úna| bu|ris|ntí|chá|hru|oml|mne|nit| os|ian| eo|caí|dhe| du|es | fr|hac|"
+      "rat|óir|fua|tos|tal|pat| ti|rda| fá|rei|nmh|nse|las|gla|ipt|rdu|it |lla|"
+      "rg |ioc|hm |asa|ál |hum|mas|den|ána|nái| c | r |bal|rúi|eic|ghn|ích|bhí|"
+      "can|roc|eim|róg|uma|da |rua|foi|nnt|dia|ún |fea|str| su|shu|tio|loc|tag|"
+      "hór|ic |chú| nd|dte|rmh|rd |lód|éit|rla|no |ndi|últ|ibh|tre|rin|hú |mpl|"
+      "nná|úla|taí|iún|tri|bun|éal|rip|phr| hi|ódá|st |hna|ua | mi| x |ime| im|"
+      "gná|iti|tab| da| ái|teo|lár| fí|at |mho|ice|ini|trú|úin| f |ché|fol|deo|"
+      " he| ua| sé|ash|uar|ver|uig|pt |hín|hil|don|tan|eil|par|rc |sin|aif|órt|"
+      " cú|cói|iad|uas|nú | ex|tim|tú |mlá|tás| gr| mo|ofa|fa |hré|éig|she|dac|"
+      "ánt|ind|hth|ír | la|oic| ró|sei|far|hor|ár |lam|éil|leo|ard|fai| wa|rtá|"
+      "thé|tho| mu|sé |éin|pró|fái|heo|ghl|mhc|ige|óg |ing|foc|dhí|aic|ór |árt|"
+      "inc|chl| mé|gra|fao| bi|ect|bht|fhá|íof|imi|méi|ras|arl|ásc|ed |cúl|ig |"
+      "ga |om |thc|oma|sío| lú|mht|sia|min| dr|ons| mí|ge |war| oc|omp|tor|mod|"
+      "ghd|mur|ura|thi|hús|sú |cód|dái|pho|sui|hdh|ipe|irs|ogá|cur|tua|fad|íot|"
+      "iot|siú|rom|hat|og |ml | ht|sto| ng|lío|tui|nár|hin|gth| gi|thf|msí|pth|"
+      "fhr|úit|et | p | mb|úch|ón |idt|óga|aos|thd| b |urt|tse|ix |hle|hlá|íol|"
+      "msi|fid|ma |ng |mpa|húl|lú | m |mód| e | ón|and| ho|ul |gar| il| op|igi|"
+      " sí|oid|fre|pór|tp |hel|orr|mea|rún|ich|irm|pos|gea|iúl|hua|dro|néi|fri|"
+      " ja|chi|pea|cór|amp|ff |asp|fhe|sis|rec|ntr|gnu|arm|iné|pe |tra|ble|rs |"
+      "iac|oi |rúp|oit|céa|mhó| u | bo|adú|thu|una|ac |naí|ss |mpe|úpa|opa|osl|"
+      "alú|top|ábh| sy|hód|brí| un|dat|mad|sac|hao|mó |dif|dí |dul|haí|ife|ínt|"
+      "mír|loi|ol |lle| té|slá|dál|lor|ali|hal|hos|mai|ake|ns |grú|nd |opt|sh |"
+      "nán| sr|ame|ut |shi|ib |chn|oll|ent|olt|hói|otá|bri|tál|abl|dhá|trí|ici|"
+      "pen|cad|plé|arb|thá|out|pha| sá|res|ink" },
+    { "vi",
+      "ng | th| kh| ch|ông|hôn|khô| tr|nh | ti| ph| nh|in |ên |tin|ập | gi|ác |"
+      " cá| tậ|tập| đư|các|hi |ỗi |ch |ược|thể|hể |ợc |ần | ng|ho |đượ|có | có|"
+      " hi| đị|ục | lỗ|ới | và|lỗi| là|số |ùng|ết | số|ối |ong|ột |cho|ại | qu|"
+      "tro|ron|ịnh|địn|của| củ|ủa |chu| lệ|ển | mộ|một|khi|hiệ|dùn|tha| dù|chỉ|"
+      "là |hỉ |mục|iệu| li|ệu |thư|tên| tê|iên| tạ|iến|ay | sa| mụ| đã|đã |hư |"
+      "ra | ký|ọn |ầu |họn|chọ|với| vớ|ký |ặp |ào | bả|phầ|hần|ất |tiế|ải |hay|"
+      " ra| ki|ặc | đầ| kế| gặ|gặp|iểu| vi|ến | đố|kết|bản|và |nhậ| đặ|tùy| bi|"
+      "đối|đầu| tù|ểu |ạng|it |ếu | lạ| bỏ|bỏ | nà|hợp|ợp | hợ|ích|ài |ình|ao |"
+      " co|lại|ản |ườn|ờng|ện |ùy |ang|iện|ghi| để|để |ưa | gh|ai |ời |huy|ặt |"
+      " độ|bị |hiể|uyể|yển| bị|vào| từ| ho|tự |đặt|òng| cả| tư|ày |git|ạn |ách|"
+      "chư| đổ|ệnh|lện| đa|kho|kiể| tự|từ |hiế|ổi | dò|lệ | bộ|đổi|bộ |chi|gia|"
+      "dòn|phả|ọc | re| đi|hải|hàn|ấu | cầ|ành|liệ|ếng|hị |ống|ảnh|này| ha|ấy |"
+      "iển|việ|au |on |ượn|ạo |ợng|tạo|hưa|ung|ều |thứ|ật | xu|iều|ánh|ân |àm |"
+      " in|đan|thô|thị|ộng|con|anh| đọ|đọc|hân|áo |ẫn |trư|óa |dạn| sử| dụ|qua|"
+      " cấ|như| dạ|ái |eo |trì|oặc|ây |the|ức |ụng|dụn|thi|ệc |iệc|ơng|ươn| tí|"
+      "iếu|ảng| tì|heo|úc |rìn|ói |sai| bạ|trợ|rợ |hoặ|thà| gó|gói|cần| lư|giá|"
+      " bá| lầ|lần|tìm|ìm |trị|rị |ận |bạn|an |am |hiê|te | vị| x |vị |báo|iá |"
+      "iao|tượ| di|ắt |phi|iết|ua |phâ| mã|ngư|át |hỗ |dẫn|mã |làm|cản|uất|rộn|"
+      "hận|sau|xuấ| dẫ|ực |tại|ính| st| hỗ|hế |liê|ngu| đế|chứ| nế|ước|ớc |nếu|"
+      "ằng|quy| gỡ|gỡ |ham|êu | da| dữ|dữ |hức|thự|ép |hực|le | dấ|thờ|hời|dấu|"
+      "êm | to| về|về | ở |hán|trê|rên|hiề|er |ưu | cu|tra|chạ|độn|húc|ởi |hập|"
+      " s | n |àn |ệt | mở|mở |thê|ội |hêm|đườ|hạy|ạy |hệ |ười| câ|tín| mà| bằ|"
+      "bằn| nó|khá| tá| hệ| he|uộc|ộc |hác|thấ|giả|đến|uy |gườ| lo| de|mới|áp |"
+      " mô|hép| nộ|nội| mớ|sử |địa|ạm |áy |tiê|thu| hà|hoá|nhi|ơn |độ |se |thá|"
+      "nhá|nó | má|máy|ồn |dan|ịa |óm |es |tho|hóa|biế| lấ| pa|ấp |phá|ĩa | no|"
+      " mặ|quá|lưu|ếp |phí|lấy|nhó|hóm| dà|ứng|ền | sá|uá |chế|cả | đó|mà |chú|"
+      " lý|lý |hứ |ck |rướ| by|hấy| cậ|ngh|iệt|byt|yte|id |sta| tả|iểm|mặc|ểm |"
+      "hìn|ẩn | tố|cấu| hì|ừng|ọi |ll |ửa |úng|ững|uỗi|hím|ím |un |huỗ|ead|cập|"
+      "nhữ|hữn| hạ|hứa|ứa |hủ | mi| du|ưng|nào| cỡ|hật| ma|tươ|tác| ba|ớp |hạn|"
+      "mô |ộn |hai|uồn|cỡ |nha|oát|ile|ăng| kí|hốn| a |dài|kíc| xó| se|ãy |thố|"
+      "cuố| ta|uối|rườ|xóa|uẩn|et |ect|hoả|trộ| bở|oản| kê|điề|fil|bởi|trạ|rạn|"
+      "án |huẩ|chữ|ịch| pr| cũ|hườ|ver|thì|hì | lụ|lục| fi|hưn| cô|côn|chủ|kê |"
+      " tà| si|sác|tài|oại| sẽ|sẽ |óng|sửa|iêu| bấ| d |hái|khớ|hớp| hò|hòa|òa |"
+      " c |ian|phé|ăn |ngo|chí| dị|khó|thế|guy|ghĩ|hĩa|ion|lin| ca|ack|hươ|uyê|"
+      "yên|trí| tắ|phụ| cà| su|oàn|iải|cài|han| so|pti|òn | rõ|rõ | hã|hãy| hơ|"
+      " sh| cù|cùn|bất|biể|hơn|đưa| xá|dịc|xác|cây|cấp| đí|ẫu |re | sự|sự |hữ |"
+      " tổ| đồ| đu|ran|huộ|ref|che|hín| mậ|all|ed | al|hau| cò|còn|mật|sh |vi |"
+      " mẫ|mẫu|nhớ| xử|xử |chấ|đíc|hớ |lượ|thú|ậpt|ôi | ản|cái| bắ|ce |em |én |"
+      "hối|đun|hea|ồng|hun| đâ| nê|loc| bu|nên|ad |int| mỗ|mỗi| tu|bắt| v | né|"
+      " rộ|guồ|nén| t |oán|tíc|đặc|hel| mọ|mọi|đây| f |âu |hết| lớ|ẩu |đi |hất|"
+      "ter|dun|ngữ|hạm|rt | ứn|no |sao|loạ| lê|tả |hú |rea|ữa |háp|lên|khú|iếp|"
+      "nt |ềm |đón|ấm |ase| yê|yêu|cầu| nằ|nằm|ằm | pi|st |ẵn |khẩ| xe| tớ|tới|"
+      "ore|mềm|giữ|pac|tạm| vì|vì |hẩu|ve | mề|phạ| l |tắt|ắn | sở|gữ |th |ếm |"
+      " fo|sở |ent|ff |thẻ|hẻ |uyế|ing|set| cơ|thí|me |híc|at | sẵ|sẵn|cơ | un|"
+      "elp|kiế|ảo | cụ|for|ame|res| mu|al | áp|tru|hàm| r | đừ|đừn|rốn|ắc |or |"
+      " đá|xem|đa |ct |trố| ex|dir|ut |quả|nhấ| me|điể|ate|õi |toá|uyề|yền|lớn|"
+      "ớn |xun|bas|rí |tor| xế|xếp| tấ|tất|ers|ia |mon| p | sy| tồ|tồn|cũn|ũng|"
+      "tab| rỗ|rỗn|ỗng| tử|tử |com|oài|hún| ve|ồi |de | nă|goà| đú|đún|nd |tối|"
+      "ệm |sec| i | lu| hỏ| mo| nố|nối| m | đệ|par|ind|so |biệ|ge |đó |đồ |str|"
+      "ry |out|hát|tio| vá|tố |rl |àng|tre|hụ |âm |ne |đán|ỏng|đột|hỏn|hướ|iền|"
+      "văn|nte|uốn|ín | dõ|dõi| gì|gì | vă|pre| ri| na| đè|vá |đè | u |toà|ổng|"
+      "cục|ché| âm|ock|ls |thử|hử | la|dat|ngắ|gắn|buộ| bù|bù |ốc |trả|câu| do|"
+      " sp|ẩy |hấm|hỏi|ỏi |tes| e |tat|rả |lp |giố|iốn|ắp | gọ|ort|di |tar|ote|"
+      "năn| an| sắ| q |ốn |ngà|gày| lờ|bit| cờ|cờ |ủy |off|nam| đơ|đơn|ix | bậ|"
+      "ip |ign|ex |ont|tải|trừ|rec|ych|sym|log|rừ |ùyc|khở|hởi|ow |khố|hao|sắp|"
+      "ta |do | cú|cú |ser|trú|gọi|rge| kỳ|kỳ " },
+    { "ru",
+      " не|ть |ени| по| пр|не |ие |ние|пол|ать| в |ия | за|ый | ко|ова|оль|ся |"
+      "ля |мен|стр| ра|айл|фай|но | фа|ет |ка | вы| дл|ный|ния|тся|пер|ить| со|"
+      "про| на|для|ани|ая |ват|раз|го |етс|пре|ров|нны|ой |вер|на |льз| па|ало|"
+      " ис|уда|дал|спо| пе|ере| уд| от| об|ии |ов | до| си|льн|ого|анн|ста|ред|"
+      "дел|ест|ом |сь |ком|ост|тро|ое |ые |ств|ки |ван|ли |исп| ст| ка|ает|зов|"
+      " ре|нов|ла |чен|уст|ент|сти| с |под|лен|при| из|пис| ин|сим|ует|мет|дан|"
+      "еме|ых |иро|тел|ий |ель| им|ось|нач|енн|лос|клю|люч|зна|рам|ист|ьзо|ера|"
+      "лов|нев|пар| и |кат|ект|вол|ите|оши|тор|та | ош|шиб|жен|каз|имв|рав|ные|"
+      "ска|мво| оп|ива|мож|те |аме|зап|ибк|дер|щен|рем|нен|пус|аци|ерж|тан|ное|"
+      "анд|ных|ран|йл |или|ног|ара|ден|ти |зме|нно|бра|аза|бка| ве|ен |рок|ата|"
+      "аче|жно|име|сли|ции|ход|ате| сл| но| то|ная|ию |мер| ил|етр|ока|тны|ок |"
+      "пра|ано|обр|воз| ар|ра |ржи|сто|зде|ика|ной|реж| кл|вае|ави|азд|ожн|орм|"
+      "олн|то |фор| ус|мещ|ьны|ей | зн|фик|тно| ук|оди|опу|ука|кон|вле|чит|сле|"
+      "ево|рма|кци|еще| да| бы|ерн|йла|рек| сп|ми | мо|одн|пос|аль|ьно| эт|тал|"
+      " се|змо|ри |вод|озм|по |да |нст| b |ер |ыть|оже|ле |тек|оло|ене|тву|кая|"
+      "лог|рег|мя |тов| чт|ома|од |ада|тр |еги|доп|пак|ифи|ко |опе|иче|из |гис|"
+      "еде|это|ман|неп|выв|ори|ак |чес|едо|ны |ном|кет|имо|ото| ди|ово|инс|раб|"
+      "вес|льк|ры |ем |ьзу|тру|еск|ым |одд|жив|дде|ыва|зан|изв|або|код|ты |рук|"
+      "тим|рас|апи|ожи|зда|рир|ько| ме|авл|еве|дол|вит|ежд|екс|лок|нит|аке|олж|"
+      "ина|тат|отк|озд|яет|сте|оде|кор|ена|уме|быт|еко|соз|его|овк|рес|вре|мат|"
+      "дат|зад|ида|азо|имя|еле|вля|нос|еду|изм|тип|тиф|ую |it | ти| вн|емы|лит|"
+      "нт |осл|тре|ове|жид|тол| та|ено|оме|укц|упр|дно|нео|ку |оки|епо|айт|ерс|"
+      "ний|стн|ва |тра|нед| ес|тст|ке |ль |как|сло| ба|ным|вет|ктн| во| фо| де|"
+      "рси|ан |что| вс|вуе|нии| re|ит |лы |ция|опр|азм|игн|вып|зат|ато|заг|ита|"
+      "уще|жим|бло|дит|ами|тве| x |зве|ющи|ела|рен|ыво|али|гра|йло|неи|рат|отс|"
+      " gi|дос|аст|обн|нек|иск|ыпо|сыл|чан|гру|иси|йст| те|ссы|чис|ско|арх|еиз|"
+      "ерв|сод|есл|рхи|орр|рре| би|мес|им | сс| co|аже|нию|адр|ери|нер| ад|абл|"
+      "зав|аем|дин| тр|кры| см|сер|луч|ляе|выр|лем|git|жде|объ| бе|има|тен|раж|"
+      " ма|овы|дре|общ|же |рны|бот|ежи|ода|ол |огр| су|пок|поз|бъе| пу| de|нет|"
+      "нта|сов|спи|дек|зуе| ож| st|арг|три|очн|нде|тит|ат |рос| ум|ять|без| вр|"
+      "етк|нти|ним|иру| no|соо|исл| од|ели|дуп|утс|их |най|нда|сут|лед|дае|олу|"
+      "уже|инд|бли|ови|ип |еля|еоб|лож|вто|ыра|чно| s |цию|бай| чи|ённ|овл|бит|"
+      "инф|лиш| бу|тсу|чны|вил|точ|сть|le |мол|мый|ни |вой|ати|нор|рти|са |во |"
+      "нал|нфо|ел |ргу|гум|умо|олч|лча|ующ|так|иль|рыт|си |от |вне|жет|обы|жит|"
+      "мац|гно|оне|ло |все| эл|рой|эле| гр|омп|епр|имы| ос|кол|за |аве|ог |ор |"
+      "on |тем|реб|том|рно|ъек|шко|сис|пор|er |ишк|спе| n |очи|ана|ылк|диа| иг|"
+      "тры|еди|ись|ез |сту|лин|пов|сме|оба|явл|шен|оро|бол|одп|рог|ее | a |оце|"
+      "ета|вен|ейс|пом|оле|тив|апа|рац|му |мы |иде|ичн| яв|юче|вых|руе|тви|роц|"
+      "апр|зон|але|мпо|дли|туп| це| бл| in|ающ|ную|авн|рез|иап|паз|есс|ебу|она|"
+      "тер|нна|амм|йте|яни|ков|дпи| сб|es |ора|бно|ючи|нут|юча| к |вно|лжн|сок|"
+      "тки| бо|тир|вый|щий|тка|ма |ава|ён |ире|ола|вы |тоб|таб|лне|чат|лич|цес|"
+      "се |зыв|иса|цел|кот|sta|уск|опи|бще|ion|ерш| дв|омм|рол|ски|еча|ако|юще|"
+      "буе|асп|роб|юч |кси|нес|нте|хив| ma|тур|йде|пон|лни|мит|вме|лиц|дов|доб|"
+      "тьс|ься|ром|айд|еку|дей|бы |мое|орт|ерт|оры|вую|нар|кла|мог|ютс|лав|озн|"
+      "no | lo|ето|йти|рит|кс |рин|мми|ооб|ах |шир|зам| se|ткр|реп|нд |аго|па |"
+      "id |тво|гол|ито|лже|кту| вв|руп|ваю|буд|ll |дир| вх|вхо|ник|роп|упп|бав|"
+      "вка|наз|лас|ген|se |тна|онт|тав|щес|сущ|дны|ile|ини|чте|азы|той|ача|ыхо|"
+      "уйт|ены|вки|итн|ток|ver| he|кти| pr|вну| уп|он | fi|тоя|тар|исо|арт|нас|"
+      "лад| о |сбо|асс|роч|fil|loc|йлы|лон|рои|йт |няе|рим|ды |руж|lin|аро| ск|"
+      "кой| ло|зак|сно|уля|рна|щие|тич|con|жат|пец|дст|азр|кал|реш| r | ва|агр|"
+      "утр| вк|вкл|они|печ|ут |изо| ни|ча | pa|in |мно| св|емо| ге|сор|ce |рев|"
+      "инт|опо|выб|мод|re | li|едс|ота|ца |зит|сос|ect|час|ck |et |льш|унк| ид|"
+      "спр|лён|сии|уче|ают| че|te |дим| d |вни|отв|ело|зре|озв|бой|ме | ну|оку|"
+      " di|асш|ием|лня|щей|кст|ица|фун|нкц|нят|азн| фу|тог|пут|сит|кац|all|нел|"
+      "оси|хра|каж|син|руг| c |оян|акс| ау|мо | др|ьзя|зя |ame| ли|олы|me |оно|"
+      "ема|нды|оче|ози|оли|int|льт|икс|вед| пл" },
+    { "uk",
+      " не|ти |ння|ня | по| ви|не |ува| за|ий |енн| пр|анн|пер|ати|но |ван|ере|"
+      "кор| ко| на|ів |ка |ся |від| до| ро|ори|зна| у |роз|на |ля |ист|ого|ний|"
+      " пе|ста|ано|про|айл|фай|го | фа|вик|рис|ити|чен|ало|для| дл|ико|ні |их |"
+      "тан|оми|аче|нач|ено|іст|пом| си|ват| ст| па| ві|мил|пов| пі|илк|них|три|"
+      "ект|пис|оре| з |рам|ть |ови|ки |стр|при|під|вда|ми |до |ани|дал|рек|каз|"
+      "тов|сим| ре| як| зн|дан|сти|вол|ося|лос|пар| бу| вд|діл|ає | ма|ред|им |"
+      "ком|льн| об|опе|ент|имв| вк|мво| мо|зді|вка|озд|ктн|мож|сто|ії | да|нов|"
+      "ом |ног|ост| ін|змі|вер|ара|мет|рес| сп|аза|еко|лен|лка|жен|зап|кат|ку |"
+      " ти|аме|рим|анд|ова|ід |ову|мен|нек|ути|зан|ові|тьс|ься|наз|азв| та|роб|"
+      "ою |ряд|тип|або|вив|що |етр|вор|ок |ков|тни| є | аб|ла |апи|ри |сув|тор|"
+      "рит|сту|лів|йл | що|ера|бут|має| кл|кон|бо |ідо|час|ден|есу| ар|дом|іль|"
+      "тво|ово|ції|ома|за | оп|изн|рів|клю|люч|ва |ним|фік|ті |код| чи|аль|мін|"
+      "му |нев|ман| вс| ря|еві|та |зав|пор|ами|ожн|ані|міс|рег|кці|тув|лу |ств|"
+      " ча|ра |вий|чит|су | ді|мат| се|ідн| ка|нен|ядк|дже| b |дов|вув|єть|ідп|"
+      "ої |орм|фор|пра|ій |гіс|йла|тал|ло |ран|тру|егі|аці|отр|ном|иво|иве|вле|"
+      " і | ве|ифі|ому|вст| зм|трі|рук|тр |іка|ідт|поп|сть|айт|ька| бі|ше |ну |"
+      "обр|ато| мі|рма|ерш|оро|пос|нем|нст|пот|але|дтр|кри|тек|ону| фо|інс|якщ|"
+      "кщо|виз|рен|озм|ата|нал|уме|нта| ба|ас |раз|укц|сер|без|оди|оду| сл| но|"
+      "юва|вил|адр|неп|ьни|тат|нос|док|ени|мір| ад|над|оло|лог|ідк|гра|ли |ика|"
+      "екс|овн|ава|дно|тів|дре|жна|нут|лиш|има|дат|діа|кла|поз|едж|ує |ими|мал|"
+      "лов| ли|ськ|заг|тиф|огр|имк|азо|то | бе|вед|слі|іл |лі |аве|ише|рав|ія |"
+      "ача|вир|лив|ви |ча |ву |нт |олі|во |йлі|сте| ме|ту |арг|овл|ить|івн|ока|"
+      "сті|кув|ису|нан|нти|пус|рог|ила|ві |ита|вим|одо|буд|льк|аст|вач|рсі|ема|"
+      "гно|рев|ежи|об |ина|нь |ргу|лок|тим| от|абл|ипо|арх|ерс|кіл|ці |гум|ол |"
+      "жли|рхі|ду |мо |ис |иму|тра|щен|туп|так|ожл|зва| x |вод|ове|чис|ник| кі|"
+      "ків| ск|бра|ира|ест|ної|лід|ага| ди|оме|ір |най|реж|апа|хід|ам |спр|вит|"
+      "лас| те| co|же |ють|нув|ип |ез |сло|бай|еде|ємо|ілу|тис|дпо|ипу|ска|тив|"
+      " re| no|те |лик|нда|она|сил|шен| де|орі|зви|тро|біт|лко|од |исл|оси|лан|"
+      "меж|бро| de|вес| st|ода|нні| од|ізн|мпо|ичн|ле | ос|зон|роц|on |амі|бло|"
+      "ото|вір|рип|омп| s |ьно| зб| ал|дек|ор |оце|іап|паз|риз| n |le |спи| гр|"
+      "ана|ма |уєт|із |мер|як |ням| із|дос|чни|икл|щод|цес|дни|ічн|таб| ці|очі|"
+      "дин|оби|дод|тит|id |ант|озп|бач|обо|ілі|рац|дит|азу|гол|пу |йти|ньо|пок|"
+      "дба|вих|аєт|едб|іде| зв|рат|ію |ьог|атн|омо|пон|ди |зат|вни|ве |іку|унк|"
+      "сно|тер|ядо|нор|уль|еви|кан|точ|ире|гру|ат |er | a |луч|атк|оку|ній|оже|"
+      "жим|руп|ніс|епр|сис|сі |тна|аго|чік|існ|ям |ion|емо|ру |ави|орт|бли| ід|"
+      "мий|илу|оли|оль|ігн|тко|рап|ція|опу| ва| вх|ісл|ерт|вог|ору|рол|піз|рез|"
+      "одн|лон|дпи|ида|мкн|лад|чно|іто|иль|сов| in|чат|ер |иск|шир|роп|ішн|ром|"
+      "ль |поч|лиц|иці|опо|леж|дто|цій|очн|тич|адт|нд |юч |пол|аже|ень|ни | су|"
+      "аз |зпі|вто|очи|вно|оча|кти|онт|дка|ора| вв|зво|олу|дні| se| r |нат|ерв|"
+      "доп|озн|пак|ров|сля|мог| lo| яз|алі|гал|lin|no |кту|іте|тно|аку|хів|es |"
+      "ця |мки|тур|де |заб|мов|сок|ькі|тем|нди|ах |піс|лом|пош|обл|вид|дкр|уст|"
+      " це|арт| ma|оно|си |исо| кр|нул|рув|тне|кіс|цьо|да |вхі|бер|loc|мі | ць|"
+      "рти|пам|зі |рив|мув|вия|ияв| зі| то| pr|цію|рше|кли|ог |таж|зас|кра|осн|"
+      "sta|дко| ят|имі|кси|ада|явл|оза|ll |кін|оря|біл|вує|ток|ері| ув|вищ|езп|"
+      "ро |іни|ала|зам| лі|нео|вну|уск| ну|єкт|юча|спо| вн|бул|спе| ус|акс|мод|"
+      "вні|аві|нте| ке|лік|ені|зув|рем|ст |овж|аро|омл|ско| рі|том|ися|йте| єк|"
+      "оне| li|зсу|рос|ною|нім|інн|еми|кий| ла|арі|кі |сум|нак| зс|уде|сів|інд|"
+      "зву|пущ|уще|кст|мле|ей |ива|іть|ивн|ріш|ежа|nt |дна|ини|гор| іс|ату|ile|"
+      "озш|ect|кун|зши|апо|рот|ают|ску|лем|сії|ик |би |чні|еро| t |рши| di|нав|"
+      "зак|вне|уля|чає|льо|циф|виб|есо|еже|пец|кож|кал|ім |йде|se |ent|блі|тні|"
+      "роч|ic | fi|рту| бл|ме | m |кс |вжи|обк|жит|віш|аті|тар|re | в |упи|fil|"
+      "нки|rel|льт|айд|утр|зв |ver|иві|збе|єдн|ако|нер| sh|tio| фу|фун|нує|нті|"
+      "реб|асо|ючі|чин|яки|ікс|йті|нкц|сам|кну|іза|ход|сну|кою|аєм| ім|зпе|овк|"
+      "сни|важ|іли|жин|ps |ціл| c |te |ьов|іна|вел|едн|рид|me |орю|нде|лав|et |"
+      "ce |акр|рет|ями| d |ики|дку| l |чи | ні|ирі|вал| ел|атр|нам|інк| дв|али|"
+      "ed |спі|ели| v |шня|дає|нит|вню|еле|яті" },
+    { "bg",
+      "на | на|не | за| пр|ане| не| из|та | по|то |ван|те |за |да | да|ите|но |"
+      " от|ия |ка | се|ва | е |ата|се | ко|пре|ен | фа|айл|фай|ени| съ|ран|про|"
+      " мо|мен|оже|ред|мож|ира|ни |раз| в |ето|ият|же |от |при|ден|под| с |ция|"
+      "ава|ове| оп|пра| ра|ост|ния|ние|ани| ст| об|ри | ре|ста| и |ие | им|име|"
+      "ави|анд|ска|ект|ли |кат|ат |изв| до|пол|рав|ът |пци|опц|ежд|ент|ест|ото|"
+      "зва|лен|нат|йл |дав|ята|или|неп|ма |изп|тел|ход|нит|ств|дан|ори| гр|нет|"
+      "ете|жда|тор| ин|зна|нда|ки |сто|сле| са|реш|ти |са |ена|аци|лед| бе|ком|"
+      " сл|дър|зад|зве| то|рек|ез |вър|аде|вил|it |ато|ят |тан| па|гре|ада|ома|"
+      " кл|ве | ар|ате| ди|епр|лов|ман|веж|каз| gi|git|ява|нос|нов|ива|ват|ода|"
+      "де |пис| ка|лон| ил|ешк|без|ука|ме | си|аза|дир|во |олз|сти|лзв|пъл| ук|"
+      "йло| въ|ст |ова|дел|шка|ире|мат|мес|оме|спе|чен|зап|од |орм|рма|кто|ълн|"
+      " бъ| къ|дад|ед |ко |усп| но|яне|тов|ква|рем|фор|ром|ъм |ети|ист|към|ено|"
+      "бъд|тва|ичн| вр|уме|изт|стр|ърж|гра|рой|арт|екс|ржа|нен|еус|еме|вер|кет|"
+      "дат|обе|ла |нти|мер| ни| вс|ешн|изх|рес|зпо| зн|ене|али| пъ|неу|три|ъде|"
+      "бек|тно|лно|еде|зхо|сва|клю|люч|ика|рен|лни|едн|ра |ърв|ел |ема|зат|ако|"
+      "рия|ви |зпъ|ина| ак|тек| та|нот| ве|айт|нал|зда|раб| сп|по |арг|вен|пеш|"
+      "мет|або|реж| дъ|еле|мо |зи | re|дар|лна|съз|ъзд|шно|аст|нт |бот|вет|той|"
+      "рат|кло|чет|ан |има|ргу|гум| ма|ана| ви|ати|бро|ции|ващ|кти|ече|пак|он |"
+      "едо|ртн|ано|кон|тир| ли|йно|поз|ойн|аке|сте|вре|рси|еди|пос| те|аме|бра|"
+      "алн| фо|иет|ача|лив| бр|азд|апи|че |тво|дек|тен|ува|зде|обр|иле|акв|тро|"
+      "ще |сам|ии |илн|рит|дре|нас|ди |дни|амо|нак|код|ой |але|инд|жа |ели|фик|"
+      " ня|ито|огр|със| де|дов|отв|същ|нде|лне|чис|тич|тре|ер |реб|рам|лав|общ|"
+      " тр| вх|одд|пот|чно|еля|път|рез| кр|вид|тни| ба|елн|ока|ерс|лип|кра| че|"
+      "чак|тит|вхо|ак |рво|чва| ед|дос| co|изи|иск| ос|сим|нач|ипс|озн|кри|тер|"
+      "ови|авя|зан|нте|съо|псв|отр|ера|оди|ник|ози|упр|зтр|еку|бло|апа|le |иде|"
+      "връ|отн|отк|сич|ичк|пов|бва|абл|кт |доб|сия|яма|йте| ус|нес|епо|луч|ми |"
+      "тар|кла|тря|изр|нни|вме|хра|ащи| s |ифи|они|ъв |нео|съд|ъдъ|вси| n |рог|"
+      "ддъ|вол|дъл|оре|нск|йла|ърш|ням|им |тав|жен|чки|бав|ло |нил|лит| а |арх|"
+      "изч|чни|оба|рхи|спи|оча|одр| ид| хр|лищ|ет |опи|осл|онт|ета|бит|мац|адр|"
+      "азв|ази|вян|зав|инф|нфо|иит| de| св|ща | ад|тиф|низ|ци | st|ряб|ябв|във|"
+      "лик|исл|съв|ери|оде|кал|ъще|тоз|ор |вор|тим|обн|ал |олу|er |кса|щот|se |"
+      "пар|зра|лок|инт|ес |ита|мал|чна|акт|два|ъс |нац|зме|оче|лът|хив|веч|азм|"
+      "ище|зли|скв| he| дв|яна|йто|щи |вия|въз|тем|вка|очи|рег| no|щен| ме|нди|"
+      "соч|рив|бай|дно|кои|тна|сис|мян|мно|одн|ъоб|нта|еск|бно| би|ид |док|роч|"
+      "ляв|нап|кан|ини|рил|бще|еоб|тат| pa|рир|анн|дуп|йст|ll |паз|ица|оце|так|"
+      "игн|исъ|чит|есъ|тра|лян|дин|тът|еду|сиг|сък| го|роц|аз |жде|ck |лиз|зир|"
+      "ама|стъ|оле|кци| уп|тър|вто| чи| мн|уст|сли|тви| ча|тик|тта|вяв|си |es |"
+      "ном|шаб|кущ|ючв|пор|дал|дна|ис |цес|енл| ша|сло|ръз|ъзк|нли|вар|щес| in|"
+      "ими|до |te |ниц|баз|вай|час| ис|on |ile|sta|ров|мод|точ|кой|оит|ога|жан|"
+      "тву|вув|ead|цел|обх| це|ов |рие|овя|зчи|лож|жим|ойк|авн|ба |еба| ло|лаг|"
+      "олн| ан|сек|отд|зис|ълж|ици|анс|гат|аря|et |еда|авъ|чал|оду| fi|fil|шен|"
+      "бли|обв|що |виш|ce |она|азл|лич|йлъ|аща|изо|дул| d |ткр|иче|ово|нст|гна|"
+      "тка| со|бхо|ека|ши |чи |инс|ора| др|нир|ver| ma|ch |ежи|звъ|вал|очн|все|"
+      "вед|опр|арч|рче|дим| al|зам|лев| ск|тъп| a | t |гла|го |ъвм|еси|тве|аже|"
+      "оля|вив|едв|ък |ack|доп| ет|ила| оч|ейс| pr|дру|иса| c |пка|леч|кръ|ца |"
+      "ай | di|вна|пър|re |ed |ad |няв|лжи|тег|стт| су|мин|чав|еки|оне|вкл|раж|"
+      "тив|con| f |свъ| чр|заг|ъпк|щат|чре|лем| вк|тал|руг|оку|шир|кси|еби|кст|"
+      "изб|дво|ate| lo|кит|одм|вни|ара|ага|ърз|кс |дмо|онф|ит |тда|рна|азн| ав|"
+      "ин | ср|из |омѐ|мѐн|ѐни|ике|ула|кум|бви|гру|аве| b |пир|сен|зво|ари|all|"
+      "ивк|дес| se|зка|тме|рии|ect|таз|ило|оло| ще|отм|руп|ref|ршв|шва|имв|мво|"
+      "рва|ъст|ter|no |пус|как|int|исв|рти|зте|чин|йск|ion|роб|атв|егл|hea|яко|"
+      "ча |lin| тъ|уча|рад|унк|ръп|ивн|авт|мак|ъзм|змо|омп|ойт|ним|фун|дач|агл|"
+      "ъщо|имо|лас| вм|нкц|щия|реи|ик | фу|бир|вие|га |чат|лат|нул|sh |урс|кац|"
+      "мах|ков|ив |rea| x |ену|сре|спо|тоя|che|al |ожн|рос|све|rt | ex|ащ |изк|"
+      "зкл|loc|кач| sh|опу|еше|ращ|нам|at | ta|озв|лир|дит|ерв|ака|иза|вит|яни|"
+      "ган|ore|ърс|таб| si|рай|еза| p |ког|ало" },
+    { "ar",
+      " ال|ية |الم|ات |رة |مست| صو|ير | مس|ند |مة |الأ|نية| في|ملف|لف |الت|اني|"
+      "دة |الي|اتي|تند|غير|ستن|الب| غي| مف|في |الإ| لا|لمس|صور|لى |يح | مع|فات|"
+      "يل |مفت| عل|لا |لية|ورة|الر|الك| مل|دية|صوت| خط|اح |فتا|تاح|لات| مي|الح|"
+      "الو|مفا|تيح|لة |ار |سية|الف|الع|على|ستو|تة | لل|ون |لما|ول |اء | تع|الق|"
+      " فش| بد|فشل|ميت|ين |يتة|يف |توى|وى | أر|زية| ما|مع |حدة|يني|خطأ|طأ | تر|"
+      "لإن|الث|لمل|ام |فل |رشي|شيف|يات|يو |يزي|قفل|أرش| من|يدي|مان|رية|ني |حزم|"
+      "حة |رك |ماك|ليز|تحد|الس|روف|وت |إنج|نجل|جلي| اس|شل |ليم|مسا|ان | كا|روس|"
+      "alt|وف |ype| بر|لمت|كية|الن|دون|يان|من | al|ert|ندي|typ|رف | قا| إل|لب |"
+      "بير|متح|الخ|الا| su|يا |يم |كبي|وسي| با|pe |تعذ| مح|طة |lt | قف| ty|لمف|"
+      "مية|وتي| عن|er |وم | مت|سار|ليس| أو| wi| بي|فية|لند|sun|حرو|در |انا|نات|"
+      "تي |لأو| مص|شفر|wer|un |لرو|لاي|ألم|صدر|ربي|بية|rty|ty |تين|بدو|ايا|مصد|"
+      " خا|الد| دو|يرة| qw|qwe|ولا| جد| مج| سل|win|فرة|الل|لول|بة |in |ديو|ch |"
+      "لأل| يو|اسم|بان|مكن|بيا| عا|ss |لكب|ctr|trl|rl |سم | قر|يد |الص|عة | مر|"
+      " وا|نسي|نتو|مين|ال |وز |فيد|ite| شف|ft |لثا|لعر|فرن|عذر|عمل|et |امة|لم |"
+      " سي|ديل|وني|لفر|لحر|قرص|لحز| فا|زمة|إلى|لخا|وي |عال|يمي|رنس|رص |قرا| ap|"
+      "حرف|فة |يمة| يم|يمك|خام|غال|روم| مض|مضغ|ضغو|غوط|كنت|توش|وفر| ct|يق |رض |"
+      "يسا|ور |لام| مو| بو|وين| sh|اكن|وش |دوف| تح|الج| صف|علا| نق|كن |مات|اك |"
+      " co|لمي|ter|ندو|shi|فرك|ائم|ذر |وب |محر|أو | أن|دم |ود |قال|on |log| وي|"
+      "ess|hif|ift|لأر|زم |لي |توق|صال|انت|ها |لمج|لبي|بري| رو| pa|ركي| حا|رمز|"
+      "عند|حتو| ان|وقع|لبر|عرض| دي|يون|بول|وط |كرو|مجر|ثنا|الة|ادة|مل |راء| لم|"
+      "قائ|ئمة|سلي|لوص|اصل|للا|بت | كو|net|ml |tec|تية|امي|سوي|اله|اري|ري |تم |"
+      "ترك|وع |افي|سي |rea|ack|متو|ثال|دول|ech|عرب|ولن|است|اد |لقر|ءة |روي|تاب|"
+      " مد|صر |توي|مكت|ناء|دعم|int|برا| و |ip |سكر| حز| lo|يكي|جري| تم|لتر|اءة|"
+      " مش|tar| بع|عد |رات|طبي|ترا|قيم|عدد|نته|صل |كتب|ليا| أم|نقط|قطة|git| in|"
+      "لوح|لث |لتا|ogi| كل|كتا|داخ|اخل| تو| ta| تن| قي|ميز|لمح|ليل| ر |لقا| تخ|"
+      "لسل| أث|أثن|عم |zip| ma|خط | دف|لبو|بال|صحي|حيح|يس |أرق|رقا|قام|بع |موع|"
+      " ل |فاص|صلة|لفا|لمم|مال|كرب|ربت|rd |nte|يند|ردي|كل |مج |ويس|نة |لرم|وح |"
+      " لي|مجم|وصل|تخط| يح|قع | فق|ديم| رم|لمو|ولي| لو|جدو|pac|يط |دوز|بدي|لإس|"
+      "تغا|ترو|يت |تصا| نو|اعد|عنص|نصر|راب|بل |جمو|معا|وحة|قدي|ابع|بر |كة |رد |"
+      "ex | رس|تار|رو | od|ادم|سر |إسب|لكر|ران|ابا| إع|عاد|دل | كت| دا|ملي|يار|"
+      "مدع|ديد|للع|ستخ|خدم| de|لمك|كان|يحت|وال|فق | تق| أي|احة| إي|للت| عر|ريد|"
+      "كول|مي | us|les|خاد|ريا|سلو|ولم|لسو|بدل|لت |ابة| م |شكل|ar |جدي|أمر| تص|"
+      "إضا|ضاف|ما |عل | إن|طية|دلي|تخد| تس|دد |دي |ساح| تش|sta|ix |ليو|لإي|توا|"
+      "زيل|تفي|ويد| tr|اثي|خطي|top|op |لرا|تشي|اتف|دا |يب |دعو|عوم|بعد|أن |جة |"
+      "رسا|نها|وما|سال|نام|قة |عدة| مك|مبر|مار|بي | سك|ورد|يكر|com|اكس|دات| مم|"
+      "ثية|مري|طيط|ضغط|مون|راث|ورك|لتش|أور|كاس|اسر|سرة|زال|قية|لكا|لكت|نوع|مر |"
+      "رمي|رمو|ارا|وجو| mi|وعة|واح|تب |تهى|هى |فار|ope| ا |بين| أل| ne|نت |افة|"
+      "bm |ord|وسو|سوف|وفت|فت |يك | re|لمع|ard|ممي|فور|وري|تان| سو|سبا|يلي|ern|"
+      "rne|ازي|شيك|برت|رتغ|وية|عي |شلت|بيت| ch|ذا | فت| ge|يز |صفر|موز|جب |وس |"
+      "بيق|جود|لد |عذ |ng |محا|لقي|كيا|فتو|توح|خر |اتص|ion|نا |مز |تال|per|ميك|"
+      "سة | fl|وان| st|us |mat|يلا| xm|يطا|apl|سوب|غط |دفو|usb|sb |ياب|كرد|رقي|"
+      "نسخ|تثب|ثبي| صا| عم| ب |نظا|ظام|لاس|مسم|هول|تنف|pt |اسي|تطب|موج|خاص| طب|"
+      "لغا|صلا|ينت|تبا|معر|لعم|امج| op| بم|عام|را |تعد| x |ff |كس |tt |cor| he|"
+      "peg|eg |pre|let|طال| حر|يسر|حاس|اسو|رب |ستا|هند|تيف| q |إيط|cka|امس|لصر|"
+      "لتح|اب |كام|امل|خلي|لعث|خيا| لت|تح |لنس|نفي|apt| يج|يجب|جد |إنش|نشا|شاء|"
+      "كون|لاح| دل|ime|me |كرا|مزي|اوي|احد|حد |بشك| مق|pen|en |يجا|ينا|الش|ewl|"
+      "لمة|لتو|ami|ريك|son|kar|برو|ترج|رون|بور|pl |اكي| أس|لتص|تعي|الض|des|esk|"
+      "skt|kto|نيا|وفا|لوف|بمف|فري|يور|جية|صرب|أوك|علي|إعا|إزا|عثو|ثور| هذ|فتح|"
+      "فيذ| إض|تيا|لعن|للم|قل | فر| بش|لكن|عرو|غيل|برن|رنا| أخ|لدي|لفي|غري| po|"
+      "ect| wa|ريل|راي|نيو|لأق| ac|ستر|ode|كلم|df |boo|ook|ok |dia|ia |ic |cke|"
+      "dle| mp|ste|كا | me| نا|نتن|xml|ونك|لفل|تصد|صدي|ديق|غول|يين| سر| az|لهن|"
+      "لجي|ممل|ملك|لكة|نغو|hew|wle|ett|ختا|مس |جعل|وكر|بق |مصا|يدة|te |قيا|سمو|"
+      "موح| به|توج|صفة|نك |اص |lin| ت |am |رجع| كي|خل |اصر|ارغ|فقط|قط | د |معل|"
+      "لوم|تشغ|شغي|ملا|لإب| تغ|اس | صح|لخل|باس| تد|لمن|لمر|اضي|الط| رق|داد|سل |"
+      "متع| آب|وبي|ema|mp |كي |ad |tex| li| di|ire|tra| تي|tou| ور|رجم|tro|ورب|"
+      " sc| f |صي |مول|يتم|يفي|عيي| a |kb |برم" },
+    { "fa",
+      "ده | در|ست |ای |در | نا|نام| بر|ان |از | خط|ار |وند|نده|ام |رون| پر|رای|"
+      "خطا|نی |پرو|می | پی|طا | نم|رد | از|انی|وان| با|ند |است| نش| اس|شده|دار|"
+      " شد|ود |نمی|برا| نو|به |دن | را| یک| دا| ها|توا| ای|را |بر |ید |یک |تبر|"
+      "اده|کرد|شان|یست|تن | یا|معت|عتب| به|نشا| فر| نی| خو| کر|نه |ته |های| تو|"
+      " شک|شکس|کست|سه |بان|نیس| مق|مه |ری |شود|ال |یر |این|کار|نگا|پیش| پا|نتظ|"
+      "شتی|تیب|نوی|امع|یبا|فت |یان|اخت| شا| مش|ارد| رو|پای|اند|ین | کل|ها | پش|"
+      "پشت|ویس|یا |امه|مشخ|مقد|قدا|یسه|یش |وجو| شو| هن|لی | مو|جود|داد|با |نشد|"
+      "وی |خوا| گر|شد |هنگ|گام| می| غی|غیر|پیا|ورد|کلی|لید| ان|یه |اد | کن|دی |"
+      "خه |نوش|وشت| خا|برن|رنا|خته|شاخ|اخه| بی|شنا|ون |روی|یت |بای|ور |ایا|ات |"
+      "رفت| بس|نما| کا|فرا|ره |سیر|خور|ردن|یاف|افت|ندا| دس|انت| عن|ساخ| بد|یند|"
+      " سی|نات|منت|ندن|اید|دست|شخص|اه |تظر| مس|اری|یم |بست| تن|تنظ|نظی|ظیم|یاد|"
+      "ودی| گو|ظره|تظا|ظار|مسی| سا|عنص|نصر|ینه|شکا| مح|که | مع|ریا|یی |ناس|یشک|"
+      "فرز|رزن|زند| so|فتن| ند| نس|اتو|تی |گزی|اشن|مای|بود|ایج|یجا|جاد| وج|مان|"
+      " حا|soc|ock|ونه| pa| شن|موج|صر | طو| مت|ادی| بو|ارج| هی|نسا|بل |on |دون|"
+      "ایی| گز| گذ|گذر|ناش| جا| ات|صال|cks|هیچ|یچ |pat|ath|th |شخ | ص | ور|بدو|"
+      "طور| شم|شما|ودن|فاد|امت|ksv|sv |یرم|رمن|صه |الی|له |گون|رس | سو| وا|زین|"
+      "باش|bus|یل |گاه|جزی| که|ستف|تفا|مت |رسی|خصه|ورو|رود| دو|دود|علا|ساز|نش |"
+      "ول | شی|اس | لا|رگا|یام|کند| ار|شتن|بار|ستن|بی |بری|وع | عل|وه |tio|ion|"
+      "سته|واس| قا|سیا| تج|تجز|زیه|راه| نق|وده| گش|گشو|شتا|تار|داخ|اخل|ردا| رف|"
+      " ب |گرف|دری|ریخ|یخت| جر|جری|ile|کی |گیر|نوع|کنش|تغی|اشد|پید|یدا|دا |مقص|"
+      "قصد|صد |خت |ذرگ|ناخ|ستر|پیو|یون|ماد|دین|میز|تما|خار|محد|حدو|لام| s |ایش|"
+      "ect|درس|ارس|بال|امب|مبر|شنب|نبه|انه|اشت|ایت|اسه|ارا|اسط| صا|اط |رده|قاب|"
+      " اج| مج| تب|تبد|بدی|دیل|گار|شت |رج | زم|sch|che|hem|شی |خال|نبا|fil|le |"
+      " تر|ازی|زی |گر | و | ری| فع| ال|سوک|وکت|کت | اط|لاع|اعا|عات|غیی|ییر| صف|"
+      "ولی|ابل|us |جاز| نگ|باز|مام| وی|واه|شته|ema|خل |چسب|سب |گرو|روه|طای|بیش|"
+      "زبا|اله|دان|یار| ما|ct |هی |ما | رم|رمز|مل |نال|سی |مول|سام|حال|ma | پس|"
+      "پس |برچ|رچس|رست|مار|cre|خط |جای| تغ|دور|متن|یرق|رقا|ارگ|انو|امن| sc|وار|"
+      " ej|eje|jec| fi| من|یری|er |فه |یده|سط | کم|صفت|tho|اجر|جرا|یاه|هه |وصی|"
+      "سیس|ستم|تم |امل|یح |red|جاب|اهی|دیت|سیگ|یگن|گنا|یق |انس|مین|تر | سر|ati|"
+      " عد|عدد| فه|ختن|گری|ترس| حد|حد |گی | دن|دنب|nt |وری| ژو|ژوئ|ستو|تور| قف|"
+      "قفل|فل | قب|قبل|خص |نقط|قطه|طه |دها|شیء|یء |قال|الب|لب | گی| ht|htt|ttp|"
+      "tp | d | bu|اهه| چو|ارب|ربر|ارش|ابه|کان|رجا|جاع|اع | تم|مال|مجا| ke|key|"
+      "ey |شدن|اتص|تصا| نت|نتو|نست|نوا| تع|top|op |زمی| بز|بزر|زرگ|ادن|ارت|دسا|"
+      "رسا|وش |رار|اهن|هنم|ope|نند|ede|یزب|مور|یز |گرد| آد|آدر| چا|چاپ|اپ |کتا|"
+      "اب | کد|نیا|یاز|انک|ریز|app|id |ame|ter| فق|فقط|قط | co|dbu|ed | pe|زنگ|"
+      "em |چون| صح|صحی|حیح|ازه|زه |ونو|me |رش | ut|utf|tf |رگو|زید|اره|اما| چن|"
+      "چند| ده|گوا|پی |یف |des|esk|skt|kto|ls | بع|بعد|اوی|سید| شر|سرا|ial| خر|"
+      "خرو|روج| عب|عبا|یب |ونی|وست|ستا|داش|فرم|روش| هو|هوی|ویت|con| مک|مکا|نون|"
+      " fd| رق|رقم|فی | عم|یات|عاد|انن|رگز|گزا|زار|کلا|لاس|قل |ژه | مط|خان| اش|"
+      "شتر|ترج|ختی|شای|ازم|غاز|یرد|pid|met| هر|ادر|rg |com|ent|nti|cat|عه | خص|"
+      "صی |مزن|pem|یص |طی | db|sta| دق|امی| gi|انش| مد|مدی|دیر|یتی|صل | شب|شبک|"
+      "بکه| آی|یشت| حذ|حذف|ذف |عد |عمل|داز| رس|وجی|جی | رش|رشت|بدر|رما|رت |اعد|"
+      "دهن|ناد|قم |رگ |افی|بسی|یوه| بل|بلن|لند| تف|تفس|فسی| مه|per|ویژ|یژگ|ژگی|"
+      "یما|نقل| اع| تص|ذرو|روا|واژ|اژه|رگی|سوا|mou|oun|unt| کت|تاب|ترا|منب|نبع|"
+      "بع |رجم|جمه| اخ|تیا|کدگ|دگذ|گذا|ذار| هم|هم |بد | زی|act| فض|فضا|ورا|شون|"
+      "str| دی| or|org|رها|mma|and|nd |دهی|ica|خصو|صوص| تش|تشخ|شخی|خیص|typ|ype|"
+      "pe | عا|عام| گس|گست|قت |مضا|rea|ندی|han|nne|lin|اتم|ویر|اتی|عمو| وص|وصل|"
+      "شرو| طر|طری|ریق|هین|ینا|آی | de|ce | gs|وز |اصل| re|ria|al |nam| ول| خد|"
+      "خدم|دمت|فعا|عال|توص|صیف| غا|غای|ایب| po|ترک|فعل|علی|درو|برد|زما|سال| se|"
+      "محت|حتو|وای| آر|آرگ|گوم|وما|أیی|emb|ico| ام|هند| لو|لول|وله| تک|کاف|ملی|"
+      "لیا|شام| gc|gcr|den|tia|als| m |قان|int|حاو|هرس| me|کل |ضای|رام|متر|بت |"
+      " fr|یرع|رعا| قو|قول|fd |دد |val|ایه|xxx|ینت|نتر|ترن|رنت|نتی|مطل|طلق|لق |"
+      "الگ|لگو| آو|آور|ریل| آگ|آگو|گوس| فو|فور|ریه| ژا|ژان|ویه|وئی|ئیه|وئن|ئن |"
+      "وام| اک|اکت|کتب| سپ|سپت|پتا|تام|twi|wit|ith|hop|era|rat| سن|ناق|اقص|قص |"
+      "بیت|زمن|مند| آز|نکی| آغ|آغا|یاب|ابد|cti| ap|ppi| at|tri|te |انا|عی |فع |"
+      "طول|یکی|dir|tra|rac| مث|مثل|کم |متغ| ته" },
+};
+
+#endif /* TRANSLATE_LANGID_PROFILES_H */
@@ -0,0 +1,280 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate language identification - which language a message is in
+ *
+ * The helpers detect the source language themselves, but only after a
+ * process has been started and the document parsed, and a good part of
+ * the mail is already in the target language. This guesses it up front,
+ * from the text translate-content extracts, so such mail never leaves
+ * the extension and the Argos helper loads the right model straight away.
+ *
+ * Scripts used by a single language decide on their own. Within Latin,
+ * Cyrillic and Arabic script, every letter trigram of the text (words
+ * padded with a space on each side) adds its rank-based weight in each
+ * language's profile, a list of that language's most frequent trigrams
+ * (translate-langid-profiles.h). The best language must lead the
+ * runner-up clearly; close calls are left to the helper.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <glib.h>
+
+#include "translate-langid.h"
+#include "translate-langid-profiles.h"
+#include "translate-segment.h"
+
+#define N_PROFILES          G_N_ELEMENTS (langid_profiles)
+#define LANGID_MAX_LETTERS  4096  /* Enough to tell; the rest only costs time */
+#define LANGID_MAX_WORD     64    /* Longer runs are cut; they are not words */
+#define LANGID_MAX_HTML     (256 * 1024)  /* Markup parsed to find those letters */
+#define LANGID_MIN_TRIGRAMS 24    /* Below this, a few words decide too much */
+#define LANGID_MIN_MARGIN   0.05  /* Lead of the best score over the runner-up */
+
+/* Weight of one trigram in each profile; 0 where it is not listed */
+typedef struct {
+    guint16 weight[N_PROFILES];
+} TrigramWeights;
+
+typedef struct {
+    GHashTable     *weights;  /* UTF-8 trigram → TrigramWeights* */
+    GUnicodeScript  script[N_PROFILES];
+} LangidTables;
+
+static gpointer
+langid_build_tables (gpointer data)
+{
+    LangidTables *tables = g_new0 (LangidTables, 1);
+
+    (void)data;
+
+    tables->weights = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+    for (guint l = 0; l < N_PROFILES; l++) {
+        const gchar *p = langid_profiles[l].trigrams;
+        guint rank = 0;
+        guint count = 1;
+
+        for (const gchar *q = p; *q; q++)
+            count += *q == '|';
+
+        tables->script[l] = G_UNICODE_SCRIPT_UNKNOWN;
+        while (*p) {
+            const gchar *end = strchr (p, '|');
+            gsize len = end ? (gsize) (end - p) : strlen (p);
+            g_autofree gchar *trigram = g_strndup (p, len);
+            TrigramWeights *weights = g_hash_table_lookup (tables->weights, trigram);
+
+            if (!weights) {
+                weights = g_new0 (TrigramWeights, 1);
+                g_hash_table_insert (tables->weights, g_strdup (trigram), weights);
+            }
+            weights->weight[l] = (guint16) (count - rank++);
+
+            /* The script of the first letter is the profile's */
+            for (const gchar *c = trigram; tables->script[l] == G_UNICODE_SCRIPT_UNKNOWN && *c;
+                 c = g_utf8_next_char (c)) {
+                if (*c != ' ')
+                    tables->script[l] = g_unichar_get_script (g_utf8_get_char (c));
+            }
+
+            p += len;
+            if (*p == '|')
+                p++;
+        }
+    }
+    return tables;
+}
+
+static const LangidTables *
+langid_get_tables (void)
+{
+    static GOnce once = G_ONCE_INIT;
+    return g_once (&once, langid_build_tables, NULL);
+}
+
+/* Adds the trigrams of @word (lower case, unpadded) to @scores */
+static guint
+langid_score_word (const LangidTables *tables,
+                   const gunichar     *word,
+                   guint               len,
+                   guint64            *scores)
+{
+    gunichar padded[LANGID_MAX_WORD + 2];
+    guint n = 0;
+
+    padded[0] = ' ';
+    memcpy (padded + 1, word, len * sizeof (gunichar));
+    padded[len + 1] = ' ';
+
+    for (guint i = 0; i + 3 <= len + 2; i++, n++) {
+        gchar key[3 * 6 + 1];
+        gint at = 0;
+        TrigramWeights *weights;
+
+        for (guint j = 0; j < 3; j++)
+            at += g_unichar_to_utf8 (padded[i + j], key + at);
+        key[at] = '\0';
+
+        weights = g_hash_table_lookup (tables->weights, key);
+        if (weights) {
+            for (guint l = 0; l < N_PROFILES; l++)
+                scores[l] += weights->weight[l];
+        }
+    }
+    return n;
+}
+
+/* The language of a script that only one language in Argos uses */
+static const gchar *
+langid_from_script (GUnicodeScript script,
+                    guint          kana)
+{
+    switch (script) {
+    case G_UNICODE_SCRIPT_GREEK:
+        return "el";
+    case G_UNICODE_SCRIPT_HEBREW:
+        return "he";
+    case G_UNICODE_SCRIPT_HANGUL:
+        return "ko";
+    case G_UNICODE_SCRIPT_HIRAGANA:
+    case G_UNICODE_SCRIPT_KATAKANA:
+        return "ja";
+    case G_UNICODE_SCRIPT_HAN:
+        /* Japanese writes kana between its kanji */
+        return kana ? "ja" : "zh";
+    case G_UNICODE_SCRIPT_THAI:
+        return "th";
+    case G_UNICODE_SCRIPT_DEVANAGARI:
+        return "hi";
+    case G_UNICODE_SCRIPT_BENGALI:
+        return "bn";
+    default:
+        return NULL;
+    }
+}
+
+const gchar *
+translate_langid_detect (const gchar *text,
+                         gssize       length)
+{
+    const LangidTables *tables;
+    const gchar *end;
+    guint64 scores[N_PROFILES] = { 0 };
+    gunichar word[LANGID_MAX_WORD];
+    guint word_len = 0;
+    guint letters = 0;
+    guint trigrams = 0;
+    guint kana = 0;
+    GUnicodeScript script = G_UNICODE_SCRIPT_UNKNOWN;
+    guint script_letters = 0;
+    GHashTable *per_script;
+    gint best = -1, second = -1;
+
+    if (!text)
+        return NULL;
+
+    tables = langid_get_tables ();
+    end = text + (length < 0 ? strlen (text) : (gsize) length);
+    per_script = g_hash_table_new (g_direct_hash, g_direct_equal);
+
+    for (const gchar *p = text; p < end && letters < LANGID_MAX_LETTERS; p = g_utf8_next_char (p)) {
+        gunichar c = g_utf8_get_char_validated (p, end - p);
+        GUnicodeScript s;
+        guint n;
+
+        if (c == (gunichar) -1 || c == (gunichar) -2)
+            break;
+
+        if (!g_unichar_isalpha (c)) {
+            if (word_len > 0)
+                trigrams += langid_score_word (tables, word, word_len, scores);
+            word_len = 0;
+            continue;
+        }
+
+        letters++;
+        s = g_unichar_get_script (c);
+        if (s == G_UNICODE_SCRIPT_HIRAGANA || s == G_UNICODE_SCRIPT_KATAKANA)
+            kana++;
+        n = GPOINTER_TO_UINT (g_hash_table_lookup (per_script, GINT_TO_POINTER (s))) + 1;
+        g_hash_table_insert (per_script, GINT_TO_POINTER (s), GUINT_TO_POINTER (n));
+        if (n > script_letters) {
+            script = s;
+            script_letters = n;
+        }
+
+        if (word_len < LANGID_MAX_WORD)
+            word[word_len++] = g_unichar_tolower (c);
+    }
+    if (word_len > 0)
+        trigrams += langid_score_word (tables, word, word_len, scores);
+    g_hash_table_unref (per_script);
+
+    if (script_letters == 0)
+        return NULL;
+    if (langid_from_script (script, kana))
+        return langid_from_script (script, kana);
+    if (trigrams < LANGID_MIN_TRIGRAMS)
+        return NULL;
+
+    for (gint l = 0; l < (gint) N_PROFILES; l++) {
+        if (tables->script[l] != script)
+            continue;
+        if (best < 0 || scores[l] > scores[best]) {
+            second = best;
+            best = l;
+        } else if (second < 0 || scores[l] > scores[second]) {
+            second = l;
+        }
+    }
+
+    if (best < 0 || scores[best] == 0)
+        return NULL;
+    if (second >= 0 &&
+        (gdouble) (scores[best] - scores[second]) < LANGID_MIN_MARGIN * scores[best])
+        return NULL;
+
+    return langid_profiles[best].code;
+}
+
+const gchar *
+translate_langid_detect_html (const gchar *html)
+{
+    g_autoptr(TranslateSegments) segments = NULL;
+    g_autoptr(GString) text = NULL;
+    g_autofree gchar *head = NULL;
+    guint count;
+
+    if (!html)
+        return NULL;
+
+    /* Enough markup to find the letters needed; a tag cut in half at the
+     * end only costs a few of them */
+    if (strnlen (html, LANGID_MAX_HTML + 1) > LANGID_MAX_HTML)
+        html = head = g_strndup (html, LANGID_MAX_HTML);
+
+    segments = translate_segments_parse (html);
+    count = translate_segments_get_count (segments);
+    text = g_string_new (NULL);
+    for (guint i = 0; i < count && text->len < 4 * LANGID_MAX_LETTERS; i++) {
+        g_string_append (text, translate_segments_get_text (segments, i));
+        g_string_append_c (text, '\n');
+    }
+
+    return translate_langid_detect (text->str, (gssize) text->len);
+}
+
+gboolean
+translate_langid_same_language (const gchar *a,
+                                const gchar *b)
+{
+    gsize len_a, len_b;
+
+    g_return_val_if_fail (a != NULL && b != NULL, FALSE);
+
+    len_a = strcspn (a, "-_");
+    len_b = strcspn (b, "-_");
+    return len_a == len_b && g_ascii_strncasecmp (a, b, len_a) == 0;
+}
@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate language identification - which language a message is in */
+
+#ifndef TRANSLATE_LANGID_H
+#define TRANSLATE_LANGID_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* Guesses the language of the UTF-8 @text (@length bytes, or -1 if
+ * NUL-terminated) from its script and letter trigrams, looking at the
+ * first few thousand letters only. Safe to call from any thread.
+ * Returns an Argos Translate language code, or NULL when the text is too
+ * short or its language is not clear enough to skip the helper's own
+ * detection. */
+const gchar *translate_langid_detect (const gchar *text,
+                                      gssize       length);
+
+/* Same for the translatable text of an HTML document. */
+const gchar *translate_langid_detect_html (const gchar *html);
+
+/* Whether two language codes name the same language, ignoring regions
+ * ("pt" and "pt-BR"). */
+gboolean translate_langid_same_language (const gchar *a,
+                                         const gchar *b);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_LANGID_H */
@@ -28,13 +28,37 @@
 #include "providers/translate-provider.h"
 #include "translate-dom.h"
 #include "translate-content.h"
+#include "translate-bulk.h"
+#include "translate-prefetch.h"
 #include "translate-preferences.h"
+#include "translate-utils.h"
 #include "m-utils.h"
 
-static inline gchar *
-get_selected_message_body_html (EShellView *shell_view)
+/* One click on "Translate Message", from loading the body to applying */
+typedef struct {
+    EShellView   *shell_view;
+    GCancellable *cancellable;  /* Owned by the display's DOM state */
+    gboolean      whole;        /* Translate the rest of a partial translation */
+} TranslateRequest;
+
+static void
+translate_request_free (TranslateRequest *req)
 {
-    return translate_get_selected_message_body_html_from_shell_view (shell_view);
+    /* A request that did not apply anything must not block the next
+     * click, which would otherwise be coalesced into it */
+    g_cancellable_cancel (req->cancellable);
+    g_object_unref (req->cancellable);
+    g_object_unref (req->shell_view);
+    g_free (req);
+}
+
+/* Partial output; @req stays alive until on_translate_finished */
+static void
+on_translate_stream (const TranslateStreamEvent *event,
+                     gpointer                    user_data)
+{
+    TranslateRequest *req = user_data;
+    translate_dom_stream_to_shell_view (req->shell_view, event);
 }
 
 static void
@@ -42,17 +66,57 @@ on_translate_finished (GObject      *source_object,
                        GAsyncResult *res,
                        gpointer      user_data)
 {
-    TranslateProvider *provider = (TranslateProvider*)source_object;
-    EShellView *shell_view = E_SHELL_VIEW (user_data);
+    TranslateRequest *req = user_data;
     g_autofree gchar *translated = NULL;
     g_autoptr(GError) error = NULL;
 
-    if (!translate_provider_translate_finish (provider, res, &translated, &error)) {
+    if (translate_common_translate_finish (res, &translated, &error)) {
+        EMailView *mail_view = NULL;
+
+        translate_dom_apply_to_shell_view (req->shell_view, translated,
+                                           translate_common_translate_is_partial (res));
+
+        g_object_get (e_shell_view_get_shell_content (req->shell_view), "mail-view", &mail_view, NULL);
+        if (mail_view) {
+            translate_prefetch_neighbours (E_MAIL_READER (mail_view));
+            g_object_unref (mail_view);
+        }
+    } else if (!g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
         g_warning ("Translate failed: %s", error ? error->message : "unknown error");
+
+    translate_request_free (req);
+}
+
+static void
+on_content_loaded (GObject      *source_object,
+                   GAsyncResult *res,
+                   gpointer      user_data)
+{
+    TranslateRequest *req = user_data;
+    g_autoptr(TranslateContent) content = NULL;
+    g_autoptr(GError) error = NULL;
+
+    content = translate_content_load_finish (res, &error);
+    if (!content || !content->body_html || !*content->body_html) {
+        if (!g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+            g_message ("[translate] No message body available to translate%s%s",
+                       error ? ": " : "", error ? error->message : "");
+        translate_request_free (req);
         return;
     }
 
-    translate_dom_apply_to_shell_view (shell_view, translated);
+    /* Use the centralized translation logic; on_translate_finished
+     * takes over the request */
+    if (req->whole)
+        translate_common_translate_whole_async (content->body_html, content->message_key,
+                                                (const gchar * const *) content->parent_keys, content->source_lang,
+                                                TRANSLATE_PRIORITY_INTERACTIVE, content->flags, on_translate_stream, req,
+                                                req->cancellable, on_translate_finished, req);
+    else
+        translate_common_translate_async (content->body_html, content->message_key,
+                                          (const gchar * const *) content->parent_keys, content->source_lang,
+                                          TRANSLATE_PRIORITY_INTERACTIVE, content->flags, on_translate_stream, req,
+                                          req->cancellable, on_translate_finished, req);
 }
 
 /**
@@ -61,33 +125,50 @@ on_translate_finished (GObject      *source_object,
  * @user_data: The EShellView instance
  *
  * Handles the "Translate Message" action from the menu/toolbar.
- * Extracts the current message body and initiates translation
- * using the common translation logic.
+ * Loads the current message body off the main thread, then initiates
+ * translation using the common translation logic. Selecting another
+ * message cancels the request; clicking again while it runs does nothing.
+ * A message translated only up to "max-translate-size" gets the rest
+ * translated instead of being toggled back.
  */
 static void
 action_translate_message_cb (GtkAction *action,
                              gpointer   user_data)
 {
     EShellView *shell_view = user_data;
+    TranslateRequest *req;
+    GCancellable *cancellable;
+    gboolean whole;
     g_return_if_fail (E_IS_SHELL_VIEW (shell_view));
 
     /* Toggle behavior: if already translated, restore original */
-    if (translate_dom_is_translated (shell_view)) {
+    whole = translate_dom_is_partial (shell_view);
+    if (!whole && translate_dom_is_translated (shell_view)) {
         translate_dom_restore_original (shell_view);
         return;
     }
-
-    /* Extract the message body HTML */
-    g_autofree gchar *body_html = get_selected_message_body_html (shell_view);
-    if (!body_html || !*body_html) {
-        g_message ("[translate] No message body available to translate");
+    if (!whole && translate_utils_get_translate_in_place ()) {
+        translate_dom_translate_in_place (shell_view);
         return;
     }
+    /* ...and back to the translation it already has */
+    if (!whole && translate_dom_show_translation (shell_view))
+        return;
 
-    /* Use the centralized translation logic (fixes memory leak) */
-    translate_common_translate_async (body_html,
-                                      on_translate_finished,
-                                      shell_view);
+    cancellable = translate_dom_begin_request (shell_view);
+    if (!cancellable)
+        return; /* Already translating this message */
+
+    req = g_new0 (TranslateRequest, 1);
+    req->shell_view = g_object_ref (shell_view);
+    req->cancellable = cancellable;
+    req->whole = whole;
+
+    /* Fetching may hit the network (IMAP), so it must not block the UI */
+    translate_content_load_from_shell_view_async (shell_view,
+                                                  req->cancellable,
+                                                  on_content_loaded,
+                                                  req);
 }
 
 static const GtkActionEntry translate_menu_action[] = {
@@ -125,6 +206,58 @@ static const GtkActionEntry translate_show_original_entries[] = {
       G_CALLBACK (action_show_original_cb) }
 };
 
+/* The shell view's reader, or NULL; (transfer none) */
+static EMailReader *
+get_mail_reader (EShellView *shell_view)
+{
+    EMailView *mail_view = NULL;
+
+    g_object_get (e_shell_view_get_shell_content (shell_view), "mail-view", &mail_view, NULL);
+    if (!mail_view)
+        return NULL;
+    /* The shell content keeps the view alive */
+    g_object_unref (mail_view);
+    return E_MAIL_READER (mail_view);
+}
+
+static void
+action_translate_selected_cb (GtkAction *action,
+                              gpointer   user_data)
+{
+    EMailReader *reader = get_mail_reader (user_data);
+
+    if (reader)
+        translate_bulk_start (reader, FALSE);
+}
+
+static void
+action_translate_folder_cb (GtkAction *action,
+                            gpointer   user_data)
+{
+    EMailReader *reader = get_mail_reader (user_data);
+
+    if (reader)
+        translate_bulk_start (reader, TRUE);
+}
+
+static const GtkActionEntry translate_selected_entries[] = {
+    { "translate-selected-action",
+      NULL,
+      N_("Translate Selected _Messages"),
+      NULL,
+      N_("Translate all selected messages in the background"),
+      G_CALLBACK (action_translate_selected_cb) }
+};
+
+static const GtkActionEntry translate_folder_entries[] = {
+    { "translate-folder-action",
+      NULL,
+      N_("Translate _Folder"),
+      NULL,
+      N_("Translate every message in this folder in the background"),
+      G_CALLBACK (action_translate_folder_cb) }
+};
+
 static void
 action_translate_settings_cb (GtkAction *action,
                               gpointer   user_data)
@@ -151,6 +284,7 @@ translate_mail_ui_update_actions_cb (EShellView *shell_view)
     EMailView *mail_view = NULL;
     GtkUIManager *ui_manager;
     gboolean has_message = FALSE;
+    gboolean has_folder = FALSE;
 
     /* Clear translation state if the displayed message has changed */
     translate_dom_clear_if_message_changed (shell_view);
@@ -159,9 +293,15 @@ translate_mail_ui_update_actions_cb (EShellView *shell_view)
     g_object_get (shell_content, "mail-view", &mail_view, NULL);
     if (E_IS_MAIL_PANED_VIEW (mail_view)) {
         GtkWidget *message_list;
+        CamelFolder *folder;
+        translate_prefetch_selection_changed (E_MAIL_READER (mail_view));
         message_list = e_mail_reader_get_message_list (E_MAIL_READER (mail_view));
         has_message = message_list_selected_count (MESSAGE_LIST (message_list)) > 0;
+        folder = e_mail_reader_ref_folder (E_MAIL_READER (mail_view));
+        has_folder = folder != NULL;
+        g_clear_object (&folder);
     }
+    g_clear_object (&mail_view);
 
     EShellWindow *sw = e_shell_view_get_shell_window (shell_view);
     ui_manager = sw ? e_shell_window_get_ui_manager (sw) : NULL;
@@ -170,6 +310,15 @@ translate_mail_ui_update_actions_cb (EShellView *shell_view)
                             G_N_ELEMENTS (translate_message_menu_entries),
                             has_message);
 
+    m_utils_enable_actions (ui_manager,
+                            translate_selected_entries,
+                            G_N_ELEMENTS (translate_selected_entries),
+                            has_message);
+    m_utils_enable_actions (ui_manager,
+                            translate_folder_entries,
+                            G_N_ELEMENTS (translate_folder_entries),
+                            has_folder);
+
     /* Enable 'Show Original' when a translation is currently applied */
     m_utils_enable_actions (ui_manager,
                             translate_show_original_entries,
@@ -191,6 +340,9 @@ translate_mail_ui_init (EShellView *shell_view)
         "      <menuitem action='translate-message-action'/>"
         "      <menuitem action='translate-show-original-action'/>"
         "      <separator/>"
+        "      <menuitem action='translate-selected-action'/>"
+        "      <menuitem action='translate-folder-action'/>"
+        "      <separator/>"
         "      <menuitem action='translate-settings-action'/>"
         "    </menu>"
         "  </menubar>"
@@ -221,6 +373,14 @@ translate_mail_ui_init (EShellView *shell_view)
                                   translate_show_original_entries,
                                   G_N_ELEMENTS (translate_show_original_entries),
                                   shell_view);
+    gtk_action_group_add_actions (group,
+                                  translate_selected_entries,
+                                  G_N_ELEMENTS (translate_selected_entries),
+                                  shell_view);
+    gtk_action_group_add_actions (group,
+                                  translate_folder_entries,
+                                  G_N_ELEMENTS (translate_folder_entries),
+                                  shell_view);
     gtk_action_group_add_actions (group,
                                   translate_settings_entries,
                                   G_N_ELEMENTS (translate_settings_entries),
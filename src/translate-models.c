@@ -0,0 +1,194 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-models.c
+ * Background downloads of missing Argos Translate models
+ *
+ * The translation helper never downloads: a request for a model that is
+ * not installed is answered at once with "model_pending", and the Argos
+ * provider asks for the model here. Downloads run in the helper pool of
+ * model_manager.py, apart from the translation helpers, so other
+ * languages keep translating. Each download is an EActivity of the mail
+ * backend. It can be cancelled from the status bar and gives up after
+ * MODEL_INSTALL_TIMEOUT.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <glib.h>
+#include <glib/gi18n-lib.h>
+#include <e-util/e-util.h>
+#include <shell/e-shell.h>
+
+#include "translate-models.h"
+#include "providers/translate-worker.h"
+
+/* Seconds before a download is given up; the index and a model are a
+ * few hundred MB at most */
+#define MODEL_INSTALL_TIMEOUT (15 * 60)
+
+typedef struct {
+    gchar        *key;          /* "source:target" */
+    gchar        *source_lang;
+    gchar        *target_lang;
+    EActivity    *activity;
+    GCancellable *cancellable;  /* The activity's */
+    guint         timeout_id;
+    gboolean      timed_out;
+} ModelInstall;
+
+/* key → ModelInstall*, running downloads */
+static GHashTable *s_installs;
+
+static gchar *
+model_key (const gchar *source_lang,
+           const gchar *target_lang)
+{
+    return g_strdup_printf ("%s:%s", source_lang, target_lang);
+}
+
+static void
+model_install_free (ModelInstall *install)
+{
+    g_clear_handle_id (&install->timeout_id, g_source_remove);
+    g_object_unref (install->cancellable);
+    g_object_unref (install->activity);
+    g_free (install->source_lang);
+    g_free (install->target_lang);
+    g_free (install->key);
+    g_free (install);
+}
+
+static gboolean
+on_install_timeout (gpointer user_data)
+{
+    ModelInstall *install = user_data;
+
+    install->timeout_id = 0;
+    install->timed_out = TRUE;
+    g_cancellable_cancel (install->cancellable);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+on_install_done (GObject      *source,
+                 GAsyncResult *res,
+                 gpointer      user_data)
+{
+    ModelInstall *install = user_data;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(JsonObject) response = translate_worker_request_finish (res, NULL, &error);
+
+    (void)source;
+
+    g_hash_table_remove (s_installs, install->key);
+
+    if (response) {
+        g_message ("[translate] Installed the %s → %s model", install->source_lang, install->target_lang);
+        e_activity_set_state (install->activity, E_ACTIVITY_COMPLETED);
+    } else if (install->timed_out) {
+        g_warning ("[translate] Gave up downloading the %s → %s model after %d minutes",
+                   install->source_lang, install->target_lang, MODEL_INSTALL_TIMEOUT / 60);
+        e_activity_set_state (install->activity, E_ACTIVITY_CANCELLED);
+    } else if (!e_activity_handle_cancellation (install->activity, error)) {
+        g_warning ("[translate] Could not install the %s → %s model: %s",
+                   install->source_lang, install->target_lang, error->message);
+        e_activity_set_text (install->activity, error->message);
+        e_activity_set_state (install->activity, E_ACTIVITY_COMPLETED);
+    }
+
+    model_install_free (install);
+}
+
+/* An activity in the mail window's status bar, without a reader to ask */
+static EActivity *
+model_new_activity (GCancellable *cancellable,
+                    const gchar  *text)
+{
+    EActivity *activity = e_activity_new ();
+    EShell *shell = e_shell_get_default ();
+    EShellBackend *backend = shell ? e_shell_get_backend_by_name (shell, "mail") : NULL;
+
+    e_activity_set_cancellable (activity, cancellable);
+    e_activity_set_text (activity, text);
+    if (backend)
+        e_shell_backend_add_activity (backend, activity);
+    return activity;
+}
+
+void
+translate_models_install (const gchar *source_lang,
+                          const gchar *target_lang)
+{
+    g_autoptr(GError) error = NULL;
+    g_autoptr(GCancellable) cancellable = NULL;
+    g_autofree gchar *text = NULL;
+    TranslateWorker *worker;
+    ModelInstall *install;
+
+    g_return_if_fail (source_lang != NULL);
+    g_return_if_fail (target_lang != NULL);
+
+    if (translate_models_is_pending (source_lang, target_lang))
+        return;
+
+    worker = translate_worker_get_shared ("model_manager.py", &error);
+    if (!worker) {
+        g_warning ("[translate] Cannot download models: %s", error->message);
+        return;
+    }
+
+    if (!s_installs)
+        s_installs = g_hash_table_new (g_str_hash, g_str_equal);
+
+    cancellable = g_cancellable_new ();
+    text = g_strdup_printf (_("Downloading the %s → %s translation model"), source_lang, target_lang);
+
+    install = g_new0 (ModelInstall, 1);
+    install->key = model_key (source_lang, target_lang);
+    install->source_lang = g_strdup (source_lang);
+    install->target_lang = g_strdup (target_lang);
+    install->cancellable = g_object_ref (cancellable);
+    install->activity = model_new_activity (cancellable, text);
+    install->timeout_id = g_timeout_add_seconds (MODEL_INSTALL_TIMEOUT, on_install_timeout, install);
+    g_hash_table_insert (s_installs, install->key, install);
+
+    g_autoptr(JsonObject) request = json_object_new ();
+    json_object_set_boolean_member (request, "install", TRUE);
+    json_object_set_string_member (request, "source", source_lang);
+    json_object_set_string_member (request, "target", target_lang);
+
+    g_message ("[translate] Downloading the %s → %s model in the background", source_lang, target_lang);
+    translate_worker_request_async (worker, request, cancellable, on_install_done, install);
+}
+
+gboolean
+translate_models_is_pending (const gchar *source_lang,
+                             const gchar *target_lang)
+{
+    g_autofree gchar *key = NULL;
+
+    if (!s_installs)
+        return FALSE;
+
+    key = model_key (source_lang, target_lang);
+    return g_hash_table_contains (s_installs, key);
+}
+
+void
+translate_models_shutdown (void)
+{
+    GHashTableIter iter;
+    gpointer value;
+
+    if (!s_installs)
+        return;
+
+    /* Each download frees itself once its cancellation has come back */
+    g_hash_table_iter_init (&iter, s_installs);
+    while (g_hash_table_iter_next (&iter, NULL, &value)) {
+        ModelInstall *install = value;
+        g_cancellable_cancel (install->cancellable);
+    }
+}
@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-models.h
+ * Background downloads of missing Argos Translate models
+ */
+
+#ifndef TRANSLATE_MODELS_H
+#define TRANSLATE_MODELS_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * translate_models_install:
+ * @source_lang: Source language code of the model
+ * @target_lang: Target language code of the model
+ *
+ * Downloads and installs the model in the model manager's own helper
+ * (tools/translate/model_manager.py), so translations keep being served
+ * meanwhile. Progress is shown as an #EActivity of the mail backend,
+ * which can also cancel the download. Does nothing if the same model is
+ * already on its way.
+ */
+void translate_models_install (const gchar *source_lang,
+                               const gchar *target_lang);
+
+/**
+ * translate_models_is_pending:
+ * @source_lang: Source language code of the model
+ * @target_lang: Target language code of the model
+ *
+ * Returns: %TRUE while the model is being downloaded or installed
+ */
+gboolean translate_models_is_pending (const gchar *source_lang,
+                                      const gchar *target_lang);
+
+/**
+ * translate_models_shutdown:
+ *
+ * Cancels every running download.
+ */
+void translate_models_shutdown (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_MODELS_H */
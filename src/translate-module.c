@@ -28,7 +28,45 @@
 #include "providers/translate-provider-google.h"
 #include "providers/translate-provider-mymemory.h"
 #include "providers/translate-provider-libre.h"
+#include "providers/translate-http.h"
 #include "providers/translate-provider.h"
+#include "providers/translate-worker.h"
+#include "translate-bulk.h"
+#include "translate-cache.h"
+#include "translate-incoming.h"
+#include "translate-models.h"
+#include "translate-prefetch.h"
+#include "translate-utils.h"
+
+/* Seconds after load before warming up, to stay out of Evolution's own
+ * start-up */
+#define WARM_START_DELAY 5
+
+static guint warm_start_id = 0;
+static guint incoming_start_id = 0;
+
+static gboolean
+warm_start_cb (gpointer user_data)
+{
+	TranslateProvider *provider = translate_provider_get_active ();
+	g_autofree gchar *target_lang = translate_utils_get_target_language ();
+
+	(void) user_data;
+	warm_start_id = 0;
+	if (provider && target_lang)
+		translate_provider_warm_up (provider, target_lang);
+	return G_SOURCE_REMOVE;
+}
+
+/* The mail backend and its folder cache exist by now */
+static gboolean
+incoming_start_cb (gpointer user_data)
+{
+	(void) user_data;
+	incoming_start_id = 0;
+	translate_incoming_start ();
+	return G_SOURCE_REMOVE;
+}
 
 /* Module Entry Points */
 void e_module_load (GTypeModule *type_module);
@@ -55,6 +93,16 @@ e_module_load (GTypeModule *type_module)
 	translate_provider_libre_type_register (type_module);
 	translate_provider_register (TRANSLATE_TYPE_PROVIDER_LIBRE);
 
+	/* Start the active provider before the first click, at idle priority */
+	if (translate_utils_get_warm_start ())
+		warm_start_id = g_timeout_add_seconds_full (G_PRIORITY_LOW, WARM_START_DELAY,
+		                                            warm_start_cb, NULL, NULL);
+
+	/* Watch for new mail to translate ahead; checks "pretranslate-enabled"
+	 * as messages arrive, so the setting can be switched at any time */
+	incoming_start_id = g_timeout_add_seconds_full (G_PRIORITY_LOW, WARM_START_DELAY,
+	                                                incoming_start_cb, NULL, NULL);
+
 	/* Log a message so automated checks can verify the module loaded */
 	g_message ("[translate] Module loaded with %d providers", 4);
 }
@@ -62,4 +110,16 @@ e_module_load (GTypeModule *type_module)
 G_MODULE_EXPORT void
 e_module_unload (GTypeModule *type_module)
 {
+	g_clear_handle_id (&warm_start_id, g_source_remove);
+	g_clear_handle_id (&incoming_start_id, g_source_remove);
+
+	/* Let resident helper processes exit with us */
+	translate_incoming_shutdown ();
+	translate_prefetch_shutdown ();
+	translate_bulk_shutdown ();
+	translate_models_shutdown ();
+	translate_worker_shutdown_all ();
+	translate_provider_registry_shutdown ();
+	translate_http_shutdown ();
+	translate_cache_shutdown ();
 }
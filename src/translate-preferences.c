@@ -10,7 +10,9 @@
 #include <gtk/gtk.h>
 
 #include "translate-preferences.h"
+#include "translate-stats.h"
 #include "translate-utils.h"
+#include "providers/translate-worker.h"
 
 typedef struct {
     const char *code;
@@ -29,6 +31,62 @@ static const Lang k_langs[] = {
     {"ja", N_("Japanese")}, {"ko", N_("Korean")}, {"zh", N_("Chinese")},
 };
 
+static void
+refresh_statistics (GtkLabel *label)
+{
+    g_autofree gchar *stats = translate_stats_format ();
+    g_autofree gchar *helpers = translate_worker_format_stats ();
+    g_autofree gchar *report = g_strconcat (stats, "\n", helpers, NULL);
+    gtk_label_set_text (label, report);
+}
+
+static void
+on_refresh_statistics_clicked (GtkButton *button,
+                               gpointer   user_data)
+{
+    (void)button;
+    refresh_statistics (GTK_LABEL (user_data));
+}
+
+static void
+on_reset_statistics_clicked (GtkButton *button,
+                             gpointer   user_data)
+{
+    (void)button;
+    translate_stats_reset ();
+    refresh_statistics (GTK_LABEL (user_data));
+}
+
+/* Latencies and counters of this session (see translate-stats.c), selectable
+ * so they can be pasted into a bug report */
+static GtkWidget *
+create_statistics_section (void)
+{
+    GtkWidget *expander = gtk_expander_new (_("Statistics"));
+    GtkWidget *box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 6);
+    GtkWidget *buttons = gtk_button_box_new (GTK_ORIENTATION_HORIZONTAL);
+    GtkWidget *label = gtk_label_new (NULL);
+    GtkWidget *refresh = gtk_button_new_with_label (_("Refresh"));
+    GtkWidget *reset = gtk_button_new_with_label (_("Reset"));
+
+    gtk_label_set_selectable (GTK_LABEL (label), TRUE);
+    gtk_label_set_xalign (GTK_LABEL (label), 0.0);
+    gtk_style_context_add_class (gtk_widget_get_style_context (label), "monospace");
+    refresh_statistics (GTK_LABEL (label));
+
+    g_signal_connect (refresh, "clicked", G_CALLBACK (on_refresh_statistics_clicked), label);
+    g_signal_connect (reset, "clicked", G_CALLBACK (on_reset_statistics_clicked), label);
+    gtk_button_box_set_layout (GTK_BUTTON_BOX (buttons), GTK_BUTTONBOX_END);
+    gtk_box_set_spacing (GTK_BOX (buttons), 6);
+    gtk_container_add (GTK_CONTAINER (buttons), refresh);
+    gtk_container_add (GTK_CONTAINER (buttons), reset);
+
+    gtk_container_add (GTK_CONTAINER (box), label);
+    gtk_container_add (GTK_CONTAINER (box), buttons);
+    gtk_container_add (GTK_CONTAINER (expander), box);
+    return expander;
+}
+
 void
 translate_preferences_show (GtkWindow *parent)
 {
@@ -80,6 +138,7 @@ translate_preferences_show (GtkWindow *parent)
     gtk_grid_attach (GTK_GRID (grid), lbl_venv, 0, 2, 1, 1);
     gtk_grid_attach (GTK_GRID (grid), venv_entry, 1, 2, 1, 1);
     gtk_grid_attach (GTK_GRID (grid), install_on_demand, 1, 3, 1, 1);
+    gtk_grid_attach (GTK_GRID (grid), create_statistics_section (), 0, 4, 2, 1);
 
     gtk_widget_show_all (dlg);
     if (gtk_dialog_run (GTK_DIALOG (dlg)) == GTK_RESPONSE_OK) {
@@ -0,0 +1,256 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-prefetch.c
+ * Speculative translation of the messages around the one being read
+ *
+ * When "prefetch-enabled" is set, translating a message also queues the
+ * "prefetch-count" messages before and after it in the message list at
+ * background priority. The results only land in the translation cache, so
+ * stepping to a neighbour with the arrow keys and translating it is
+ * answered at once. Each reader keeps one prefetch window; selecting a
+ * message outside of it cancels whatever is still outstanding.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <glib.h>
+#include <camel/camel.h>
+#include <e-util/e-util.h>
+#include <mail/message-list.h>
+
+#include "translate-prefetch.h"
+#include "translate-common.h"
+#include "translate-content.h"
+#include "translate-utils.h"
+
+typedef struct {
+    EMailReader  *reader;       /* Not referenced; watched with a weak ref */
+    GCancellable *cancellable;  /* Shared by every prefetch of the window */
+    GHashTable   *uids;         /* Messages already covered by the window */
+} PrefetchWindow;
+
+/* EMailReader* → PrefetchWindow* */
+static GHashTable *s_windows;
+
+static void
+prefetch_window_free (PrefetchWindow *window)
+{
+    g_cancellable_cancel (window->cancellable);
+    g_object_unref (window->cancellable);
+    g_hash_table_destroy (window->uids);
+    g_free (window);
+}
+
+static void
+on_reader_finalized (gpointer  data,
+                     GObject  *where_the_object_was)
+{
+    (void)data;
+    g_hash_table_remove (s_windows, where_the_object_was);
+}
+
+static void
+prefetch_window_drop (EMailReader *reader)
+{
+    if (!s_windows || !g_hash_table_contains (s_windows, reader))
+        return;
+
+    g_object_weak_unref (G_OBJECT (reader), on_reader_finalized, NULL);
+    g_hash_table_remove (s_windows, reader);
+}
+
+/* The first selected UID of @reader, or NULL */
+static gchar *
+dup_selected_uid (EMailReader *reader)
+{
+    g_autoptr(GPtrArray) uids = e_mail_reader_get_selected_uids (reader);
+
+    if (!uids || uids->len == 0)
+        return NULL;
+    return g_strdup (g_ptr_array_index (uids, 0));
+}
+
+/**
+ * collect_neighbours:
+ * @message_list: The reader's message list
+ * @uid: The message to look around
+ * @count: How many messages to take on each side
+ *
+ * Walks the message list in display order (sorting and threading as the
+ * user sees them), alternating after/before so the closest messages come
+ * first. Messages in collapsed threads have no row and are skipped.
+ *
+ * Returns: (transfer full) (element-type utf8): UIDs, nearest first
+ */
+static GPtrArray *
+collect_neighbours (MessageList *message_list,
+                    const gchar *uid,
+                    gint         count)
+{
+    GPtrArray *neighbours = g_ptr_array_new_with_free_func (g_free);
+    ETreeTableAdapter *adapter = e_tree_get_table_adapter (E_TREE (message_list));
+    ETreePath node = g_hash_table_lookup (message_list->uid_nodemap, uid);
+    gint row;
+
+    if (!node || (row = e_tree_table_adapter_row_of_node (adapter, node)) < 0)
+        return neighbours;
+
+    for (gint distance = 1; distance <= count; distance++) {
+        const gint rows[] = { row + distance, row - distance };
+
+        for (guint i = 0; i < G_N_ELEMENTS (rows); i++) {
+            GNode *neighbour;
+            CamelMessageInfo *info;
+
+            if (rows[i] < 0)
+                continue;
+            neighbour = e_tree_table_adapter_node_at_row (adapter, rows[i]);
+            info = neighbour ? neighbour->data : NULL;
+            if (info)
+                g_ptr_array_add (neighbours, g_strdup (camel_message_info_get_uid (info)));
+        }
+    }
+
+    return neighbours;
+}
+
+static void
+on_prefetch_translated (GObject      *source_object,
+                        GAsyncResult *res,
+                        gpointer      user_data)
+{
+    g_autoptr(GError) error = NULL;
+
+    (void)source_object;
+    (void)user_data;
+
+    /* translate-common has already put the result in the cache */
+    if (!translate_common_translate_finish (res, NULL, &error) &&
+        !g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        g_debug ("[translate] Prefetch failed: %s", error ? error->message : "unknown error");
+}
+
+static void
+on_prefetch_loaded (GObject      *source_object,
+                    GAsyncResult *res,
+                    gpointer      user_data)
+{
+    g_autoptr(GCancellable) cancellable = user_data;
+    g_autoptr(GError) error = NULL;
+    g_autoptr(TranslateContent) content = translate_content_load_finish (res, &error);
+
+    (void)source_object;
+
+    if (!content || !content->body_html || !*content->body_html ||
+        g_cancellable_is_cancelled (cancellable))
+        return;
+
+    translate_common_translate_async (content->body_html,
+                                      content->message_key,
+                                      (const gchar * const *) content->parent_keys,
+                                      content->source_lang,
+                                      TRANSLATE_PRIORITY_BACKGROUND,
+                                      content->flags,
+                                      NULL, NULL,  /* no partial output */
+                                      cancellable,
+                                      on_prefetch_translated,
+                                      NULL);
+}
+
+void
+translate_prefetch_neighbours (EMailReader *reader)
+{
+    g_autoptr(CamelFolder) folder = NULL;
+    g_autoptr(GPtrArray) neighbours = NULL;
+    g_autofree gchar *uid = NULL;
+    PrefetchWindow *window;
+    GtkWidget *message_list;
+    gint count;
+
+    g_return_if_fail (E_IS_MAIL_READER (reader));
+
+    if (!translate_utils_get_prefetch_enabled () ||
+        (count = translate_utils_get_prefetch_count ()) <= 0)
+        return;
+
+    message_list = e_mail_reader_get_message_list (reader);
+    folder = e_mail_reader_ref_folder (reader);
+    uid = dup_selected_uid (reader);
+    if (!message_list || !folder || !uid)
+        return;
+
+    if (!s_windows)
+        s_windows = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
+                                           (GDestroyNotify) prefetch_window_free);
+
+    /* Moving within the window keeps its work running and only extends it */
+    window = g_hash_table_lookup (s_windows, reader);
+    if (window && !g_hash_table_contains (window->uids, uid)) {
+        prefetch_window_drop (reader);
+        window = NULL;
+    }
+
+    if (!window) {
+        window = g_new0 (PrefetchWindow, 1);
+        window->reader = reader;
+        window->cancellable = g_cancellable_new ();
+        window->uids = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+        g_hash_table_add (window->uids, g_strdup (uid));
+        g_hash_table_insert (s_windows, reader, window);
+        g_object_weak_ref (G_OBJECT (reader), on_reader_finalized, NULL);
+    }
+
+    neighbours = collect_neighbours (MESSAGE_LIST (message_list), uid, count);
+    for (guint i = 0; i < neighbours->len; i++) {
+        const gchar *neighbour = g_ptr_array_index (neighbours, i);
+
+        if (g_hash_table_contains (window->uids, neighbour))
+            continue;
+
+        g_hash_table_add (window->uids, g_strdup (neighbour));
+        g_debug ("[translate] Prefetching translation of %s", neighbour);
+        translate_content_load_uid_async (folder,
+                                          neighbour,
+                                          window->cancellable,
+                                          on_prefetch_loaded,
+                                          g_object_ref (window->cancellable));
+    }
+}
+
+void
+translate_prefetch_selection_changed (EMailReader *reader)
+{
+    g_autofree gchar *uid = NULL;
+    PrefetchWindow *window;
+
+    g_return_if_fail (E_IS_MAIL_READER (reader));
+
+    window = s_windows ? g_hash_table_lookup (s_windows, reader) : NULL;
+    if (!window)
+        return;
+
+    uid = dup_selected_uid (reader);
+    if (uid && g_hash_table_contains (window->uids, uid))
+        return;
+
+    g_debug ("[translate] Selection left the prefetch window, cancelling prefetch");
+    prefetch_window_drop (reader);
+}
+
+void
+translate_prefetch_shutdown (void)
+{
+    GHashTableIter iter;
+    gpointer key;
+
+    if (!s_windows)
+        return;
+
+    g_hash_table_iter_init (&iter, s_windows);
+    while (g_hash_table_iter_next (&iter, &key, NULL))
+        g_object_weak_unref (G_OBJECT (key), on_reader_finalized, NULL);
+
+    g_clear_pointer (&s_windows, g_hash_table_destroy);
+}
@@ -0,0 +1,43 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-prefetch.h
+ * Speculative translation of the messages around the one being read
+ */
+
+#ifndef TRANSLATE_PREFETCH_H
+#define TRANSLATE_PREFETCH_H
+
+#include <glib.h>
+#include <mail/e-mail-reader.h>
+
+G_BEGIN_DECLS
+
+/**
+ * translate_prefetch_neighbours:
+ * @reader: The reader whose selected message was just translated
+ *
+ * Queues background translations of the messages around the selected one
+ * in @reader's message list, if the "prefetch-enabled" setting is on. The
+ * results go into the translation cache only.
+ */
+void translate_prefetch_neighbours (EMailReader *reader);
+
+/**
+ * translate_prefetch_selection_changed:
+ * @reader: A reader whose selection changed
+ *
+ * Cancels @reader's outstanding prefetches when the newly selected message
+ * is not one of those being prefetched.
+ */
+void translate_prefetch_selection_changed (EMailReader *reader);
+
+/**
+ * translate_prefetch_shutdown:
+ *
+ * Cancels every outstanding prefetch.
+ */
+void translate_prefetch_shutdown (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_PREFETCH_H */
@@ -0,0 +1,394 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-scheduler.c
+ * Bounded, prioritized queue in front of the translation providers
+ *
+ * Every reader window and the main shell view funnel their requests through
+ * here, so simultaneous clicks no longer start unbounded parallel work. The
+ * number of running translations is capped by the "max-workers" setting,
+ * which also sizes each provider's helper pool; everything else waits in
+ * one queue per priority. When more than one slot is available, background
+ * work never takes the last one, so an interactive request does not have
+ * to wait for a prefetch to finish. A queued job that is cancelled leaves
+ * its queue and completes at once, without waiting for a free slot.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <glib.h>
+#include "translate-scheduler.h"
+#include "translate-stats.h"
+#include "translate-utils.h"
+
+typedef struct {
+    TranslateProvider  *provider;
+    gchar              *input;
+    gchar             **inputs;      /* Batch jobs: plain-text segments */
+    guint               n_inputs;
+    gboolean            is_html;
+    gchar              *source_lang;
+    gchar              *target_lang;
+    TranslatePriority   priority;
+    TranslateStreamFunc stream_func;
+    gpointer            stream_data;
+    gint64              started;     /* Monotonic time the provider was called */
+    GSource            *cancel_source; /* Watches the cancellable while queued */
+} TranslateJob;
+
+/* Waiting jobs (GTask* carrying a TranslateJob), one queue per priority */
+static GQueue s_queues[TRANSLATE_N_PRIORITIES] = {
+    G_QUEUE_INIT, G_QUEUE_INIT
+};
+static guint s_running;
+static guint s_running_background;
+
+static void scheduler_dispatch (void);
+
+static void
+translate_job_free (TranslateJob *job)
+{
+    if (job->cancel_source) {
+        g_source_destroy (job->cancel_source);
+        g_source_unref (job->cancel_source);
+    }
+    g_clear_object (&job->provider);
+    g_free (job->input);
+    g_strfreev (job->inputs);
+    g_free (job->source_lang);
+    g_free (job->target_lang);
+    g_free (job);
+}
+
+/* Runs in the main loop when a queued job's cancellable fires */
+static gboolean
+on_queued_job_cancelled (GCancellable *cancellable,
+                         gpointer      user_data)
+{
+    GTask *task = user_data;
+    TranslateJob *job = g_task_get_task_data (task);
+
+    (void)cancellable;
+
+    g_clear_pointer (&job->cancel_source, g_source_unref);
+    if (g_queue_remove (&s_queues[job->priority], task)) {
+        g_debug ("[translate] Dropped cancelled queued job");
+        g_task_return_error_if_cancelled (task);
+        g_object_unref (task);
+    }
+    return G_SOURCE_REMOVE;
+}
+
+/* Queues @task, taking over the caller's reference */
+static void
+scheduler_enqueue (GTask *task)
+{
+    TranslateJob *job = g_task_get_task_data (task);
+    GCancellable *cancellable = g_task_get_cancellable (task);
+
+    if (cancellable) {
+        job->cancel_source = g_cancellable_source_new (cancellable);
+        g_source_set_callback (job->cancel_source, (GSourceFunc) on_queued_job_cancelled, task, NULL);
+        g_source_attach (job->cancel_source, NULL);
+    }
+
+    g_queue_push_tail (&s_queues[job->priority], task);
+    scheduler_dispatch ();
+}
+
+static GTask *
+scheduler_pop_next (guint limit)
+{
+    if (!g_queue_is_empty (&s_queues[TRANSLATE_PRIORITY_INTERACTIVE]))
+        return g_queue_pop_head (&s_queues[TRANSLATE_PRIORITY_INTERACTIVE]);
+
+    /* Keep one slot free for interactive requests */
+    if (limit > 1 && s_running_background >= limit - 1)
+        return NULL;
+
+    return g_queue_pop_head (&s_queues[TRANSLATE_PRIORITY_BACKGROUND]);
+}
+
+static void
+scheduler_release_slot (TranslateJob *job)
+{
+    s_running--;
+    if (job->priority == TRANSLATE_PRIORITY_BACKGROUND)
+        s_running_background--;
+}
+
+/* Records the provider call of a finished job; cancelled ones say nothing
+ * about the provider */
+static void
+scheduler_note_request (TranslateJob *job,
+                        gsize         bytes_out,
+                        const GError *error)
+{
+    gsize bytes_in = 0;
+
+    if (g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        return;
+
+    if (job->inputs) {
+        for (guint i = 0; i < job->n_inputs; i++)
+            bytes_in += strlen (job->inputs[i]);
+    } else {
+        bytes_in = strlen (job->input);
+    }
+    translate_stats_add_request (translate_provider_get_id (job->provider), job->started,
+                                 bytes_in, bytes_out, error == NULL);
+}
+
+static void
+on_job_done (GObject      *source,
+             GAsyncResult *res,
+             gpointer      user_data)
+{
+    GTask *task = G_TASK (user_data);
+    TranslateJob *job = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    gchar *translated = NULL;
+
+    scheduler_release_slot (job);
+
+    if (translate_provider_translate_finish (TRANSLATE_PROVIDER (source), res, &translated, &error)) {
+        scheduler_note_request (job, translated ? strlen (translated) : 0, NULL);
+        g_task_return_pointer (task, translated, g_free);
+    } else {
+        scheduler_note_request (job, 0, error);
+        g_task_return_error (task, g_steal_pointer (&error));
+    }
+    g_object_unref (task);
+
+    scheduler_dispatch ();
+}
+
+static void
+on_batch_job_done (GObject      *source,
+                   GAsyncResult *res,
+                   gpointer      user_data)
+{
+    GTask *task = G_TASK (user_data);
+    TranslateJob *job = g_task_get_task_data (task);
+    g_autoptr(GError) error = NULL;
+    gchar **translations = NULL;
+
+    scheduler_release_slot (job);
+
+    if (translate_provider_translate_batch_finish (TRANSLATE_PROVIDER (source), res, &translations, &error)) {
+        gsize bytes_out = 0;
+
+        for (guint i = 0; translations && translations[i]; i++)
+            bytes_out += strlen (translations[i]);
+        scheduler_note_request (job, bytes_out, NULL);
+        g_task_return_pointer (task, translations, (GDestroyNotify) g_strfreev);
+    } else {
+        scheduler_note_request (job, 0, error);
+        g_task_return_error (task, g_steal_pointer (&error));
+    }
+    g_object_unref (task);
+
+    scheduler_dispatch ();
+}
+
+static void
+scheduler_dispatch (void)
+{
+    guint limit = (guint) translate_utils_get_max_workers ();
+
+    while (s_running < limit) {
+        GTask *task = scheduler_pop_next (limit);
+        TranslateJob *job;
+
+        if (!task)
+            break;
+
+        /* Dropped while waiting: don't spend a slot on it */
+        if (g_task_return_error_if_cancelled (task)) {
+            g_object_unref (task);
+            continue;
+        }
+
+        job = g_task_get_task_data (task);
+        /* From here on the provider handles cancellation */
+        if (job->cancel_source) {
+            g_source_destroy (job->cancel_source);
+            g_clear_pointer (&job->cancel_source, g_source_unref);
+        }
+        s_running++;
+        if (job->priority == TRANSLATE_PRIORITY_BACKGROUND)
+            s_running_background++;
+        g_debug ("[translate] Starting %s job (%u running)",
+                 job->priority == TRANSLATE_PRIORITY_INTERACTIVE ? "interactive" : "background",
+                 s_running);
+        job->started = g_get_monotonic_time ();
+        if (job->inputs) {
+            translate_provider_translate_batch_async (job->provider,
+                                                      (const gchar * const *) job->inputs,
+                                                      job->n_inputs,
+                                                      job->source_lang,
+                                                      job->target_lang,
+                                                      g_task_get_cancellable (task),
+                                                      on_batch_job_done,
+                                                      task);
+            continue;
+        }
+        translate_provider_translate_stream_async (job->provider,
+                                                   job->input,
+                                                   job->is_html,
+                                                   job->source_lang,
+                                                   job->target_lang,
+                                                   job->stream_func,
+                                                   job->stream_data,
+                                                   g_task_get_cancellable (task),
+                                                   on_job_done,
+                                                   task);
+    }
+}
+
+void
+translate_scheduler_submit_async (TranslateProvider  *provider,
+                                  const gchar        *input,
+                                  gboolean            is_html,
+                                  const gchar        *source_lang_opt,
+                                  const gchar        *target_lang,
+                                  TranslatePriority   priority,
+                                  TranslateStreamFunc stream_func,
+                                  gpointer            stream_data,
+                                  GCancellable       *cancellable,
+                                  GAsyncReadyCallback callback,
+                                  gpointer            user_data)
+{
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (provider));
+    g_return_if_fail (input != NULL);
+    g_return_if_fail (target_lang != NULL);
+    g_return_if_fail (priority < TRANSLATE_N_PRIORITIES);
+
+    TranslateJob *job = g_new0 (TranslateJob, 1);
+    job->provider = g_object_ref (provider);
+    job->input = g_strdup (input);
+    job->is_html = is_html;
+    job->source_lang = g_strdup (source_lang_opt);
+    job->target_lang = g_strdup (target_lang);
+    job->priority = priority;
+    job->stream_func = stream_func;
+    job->stream_data = stream_data;
+
+    GTask *task = g_task_new (NULL, cancellable, callback, user_data);
+    g_task_set_source_tag (task, translate_scheduler_submit_async);
+    g_task_set_task_data (task, job, (GDestroyNotify) translate_job_free);
+
+    scheduler_enqueue (task);
+}
+
+void
+translate_scheduler_submit_batch_async (TranslateProvider   *provider,
+                                        const gchar * const *inputs,
+                                        guint                n_inputs,
+                                        const gchar         *source_lang_opt,
+                                        const gchar         *target_lang,
+                                        TranslatePriority    priority,
+                                        GCancellable        *cancellable,
+                                        GAsyncReadyCallback  callback,
+                                        gpointer             user_data)
+{
+    g_return_if_fail (TRANSLATE_IS_PROVIDER (provider));
+    g_return_if_fail (inputs != NULL || n_inputs == 0);
+    g_return_if_fail (target_lang != NULL);
+    g_return_if_fail (priority < TRANSLATE_N_PRIORITIES);
+
+    TranslateJob *job = g_new0 (TranslateJob, 1);
+    job->provider = g_object_ref (provider);
+    job->inputs = g_new0 (gchar *, n_inputs + 1);
+    for (guint i = 0; i < n_inputs; i++)
+        job->inputs[i] = g_strdup (inputs[i]);
+    job->n_inputs = n_inputs;
+    job->source_lang = g_strdup (source_lang_opt);
+    job->target_lang = g_strdup (target_lang);
+    job->priority = priority;
+
+    GTask *task = g_task_new (NULL, cancellable, callback, user_data);
+    g_task_set_source_tag (task, translate_scheduler_submit_batch_async);
+    g_task_set_task_data (task, job, (GDestroyNotify) translate_job_free);
+
+    scheduler_enqueue (task);
+}
+
+gboolean
+translate_scheduler_submit_batch_finish (GAsyncResult *res,
+                                         gchar      ***out_translations,
+                                         GError      **error)
+{
+    g_return_val_if_fail (g_task_is_valid (res, NULL), FALSE);
+
+    gchar **ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_translations)
+        *out_translations = ret;
+    else
+        g_strfreev (ret);
+    return ret != NULL;
+}
+
+void
+translate_scheduler_promote (GCancellable *cancellable)
+{
+    GQueue *background = &s_queues[TRANSLATE_PRIORITY_BACKGROUND];
+
+    g_return_if_fail (G_IS_CANCELLABLE (cancellable));
+
+    for (GList *l = background->head; l; l = l->next) {
+        GTask *task = l->data;
+        TranslateJob *job;
+
+        if (g_task_get_cancellable (task) != cancellable)
+            continue;
+
+        job = g_task_get_task_data (task);
+        job->priority = TRANSLATE_PRIORITY_INTERACTIVE;
+        g_queue_delete_link (background, l);
+        g_queue_push_tail (&s_queues[TRANSLATE_PRIORITY_INTERACTIVE], task);
+        g_debug ("[translate] Promoted queued background job");
+        scheduler_dispatch ();
+        return;
+    }
+}
+
+gboolean
+translate_scheduler_withdraw (GCancellable *cancellable)
+{
+    g_return_val_if_fail (G_IS_CANCELLABLE (cancellable), FALSE);
+
+    for (guint p = 0; p < TRANSLATE_N_PRIORITIES; p++) {
+        for (GList *l = s_queues[p].head; l; l = l->next) {
+            GTask *task = l->data;
+
+            if (g_task_get_cancellable (task) != cancellable)
+                continue;
+
+            g_queue_delete_link (&s_queues[p], l);
+            g_debug ("[translate] Withdrew queued job");
+            g_task_return_new_error (task, G_IO_ERROR, G_IO_ERROR_CANCELLED,
+                                     "Translation withdrawn");
+            g_object_unref (task);
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+gboolean
+translate_scheduler_submit_finish (GAsyncResult *res,
+                                   gchar       **out_translated,
+                                   GError      **error)
+{
+    g_return_val_if_fail (g_task_is_valid (res, NULL), FALSE);
+
+    gchar *ret = g_task_propagate_pointer (G_TASK (res), error);
+    if (out_translated)
+        *out_translated = ret;
+    else
+        g_free (ret);
+    return ret != NULL;
+}
@@ -0,0 +1,133 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-scheduler.h
+ * Bounded, prioritized queue in front of the translation providers
+ */
+
+#ifndef TRANSLATE_SCHEDULER_H
+#define TRANSLATE_SCHEDULER_H
+
+#include <glib.h>
+#include <gio/gio.h>
+#include "providers/translate-provider.h"
+
+G_BEGIN_DECLS
+
+/**
+ * TranslatePriority:
+ * @TRANSLATE_PRIORITY_INTERACTIVE: The user is waiting for the result
+ * @TRANSLATE_PRIORITY_BACKGROUND: Speculative or bulk work; runs only when
+ *   no interactive request is waiting
+ */
+typedef enum {
+    TRANSLATE_PRIORITY_INTERACTIVE,
+    TRANSLATE_PRIORITY_BACKGROUND,
+    TRANSLATE_N_PRIORITIES
+} TranslatePriority;
+
+/**
+ * translate_scheduler_submit_async:
+ * @provider: The provider that performs the translation
+ * @input: Text or HTML to translate
+ * @is_html: Whether @input is HTML
+ * @source_lang_opt: (nullable): Source language, or %NULL to auto-detect
+ * @target_lang: Target language code
+ * @priority: Queue to place the request in
+ * @stream_func: (nullable): Receives partial output, if the provider streams
+ * @stream_data: User data for @stream_func; must stay valid until @callback runs
+ * @cancellable: (nullable): Optional #GCancellable
+ * @callback: Callback to invoke when the translation completes
+ * @user_data: User data for @callback
+ *
+ * Queues a translation. At most "max-workers" translations run at the same
+ * time; queued interactive requests always start before background ones,
+ * and requests of the same priority start in submission order. Background
+ * jobs leave one slot free for interactive requests when "max-workers" > 1.
+ */
+void translate_scheduler_submit_async (TranslateProvider  *provider,
+                                       const gchar        *input,
+                                       gboolean            is_html,
+                                       const gchar        *source_lang_opt,
+                                       const gchar        *target_lang,
+                                       TranslatePriority   priority,
+                                       TranslateStreamFunc stream_func,
+                                       gpointer            stream_data,
+                                       GCancellable       *cancellable,
+                                       GAsyncReadyCallback callback,
+                                       gpointer            user_data);
+
+/**
+ * translate_scheduler_submit_batch_async:
+ * @provider: The provider that performs the translation
+ * @inputs: (array length=n_inputs): Plain-text segments to translate
+ * @n_inputs: Number of entries in @inputs
+ * @source_lang_opt: (nullable): Source language, or %NULL to auto-detect
+ * @target_lang: Target language code
+ * @priority: Queue to place the request in
+ * @cancellable: (nullable): Optional #GCancellable
+ * @callback: Callback to invoke when the batch completes
+ * @user_data: User data for @callback
+ *
+ * Like translate_scheduler_submit_async(), but the job is one
+ * translate_provider_translate_batch_async() call and takes one slot.
+ */
+void translate_scheduler_submit_batch_async (TranslateProvider   *provider,
+                                             const gchar * const *inputs,
+                                             guint                n_inputs,
+                                             const gchar         *source_lang_opt,
+                                             const gchar         *target_lang,
+                                             TranslatePriority    priority,
+                                             GCancellable        *cancellable,
+                                             GAsyncReadyCallback  callback,
+                                             gpointer             user_data);
+
+/**
+ * translate_scheduler_submit_batch_finish:
+ * @res: The #GAsyncResult passed to the callback
+ * @out_translations: (out) (transfer full): %NULL-terminated, one entry
+ *   per input
+ * @error: Return location for a #GError
+ *
+ * Returns: TRUE on success, FALSE if the batch failed or was cancelled
+ */
+gboolean translate_scheduler_submit_batch_finish (GAsyncResult *res,
+                                                  gchar      ***out_translations,
+                                                  GError      **error);
+
+/**
+ * translate_scheduler_promote:
+ * @cancellable: The #GCancellable a background job was submitted with
+ *
+ * Moves the queued background job submitted with @cancellable to the end
+ * of the interactive queue, for when the user starts waiting on work that
+ * was queued speculatively. Jobs that already started are unaffected.
+ */
+void translate_scheduler_promote (GCancellable *cancellable);
+
+/**
+ * translate_scheduler_withdraw:
+ * @cancellable: The #GCancellable a job was submitted with
+ *
+ * Drops the queued job submitted with @cancellable, which completes with
+ * %G_IO_ERROR_CANCELLED. A job that already started is left to finish,
+ * since cancelling it may also stop the helper it runs on.
+ *
+ * Returns: TRUE if the job was still queued
+ */
+gboolean translate_scheduler_withdraw (GCancellable *cancellable);
+
+/**
+ * translate_scheduler_submit_finish:
+ * @res: The #GAsyncResult passed to the callback
+ * @out_translated: (out) (transfer full): The translated text
+ * @error: Return location for a #GError
+ *
+ * Returns: TRUE on success, FALSE if the translation failed or was cancelled
+ */
+gboolean translate_scheduler_submit_finish (GAsyncResult *res,
+                                            gchar       **out_translated,
+                                            GError      **error);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_SCHEDULER_H */
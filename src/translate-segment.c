@@ -0,0 +1,615 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate HTML segmentation - the translatable text runs of a document
+ *
+ * Mail HTML is mostly markup: inline styles, tables and tracking links
+ * around comparatively little text. Rather than shipping the whole
+ * document to a helper that parses it again (once for language detection,
+ * once for translation), the document is tokenized here once. Only the
+ * text runs go to the provider, and the translations are spliced back
+ * into the original bytes, so everything else stays exactly as it was.
+ *
+ * This is a tokenizer, not a tree builder: it only needs to know where
+ * tags, comments and raw-text elements start and end.
+ *
+ * Very large documents are translated in windows (see translate-common.c)
+ * so no provider request, helper payload or response holds more than a
+ * window's worth. Windows end right before the token that follows a text
+ * run, which is where the tokenizer starts afresh anyway, so a window
+ * parsed on its own yields the same segments as the whole document.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <glib.h>
+
+#include "translate-segment.h"
+#include "providers/translate-provider.h"
+
+typedef struct {
+    gsize    start;   /* Byte range of the trimmed run in the original HTML */
+    gsize    end;
+    gchar   *text;    /* Decoded text */
+    gboolean quoted;  /* Inside <blockquote type="cite">, or a "> " line */
+} Segment;
+
+struct _TranslateSegments {
+    gchar  *html;
+    gsize   len;
+    GArray *segments;   /* Segment */
+};
+
+static void
+segment_clear (gpointer data)
+{
+    Segment *seg = data;
+    g_free (seg->text);
+}
+
+/* ============================================================================
+ * ENTITIES
+ * ============================================================================ */
+
+/* HTML 4 Latin-1 entities, which name U+00A0 to U+00FF in order */
+static const gchar * const latin1_entities[] = {
+    "nbsp", "iexcl", "cent", "pound", "curren", "yen", "brvbar", "sect",
+    "uml", "copy", "ordf", "laquo", "not", "shy", "reg", "macr",
+    "deg", "plusmn", "sup2", "sup3", "acute", "micro", "para", "middot",
+    "cedil", "sup1", "ordm", "raquo", "frac14", "frac12", "frac34", "iquest",
+    "Agrave", "Aacute", "Acirc", "Atilde", "Auml", "Aring", "AElig", "Ccedil",
+    "Egrave", "Eacute", "Ecirc", "Euml", "Igrave", "Iacute", "Icirc", "Iuml",
+    "ETH", "Ntilde", "Ograve", "Oacute", "Ocirc", "Otilde", "Ouml", "times",
+    "Oslash", "Ugrave", "Uacute", "Ucirc", "Uuml", "Yacute", "THORN", "szlig",
+    "agrave", "aacute", "acirc", "atilde", "auml", "aring", "aelig", "ccedil",
+    "egrave", "eacute", "ecirc", "euml", "igrave", "iacute", "icirc", "iuml",
+    "eth", "ntilde", "ograve", "oacute", "ocirc", "otilde", "ouml", "divide",
+    "oslash", "ugrave", "uacute", "ucirc", "uuml", "yacute", "thorn", "yuml"
+};
+
+/* Other entities that are common in mail */
+static const struct {
+    const gchar *name;
+    gunichar     ch;
+} other_entities[] = {
+    { "amp", '&' }, { "lt", '<' }, { "gt", '>' }, { "quot", '"' }, { "apos", '\'' },
+    { "euro", 0x20AC }, { "hellip", 0x2026 }, { "bull", 0x2022 }, { "trade", 0x2122 },
+    { "ndash", 0x2013 }, { "mdash", 0x2014 }, { "lsquo", 0x2018 }, { "rsquo", 0x2019 },
+    { "sbquo", 0x201A }, { "ldquo", 0x201C }, { "rdquo", 0x201D }, { "bdquo", 0x201E },
+    { "zwnj", 0x200C }, { "zwj", 0x200D }
+};
+
+static gunichar
+lookup_named_entity (const gchar *name,
+                     gsize        len)
+{
+    for (guint i = 0; i < G_N_ELEMENTS (latin1_entities); i++) {
+        if (strlen (latin1_entities[i]) == len && strncmp (latin1_entities[i], name, len) == 0)
+            return 0xA0 + i;
+    }
+    for (guint i = 0; i < G_N_ELEMENTS (other_entities); i++) {
+        if (strlen (other_entities[i].name) == len && strncmp (other_entities[i].name, name, len) == 0)
+            return other_entities[i].ch;
+    }
+    return 0;
+}
+
+/* Decodes the entity at @p (just after the '&'); on success appends the
+ * character to @out and returns the position after the ';' */
+static const gchar *
+decode_entity (const gchar *p,
+               const gchar *end,
+               GString     *out)
+{
+    const gchar *semi = memchr (p, ';', MIN ((gsize) (end - p), 32));
+    gunichar ch = 0;
+
+    if (!semi || semi == p)
+        return NULL;
+
+    if (*p == '#') {
+        g_autofree gchar *digits = g_strndup (p + 1, semi - p - 1);
+        gchar *tail = NULL;
+        guint64 value;
+
+        if (digits[0] == 'x' || digits[0] == 'X')
+            value = g_ascii_strtoull (digits + 1, &tail, 16);
+        else
+            value = g_ascii_strtoull (digits, &tail, 10);
+        if (!tail || *tail || value > 0x10FFFF)
+            return NULL;
+        ch = (gunichar) value;
+    } else {
+        ch = lookup_named_entity (p, semi - p);
+    }
+
+    if (!ch || !g_unichar_validate (ch))
+        return NULL;
+
+    g_string_append_unichar (out, ch);
+    return semi + 1;
+}
+
+/* The text of @html[start, end) with entities decoded */
+static gchar *
+decode_text (const gchar *start,
+             const gchar *end)
+{
+    GString *out = g_string_sized_new (end - start);
+    const gchar *p = start;
+
+    while (p < end) {
+        const gchar *amp = memchr (p, '&', end - p);
+        const gchar *next;
+
+        if (!amp) {
+            g_string_append_len (out, p, end - p);
+            break;
+        }
+        g_string_append_len (out, p, amp - p);
+        next = decode_entity (amp + 1, end, out);
+        if (next) {
+            p = next;
+        } else {
+            /* Not an entity we know; keep the ampersand literally */
+            g_string_append_c (out, '&');
+            p = amp + 1;
+        }
+    }
+
+    return g_string_free (out, FALSE);
+}
+
+/* ============================================================================
+ * SKIP RULES
+ * ============================================================================ */
+
+static gboolean
+looks_like_address (const gchar *text)
+{
+    if (strpbrk (text, " \t\r\n"))
+        return FALSE;
+
+    if (g_ascii_strncasecmp (text, "http://", 7) == 0 ||
+        g_ascii_strncasecmp (text, "https://", 8) == 0 ||
+        g_ascii_strncasecmp (text, "www.", 4) == 0 ||
+        g_ascii_strncasecmp (text, "mailto:", 7) == 0)
+        return TRUE;
+
+    /* user@example.com */
+    const gchar *at = strchr (text, '@');
+    return at && at != text && strchr (at, '.') != NULL;
+}
+
+/* Same rules as the helper scripts: at least two characters, at least one
+ * letter (so numbers, prices, dates and separators are left alone), and
+ * not a bare URL or address */
+static gboolean
+worth_translating (const gchar *text)
+{
+    gboolean has_letter = FALSE;
+
+    if (g_utf8_strlen (text, -1) < 2)
+        return FALSE;
+
+    for (const gchar *p = text; *p; p = g_utf8_next_char (p)) {
+        if (g_unichar_isalpha (g_utf8_get_char (p))) {
+            has_letter = TRUE;
+            break;
+        }
+    }
+
+    return has_letter && !looks_like_address (text);
+}
+
+/* ============================================================================
+ * TOKENIZER
+ * ============================================================================ */
+
+/* Tags that start or end a block; a window ending before one does not cut
+ * a paragraph in half */
+static const gchar * const block_elements[] = {
+    "p", "div", "br", "hr", "li", "ul", "ol", "dl", "dt", "dd", "tr", "table",
+    "tbody", "thead", "blockquote", "pre", "h1", "h2", "h3", "h4", "h5", "h6",
+    "section", "article", "header", "footer", "center"
+};
+
+/* Elements whose contents are not markup: code, or the document title
+ * (which a skeleton span would end up in verbatim) */
+static const gchar * const raw_text_elements[] = { "script", "style", "title" };
+
+static gboolean
+is_space (gchar c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f';
+}
+
+/* Case-insensitive search for @needle in [p, end) */
+static const gchar *
+find_ci (const gchar *p,
+         const gchar *end,
+         const gchar *needle)
+{
+    gsize n = strlen (needle);
+
+    for (; p + n <= end; p++) {
+        if (g_ascii_strncasecmp (p, needle, n) == 0)
+            return p;
+    }
+    return NULL;
+}
+
+/* End of the tag starting at @p ('<'), skipping quoted attribute values */
+static const gchar *
+skip_tag (const gchar *p,
+          const gchar *end)
+{
+    gchar quote = 0;
+
+    for (p++; p < end; p++) {
+        if (quote) {
+            if (*p == quote)
+                quote = 0;
+        } else if (*p == '"' || *p == '\'') {
+            quote = *p;
+        } else if (*p == '>') {
+            return p + 1;
+        }
+    }
+    return end;
+}
+
+static void
+add_run (TranslateSegments *segments,
+         const gchar       *start,
+         const gchar       *end,
+         gboolean           quoted)
+{
+    while (start < end && is_space (*start))
+        start++;
+    while (end > start && is_space (end[-1]))
+        end--;
+    if (start == end)
+        return;
+
+    g_autofree gchar *text = decode_text (start, end);
+    if (!worth_translating (text))
+        return;
+
+    Segment seg = {
+        .start = start - segments->html,
+        .end = end - segments->html,
+        .text = g_steal_pointer (&text),
+        .quoted = quoted || *start == '>' || strncmp (start, "&gt;", 4) == 0,
+    };
+    g_array_append_val (segments->segments, seg);
+}
+
+/* Whether the tag at @p ('<'), ending before @tag_end, has attribute
+ * @attr with the value @value, both compared case-insensitively */
+static gboolean
+tag_has_attr (const gchar *p,
+              const gchar *tag_end,
+              const gchar *attr,
+              const gchar *value)
+{
+    gsize attr_len = strlen (attr);
+    gsize value_len = strlen (value);
+
+    /* Skip the tag name */
+    for (p++; p < tag_end && !is_space (*p) && *p != '>' && *p != '/'; p++)
+        ;
+
+    while (p < tag_end) {
+        const gchar *name, *val = NULL;
+        gsize name_len, val_len = 0;
+
+        while (p < tag_end && (is_space (*p) || *p == '/'))
+            p++;
+        if (p >= tag_end || *p == '>')
+            break;
+
+        name = p;
+        while (p < tag_end && !is_space (*p) && *p != '=' && *p != '>' && *p != '/')
+            p++;
+        name_len = p - name;
+
+        while (p < tag_end && is_space (*p))
+            p++;
+        if (p < tag_end && *p == '=') {
+            for (p++; p < tag_end && is_space (*p); p++)
+                ;
+            if (p < tag_end && (*p == '"' || *p == '\'')) {
+                gchar quote = *p++;
+                val = p;
+                while (p < tag_end && *p != quote)
+                    p++;
+                val_len = p - val;
+                if (p < tag_end)
+                    p++;
+            } else {
+                val = p;
+                while (p < tag_end && !is_space (*p) && *p != '>')
+                    p++;
+                val_len = p - val;
+            }
+        }
+
+        if (name_len == attr_len && g_ascii_strncasecmp (name, attr, attr_len) == 0)
+            return val && val_len == value_len && g_ascii_strncasecmp (val, value, value_len) == 0;
+    }
+    return FALSE;
+}
+
+/* Tracks <blockquote> nesting at the tag at @p: @cites has bit N set if
+ * the blockquote at depth N is a citation (type="cite"). Returns whether
+ * text after the tag is quoted. */
+static gboolean
+track_blockquote (const gchar *p,
+                  const gchar *tag_end,
+                  guint       *depth,
+                  guint64     *cites)
+{
+    gboolean closing = p[1] == '/';
+    const gchar *name = closing ? p + 2 : p + 1;
+
+    if (g_ascii_strncasecmp (name, "blockquote", 10) == 0 && !g_ascii_isalnum (name[10])) {
+        if (closing && *depth > 0) {
+            (*depth)--;
+            if (*depth < 64)
+                *cites &= ~(G_GUINT64_CONSTANT (1) << *depth);
+        } else if (!closing) {
+            if (*depth < 64 && tag_has_attr (p, tag_end, "type", "cite"))
+                *cites |= G_GUINT64_CONSTANT (1) << *depth;
+            (*depth)++;
+        }
+    }
+    return *cites != 0;
+}
+
+TranslateSegments *
+translate_segments_parse (const gchar *html)
+{
+    TranslateSegments *segments = g_new0 (TranslateSegments, 1);
+    const gchar *p, *end, *run;
+    guint quote_depth = 0;
+    guint64 cites = 0;
+    gboolean quoted = FALSE;
+
+    segments->html = g_strdup (html ? html : "");
+    segments->len = strlen (segments->html);
+    segments->segments = g_array_new (FALSE, FALSE, sizeof (Segment));
+    g_array_set_clear_func (segments->segments, segment_clear);
+
+    p = run = segments->html;
+    end = segments->html + segments->len;
+
+    while (p < end) {
+        const gchar *next;
+
+        if (*p != '<') {
+            p++;
+            continue;
+        }
+
+        if (strncmp (p, "<!--", 4) == 0) {
+            const gchar *close = strstr (p + 4, "-->");
+            next = close ? close + 3 : end;
+        } else if (p[1] == '!' || p[1] == '?' || p[1] == '/' || g_ascii_isalpha (p[1])) {
+            next = skip_tag (p, end);
+
+            /* Raw text elements: no markup inside, and nothing to show */
+            for (guint i = 0; i < G_N_ELEMENTS (raw_text_elements); i++) {
+                const gchar *name = raw_text_elements[i];
+                gsize n = strlen (name);
+
+                if (g_ascii_strncasecmp (p + 1, name, n) == 0 && !g_ascii_isalnum (p[1 + n])) {
+                    g_autofree gchar *close_tag = g_strconcat ("</", name, NULL);
+                    const gchar *close = find_ci (next, end, close_tag);
+                    next = close ? skip_tag (close, end) : end;
+                    break;
+                }
+            }
+        } else {
+            /* A stray '<' is just text */
+            p++;
+            continue;
+        }
+
+        add_run (segments, run, p, quoted);
+        if (p[1] != '!')
+            quoted = track_blockquote (p, next, &quote_depth, &cites);
+        p = run = next;
+    }
+    add_run (segments, run, end, quoted);
+
+    return segments;
+}
+
+void
+translate_segments_free (TranslateSegments *segments)
+{
+    if (!segments)
+        return;
+    g_array_unref (segments->segments);
+    g_free (segments->html);
+    g_free (segments);
+}
+
+guint
+translate_segments_get_count (const TranslateSegments *segments)
+{
+    g_return_val_if_fail (segments != NULL, 0);
+    return segments->segments->len;
+}
+
+const gchar *
+translate_segments_get_text (const TranslateSegments *segments,
+                             guint                    index)
+{
+    g_return_val_if_fail (segments != NULL, NULL);
+    g_return_val_if_fail (index < segments->segments->len, NULL);
+    return g_array_index (segments->segments, Segment, index).text;
+}
+
+gboolean
+translate_segments_is_quoted (const TranslateSegments *segments,
+                              guint                    index)
+{
+    g_return_val_if_fail (segments != NULL, FALSE);
+    g_return_val_if_fail (index < segments->segments->len, FALSE);
+    return g_array_index (segments->segments, Segment, index).quoted;
+}
+
+gchar *
+translate_segments_build_skeleton (const TranslateSegments *segments)
+{
+    GString *out;
+    gsize pos = 0;
+
+    g_return_val_if_fail (segments != NULL, NULL);
+
+    out = g_string_sized_new (segments->len + segments->segments->len * 40);
+    for (guint i = 0; i < segments->segments->len; i++) {
+        const Segment *seg = &g_array_index (segments->segments, Segment, i);
+
+        g_string_append_len (out, segments->html + pos, seg->start - pos);
+        g_string_append_printf (out, "<span " TRANSLATE_STREAM_SEGMENT_ATTR "=\"%u\">", i);
+        g_string_append_len (out, segments->html + seg->start, seg->end - seg->start);
+        g_string_append (out, "</span>");
+        pos = seg->end;
+    }
+    g_string_append_len (out, segments->html + pos, segments->len - pos);
+
+    return g_string_free (out, FALSE);
+}
+
+gchar *
+translate_segments_rebuild (const TranslateSegments *segments,
+                            const gchar * const     *translations,
+                            guint                    n_translations)
+{
+    GString *out;
+    gsize pos = 0;
+
+    g_return_val_if_fail (segments != NULL, NULL);
+    g_return_val_if_fail (n_translations == segments->segments->len, NULL);
+
+    out = g_string_sized_new (segments->len);
+    for (guint i = 0; i < segments->segments->len; i++) {
+        const Segment *seg = &g_array_index (segments->segments, Segment, i);
+        const gchar *translated = translations ? translations[i] : NULL;
+
+        g_string_append_len (out, segments->html + pos, seg->start - pos);
+        if (translated && *translated) {
+            g_autofree gchar *escaped = g_markup_escape_text (translated, -1);
+            g_string_append (out, escaped);
+        } else {
+            g_string_append_len (out, segments->html + seg->start, seg->end - seg->start);
+        }
+        pos = seg->end;
+    }
+    g_string_append_len (out, segments->html + pos, segments->len - pos);
+
+    return g_string_free (out, FALSE);
+}
+
+/* ============================================================================
+ * WINDOWS
+ * ============================================================================ */
+
+/* Whether the tag at @p ('<') opens or closes a block-level element */
+static gboolean
+is_block_tag (const gchar *p)
+{
+    const gchar *name = p[1] == '/' ? p + 2 : p + 1;
+
+    for (guint i = 0; i < G_N_ELEMENTS (block_elements); i++) {
+        gsize n = strlen (block_elements[i]);
+
+        if (g_ascii_strncasecmp (name, block_elements[i], n) == 0 && !g_ascii_isalnum (name[n]))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* Where a window may end after segment @index: the token following it,
+ * or the end of the document if nothing does */
+static gsize
+window_cut_after (const TranslateSegments *segments,
+                  guint                    index)
+{
+    gsize cut = g_array_index (segments->segments, Segment, index).end;
+
+    while (cut < segments->len && is_space (segments->html[cut]))
+        cut++;
+    return cut;
+}
+
+static void
+add_window (GArray *windows,
+            gsize   offset,
+            gsize   end,
+            guint   first_segment,
+            guint   end_segment)
+{
+    TranslateWindow window = {
+        .offset = offset,
+        .length = end - offset,
+        .first_segment = first_segment,
+        .n_segments = end_segment - first_segment,
+    };
+    g_array_append_val (windows, window);
+}
+
+GArray *
+translate_segments_split_windows (const TranslateSegments *segments,
+                                  gsize                    max_bytes)
+{
+    GArray *windows;
+    guint count, first = 0;
+    gsize start = 0;
+
+    g_return_val_if_fail (segments != NULL, NULL);
+    g_return_val_if_fail (max_bytes > 0, NULL);
+
+    windows = g_array_new (FALSE, FALSE, sizeof (TranslateWindow));
+    count = segments->segments->len;
+
+    while (segments->len - start > max_bytes && first < count) {
+        gsize cut = 0, block_cut = 0;
+        guint end = first, block_end = first;
+
+        for (guint i = first; i < count; i++) {
+            gsize at = window_cut_after (segments, i);
+
+            if (at >= segments->len || at - start > max_bytes)
+                break;
+            cut = at;
+            end = i + 1;
+            if (is_block_tag (segments->html + at)) {
+                block_cut = at;
+                block_end = i + 1;
+            }
+        }
+
+        if (end == first) {
+            /* Not even the first run fits: it gets a window of its own */
+            cut = window_cut_after (segments, first);
+            end = first + 1;
+            if (cut >= segments->len)
+                break;
+        } else if (block_cut && block_cut - start >= max_bytes / 2) {
+            cut = block_cut;
+            end = block_end;
+        }
+
+        add_window (windows, start, cut, first, end);
+        start = cut;
+        first = end;
+    }
+
+    add_window (windows, start, segments->len, first, count);
+    return windows;
+}
@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/* Translate HTML segmentation - the translatable text runs of a document */
+
+#ifndef TRANSLATE_SEGMENT_H
+#define TRANSLATE_SEGMENT_H
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* A parsed document: the original HTML plus the byte ranges of its text
+ * runs worth translating, in document order. */
+typedef struct _TranslateSegments TranslateSegments;
+
+/* Tokenizes @html once and collects its translatable text runs. Markup,
+ * comments, <script>/<style>/<title> contents, runs without letters, URLs
+ * and e-mail addresses are left out. Never fails; malformed markup just
+ * ends up in fewer or larger runs. */
+TranslateSegments *translate_segments_parse (const gchar *html);
+
+void translate_segments_free (TranslateSegments *segments);
+
+guint translate_segments_get_count (const TranslateSegments *segments);
+
+/* The text of segment @index with entities decoded and surrounding
+ * whitespace removed, ready to hand to a translator. */
+const gchar *translate_segments_get_text (const TranslateSegments *segments,
+                                          guint                    index);
+
+/* Whether segment @index is quoted from an earlier message: inside a
+ * <blockquote type="cite">, or a plain-text line starting with '>'. */
+gboolean translate_segments_is_quoted (const TranslateSegments *segments,
+                                       guint                    index);
+
+/* Returns (transfer full) the document with each segment wrapped in
+ * <span data-translate-seg="N">, for progressive display. */
+gchar *translate_segments_build_skeleton (const TranslateSegments *segments);
+
+/* Returns (transfer full) the document with segment i replaced by the
+ * plain text @translations[i], escaped for HTML. @n_translations must
+ * match the segment count; NULL or empty entries keep the original. */
+gchar *translate_segments_rebuild (const TranslateSegments *segments,
+                                   const gchar * const     *translations,
+                                   guint                    n_translations);
+
+/* A slice of a parsed document for windowed translation: bytes [offset,
+ * offset + length) of the HTML, holding segments [first_segment,
+ * first_segment + n_segments). */
+typedef struct {
+    gsize offset;
+    gsize length;
+    guint first_segment;
+    guint n_segments;
+} TranslateWindow;
+
+/* Returns (transfer full) the windows, in order and covering the whole
+ * document, of at most @max_bytes each. Windows only end where a tag,
+ * comment or raw-text element follows a segment, preferably a block-level
+ * tag, so each one parses on its own into exactly its segments. A window
+ * grows past @max_bytes only for a single run (or markup) that long. */
+GArray *translate_segments_split_windows (const TranslateSegments *segments,
+                                          gsize                    max_bytes);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC (TranslateSegments, translate_segments_free)
+
+G_END_DECLS
+
+#endif /* TRANSLATE_SEGMENT_H */
@@ -0,0 +1,392 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-stats.c
+ * Per-stage latencies and rolling counters of the translation pipeline
+ *
+ * A slow translation can spend its time anywhere between fetching the
+ * message and WebKit laying out the result, so each stage reports how
+ * long it took: the message fetch, MIME decoding and language detection
+ * in translate-content.c, spawning helpers and reading their frames in
+ * translate-worker.c, HTTP round trips in translate-http.c, rendering in
+ * translate-dom.c, and whatever the helpers time themselves (imports,
+ * model loads, inference). The scheduler adds one request per provider
+ * call with the bytes sent and received.
+ *
+ * Providers also keep a smoothed latency and deviation, the way TCP
+ * times its retransmissions (RFC 6298); translate-common.c takes from
+ * them the deadline after which a second provider is asked too.
+ *
+ * Every series keeps its last STATS_WINDOW samples, from which the
+ * percentiles are taken, so the report follows the current behaviour
+ * rather than the whole session. With sysprof-capture every stage also
+ * becomes a mark in the "translate" group of a sysprof recording.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include <glib/gi18n-lib.h>
+#ifdef HAVE_SYSPROF
+#include <sysprof-capture.h>
+#endif
+
+#include "translate-stats.h"
+
+/* Samples per series the percentiles are taken from */
+#define STATS_WINDOW 256
+
+typedef struct {
+    gint64  samples[STATS_WINDOW];  /* Durations in microseconds, a ring */
+    guint   n_samples;
+    guint   next;
+    guint64 count;
+    guint64 failures;
+    guint64 bytes_in;
+    guint64 bytes_out;
+    gdouble srtt;    /* Smoothed latency, usec; 0 before the first sample */
+    gdouble rttvar;  /* Smoothed deviation from it */
+} StatsSeries;
+
+/* Guards everything below; stages are reported from worker threads too */
+static GMutex s_lock;
+static GHashTable *s_stages;     /* Stage name → StatsSeries* */
+static GHashTable *s_providers;  /* Provider id → StatsSeries* */
+static guint64 s_cache_hits;
+static guint64 s_cache_misses;
+static guint64 s_memory_hits;
+static guint64 s_memory_misses;
+static guint64 s_worker_restarts;
+static guint64 s_idle_stops;
+static guint64 s_low_memory_stops;
+static guint64 s_models_unloaded;
+static guint64 s_hedges;
+static guint64 s_hedges_won;
+
+/* Call with s_lock held */
+static StatsSeries *
+stats_series_get (GHashTable **table,
+                  const gchar *name)
+{
+    StatsSeries *series;
+
+    if (!*table)
+        *table = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+
+    series = g_hash_table_lookup (*table, name);
+    if (!series) {
+        series = g_new0 (StatsSeries, 1);
+        g_hash_table_insert (*table, g_strdup (name), series);
+    }
+    return series;
+}
+
+static void
+stats_series_add (StatsSeries *series,
+                  gint64       duration_usec)
+{
+    series->samples[series->next] = MAX (duration_usec, 0);
+    series->next = (series->next + 1) % STATS_WINDOW;
+    series->n_samples = MIN (series->n_samples + 1, STATS_WINDOW);
+    series->count++;
+}
+
+static void
+stats_mark (const gchar *stage,
+            gint64       begin_usec,
+            gint64       duration_usec)
+{
+#ifdef HAVE_SYSPROF
+    sysprof_collector_mark (begin_usec * 1000, duration_usec * 1000, "translate", stage, NULL);
+#else
+    (void)stage;
+    (void)begin_usec;
+    (void)duration_usec;
+#endif
+}
+
+void
+translate_stats_add_stage (const gchar *stage,
+                           gint64       begin_usec)
+{
+    gint64 duration = g_get_monotonic_time () - begin_usec;
+
+    g_return_if_fail (stage != NULL);
+
+    stats_mark (stage, begin_usec, duration);
+
+    g_mutex_lock (&s_lock);
+    stats_series_add (stats_series_get (&s_stages, stage), duration);
+    g_mutex_unlock (&s_lock);
+}
+
+void
+translate_stats_add_request (const gchar *provider_id,
+                             gint64       begin_usec,
+                             gsize        bytes_in,
+                             gsize        bytes_out,
+                             gboolean     ok)
+{
+    gint64 duration = g_get_monotonic_time () - begin_usec;
+    StatsSeries *series;
+
+    g_return_if_fail (provider_id != NULL);
+
+    stats_mark (provider_id, begin_usec, duration);
+
+    g_mutex_lock (&s_lock);
+    series = stats_series_get (&s_providers, provider_id);
+    series->bytes_in += bytes_in;
+    series->bytes_out += bytes_out;
+    if (ok) {
+        stats_series_add (series, duration);
+        if (series->srtt == 0) {
+            series->srtt = duration;
+            series->rttvar = duration / 2.0;
+        } else {
+            series->rttvar = 0.75 * series->rttvar + 0.25 * ABS (series->srtt - duration);
+            series->srtt = 0.875 * series->srtt + 0.125 * duration;
+        }
+    } else {
+        series->count++;
+        series->failures++;
+    }
+    g_mutex_unlock (&s_lock);
+}
+
+gint64
+translate_stats_get_latency_estimate (const gchar *provider_id)
+{
+    const StatsSeries *series;
+    gint64 estimate = 0;
+
+    g_return_val_if_fail (provider_id != NULL, 0);
+
+    g_mutex_lock (&s_lock);
+    series = s_providers ? g_hash_table_lookup (s_providers, provider_id) : NULL;
+    if (series && series->srtt > 0)
+        estimate = (gint64) (series->srtt + 4 * series->rttvar);
+    g_mutex_unlock (&s_lock);
+
+    return estimate;
+}
+
+void
+translate_stats_add_hedge (gboolean secondary_won)
+{
+    g_mutex_lock (&s_lock);
+    s_hedges++;
+    if (secondary_won)
+        s_hedges_won++;
+    g_mutex_unlock (&s_lock);
+}
+
+void
+translate_stats_add_cache_lookup (gboolean hit)
+{
+    g_mutex_lock (&s_lock);
+    if (hit)
+        s_cache_hits++;
+    else
+        s_cache_misses++;
+    g_mutex_unlock (&s_lock);
+}
+
+void
+translate_stats_add_memory_lookups (guint64 hits,
+                                    guint64 misses)
+{
+    g_mutex_lock (&s_lock);
+    s_memory_hits += hits;
+    s_memory_misses += misses;
+    g_mutex_unlock (&s_lock);
+}
+
+void
+translate_stats_add_worker_restart (void)
+{
+    g_mutex_lock (&s_lock);
+    s_worker_restarts++;
+    g_mutex_unlock (&s_lock);
+}
+
+void
+translate_stats_add_helper_stop (gboolean low_memory)
+{
+    g_mutex_lock (&s_lock);
+    if (low_memory)
+        s_low_memory_stops++;
+    else
+        s_idle_stops++;
+    g_mutex_unlock (&s_lock);
+}
+
+void
+translate_stats_add_models_unloaded (guint count)
+{
+    g_mutex_lock (&s_lock);
+    s_models_unloaded += count;
+    g_mutex_unlock (&s_lock);
+}
+
+void
+translate_stats_add_helper_timings (JsonObject *timings)
+{
+    g_autoptr(GList) members = NULL;
+    gint64 now = g_get_monotonic_time ();
+
+    g_return_if_fail (timings != NULL);
+
+    members = json_object_get_members (timings);
+    for (GList *l = members; l; l = l->next) {
+        const gchar *name = l->data;
+        JsonNode *node = json_object_get_member (timings, name);
+        g_autofree gchar *stage = NULL;
+        gint64 duration;
+
+        if (!JSON_NODE_HOLDS_VALUE (node))
+            continue;
+
+        duration = (gint64) (json_node_get_double (node) * 1000.0);
+        stage = g_strconcat ("helper:", name, NULL);
+        stats_mark (stage, now - duration, duration);
+
+        g_mutex_lock (&s_lock);
+        stats_series_add (stats_series_get (&s_stages, stage), duration);
+        g_mutex_unlock (&s_lock);
+    }
+}
+
+static gint
+compare_gint64 (gconstpointer a,
+                gconstpointer b)
+{
+    gint64 x = *(const gint64 *) a, y = *(const gint64 *) b;
+
+    return x < y ? -1 : x > y;
+}
+
+/* Fills in the 50th and 95th percentile of @series, in microseconds */
+static void
+stats_series_percentiles (const StatsSeries *series,
+                          gint64            *p50,
+                          gint64            *p95)
+{
+    gint64 sorted[STATS_WINDOW];
+    guint n = series->n_samples;
+
+    *p50 = *p95 = 0;
+    if (n == 0)
+        return;
+
+    memcpy (sorted, series->samples, n * sizeof (gint64));
+    qsort (sorted, n, sizeof (gint64), compare_gint64);
+    *p50 = sorted[(n - 1) / 2];
+    *p95 = sorted[(n - 1) * 95 / 100];
+}
+
+static gchar *
+format_duration (gint64 usec)
+{
+    if (usec < 10000)
+        return g_strdup_printf ("%.1f ms", usec / 1000.0);
+    if (usec < 10000000)
+        return g_strdup_printf ("%" G_GINT64_FORMAT " ms", usec / 1000);
+    return g_strdup_printf ("%.1f s", usec / 1000000.0);
+}
+
+static void
+format_ratio (GString     *out,
+              const gchar *label,
+              guint64      hits,
+              guint64      misses)
+{
+    guint64 total = hits + misses;
+
+    if (total == 0) {
+        g_string_append_printf (out, "%-16s%s\n", label, _("no lookups"));
+        return;
+    }
+    g_string_append_printf (out, "%-16s%" G_GUINT64_FORMAT "/%" G_GUINT64_FORMAT " (%.0f%%)\n",
+                            label, hits, total, 100.0 * (gdouble) hits / (gdouble) total);
+}
+
+/* Call with s_lock held */
+static void
+format_series (GString    *out,
+               GHashTable *table,
+               gboolean    with_bytes)
+{
+    g_autoptr(GList) names = table ? g_hash_table_get_keys (table) : NULL;
+
+    names = g_list_sort (names, (GCompareFunc) g_strcmp0);
+    for (GList *l = names; l; l = l->next) {
+        const StatsSeries *series = g_hash_table_lookup (table, l->data);
+        g_autofree gchar *p50_text = NULL;
+        g_autofree gchar *p95_text = NULL;
+        gint64 p50, p95;
+
+        stats_series_percentiles (series, &p50, &p95);
+        p50_text = format_duration (p50);
+        p95_text = format_duration (p95);
+        g_string_append_printf (out, "%-18s%6" G_GUINT64_FORMAT "  %9s  %9s",
+                                (const gchar *) l->data, series->count, p50_text, p95_text);
+        if (with_bytes) {
+            g_autofree gchar *in_text = g_format_size (series->bytes_in);
+            g_autofree gchar *out_text = g_format_size (series->bytes_out);
+
+            g_string_append_printf (out, "  %10s  %10s  %6" G_GUINT64_FORMAT,
+                                    in_text, out_text, series->failures);
+        }
+        g_string_append_c (out, '\n');
+    }
+}
+
+gchar *
+translate_stats_format (void)
+{
+    GString *out = g_string_new (NULL);
+
+    g_mutex_lock (&s_lock);
+
+    g_string_append_printf (out, "%-18s%6s  %9s  %9s  %10s  %10s  %6s\n",
+                            _("Provider"), _("Runs"), "p50", "p95", _("Sent"), _("Received"), _("Failed"));
+    format_series (out, s_providers, TRUE);
+
+    g_string_append_printf (out, "\n%-18s%6s  %9s  %9s\n", _("Stage"), _("Runs"), "p50", "p95");
+    format_series (out, s_stages, FALSE);
+
+    g_string_append_c (out, '\n');
+    format_ratio (out, _("Message cache:"), s_cache_hits, s_cache_misses);
+    format_ratio (out, _("Segment memory:"), s_memory_hits, s_memory_misses);
+    g_string_append_printf (out, "%-16s%" G_GUINT64_FORMAT "\n", _("Helper restarts:"), s_worker_restarts);
+    if (s_idle_stops + s_low_memory_stops > 0)
+        g_string_append_printf (out, "%-16s%" G_GUINT64_FORMAT " %s, %" G_GUINT64_FORMAT " %s\n",
+                                _("Helper stops:"), s_idle_stops, _("idle"), s_low_memory_stops, _("low memory"));
+    if (s_models_unloaded > 0)
+        g_string_append_printf (out, "%-16s%" G_GUINT64_FORMAT "\n", _("Models unloaded:"), s_models_unloaded);
+    if (s_hedges > 0)
+        g_string_append_printf (out, "%-16s%" G_GUINT64_FORMAT " (%" G_GUINT64_FORMAT " %s)\n",
+                                _("Hedged:"), s_hedges, s_hedges_won, _("answered by the second provider"));
+
+    g_mutex_unlock (&s_lock);
+
+    return g_string_free (out, FALSE);
+}
+
+void
+translate_stats_reset (void)
+{
+    g_mutex_lock (&s_lock);
+    g_clear_pointer (&s_stages, g_hash_table_unref);
+    g_clear_pointer (&s_providers, g_hash_table_unref);
+    s_cache_hits = s_cache_misses = 0;
+    s_memory_hits = s_memory_misses = 0;
+    s_worker_restarts = 0;
+    s_idle_stops = s_low_memory_stops = s_models_unloaded = 0;
+    s_hedges = s_hedges_won = 0;
+    g_mutex_unlock (&s_lock);
+}
@@ -0,0 +1,105 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-stats.h
+ * Per-stage latencies and rolling counters of the translation pipeline
+ */
+
+#ifndef TRANSLATE_STATS_H
+#define TRANSLATE_STATS_H
+
+#include <glib.h>
+#include <json-glib/json-glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * translate_stats_add_stage:
+ * @stage: Static stage name, e.g. "fetch", "decode", "detect", "spawn",
+ *   "parse", "http" or "render"
+ * @begin_usec: g_get_monotonic_time() when the stage started; it ends now
+ *
+ * Records one run of @stage, as a sysprof mark too when the module is
+ * built with sysprof-capture. Safe to call from any thread.
+ */
+void translate_stats_add_stage (const gchar *stage,
+                                gint64       begin_usec);
+
+/**
+ * translate_stats_add_request:
+ * @provider_id: The provider that served the request
+ * @begin_usec: g_get_monotonic_time() when the provider was called
+ * @bytes_in: Size of the text sent
+ * @bytes_out: Size of the translation, 0 on failure
+ * @ok: Whether the provider returned a translation
+ *
+ * Records one translation request. Only successful requests count
+ * towards the provider's latency percentiles.
+ */
+void translate_stats_add_request (const gchar *provider_id,
+                                  gint64       begin_usec,
+                                  gsize        bytes_in,
+                                  gsize        bytes_out,
+                                  gboolean     ok);
+
+/**
+ * translate_stats_get_latency_estimate:
+ * @provider_id: A provider ID
+ *
+ * A deadline most successful requests to @provider_id meet: its smoothed
+ * latency plus four times the smoothed deviation, as TCP's
+ * retransmission timer.
+ *
+ * Returns: The estimate in microseconds, or 0 before the first sample
+ */
+gint64 translate_stats_get_latency_estimate (const gchar *provider_id);
+
+/* Records a request that was also given to a second provider, and
+ * whether that one answered first */
+void translate_stats_add_hedge (gboolean secondary_won);
+
+/* Records a lookup in the whole-message cache */
+void translate_stats_add_cache_lookup (gboolean hit);
+
+/* Records segments answered (or not) by a helper's translation memory */
+void translate_stats_add_memory_lookups (guint64 hits,
+                                         guint64 misses);
+
+/* Records a helper process that died and had to be replaced */
+void translate_stats_add_worker_restart (void);
+
+/* Records a helper stopped after sitting idle, or because the system
+ * was low on memory */
+void translate_stats_add_helper_stop (gboolean low_memory);
+
+/* Records models a helper unloaded to stay within its memory budget */
+void translate_stats_add_models_unloaded (guint count);
+
+/**
+ * translate_stats_add_helper_timings:
+ * @timings: The "timings" object of a helper response: milliseconds
+ *   spent per stage, e.g. "import", "detect", "load", "inference"
+ *
+ * Records the stages a helper timed itself, as "helper:<stage>". The
+ * helper does not say when they started, so their sysprof marks end
+ * when the response arrived.
+ */
+void translate_stats_add_helper_timings (JsonObject *timings);
+
+/**
+ * translate_stats_format:
+ *
+ * Summarizes everything recorded since start-up or the last
+ * translate_stats_reset(): p50/p95 per provider and stage over the
+ * most recent samples, bytes sent and received, the cache hit rates
+ * and helper restarts.
+ *
+ * Returns: (transfer full): A multi-line report for a monospace label
+ */
+gchar *translate_stats_format (void);
+
+/* Forgets every sample and counter */
+void translate_stats_reset (void);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_STATS_H */
@@ -0,0 +1,236 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-thread.c
+ * Reuse of earlier translations for the quotes of replies
+ *
+ * Each reply in a long thread quotes the messages before it, so
+ * translating the thread message by message would translate the oldest
+ * text over and over. Every translated message therefore leaves its
+ * segment translations in the translation cache, keyed by its message
+ * key, provider and target language. A reply names the messages it
+ * answers in In-Reply-To and References; its quoted segments (see
+ * translate_segments_is_quoted()) are looked up there, and only the rest
+ * of the reply is sent to the provider.
+ *
+ * Segments are matched on their text with the quote markers stripped
+ * and white space collapsed, which is how HTML quotes and plain-text
+ * quotes that kept the line breaks reproduce the original. A quote that
+ * re-wrapped the lines simply misses and is translated as new text.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <glib.h>
+
+#include "translate-thread.h"
+#include "translate-cache.h"
+
+/* A kept message is a list of "source UNIT translation RECORD" */
+#define THREAD_UNIT   '\x1f'
+#define THREAD_RECORD '\x1e'
+
+/* How far up the thread to look; the nearest parents quote the most */
+#define THREAD_MAX_PARENTS 8
+
+static gchar *
+thread_cache_key (const gchar *message_key,
+                  const gchar *provider_id,
+                  const gchar *target_lang)
+{
+    return translate_cache_make_key (message_key, "\x1ethread-segments", provider_id, target_lang);
+}
+
+/* @text without its leading quote markers ("> ", ">> ", "> > ") and with
+ * runs of white space made single spaces; @out_marker_len gets the length
+ * of the markers, to put them back in front of a translation */
+static gchar *
+thread_normalize (const gchar *text,
+                  gsize       *out_marker_len)
+{
+    const gchar *p = text;
+    GString *out;
+    gboolean space = FALSE;
+
+    while (*p == '>' || g_ascii_isspace (*p))
+        p++;
+    if (out_marker_len)
+        *out_marker_len = p - text;
+
+    out = g_string_sized_new (strlen (p));
+    for (; *p; p++) {
+        if (g_ascii_isspace (*p)) {
+            space = TRUE;
+            continue;
+        }
+        if (space && out->len > 0)
+            g_string_append_c (out, ' ');
+        space = FALSE;
+        g_string_append_c (out, *p);
+    }
+    return g_string_free (out, FALSE);
+}
+
+void
+translate_thread_remember (const gchar             *message_key,
+                           const gchar             *provider_id,
+                           const gchar             *target_lang,
+                           const TranslateSegments *segments,
+                           const gchar * const     *translations)
+{
+    g_autofree gchar *key = NULL;
+    GString *record;
+    guint count;
+
+    g_return_if_fail (segments != NULL);
+
+    if (!message_key || !provider_id || !target_lang || !translations)
+        return;
+
+    count = translate_segments_get_count (segments);
+    record = g_string_new (NULL);
+    for (guint i = 0; i < count; i++) {
+        g_autofree gchar *source = NULL;
+        g_autofree gchar *translated = NULL;
+
+        if (!translations[i] || !*translations[i])
+            continue;
+
+        source = thread_normalize (translate_segments_get_text (segments, i), NULL);
+        translated = thread_normalize (translations[i], NULL);
+        if (!*source || !*translated ||
+            strchr (source, THREAD_UNIT) || strchr (source, THREAD_RECORD) ||
+            strchr (translated, THREAD_UNIT) || strchr (translated, THREAD_RECORD))
+            continue;
+
+        g_string_append (record, source);
+        g_string_append_c (record, THREAD_UNIT);
+        g_string_append (record, translated);
+        g_string_append_c (record, THREAD_RECORD);
+    }
+
+    if (record->len > 0) {
+        key = thread_cache_key (message_key, provider_id, target_lang);
+        translate_cache_store (key, record->str);
+    }
+    g_string_free (record, TRUE);
+}
+
+void
+translate_thread_remember_html (const gchar *message_key,
+                                const gchar *provider_id,
+                                const gchar *target_lang,
+                                const gchar *body_html,
+                                const gchar *translated_html)
+{
+    g_autoptr(TranslateSegments) source = NULL;
+    g_autoptr(TranslateSegments) translated = NULL;
+    g_autoptr(GPtrArray) texts = NULL;
+    guint count;
+
+    if (!message_key || !body_html || !translated_html)
+        return;
+
+    /* Segments are spliced back in place, so a well-behaved provider's
+     * translation has exactly the segments of its source */
+    source = translate_segments_parse (body_html);
+    translated = translate_segments_parse (translated_html);
+    count = translate_segments_get_count (source);
+    if (count == 0 || count != translate_segments_get_count (translated))
+        return;
+
+    texts = g_ptr_array_sized_new (count);
+    for (guint i = 0; i < count; i++)
+        g_ptr_array_add (texts, (gpointer) translate_segments_get_text (translated, i));
+
+    translate_thread_remember (message_key, provider_id, target_lang, source,
+                               (const gchar * const *) texts->pdata);
+}
+
+/* Adds the segments kept for @message_key to @memory, keeping entries
+ * already there (from nearer parents) */
+static void
+thread_load (GHashTable  *memory,
+             const gchar *message_key,
+             const gchar *provider_id,
+             const gchar *target_lang)
+{
+    g_autofree gchar *key = thread_cache_key (message_key, provider_id, target_lang);
+    g_autofree gchar *record = translate_cache_peek (key);
+    gchar *p;
+
+    for (p = record; p && *p;) {
+        gchar *unit = strchr (p, THREAD_UNIT);
+        gchar *end = unit ? strchr (unit + 1, THREAD_RECORD) : NULL;
+
+        if (!end)
+            break;
+        *unit = *end = '\0';
+        if (!g_hash_table_contains (memory, p))
+            g_hash_table_insert (memory, g_strdup (p), g_strdup (unit + 1));
+        p = end + 1;
+    }
+}
+
+GPtrArray *
+translate_thread_reuse (const gchar * const     *parent_keys,
+                        const gchar             *provider_id,
+                        const gchar             *target_lang,
+                        const TranslateSegments *segments,
+                        guint                   *out_reused)
+{
+    g_autoptr(GHashTable) memory = NULL;
+    GPtrArray *translations;
+    guint count, reused = 0;
+    gboolean any_quoted = FALSE;
+
+    g_return_val_if_fail (segments != NULL, NULL);
+    g_return_val_if_fail (out_reused != NULL, NULL);
+
+    *out_reused = 0;
+    if (!parent_keys || !*parent_keys)
+        return NULL;
+
+    /* Loading the parents costs cache lookups; a reply without quotes
+     * does not need them */
+    count = translate_segments_get_count (segments);
+    for (guint i = 0; i < count && !any_quoted; i++)
+        any_quoted = translate_segments_is_quoted (segments, i);
+    if (!any_quoted)
+        return NULL;
+
+    memory = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+    for (guint i = 0; parent_keys[i] && i < THREAD_MAX_PARENTS; i++)
+        thread_load (memory, parent_keys[i], provider_id, target_lang);
+    if (g_hash_table_size (memory) == 0)
+        return NULL;
+
+    translations = g_ptr_array_new_full (count, g_free);
+    for (guint i = 0; i < count; i++) {
+        const gchar *text = translate_segments_get_text (segments, i);
+        g_autofree gchar *normalized = NULL;
+        const gchar *hit = NULL;
+        gsize marker_len = 0;
+
+        if (translate_segments_is_quoted (segments, i)) {
+            normalized = thread_normalize (text, &marker_len);
+            hit = g_hash_table_lookup (memory, normalized);
+        }
+        if (hit) {
+            /* The quote markers stay in front of the translation */
+            g_ptr_array_add (translations, g_strdup_printf ("%.*s%s", (gint) marker_len, text, hit));
+            reused++;
+        } else {
+            g_ptr_array_add (translations, NULL);
+        }
+    }
+
+    if (reused == 0) {
+        g_ptr_array_unref (translations);
+        return NULL;
+    }
+    *out_reused = reused;
+    return translations;
+}
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/**
+ * translate-thread.h
+ * Reuse of earlier translations for the quotes of replies
+ */
+
+#ifndef TRANSLATE_THREAD_H
+#define TRANSLATE_THREAD_H
+
+#include <glib.h>
+
+#include "translate-segment.h"
+
+G_BEGIN_DECLS
+
+/**
+ * translate_thread_remember:
+ * @message_key: The message's key, as in #TranslateContent
+ * @provider_id: The provider that translated it
+ * @target_lang: The target language
+ * @segments: The message's parsed body
+ * @translations: The translation of each of @segments, NULL where none
+ *
+ * Keeps the segment translations of a translated message, in the
+ * translation cache, for replies that quote it.
+ */
+void translate_thread_remember (const gchar             *message_key,
+                                const gchar             *provider_id,
+                                const gchar             *target_lang,
+                                const TranslateSegments *segments,
+                                const gchar * const     *translations);
+
+/**
+ * translate_thread_remember_html:
+ * @message_key: The message's key, as in #TranslateContent
+ * @provider_id: The provider that translated it
+ * @target_lang: The target language
+ * @body_html: The message's body
+ * @translated_html: Its translation
+ *
+ * Like translate_thread_remember(), for a translation that came back as
+ * a document. Nothing is kept if the two do not have the same segments.
+ */
+void translate_thread_remember_html (const gchar *message_key,
+                                     const gchar *provider_id,
+                                     const gchar *target_lang,
+                                     const gchar *body_html,
+                                     const gchar *translated_html);
+
+/**
+ * translate_thread_reuse:
+ * @parent_keys: Keys of the messages @segments may quote, nearest first
+ * @provider_id: The provider that is to translate @segments
+ * @target_lang: The target language
+ * @segments: The parsed body of a reply
+ * @out_reused: (out): Number of segments translated from @parent_keys
+ *
+ * Looks the quoted segments of a reply up in what
+ * translate_thread_remember() kept for the messages it answers.
+ *
+ * Returns: (transfer full) (nullable): The translation of each of
+ *   @segments, NULL for those still to translate, or %NULL if no quote
+ *   was found
+ */
+GPtrArray *translate_thread_reuse (const gchar * const     *parent_keys,
+                                   const gchar             *provider_id,
+                                   const gchar             *target_lang,
+                                   const TranslateSegments *segments,
+                                   guint                   *out_reused);
+
+G_END_DECLS
+
+#endif /* TRANSLATE_THREAD_H */
@@ -99,6 +99,273 @@ translate_utils_get_install_on_demand (void)
     return TRUE;
 }
 
+/**
+ * translate_utils_get_model_fallback:
+ *
+ * Gets the ID of the provider that translates while an Argos model
+ * downloads in the background.
+ *
+ * Returns: (transfer full): The provider ID, or an empty string if none is set
+ */
+gchar *
+translate_utils_get_model_fallback (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_string (provider_settings, "model-fallback");
+    }
+
+    return g_strdup ("");
+}
+
+/**
+ * translate_utils_get_hedge_provider:
+ *
+ * Gets the ID of the provider that is asked too when the active one is
+ * slow to answer an interactive request.
+ *
+ * Returns: (transfer full): The provider ID, or an empty string if none is set
+ */
+gchar *
+translate_utils_get_hedge_provider (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_string (provider_settings, "hedge-provider");
+    }
+
+    return g_strdup ("");
+}
+
+/**
+ * translate_utils_get_hedge_delay:
+ *
+ * Gets how long the active provider has before the "hedge-provider" is
+ * asked too.
+ *
+ * Returns: The delay in milliseconds; 0 derives it from the provider's
+ *          recent latency
+ */
+gint
+translate_utils_get_hedge_delay (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_int (provider_settings, "hedge-delay");
+    }
+
+    return 0;
+}
+
+/**
+ * translate_utils_is_private_account:
+ * @uid: (nullable): UID of a mail account's store
+ *
+ * Gets whether @uid is listed in "private-accounts", whose messages are
+ * never handed to an online provider the user did not choose.
+ *
+ * Returns: TRUE if the account is private
+ */
+gboolean
+translate_utils_is_private_account (const gchar *uid)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+    g_auto(GStrv) uids = NULL;
+
+    if (!uid || !provider_settings) {
+        return FALSE;
+    }
+
+    uids = g_settings_get_strv (provider_settings, "private-accounts");
+    return g_strv_contains ((const gchar * const *) uids, uid);
+}
+
+/**
+ * translate_utils_get_max_batch_tokens:
+ *
+ * Gets how many tokens the Argos helper passes to the model per batch.
+ *
+ * Returns: The configured batch size in tokens; 0 leaves it to the helper
+ */
+gint
+translate_utils_get_max_batch_tokens (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_int (provider_settings, "max-batch-tokens");
+    }
+
+    return 0;
+}
+
+/**
+ * translate_utils_get_inter_threads:
+ *
+ * Gets how many batches CTranslate2 translates in parallel in each Argos
+ * helper.
+ *
+ * Returns: The thread count; 0 leaves it to the helper
+ */
+gint
+translate_utils_get_inter_threads (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_int (provider_settings, "inter-threads");
+    }
+
+    return 0;
+}
+
+/**
+ * translate_utils_get_intra_threads:
+ *
+ * Gets how many threads CTranslate2 uses for each batch in an Argos helper.
+ *
+ * Returns: The thread count; 0 leaves it to the helper
+ */
+gint
+translate_utils_get_intra_threads (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_int (provider_settings, "intra-threads");
+    }
+
+    return 0;
+}
+
+/**
+ * translate_utils_get_compute_type:
+ *
+ * Gets the CTranslate2 compute type the Argos models run with.
+ *
+ * Returns: (transfer full): The compute type, e.g. "int8" or "float16",
+ *          or "auto" for the fastest one the device supports
+ */
+gchar *
+translate_utils_get_compute_type (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_string (provider_settings, "compute-type");
+    }
+
+    return g_strdup ("auto");
+}
+
+/**
+ * translate_utils_get_beam_size:
+ *
+ * Gets the beam size the Argos helper decodes with.
+ *
+ * Returns: The beam size; 0 leaves it to the helper
+ */
+gint
+translate_utils_get_beam_size (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_int (provider_settings, "beam-size");
+    }
+
+    return 0;
+}
+
+/**
+ * translate_utils_get_model_memory_budget:
+ *
+ * Gets how much memory an Argos helper may use before it unloads its
+ * least recently used models.
+ *
+ * Returns: The budget in MiB; 0 keeps every model loaded
+ */
+gint
+translate_utils_get_model_memory_budget (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_int (provider_settings, "model-memory-budget");
+    }
+
+    return 2048;
+}
+
+/**
+ * translate_utils_get_native_http:
+ *
+ * Gets whether online providers send their requests directly over HTTP.
+ *
+ * Returns: TRUE (the default) to use the built-in HTTP client, FALSE to
+ *          go through the Python helper
+ */
+gboolean
+translate_utils_get_native_http (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_boolean (provider_settings, "native-http");
+    }
+
+    return TRUE;
+}
+
+/**
+ * translate_utils_get_libre_url:
+ *
+ * Gets the base URL of the LibreTranslate server. Falls back to the
+ * LIBRE_TRANSLATE_URL environment variable the Python helper also reads.
+ *
+ * Returns: (transfer full): The base URL. Free with g_free() when done.
+ */
+gchar *
+translate_utils_get_libre_url (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+    g_autofree gchar *url = NULL;
+    const gchar *env;
+
+    if (provider_settings) {
+        url = g_settings_get_string (provider_settings, "libre-url");
+    }
+
+    if (url && *url) {
+        return g_steal_pointer (&url);
+    }
+
+    env = g_getenv ("LIBRE_TRANSLATE_URL");
+    return g_strdup (env && *env ? env : "https://libretranslate.de");
+}
+
+/**
+ * translate_utils_get_libre_api_key:
+ *
+ * Gets the API key for the LibreTranslate server.
+ *
+ * Returns: (transfer full): The key, or an empty string if none is set
+ */
+gchar *
+translate_utils_get_libre_api_key (void)
+{
+    GSettings *provider_settings = translate_utils_get_provider_settings ();
+
+    if (provider_settings) {
+        return g_settings_get_string (provider_settings, "libre-api-key");
+    }
+
+    return g_strdup ("");
+}
+
 /**
  * translate_utils_get_provider_id:
  *
@@ -126,3 +393,219 @@ translate_utils_get_provider_id (void)
 
     return g_strdup ("google");
 }
+
+/**
+ * translate_utils_get_max_workers:
+ *
+ * Gets the maximum number of concurrent translations from GSettings.
+ * The scheduler never runs more requests than this at once, and each
+ * provider keeps at most this many helper processes alive.
+ *
+ * Returns: The configured limit (at least 1), or 2 as default
+ */
+gint
+translate_utils_get_max_workers (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return MAX (1, g_settings_get_int (settings, "max-workers"));
+    }
+
+    return 2;
+}
+
+/**
+ * translate_utils_get_worker_idle_timeout:
+ *
+ * Gets how long a helper process may sit idle before it is stopped.
+ *
+ * Returns: The timeout in seconds; 0 never stops idle helpers
+ */
+gint
+translate_utils_get_worker_idle_timeout (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return MAX (0, g_settings_get_int (settings, "worker-idle-timeout"));
+    }
+
+    return 900;
+}
+
+/**
+ * translate_utils_get_cache_memory_size:
+ *
+ * Gets the in-memory translation cache budget from GSettings.
+ *
+ * Returns: The budget in MiB (0 disables the tier), or 16 as default
+ */
+gint
+translate_utils_get_cache_memory_size (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return MAX (0, g_settings_get_int (settings, "cache-memory-size"));
+    }
+
+    return 16;
+}
+
+/**
+ * translate_utils_get_cache_disk_size:
+ *
+ * Gets the on-disk translation cache budget from GSettings.
+ *
+ * Returns: The budget in MiB (0 disables the tier), or 64 as default
+ */
+gint
+translate_utils_get_cache_disk_size (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return MAX (0, g_settings_get_int (settings, "cache-disk-size"));
+    }
+
+    return 64;
+}
+
+/**
+ * translate_utils_get_prefetch_enabled:
+ *
+ * Gets whether neighbouring messages are translated in the background.
+ *
+ * Returns: TRUE if prefetching is enabled, FALSE (the default) otherwise
+ */
+gboolean
+translate_utils_get_prefetch_enabled (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return g_settings_get_boolean (settings, "prefetch-enabled");
+    }
+
+    return FALSE;
+}
+
+/**
+ * translate_utils_get_prefetch_count:
+ *
+ * Gets how many messages on each side of a translated one are prefetched.
+ *
+ * Returns: The configured count, or 2 as default
+ */
+gint
+translate_utils_get_prefetch_count (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return MAX (0, g_settings_get_int (settings, "prefetch-count"));
+    }
+
+    return 2;
+}
+
+/**
+ * translate_utils_get_pretranslate_enabled:
+ *
+ * Gets whether new mail in the "pretranslate-folders" or from the
+ * "pretranslate-senders" is translated in the background as it arrives.
+ *
+ * Returns: TRUE if enabled, FALSE (the default) otherwise
+ */
+gboolean
+translate_utils_get_pretranslate_enabled (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return g_settings_get_boolean (settings, "pretranslate-enabled");
+    }
+
+    return FALSE;
+}
+
+/**
+ * translate_utils_get_warm_start:
+ *
+ * Gets whether the active provider is prepared in the background when
+ * Evolution starts.
+ *
+ * Returns: TRUE if warm start is enabled, FALSE (the default) otherwise
+ */
+gboolean
+translate_utils_get_warm_start (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return g_settings_get_boolean (settings, "warm-start");
+    }
+
+    return FALSE;
+}
+
+/**
+ * translate_utils_get_translate_in_place:
+ *
+ * Gets whether messages are translated in place, as they are scrolled
+ * into view, rather than replaced by a translated copy.
+ *
+ * Returns: TRUE if in-place translation is enabled, FALSE (the default)
+ * otherwise
+ */
+gboolean
+translate_utils_get_translate_in_place (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return g_settings_get_boolean (settings, "translate-in-place");
+    }
+
+    return FALSE;
+}
+
+/**
+ * translate_utils_get_window_size:
+ *
+ * Gets the size of the windows larger messages are translated in.
+ *
+ * Returns: The window size in bytes, 256 KiB by default, or 0 to send
+ * messages whole
+ */
+gsize
+translate_utils_get_window_size (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return (gsize) MAX (0, g_settings_get_int (settings, "window-size")) * 1024;
+    }
+
+    return 256 * 1024;
+}
+
+/**
+ * translate_utils_get_max_translate_size:
+ *
+ * Gets how much of a message is translated before asking to continue.
+ *
+ * Returns: The limit in bytes, 1 MiB by default, or 0 for no limit
+ */
+gsize
+translate_utils_get_max_translate_size (void)
+{
+    GSettings *settings = translate_utils_get_settings ();
+
+    if (settings) {
+        return (gsize) MAX (0, g_settings_get_int (settings, "max-translate-size")) * 1024;
+    }
+
+    return 1024 * 1024;
+}
@@ -53,6 +53,122 @@ GSettings *translate_utils_get_provider_settings (void);
  */
 gboolean translate_utils_get_install_on_demand (void);
 
+/**
+ * translate_utils_get_model_fallback:
+ *
+ * Gets the provider that translates while an Argos model downloads.
+ *
+ * Returns: (transfer full): The provider ID, or an empty string for none
+ */
+gchar *translate_utils_get_model_fallback (void);
+
+/**
+ * translate_utils_get_hedge_provider:
+ *
+ * Gets the provider asked too when the active one is slow.
+ *
+ * Returns: (transfer full): The provider ID, or an empty string for none
+ */
+gchar *translate_utils_get_hedge_provider (void);
+
+/**
+ * translate_utils_get_hedge_delay:
+ *
+ * Gets how long the active provider has before the hedge provider is
+ * asked too.
+ *
+ * Returns: The delay in milliseconds, or 0 to derive it from latency
+ */
+gint translate_utils_get_hedge_delay (void);
+
+/**
+ * translate_utils_is_private_account:
+ * @uid: (nullable): UID of a mail account's store
+ *
+ * Returns: TRUE if @uid is listed in "private-accounts"
+ */
+gboolean translate_utils_is_private_account (const gchar *uid);
+
+/**
+ * translate_utils_get_max_batch_tokens:
+ *
+ * Gets how many tokens the Argos helper passes to the model per batch.
+ *
+ * Returns: The batch size in tokens, or 0 for the helper's default
+ */
+gint translate_utils_get_max_batch_tokens (void);
+
+/**
+ * translate_utils_get_inter_threads:
+ *
+ * Gets how many batches CTranslate2 translates in parallel per helper.
+ *
+ * Returns: The thread count, or 0 for the helper's choice
+ */
+gint translate_utils_get_inter_threads (void);
+
+/**
+ * translate_utils_get_intra_threads:
+ *
+ * Gets how many threads CTranslate2 uses per batch.
+ *
+ * Returns: The thread count, or 0 for the helper's choice
+ */
+gint translate_utils_get_intra_threads (void);
+
+/**
+ * translate_utils_get_compute_type:
+ *
+ * Returns: (transfer full): The CTranslate2 compute type, or "auto"
+ */
+gchar *translate_utils_get_compute_type (void);
+
+/**
+ * translate_utils_get_beam_size:
+ *
+ * Gets the beam size the Argos helper decodes with.
+ *
+ * Returns: The beam size, or 0 for the helper's choice
+ */
+gint translate_utils_get_beam_size (void);
+
+/**
+ * translate_utils_get_model_memory_budget:
+ *
+ * Gets how much memory an Argos helper may use before it unloads its
+ * least recently used models.
+ *
+ * Returns: The budget in MiB (0 = unlimited), or 2048 as default
+ */
+gint translate_utils_get_model_memory_budget (void);
+
+/**
+ * translate_utils_get_native_http:
+ *
+ * Gets whether online providers send their requests directly over HTTP.
+ *
+ * Returns: TRUE (the default) to use the built-in HTTP client, FALSE to
+ *          go through the Python helper
+ */
+gboolean translate_utils_get_native_http (void);
+
+/**
+ * translate_utils_get_libre_url:
+ *
+ * Gets the base URL of the LibreTranslate server.
+ *
+ * Returns: (transfer full): The configured URL, else $LIBRE_TRANSLATE_URL,
+ *          else "https://libretranslate.de"
+ */
+gchar *translate_utils_get_libre_url (void);
+
+/**
+ * translate_utils_get_libre_api_key:
+ *
+ * Returns: (transfer full): The LibreTranslate API key, or an empty string
+ */
+gchar *translate_utils_get_libre_api_key (void);
+
 /**
  * translate_utils_get_provider_id:
  *
@@ -64,6 +180,109 @@ gboolean translate_utils_get_install_on_demand (void);
  */
 gchar *translate_utils_get_provider_id (void);
 
+/**
+ * translate_utils_get_max_workers:
+ *
+ * Gets the maximum number of concurrent translations from GSettings.
+ * This bounds both the request scheduler and each provider's helper pool.
+ *
+ * Returns: The configured limit, or 2 as default
+ */
+gint translate_utils_get_max_workers (void);
+
+/**
+ * translate_utils_get_worker_idle_timeout:
+ *
+ * Gets how long a helper process may sit idle before it is stopped.
+ *
+ * Returns: The timeout in seconds (0 = never), or 900 as default
+ */
+gint translate_utils_get_worker_idle_timeout (void);
+
+/**
+ * translate_utils_get_cache_memory_size:
+ *
+ * Gets the in-memory translation cache budget from GSettings.
+ *
+ * Returns: The budget in MiB (0 disables the tier), or 16 as default
+ */
+gint translate_utils_get_cache_memory_size (void);
+
+/**
+ * translate_utils_get_cache_disk_size:
+ *
+ * Gets the on-disk translation cache budget from GSettings.
+ *
+ * Returns: The budget in MiB (0 disables the tier), or 64 as default
+ */
+gint translate_utils_get_cache_disk_size (void);
+
+/**
+ * translate_utils_get_prefetch_enabled:
+ *
+ * Gets whether neighbouring messages are translated in the background.
+ *
+ * Returns: TRUE if prefetching is enabled, FALSE (the default) otherwise
+ */
+gboolean translate_utils_get_prefetch_enabled (void);
+
+/**
+ * translate_utils_get_prefetch_count:
+ *
+ * Gets how many messages on each side of a translated one are prefetched.
+ *
+ * Returns: The configured count, or 2 as default
+ */
+gint translate_utils_get_prefetch_count (void);
+
+/**
+ * translate_utils_get_pretranslate_enabled:
+ *
+ * Gets whether new mail from the chosen folders and senders is translated
+ * in the background as it arrives.
+ *
+ * Returns: TRUE if enabled, FALSE (the default) otherwise
+ */
+gboolean translate_utils_get_pretranslate_enabled (void);
+
+/**
+ * translate_utils_get_warm_start:
+ *
+ * Gets whether the active provider is prepared in the background when
+ * Evolution starts.
+ *
+ * Returns: TRUE if warm start is enabled, FALSE (the default) otherwise
+ */
+gboolean translate_utils_get_warm_start (void);
+
+/**
+ * translate_utils_get_translate_in_place:
+ *
+ * Gets whether messages are translated in place, as they are scrolled
+ * into view, rather than replaced by a translated copy.
+ *
+ * Returns: TRUE if in-place translation is enabled
+ */
+gboolean translate_utils_get_translate_in_place (void);
+
+/**
+ * translate_utils_get_window_size:
+ *
+ * Gets the size of the windows larger messages are translated in.
+ *
+ * Returns: The window size in bytes, or 0 to send messages whole
+ */
+gsize translate_utils_get_window_size (void);
+
+/**
+ * translate_utils_get_max_translate_size:
+ *
+ * Gets how much of a message is translated before asking to continue.
+ *
+ * Returns: The limit in bytes, or 0 for no limit
+ */
+gsize translate_utils_get_max_translate_size (void);
+
 G_END_DECLS
 
 #endif /* TRANSLATE_UTILS_H */
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+argos_batch.py
+Batched sentence translation on top of an Argos Translate model.
+
+Argos' own ITranslation.translate() handles one string per call, so an
+HTML mail with hundreds of small text nodes means hundreds of model
+invocations. BatchTranslator adds translate_batch(): every text is split
+into lines and sentences, all sentences are tokenized, and they go to
+CTranslate2's translate_batch() in one call. CTranslate2 then regroups
+them into batches of at most max_batch_tokens tokens, which is what keeps
+a GPU or several CPU cores busy.
+
+Translations that do not expose a CTranslate2 package (pivot
+translations through a third language, or Argos versions with a
+different layout) are translated text by text as before.
+"""
+
+import re
+import sys
+from typing import Callable, List, Optional
+
+# Tokens per CTranslate2 batch when the request does not say otherwise
+DEFAULT_MAX_BATCH_TOKENS = 1024
+
+# Same decoding options as argostranslate's own translate(); the beam
+# size is the default of BatchTranslator's
+_BEAM_SIZE = 4
+_LENGTH_PENALTY = 0.2
+
+# Sentence ends followed by whitespace; text nodes in mails are short,
+# so this is close enough to Argos' own sentence splitting
+_SENTENCE_RE = re.compile(r"(?<=[.!?])\s+")
+
+
+def _split_sentences(line: str) -> List[str]:
+    return [s for s in _SENTENCE_RE.split(line.strip()) if s]
+
+
+class BatchTranslator:
+    """
+    Wraps an Argos translation with translate()/translate_batch().
+
+    max_batch_tokens <= 0 selects DEFAULT_MAX_BATCH_TOKENS, beam_size <= 0
+    Argos' own beam size.
+    """
+
+    def __init__(self, translation, max_batch_tokens: int = 0,
+                 debug_func: Optional[Callable[[str], None]] = None,
+                 beam_size: int = 0):
+        self._translation = translation
+        self._max_batch_tokens = max_batch_tokens if max_batch_tokens > 0 else DEFAULT_MAX_BATCH_TOKENS
+        self._beam_size = beam_size if beam_size > 0 else _BEAM_SIZE
+        self._log = debug_func if debug_func else lambda msg: None
+        self._package = self._find_package(translation)
+
+    @staticmethod
+    def _find_package(translation):
+        """The PackageTranslation behind translation, or None."""
+        # Newer Argos versions wrap it in a CachedTranslation
+        while hasattr(translation, "underlying"):
+            translation = translation.underlying
+        pkg = getattr(translation, "pkg", None)
+        tokenizer = getattr(pkg, "tokenizer", None)
+        if not hasattr(tokenizer, "encode") or not hasattr(tokenizer, "decode"):
+            return None
+        if not hasattr(translation, "translator"):
+            return None
+        return translation
+
+    def _ctranslate2(self):
+        """The package's CTranslate2 translator, created the way Argos does."""
+        package = self._package
+        if package.translator is None:
+            import ctranslate2
+            from argostranslate import settings
+
+            package.translator = ctranslate2.Translator(
+                str(package.pkg.package_path / "model"),
+                device=settings.device,
+                inter_threads=settings.inter_threads,
+                intra_threads=settings.intra_threads,
+                compute_type=getattr(settings, "compute_type", "auto"),
+            )
+        return package.translator
+
+    def _translate_native(self, texts: List[str]) -> List[str]:
+        pkg = self._package.pkg
+        tokenizer = pkg.tokenizer
+        prefix = getattr(pkg, "target_prefix", "") or ""
+
+        # Flatten texts → lines → sentences, remembering where each belongs
+        layout = []     # per text: per line: number of sentences
+        sentences = []
+        for text in texts:
+            lines = []
+            for line in text.split("\n"):
+                parts = _split_sentences(line)
+                lines.append(len(parts))
+                sentences.extend(parts)
+            layout.append(lines)
+
+        translated = []
+        if sentences:
+            tokenized = [tokenizer.encode(s) for s in sentences]
+            results = self._ctranslate2().translate_batch(
+                tokenized,
+                target_prefix=[[prefix]] * len(tokenized) if prefix else None,
+                max_batch_size=self._max_batch_tokens,
+                batch_type="tokens",
+                beam_size=self._beam_size,
+                num_hypotheses=1,
+                length_penalty=_LENGTH_PENALTY,
+                replace_unknowns=True,
+            )
+            for result in results:
+                tokens = result.hypotheses[0]
+                if prefix and tokens and tokens[0] == prefix:
+                    tokens = tokens[1:]
+                translated.append(tokenizer.decode(tokens))
+
+        self._log(f"Batched {len(sentences)} sentences from {len(texts)} segments "
+                  f"(max {self._max_batch_tokens} tokens per batch)")
+
+        out = []
+        position = 0
+        for lines in layout:
+            rebuilt = []
+            for count in lines:
+                rebuilt.append(" ".join(translated[position:position + count]))
+                position += count
+            out.append("\n".join(rebuilt))
+        return out
+
+    def translate_batch(self, texts: List[str]) -> List[str]:
+        if self._package is not None and texts:
+            try:
+                return self._translate_native(texts)
+            except (ImportError, AttributeError, TypeError, RuntimeError, ValueError) as e:
+                # Don't retry a layout we cannot drive for every chunk
+                print(f"[translate] Batched translation unavailable, translating one by one: {e}",
+                      file=sys.stderr)
+                self._package = None
+        return [self._translation.translate(t) for t in texts]
+
+    def translate(self, text: str) -> str:
+        return self.translate_batch([text])[0]
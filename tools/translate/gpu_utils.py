@@ -5,10 +5,153 @@ Shared GPU acceleration utilities for Argos Translate.
 
 This module provides centralized GPU detection and configuration logic
 to avoid code duplication across translation scripts.
+
+Importing torch only to ask for CUDA takes seconds, so the answer is
+cached in $XDG_CACHE_HOME/evolution-translate/device.json, keyed by the
+interpreter and the installed torch package, and probed again once a
+week or when either changes. TRANSLATE_DEVICE_CACHE overrides the path;
+"off" disables the cache.
+
+ctranslate2_options() fills in the CTranslate2 threading, compute type
+and beam size the extension leaves on automatic, from the device and the
+CPU cores this process may use, and apply_ctranslate2_options() hands
+them to argostranslate.settings (or, before it is imported, to the
+ARGOS_* variables it reads).
 """
 
+import importlib.util
+import json
 import os
 import sys
+import time
+
+CACHE_MAX_AGE = 7 * 24 * 3600  # seconds
+
+# Cores per CTranslate2 batch before a second batch in parallel pays off
+CORES_PER_BATCH = 8
+MAX_INTER_THREADS = 4
+# The host side of a GPU translation needs few threads
+GPU_INTRA_THREADS = 4
+
+
+def _cache_path():
+    path = os.environ.get("TRANSLATE_DEVICE_CACHE")
+    if path:
+        return None if path == "off" else path
+    base = os.environ.get("XDG_CACHE_HOME") or os.path.join(os.path.expanduser("~"), ".cache")
+    return os.path.join(base, "evolution-translate", "device.json")
+
+
+def _cache_key(spec):
+    """What the cached answer depends on, without importing torch."""
+    try:
+        mtime = os.path.getmtime(spec.origin)
+    except (OSError, TypeError):
+        mtime = 0
+    return {"python": sys.executable, "torch": [spec.origin, mtime]}
+
+
+def _read_cache(path, key):
+    try:
+        with open(path, "r", encoding="utf-8") as f:
+            entry = json.load(f)
+    except (OSError, ValueError):
+        return None
+    if entry.get("key") != key or time.time() - entry.get("time", 0) > CACHE_MAX_AGE:
+        return None
+    device = entry.get("device")
+    return device if device in ("cuda", "cpu") else None
+
+
+def _write_cache(path, key, device):
+    tmp = f"{path}.{os.getpid()}.tmp"
+    try:
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(tmp, "w", encoding="utf-8") as f:
+            json.dump({"key": key, "device": device, "time": time.time()}, f)
+        os.replace(tmp, path)
+    except OSError:
+        try:
+            os.unlink(tmp)
+        except OSError:
+            pass
+
+
+def _probe_device(log):
+    """Ask torch for a CUDA device; 'cpu' if it cannot be asked."""
+    try:
+        import torch
+        if torch.cuda.is_available():
+            print("[translate] GPU acceleration enabled (CUDA available)", file=sys.stderr)
+            log("GPU config: GPU acceleration enabled (CUDA available)")
+            return "cuda"
+        print("[translate] Using CPU (no CUDA device found)", file=sys.stderr)
+        log("GPU config: Using CPU (no CUDA device found)")
+    except ImportError:
+        # PyTorch not installed, fall back to CPU
+        print("[translate] Using CPU (PyTorch not available for GPU detection)", file=sys.stderr)
+        log("GPU config: Using CPU (PyTorch not available for GPU detection)")
+    except Exception as e:
+        # Any other error, fall back to CPU
+        print(f"[translate] Using CPU (error during GPU detection: {e})", file=sys.stderr)
+        log(f"GPU config: Using CPU (error during GPU detection: {e})")
+    return "cpu"
+
+
+def usable_cores():
+    """CPU cores this process may run on (affinity and cgroup cpusets)."""
+    try:
+        return max(1, len(os.sched_getaffinity(0)))
+    except (AttributeError, OSError):
+        return max(1, os.cpu_count() or 1)
+
+
+def ctranslate2_options(device, inter_threads=0, intra_threads=0, compute_type="auto",
+                        beam_size=0, pool_size=1):
+    """
+    Resolve the decoder options of a request; 0 and "auto" are chosen here.
+
+    The pool_size helpers of the extension share the machine, so each gets
+    its part of the cores. A CPU helper with many cores runs a batch in
+    parallel for every CORES_PER_BATCH of them and splits its cores among
+    those; a GPU helper needs one batch and a few host threads. CTranslate2
+    itself picks the fastest compute type the device supports for "auto"
+    (int8 on most CPUs, float16 or int8_float16 on GPUs).
+
+    Returns:
+        dict: inter_threads, intra_threads, compute_type and beam_size
+    """
+    cores = max(1, usable_cores() // max(1, pool_size))
+
+    if device == "cuda":
+        inter = inter_threads or 1
+        intra = intra_threads or min(cores, GPU_INTRA_THREADS)
+    else:
+        inter = inter_threads or max(1, min(MAX_INTER_THREADS, cores // CORES_PER_BATCH))
+        intra = intra_threads or max(1, cores // inter)
+
+    # Argos decodes with 4 beams; halving them nearly halves the time on
+    # a CPU that has little to spare
+    beam = beam_size or (4 if device == "cuda" or cores >= 4 else 2)
+
+    return {"inter_threads": inter, "intra_threads": intra,
+            "compute_type": compute_type or "auto", "beam_size": beam}
+
+
+def apply_ctranslate2_options(options):
+    """
+    Make argostranslate create its CTranslate2 translators with options.
+    Translators created before keep their threads; see the caller.
+    """
+    os.environ["ARGOS_INTER_THREADS"] = str(options["inter_threads"])
+    os.environ["ARGOS_INTRA_THREADS"] = str(options["intra_threads"])
+    os.environ["ARGOS_COMPUTE_TYPE"] = options["compute_type"]
+
+    settings = sys.modules.get("argostranslate.settings")
+    if settings is not None:
+        settings.inter_threads = options["inter_threads"]
+        settings.intra_threads = options["intra_threads"]
+        settings.compute_type = options["compute_type"]
 
 
 def setup_gpu_acceleration(debug_log_func=None):
@@ -32,29 +175,26 @@ def setup_gpu_acceleration(debug_log_func=None):
         log(f"GPU config: Using user-defined ARGOS_DEVICE_TYPE={os.environ['ARGOS_DEVICE_TYPE']}")
         return os.environ["ARGOS_DEVICE_TYPE"]
 
-    device_type = "cpu"  # Default fallback
-
     try:
-        import torch
-        if torch.cuda.is_available():
-            device_type = "cuda"
-            msg = "[translate] GPU acceleration enabled (CUDA available)"
-            print(msg, file=sys.stderr)
-            log("GPU config: GPU acceleration enabled (CUDA available)")
-        else:
-            msg = "[translate] Using CPU (no CUDA device found)"
-            print(msg, file=sys.stderr)
-            log("GPU config: Using CPU (no CUDA device found)")
-    except ImportError:
-        # PyTorch not installed, fall back to CPU
-        msg = "[translate] Using CPU (PyTorch not available for GPU detection)"
-        print(msg, file=sys.stderr)
+        spec = importlib.util.find_spec("torch")
+    except (ImportError, ValueError):
+        spec = None
+
+    if spec is None:
+        # Nothing to import, nothing to cache
+        device_type = "cpu"
+        print("[translate] Using CPU (PyTorch not available for GPU detection)", file=sys.stderr)
         log("GPU config: Using CPU (PyTorch not available for GPU detection)")
-    except Exception as e:
-        # Any other error, fall back to CPU
-        msg = f"[translate] Using CPU (error during GPU detection: {e})"
-        print(msg, file=sys.stderr)
-        log(f"GPU config: Using CPU (error during GPU detection: {e})")
+    else:
+        path = _cache_path()
+        key = _cache_key(spec)
+        device_type = _read_cache(path, key) if path else None
+        if device_type:
+            log(f"GPU config: Using cached device {device_type} from {path}")
+        else:
+            device_type = _probe_device(log)
+            if path:
+                _write_cache(path, key, device_type)
 
     os.environ["ARGOS_DEVICE_TYPE"] = device_type
     log(f"GPU config: Set ARGOS_DEVICE_TYPE={device_type}")
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+model_cache.py
+The Argos translators a helper keeps loaded.
+
+Every loaded language pair holds a CTranslate2 model of a few hundred MB
+for as long as the helper lives. ModelCache keeps the translators in
+least-recently-used order; after each request trim() unloads the oldest
+ones until the helper's resident set fits the budget the extension sends
+("memory_budget", in MiB), always keeping the pair just used. Idle
+helpers and helpers under memory pressure are stopped by the extension
+itself (see src/providers/translate-worker.c), which frees everything.
+"""
+
+import collections
+import ctypes
+import gc
+import os
+from typing import Callable, List, Optional
+
+
+def rss_bytes() -> int:
+    """This process's resident set size, or 0 where /proc is not available."""
+    try:
+        with open("/proc/self/statm", "r") as f:
+            resident = int(f.read().split()[1])
+        return resident * os.sysconf("SC_PAGE_SIZE")
+    except (OSError, ValueError, IndexError):
+        return 0
+
+
+def _release_memory() -> None:
+    """Collect the dropped model and hand freed heap pages back to the system."""
+    gc.collect()
+    try:
+        ctypes.CDLL("libc.so.6").malloc_trim(0)
+    except (OSError, AttributeError):
+        pass  # Not glibc
+
+
+def _unload(translation) -> None:
+    """Drop the CTranslate2 translators held by an Argos translation,
+    including both halves of a pivot through a third language."""
+    stack, seen = [translation], set()
+    while stack:
+        t = stack.pop()
+        if t is None or id(t) in seen:
+            continue
+        seen.add(id(t))
+        for attr in ("underlying", "t1", "t2"):
+            stack.append(getattr(t, attr, None))
+        if getattr(t, "translator", None) is not None:
+            try:
+                t.translator = None
+            except AttributeError:
+                pass
+
+
+class ModelCache:
+    """Loaded translators keyed by (from_code, to_code), oldest first."""
+
+    def __init__(self):
+        self._translators = collections.OrderedDict()
+
+    def __len__(self) -> int:
+        return len(self._translators)
+
+    def get(self, key):
+        translator = self._translators.get(key)
+        if translator is not None:
+            self._translators.move_to_end(key)
+        return translator
+
+    def put(self, key, translator) -> None:
+        self._translators[key] = translator
+        self._translators.move_to_end(key)
+
+    def clear(self) -> None:
+        for translator in self._translators.values():
+            _unload(translator)
+        self._translators.clear()
+        _release_memory()
+
+    def pairs(self) -> List[str]:
+        """The loaded language pairs, e.g. ["de-en", "fr-en"], oldest first."""
+        return [f"{source}-{target}" for source, target in self._translators]
+
+    def trim(self, budget_mb: int, log: Optional[Callable[[str], None]] = None) -> int:
+        """
+        Unload the least recently used translators while the process uses
+        more than budget_mb MiB; budget_mb <= 0 keeps everything.
+
+        Returns:
+            int: How many translators were unloaded
+        """
+        if budget_mb <= 0:
+            return 0
+
+        budget = budget_mb * 1024 * 1024
+        unloaded = 0
+        while len(self._translators) > 1:
+            rss = rss_bytes()
+            if rss <= budget:
+                break
+            (source, target), translator = self._translators.popitem(last=False)
+            _unload(translator)
+            _release_memory()
+            unloaded += 1
+            if log:
+                log(f"Unloaded {source} → {target}: {rss // (1024 * 1024)} MiB over a "
+                    f"{budget_mb} MiB budget")
+        return unloaded
@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""
+model_manager.py
+Argos Translate package index and model downloads, kept out of the
+translation request path.
+
+The package index is only fetched again when the local copy is older
+than INDEX_TTL, so looking up a language pair costs no network round
+trip. Downloads run in a helper of their own: started with --worker it
+serves framed requests (see worker_protocol.py) such as
+  {"id": 1, "install": true, "source": "de", "target": "en"}
+and answers once the model is installed, with "installed": true. The
+translation runner answers a request for a missing model at once with
+ModelPending, and the extension asks this helper for the model.
+
+A lock file per language pair keeps two helpers from downloading the
+same model at once.
+"""
+
+import argparse
+import fcntl
+import os
+import sys
+import time
+from typing import Optional
+
+import worker_protocol
+from worker_protocol import HelperError
+
+INDEX_TTL = 24 * 3600  # seconds
+
+
+class ModelPending(HelperError):
+    """The model for source → target is not installed but can be."""
+
+    def __init__(self, source: str, target: str):
+        super().__init__("model-pending", f"The {source} → {target} model is not installed yet")
+        self.source = source
+        self.target = target
+
+
+def _index_path() -> Optional[str]:
+    try:
+        import argostranslate.settings as argossettings
+        return str(argossettings.local_package_index)
+    except (ImportError, AttributeError):
+        return None
+
+
+def index_age() -> Optional[float]:
+    """Seconds since the local package index was fetched, None if never."""
+    path = _index_path()
+    try:
+        return time.time() - os.path.getmtime(path) if path else None
+    except OSError:
+        return None
+
+
+def ensure_index(max_age: float = INDEX_TTL) -> None:
+    """Fetch the package index unless the local copy is recent enough."""
+    import argostranslate.package as argospkg
+
+    age = index_age()
+    if age is not None and age < max_age:
+        return
+    print("[translate] Updating package index...", file=sys.stderr)
+    argospkg.update_package_index()
+
+
+def find_package(source: str, target: str, refresh: bool = False):
+    """
+    The package translating source → target, from the local index only
+    unless refresh is set.
+
+    Returns:
+        The package, or None if the index does not list the pair
+    """
+    import argostranslate.package as argospkg
+
+    if refresh:
+        ensure_index()
+    for pkg in argospkg.get_available_packages():
+        if pkg.type == "translate" and pkg.from_code == source and pkg.to_code == target:
+            return pkg
+    return None
+
+
+def can_install(source: str, target: str) -> bool:
+    """
+    Whether a download could provide source → target, judged from the
+    cached index without touching the network. Without a cached index
+    the answer is yes; the download will tell.
+    """
+    if index_age() is None:
+        return True
+    try:
+        return find_package(source, target) is not None
+    except (ImportError, OSError, ValueError):
+        return True
+
+
+def _lock_path(source: str, target: str) -> str:
+    base = os.environ.get("XDG_CACHE_HOME") or os.path.join(os.path.expanduser("~"), ".cache")
+    directory = os.path.join(base, "evolution-translate")
+    os.makedirs(directory, exist_ok=True)
+    return os.path.join(directory, f"install-{source}-{target}.lock")
+
+
+def _is_installed(source: str, target: str) -> bool:
+    import argostranslate.translate as argostr
+
+    languages = {lang.code: lang for lang in argostr.get_installed_languages()}
+    return (source in languages and target in languages and
+            languages[source].get_translation(languages[target]) is not None)
+
+
+def install(source: str, target: str) -> None:
+    """
+    Download and install the source → target model, unless another
+    helper did while we waited for the lock.
+
+    Raises:
+        HelperError: "unavailable" if no such model exists, "failed" if
+            the index or the model could not be downloaded
+    """
+    try:
+        import argostranslate.package as argospkg
+    except ImportError as e:
+        raise HelperError("unavailable", f"Argos Translate is not installed: {e}")
+
+    with open(_lock_path(source, target), "w") as lock:
+        fcntl.flock(lock, fcntl.LOCK_EX)
+        if _is_installed(source, target):
+            return
+        try:
+            pkg = find_package(source, target, refresh=True)
+            if pkg is None and (index_age() or 0) > 60:
+                # The pair may be newer than our copy of the index
+                ensure_index(max_age=0)
+                pkg = find_package(source, target)
+            if pkg is None:
+                raise HelperError("unavailable", f"No {source} → {target} model exists")
+            print(f"[translate] Downloading {source} → {target} translation model...", file=sys.stderr)
+            path = pkg.download()
+            print(f"[translate] Installing {source} → {target} model...", file=sys.stderr)
+            argospkg.install_from_path(path)
+        except HelperError:
+            raise
+        except Exception as e:
+            raise HelperError("failed", f"Could not install the {source} → {target} model: {e}")
+    print(f"[translate] ✓ Installed {source} → {target} translation model", file=sys.stderr)
+
+
+def handle_request(request: dict) -> dict:
+    if not request.get("install"):
+        raise HelperError("invalid-request", "only install requests are served")
+    source, target = request.get("source"), request.get("target")
+    if not source or not target:
+        raise HelperError("invalid-request", "install needs a source and a target")
+    if os.environ.get("TRANSLATE_FAKE_UPPERCASE") != "1":
+        install(source, target)
+    return {"translated": "", "installed": True}
+
+
+def serve_worker() -> int:
+    out = worker_protocol.binary_stdout()
+    while True:
+        try:
+            frame = worker_protocol.read_frame(sys.stdin.buffer)
+        except (worker_protocol.ProtocolError, ValueError) as e:
+            print(f"[translate] ERROR: Malformed worker request: {e}", file=sys.stderr)
+            return 1
+        if frame is None:
+            return 0
+        meta, payload = frame
+        try:
+            result = handle_request(worker_protocol.decode_request(meta, payload))
+        except (HelperError, UnicodeDecodeError) as e:
+            worker_protocol.write_error(out, meta.get("id"), getattr(e, "code", "invalid-request"), str(e))
+        else:
+            worker_protocol.write_response(out, meta.get("id"), result)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description="Argos Translate model downloads")
+    ap.add_argument("--worker", action="store_true",
+                    help="Stay resident and serve framed install requests on stdin/stdout")
+    ap.add_argument("--install", nargs=2, metavar=("FROM", "TO"), help="Install the model for FROM TO")
+    args = ap.parse_args()
+    if args.worker:
+        return serve_worker()
+    if args.install:
+        try:
+            install(*args.install)
+        except HelperError as e:
+            print(f"[translate] ERROR: {e}", file=sys.stderr)
+            return 1
+        return 0
+    ap.print_help()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
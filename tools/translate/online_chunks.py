@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+"""
+online_chunks.py
+Request packing, rate limiting and retries for the online runner.
+
+Online services throttle bursts, and every request costs a round trip,
+so sending each sentence on its own is slow and still trips their
+limits. ChunkedTranslator wraps a deep-translator instance: it cuts the
+texts of a batch into lines (and overlong lines at sentence ends), packs
+the lines into requests up to the provider's size limit, joined by
+newlines, and sends up to MAX_PARALLEL requests at once. A token bucket
+spaces them out to the provider's rate. A request that is throttled or
+fails on the network is retried on its own with exponential backoff; the
+rest of the document is not sent again.
+
+The limits come with each request from the extension, which also sends
+direct requests to the same services (src/providers/translate-http.c):
+"max_chars", "rate" and "burst", and in "tokens" the requests its own
+bucket has already paid for. Requests sent beyond those are reported
+back as "extra_requests" and charged to the extension's bucket, so both
+paths share one rate budget.
+"""
+
+import sys
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+from typing import List, NamedTuple, Optional, Tuple
+
+MAX_PARALLEL = 4
+MAX_ATTEMPTS = 4
+BACKOFF_BASE = 0.5  # seconds, doubled after every failed attempt
+
+
+class Limits(NamedTuple):
+    max_chars: int   # Characters per request
+    rate: float      # Requests per second; 0 = unlimited
+    burst: int       # Requests allowed at once before the rate applies
+    tokens: int      # Requests already paid for when the batch starts
+
+    @classmethod
+    def from_request(cls, request: dict) -> "Limits":
+        """The limits the extension sent along, or DEFAULT_LIMITS."""
+        burst = int(request.get("burst", DEFAULT_LIMITS.burst))
+        return cls(max_chars=int(request.get("max_chars", DEFAULT_LIMITS.max_chars)),
+                   rate=float(request.get("rate", DEFAULT_LIMITS.rate)),
+                   burst=burst,
+                   tokens=int(request.get("tokens", burst)))
+
+
+# For the command line, where no extension hands over its limits
+DEFAULT_LIMITS = Limits(max_chars=2000, rate=1.0, burst=2, tokens=2)
+
+_SENTENCE_ENDS = (". ", "! ", "? ", " ")
+
+
+class ChunkFailed(Exception):
+    """Every request of a batch failed, retries included."""
+
+
+class TokenBucket:
+    """
+    Allows `burst` requests at once and `rate` per second after that,
+    starting with `tokens` requests already paid for. Counts the requests
+    it lets through.
+    """
+
+    def __init__(self, rate: float, burst: int, tokens: int):
+        self.rate = rate
+        self.burst = burst
+        self.acquired = 0
+        self._tokens = float(tokens)
+        self._stamp = time.monotonic()
+        self._lock = threading.Lock()
+
+    def _refill(self) -> None:
+        now = time.monotonic()
+        self._tokens = min(float(self.burst), self._tokens + (now - self._stamp) * self.rate)
+        self._stamp = now
+
+    def acquire(self) -> None:
+        """Block until a request may be sent."""
+        while True:
+            with self._lock:
+                if self.rate <= 0:
+                    self.acquired += 1
+                    return
+                self._refill()
+                if self._tokens >= 1.0:
+                    self._tokens -= 1.0
+                    self.acquired += 1
+                    return
+                wait = (1.0 - self._tokens) / self.rate
+            time.sleep(wait)
+
+    def drain(self) -> None:
+        """The provider said slow down: start refilling from empty."""
+        with self._lock:
+            self._refill()
+            self._tokens = 0.0
+
+
+def split_long(text: str, max_chars: int) -> List[str]:
+    """Cut text into parts of at most max_chars, at sentence ends or spaces."""
+    parts = []
+    while len(text) > max_chars:
+        cut = max_chars
+        for sep in _SENTENCE_ENDS:
+            pos = text.rfind(sep, max_chars // 2, max_chars)
+            if pos >= 0:
+                cut = pos + len(sep)
+                break
+        parts.append(text[:cut])
+        text = text[cut:]
+    parts.append(text)
+    return parts
+
+
+# A piece is [leading whitespace, text to send, trailing whitespace, translation]
+def _pieces_of(text: str, max_chars: int) -> List[list]:
+    pieces = []
+    for line in text.splitlines(keepends=True):
+        for part in split_long(line, max_chars):
+            core = part.strip()
+            lead = part[:len(part) - len(part.lstrip())]
+            pieces.append([lead, core, part[len(lead) + len(core):], None if core else ""])
+    return pieces
+
+
+def _pack(pieces: List[list], max_chars: int) -> List[List[list]]:
+    """Group consecutive pieces into requests of at most max_chars."""
+    chunks, current, size = [], [], 0
+    for piece in pieces:
+        length = len(piece[1]) + 1
+        if current and size + length > max_chars:
+            chunks.append(current)
+            current, size = [], 0
+        current.append(piece)
+        size += length
+    if current:
+        chunks.append(current)
+    return chunks
+
+
+class ChunkedTranslator:
+    """
+    Wraps a deep-translator instance for one provider with packing,
+    rate limiting and per-request retries (see the module docstring).
+
+    translate_batch() returns None for texts that could not be fully
+    translated, so callers keep the original and nothing half-translated
+    ends up in the translation memory.
+    """
+
+    def __init__(self, translator, limits: Limits = DEFAULT_LIMITS):
+        self._translator = translator
+        self._max_chars = limits.max_chars
+        self._prepaid = limits.tokens
+        self._bucket = TokenBucket(limits.rate, limits.burst, limits.tokens)
+
+    @property
+    def extra_requests(self) -> int:
+        """Requests sent beyond those paid for up front; negative if fewer."""
+        return self._bucket.acquired - self._prepaid
+
+    def _send(self, text: str) -> str:
+        """One request, retried on throttling and network errors."""
+        from deep_translator.exceptions import RequestError, TooManyRequests
+
+        for attempt in range(MAX_ATTEMPTS):
+            self._bucket.acquire()
+            try:
+                return self._translator.translate(text) or ""
+            except (TooManyRequests, RequestError) as e:
+                if attempt == MAX_ATTEMPTS - 1:
+                    raise
+                if isinstance(e, TooManyRequests):
+                    self._bucket.drain()
+                time.sleep(BACKOFF_BASE * (2 ** attempt))
+        return ""
+
+    def _run_chunk(self, chunk: List[list]) -> None:
+        cores = [piece[1] for piece in chunk]
+        translated = self._send("\n".join(cores)).split("\n")
+        if len(translated) != len(cores):
+            # The service merged or split lines; send them one by one
+            translated = [self._send(core) for core in cores]
+        for piece, text in zip(chunk, translated):
+            piece[3] = text.strip()
+
+    def _translate_all(self, texts: List[str]) -> Tuple[List[Optional[str]], List[Exception]]:
+        per_text = [_pieces_of(text, self._max_chars) for text in texts]
+        chunks = _pack([p for pieces in per_text for p in pieces if p[3] is None], self._max_chars)
+        failures: List[Exception] = []
+
+        def run(chunk: List[list]) -> None:
+            try:
+                self._run_chunk(chunk)
+            except Exception as e:
+                failures.append(e)
+
+        if len(chunks) == 1:
+            run(chunks[0])
+        elif chunks:
+            with ThreadPoolExecutor(max_workers=min(MAX_PARALLEL, len(chunks))) as pool:
+                list(pool.map(run, chunks))
+
+        if failures:
+            print(f"[translate] {len(failures)} of {len(chunks)} requests failed: {failures[-1]}",
+                  file=sys.stderr)
+        results = []
+        for pieces in per_text:
+            if any(piece[3] is None for piece in pieces):
+                results.append(None)
+            else:
+                results.append("".join(lead + out + trail for lead, _, trail, out in pieces))
+        return results, failures
+
+    def translate_batch(self, texts: List[str]) -> List[Optional[str]]:
+        results, failures = self._translate_all(list(texts))
+        if failures and all(r is None for r in results):
+            raise ChunkFailed(str(failures[-1])) from failures[-1]
+        return results
+
+    def translate(self, text: str) -> str:
+        results, failures = self._translate_all([text])
+        if results[0] is None:
+            raise ChunkFailed(str(failures[-1])) from failures[-1]
+        return results[0]
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+segment_stream.py
+Progressive output of HTML translations for the worker protocol.
+
+When a worker request carries "stream": true, the runner answers with
+extra event frames (see worker_protocol.py) before the final response,
+all carrying the request id:
+
+  {"id": 1, "event": "skeleton", "segments": 12} + document
+      The original document with every text segment that will be
+      translated wrapped in <span data-translate-seg="N">. Only sent for
+      whole documents; for segment requests the extension builds it.
+  {"id": 1, "event": "segments", "first": 0, "count": 4} + texts
+      Translations of segments first, first + 1, ... ready to be put
+      into the matching spans.
+
+The final response is unchanged and carries the complete result without
+markers, so it can be cached as usual.
+"""
+
+from typing import BinaryIO, Callable, Iterator, List, Optional, Tuple
+
+import worker_protocol
+
+SEGMENT_ATTR = "data-translate-seg"
+
+# The first chunk is small so the first words show up quickly; later
+# chunks grow so batching still pays off on long documents
+FIRST_CHUNK = 4
+LARGEST_CHUNK = 32
+
+Emitter = Callable[[dict], None]
+
+
+def make_emitter(stream: BinaryIO, request_id) -> Emitter:
+    """Return a function that writes one event frame for request_id."""
+    def emit(event: dict) -> None:
+        meta = {k: v for k, v in event.items() if k not in ("html", "texts")}
+        meta["id"] = request_id
+        if "texts" in event:
+            meta["count"] = len(event["texts"])
+            payload = worker_protocol.join_texts(event["texts"])
+        else:
+            payload = event.get("html", "").encode("utf-8")
+        worker_protocol.write_frame(stream, meta, payload)
+    return emit
+
+
+def chunk_ranges(count: int) -> Iterator[Tuple[int, int]]:
+    """Yield (start, end) index ranges covering count segments."""
+    start, size = 0, FIRST_CHUNK
+    while start < count:
+        end = min(count, start + size)
+        yield start, end
+        start, size = end, min(size * 2, LARGEST_CHUNK)
+
+
+def mark_segments(soup, nodes) -> List:
+    """Wrap each text node in a marker span; returns the spans in order."""
+    spans = []
+    for index, node in enumerate(nodes):
+        span = soup.new_tag("span", attrs={SEGMENT_ATTR: str(index)})
+        node.wrap(span)
+        spans.append(span)
+    return spans
+
+
+def unmark_segments(spans) -> None:
+    """Remove the marker spans again, keeping their (translated) contents."""
+    for span in spans:
+        span.unwrap()
+
+
+def emit_skeleton(emit: Optional[Emitter], soup, count: int) -> None:
+    if emit is not None:
+        emit({"event": "skeleton", "html": str(soup), "segments": count})
+
+
+def emit_segments(emit: Optional[Emitter], first: int, texts: List[str]) -> None:
+    if emit is not None and texts:
+        emit({"event": "segments", "first": first, "texts": texts})
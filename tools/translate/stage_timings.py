@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""
+stage_timings.py
+Where a helper spends its time, reported back to the extension.
+
+A worker serves one request at a time, so the stages of the current
+request are collected here rather than passed around: wrap each one in
+  with stage_timings.stage("inference"):
+and the response gets the milliseconds per stage, e.g.
+  "timings": {"detect": 2.9, "load": 410.3, "inference": 95.7}
+which the extension adds to its statistics (src/translate-stats.c).
+A stage that runs more than once per request is summed. The first
+response of a process also carries "startup", the time its module
+imports and GPU set-up took.
+"""
+
+import time
+from contextlib import contextmanager
+from typing import Dict, Optional
+
+_STARTED = time.perf_counter()
+_startup: Optional[float] = None
+_current: Dict[str, float] = {}
+
+
+def startup_done() -> None:
+    """Call once the helper's imports are done; reported with the first response."""
+    global _startup
+    _startup = (time.perf_counter() - _STARTED) * 1000.0
+
+
+def add(name: str, ms: float) -> None:
+    _current[name] = _current.get(name, 0.0) + ms
+
+
+@contextmanager
+def stage(name: str):
+    """Add the time spent in the with-block to the stage name."""
+    start = time.perf_counter()
+    try:
+        yield
+    finally:
+        add(name, (time.perf_counter() - start) * 1000.0)
+
+
+def begin_request() -> None:
+    """Forget the stages of the previous request."""
+    _current.clear()
+
+
+def collect() -> dict:
+    """The fields to add to the response: {"timings": ...}, or {} if nothing was timed."""
+    global _startup
+    if _startup is not None:
+        add("startup", _startup)
+        _startup = None
+    if not _current:
+        return {}
+    timings = {name: round(ms, 1) for name, ms in _current.items()}
+    _current.clear()
+    return {"timings": timings}
@@ -6,8 +6,45 @@ plain text to stdout. Options:
   --target <lang>  target ISO 639-1 (default: en)
   --html | --text  hint whether input is HTML (best-effort)
   --install-on-demand | --no-install-on-demand  enable/disable auto-download of models
+  --max-batch-tokens <n>  tokens per CTranslate2 batch (default: 1024)
+  --inter-threads <n> / --intra-threads <n>  CTranslate2 parallel batches
+                   and threads per batch (default: 0, from the cores)
+  --compute-type <t>  CTranslate2 compute type (default: auto)
+  --beam-size <n>  beams while decoding (default: 0, from the device)
+  --worker         stay resident and serve framed requests on stdin
   --debug          enable debug logging to /tmp/translate_debug.log
 
+In worker mode requests and responses are binary frames (see
+worker_protocol.py): a JSON header with the parameters, such as
+  {"id": 1, "target": "en", "install_on_demand": true, "max_batch_tokens": 1024,
+   "payload": "text"}
+followed by the raw text. The extension cuts HTML into text segments
+itself and sends them NUL-separated with "payload": "segments"; the
+response then holds one translation per segment. Models and translators
+stay loaded between requests.
+Responses also carry "tm_hits"/"tm_misses": how many text segments were
+answered by the shared translation memory (see translation_memory.py),
+and "timings": milliseconds spent importing Argos, detecting the
+language, loading the model and translating (see stage_timings.py).
+Requests with "stream": true are preceded by "segments" event frames (and
+a "skeleton" for whole documents) so the preview can fill in as segments
+finish (see segment_stream.py).
+Every request also carries the decoder options "inter_threads",
+"intra_threads", "compute_type" and "beam_size" (0 or "auto" to choose
+them here, see configure_decoder()) and "pool_size", the number of
+helpers sharing the machine, and "memory_budget": the MiB this helper may
+use before it unloads its least recently used translators (see
+model_cache.py). Responses list the language pairs still loaded in
+"models", and how many were just unloaded in "unloaded".
+A {"warm": true, "target": ...} request loads the installed models for the
+source languages most often translated into target (see warm_up()) and
+answers with their codes in "warmed".
+A request that needs a model which is not installed is answered at once
+with the untranslated input and "model_pending": {"source", "target"};
+the extension downloads the model through model_manager.py.
+All text segments of a document are translated with one batched model
+call (see argos_batch.py).
+
 If argostranslate/translate_html/langdetect are unavailable or models are
 missing, falls back to a no-op (echo) translation, so the pipeline works.
 """
@@ -16,6 +53,7 @@ import argparse
 import os
 import sys
 import json
+from typing import List, Optional
 
 # Debug logging support
 DEBUG_MODE = False
@@ -30,85 +68,98 @@ def debug_log(msg):
         except Exception:
             pass  # Silently ignore debug logging errors
 
+# First, so the start-up time reported covers the imports below
+import stage_timings
+
 # Import shared GPU utilities
-from gpu_utils import setup_gpu_acceleration
+from gpu_utils import setup_gpu_acceleration, ctranslate2_options, apply_ctranslate2_options
+import argos_batch
+import model_cache
+import model_manager
+import segment_stream
+import translation_memory
+import worker_protocol
+from worker_protocol import HelperError
 
 # Set up GPU acceleration before importing argostranslate
 setup_gpu_acceleration(debug_log_func=debug_log)
+stage_timings.startup_done()
 
-def auto_download_model(from_code: str, to_code: str, debug_func=None) -> bool:
-    """
-    Auto-download a translation model if it's not installed.
+# Loaded translators keyed by (from_code, to_code), least recently used
+# first. In one-shot mode this only lives for a single request; in worker
+# mode it keeps models warm within the memory budget.
+_TRANSLATORS = model_cache.ModelCache()
 
-    Args:
-        from_code: Source language code (ISO 639-1)
-        to_code: Target language code (ISO 639-1)
-        debug_func: Optional debug logging function
+# Decoder options in effect (see configure_decoder())
+_DECODER = {}
 
-    Returns:
-        True if model was successfully downloaded and installed, False otherwise.
-    """
-    log = debug_func if debug_func else lambda msg: None
 
-    try:
-        import argostranslate.package as argospkg
+def configure_decoder(inter_threads: int = 0, intra_threads: int = 0,
+                      compute_type: str = "auto", beam_size: int = 0,
+                      pool_size: int = 1) -> None:
+    """
+    Resolve the decoder options of a request (see
+    gpu_utils.ctranslate2_options()) and put them in effect. CTranslate2
+    fixes threads and compute type when it loads a model, so if those
+    change, the loaded translators are dropped and load again on use.
+    """
+    global _DECODER
 
-        log(f"Auto-download requested for {from_code} → {to_code}")
+    options = ctranslate2_options(os.environ.get("ARGOS_DEVICE_TYPE", "cpu"), inter_threads,
+                                  intra_threads, compute_type, beam_size, pool_size)
+    if options == _DECODER:
+        return
 
-        # Update package index to get latest available models
-        print(f"[translate] Updating package index...", file=sys.stderr)
-        log("Updating argostranslate package index...")
-        argospkg.update_package_index()
-        log("Package index updated successfully")
+    def loaded(o):
+        return {k: v for k, v in o.items() if k != "beam_size"}
 
-        # Find the specific translation package
-        available_packages = argospkg.get_available_packages()
-        log(f"Found {len(available_packages)} available packages")
+    if _DECODER and loaded(options) != loaded(_DECODER) and _TRANSLATORS:
+        debug_log(f"Decoder options changed, unloading {len(_TRANSLATORS)} translators")
+        _TRANSLATORS.clear()
+    apply_ctranslate2_options(options)
+    _DECODER = options
+    print(f"[translate] CTranslate2: {options['inter_threads']} x {options['intra_threads']} threads, "
+          f"{options['compute_type']}, beam {options['beam_size']}", file=sys.stderr)
 
-        target_package = None
-        for pkg in available_packages:
-            if pkg.type == "translate" and pkg.from_code == from_code and pkg.to_code == to_code:
-                target_package = pkg
-                break
 
-        if not target_package:
-            print(f"[translate] ERROR: No translation model found for {from_code} → {to_code}", file=sys.stderr)
-            print(f"[translate] Available language pairs can be found at: https://www.argosopentech.com/argospm/index/", file=sys.stderr)
-            log(f"No package found for {from_code} → {to_code}")
-            return False
+def get_translator(from_code: str, to_code: str):
+    """
+    Return a cached Argos translator for the language pair, or None if
+    either language is not installed.
+    """
+    key = (from_code, to_code)
+    translator = _TRANSLATORS.get(key)
+    if translator is not None:
+        return translator
 
-        # Download and install the package
-        print(f"[translate] Downloading {from_code} → {to_code} translation model...", file=sys.stderr)
-        log(f"Downloading package: {target_package.package_name}")
+    import argostranslate.translate as argostrans
 
-        download_path = target_package.download()
-        log(f"Downloaded to: {download_path}")
+    with stage_timings.stage("load"):
+        installed = argostrans.get_installed_languages()
+    debug_log(f"Installed languages: {[l.code for l in installed]}")
 
-        print(f"[translate] Installing {from_code} → {to_code} model...", file=sys.stderr)
-        argospkg.install_from_path(download_path)
+    src_lang = next((l for l in installed if l.code == from_code), None)
+    tgt_lang = next((l for l in installed if l.code == to_code), None)
 
-        print(f"[translate] ✓ Successfully installed {from_code} → {to_code} translation model", file=sys.stderr)
-        log(f"Successfully installed {from_code} → {to_code}")
-        return True
+    debug_log(f"Source lang: {src_lang.code if src_lang else 'None'}")
+    debug_log(f"Target lang: {tgt_lang.code if tgt_lang else 'None'}")
 
-    except ImportError as e:
-        print(f"[translate] ERROR: Failed to import argostranslate: {e}", file=sys.stderr)
-        log(f"ImportError in auto_download_model: {e}")
-        return False
-    except OSError as e:
-        print(f"[translate] ERROR: Network or file system error: {e}", file=sys.stderr)
-        log(f"OSError in auto_download_model: {e}")
-        return False
-    except Exception as e:
-        print(f"[translate] ERROR: Failed to auto-download model: {e}", file=sys.stderr)
-        log(f"Exception in auto_download_model: {e}")
-        return False
+    if not src_lang or not tgt_lang:
+        return None
 
+    with stage_timings.stage("load"):
+        translator = src_lang.get_translation(tgt_lang)
+    if translator is not None:
+        _TRANSLATORS.put(key, translator)
+    return translator
 
-def translate_html_carefully(translator, html_content: str) -> str:
+def translate_html_carefully(translator, html_content: str,
+                             emit: Optional[segment_stream.Emitter] = None) -> str:
     """
     Translate HTML content while preserving all HTML structure, tags, attributes, and comments.
     Only translates text nodes, leaving everything else untouched.
+    With emit, the marked-up document and each finished chunk of segments
+    are reported while the translation runs.
     """
     try:
         from bs4 import BeautifulSoup, NavigableString, Comment, Doctype
@@ -128,8 +179,10 @@ def translate_html_carefully(translator, html_content: str) -> str:
                 return False
             return True
 
-        def translate_element(element):
-            """Recursively translate text nodes in an element"""
+        nodes = []
+
+        def collect_element(element):
+            """Recursively collect the text nodes worth translating"""
             if isinstance(element, NavigableString):
                 # Skip comments, doctype, and other special strings
                 if isinstance(element, (Comment, Doctype)):
@@ -137,29 +190,53 @@ def translate_html_carefully(translator, html_content: str) -> str:
 
                 # Only translate if the text is substantial
                 if should_translate_text(element.string):
-                    try:
-                        # Preserve leading/trailing whitespace
-                        original = element.string
-                        stripped = original.strip()
-                        leading_ws = original[:len(original) - len(original.lstrip())]
-                        trailing_ws = original[len(original.rstrip()):]
-
-                        # Translate the stripped text
-                        translated = translator.translate(stripped)
-
-                        # Restore whitespace
-                        element.string.replace_with(leading_ws + translated + trailing_ws)
-                    except (RuntimeError, ValueError, AttributeError) as e:
-                        # If translation fails for this node, leave it as-is
-                        print(f"[translate] Failed to translate text node: {e}", file=sys.stderr)
-                        pass
+                    nodes.append(element)
             elif hasattr(element, 'children'):
                 # Recursively process all children
                 for child in list(element.children):
-                    translate_element(child)
-
-        # Translate all text nodes in the document
-        translate_element(soup)
+                    collect_element(child)
+
+        def translate_one(text: str) -> str:
+            try:
+                return translator.translate(text)
+            except (RuntimeError, ValueError, AttributeError) as e:
+                # If translation fails for this node, leave it as-is
+                print(f"[translate] Failed to translate text node: {e}", file=sys.stderr)
+                return text
+
+        def translate_segments(segments):
+            # One batch per chunk lets the translation memory answer all
+            # known segments with a single lookup
+            if segments and hasattr(translator, 'translate_batch'):
+                try:
+                    return translator.translate_batch(segments)
+                except (RuntimeError, ValueError, AttributeError) as e:
+                    debug_log(f"Batch translation failed: {e}, translating node by node")
+            return [translate_one(seg) for seg in segments]
+
+        def replace_text(node, text):
+            # Preserve leading/trailing whitespace
+            original = str(node)
+            leading_ws = original[:len(original) - len(original.lstrip())]
+            trailing_ws = original[len(original.rstrip()):]
+            replaced = leading_ws + text + trailing_ws
+            node.replace_with(replaced)
+            return replaced
+
+        collect_element(soup)
+        segments = [str(node).strip() for node in nodes]
+
+        if emit is None:
+            for node, text in zip(nodes, translate_segments(segments)):
+                replace_text(node, text)
+        else:
+            spans = segment_stream.mark_segments(soup, nodes)
+            segment_stream.emit_skeleton(emit, soup, len(nodes))
+            for start, end in segment_stream.chunk_ranges(len(nodes)):
+                translated = translate_segments(segments[start:end])
+                texts = [replace_text(node, text) for node, text in zip(nodes[start:end], translated)]
+                segment_stream.emit_segments(emit, start, texts)
+            segment_stream.unmark_segments(spans)
 
         # Return the HTML, preserving the original structure as much as possible
         # Use str() instead of prettify() to avoid reformatting
@@ -171,59 +248,47 @@ def translate_html_carefully(translator, html_content: str) -> str:
         return translator.translate(html_content)
 
 
-def translate_offline(text: str, target: str, is_html: bool, install_on_demand: bool = True) -> str:
-    """
-    Translate text using ArgosTranslate offline translation.
+class _FakeTranslator:
+    """TRANSLATE_FAKE_UPPERCASE=1: 'translates' by upper-casing."""
+    def translate(self, s: str) -> str:
+        return s.upper()
 
-    Args:
-        text: Text or HTML to translate
-        target: Target language code (ISO 639-1)
-        is_html: Whether input is HTML (preserves structure if True)
-        install_on_demand: Whether to auto-download missing models (default: True)
 
-    Returns:
-        Translated text, or original text if translation fails
+def get_offline_translator(sample: str, target: str, install_on_demand: bool = True,
+                           max_batch_tokens: int = 0, source: Optional[str] = None):
     """
-    debug_log(f"=== TRANSLATE REQUEST ===")
-    debug_log(f"Input length: {len(text)}")
-    debug_log(f"Input preview: {text[:200] if len(text) > 200 else text}")
-    debug_log(f"Target: {target}, HTML: {is_html}, Install-on-demand: {install_on_demand}")
+    Detect the source language of sample (unless the caller passes it as
+    source) and return a translator into target, wrapped for batching and
+    the translation memory.
 
-    fake_mode = os.environ.get("TRANSLATE_FAKE_UPPERCASE") == "1"
+    Returns:
+        The translator, or None if no translation is needed
 
-    if fake_mode:
-        class _FakeTranslator:
-            def translate(self, s: str) -> str:
-                return s.upper()
-        translator = _FakeTranslator()
-        if is_html:
-            return translate_html_carefully(translator, text)
-        return translator.translate(text)
+    Raises:
+        HelperError: Argos Translate or the language model is missing
+    """
+    if os.environ.get("TRANSLATE_FAKE_UPPERCASE") == "1":
+        return translation_memory.wrap(_FakeTranslator(), "auto", target, "fake")
 
     try:
-        import argostranslate.package as argospkg
-        import argostranslate.translate as argostrans
+        if "argostranslate.translate" in sys.modules:
+            import argostranslate.translate  # noqa: F401
+        else:
+            with stage_timings.stage("import"):
+                import argostranslate.translate  # noqa: F401
         debug_log("Argos modules imported successfully")
     except ImportError as e:
         debug_log(f"Failed to import argos: {e}")
         print(f"[translate] ERROR: ArgosTranslate not available: {e}", file=sys.stderr)
-        return text
+        raise HelperError("unavailable", f"Argos Translate is not installed: {e}")
 
     # Language detection (optional)
-    detected = None
-    if not fake_mode:
+    detected = source
+    if not detected:
         try:
             from langdetect import detect
-            # For HTML, try to extract text content for better detection
-            text_for_detection = text
-            if is_html:
-                try:
-                    from bs4 import BeautifulSoup
-                    soup = BeautifulSoup(text, 'html.parser')
-                    text_for_detection = soup.get_text()
-                except (ImportError, ValueError):
-                    pass  # Fall back to full HTML
-            detected = detect(text_for_detection)
+            with stage_timings.stage("detect"):
+                detected = detect(sample)
             debug_log(f"Detected language: {detected}")
         except (ImportError, ValueError, RuntimeError) as e:
             debug_log(f"Language detection failed: {e}")
@@ -234,64 +299,293 @@ def translate_offline(text: str, target: str, is_html: bool, install_on_demand:
     if from_code == "af":
         from_code = "nl"
 
-    # If no language detected, return original text
+    # If no language detected, keep the original text
     if from_code == "auto" or from_code == target:
         debug_log(f"No translation needed (from={from_code}, target={target})")
-        return text
+        return None
 
     # Try installed languages first
-    installed = argostrans.get_installed_languages()
-    debug_log(f"Installed languages: {[l.code for l in installed]}")
-
-    src_lang = next((l for l in installed if l.code == from_code), None)
-    tgt_lang = next((l for l in installed if l.code == target), None)
-
-    debug_log(f"Source lang: {src_lang.code if src_lang else 'None'}")
-    debug_log(f"Target lang: {tgt_lang.code if tgt_lang else 'None'}")
+    translator = get_translator(from_code, target)
 
     # If models are missing, try to auto-download (if enabled)
-    if not src_lang or not tgt_lang:
+    if translator is None:
+        if install_on_demand and DEFER_INSTALL:
+            # Answer now; the extension has the model downloaded meanwhile
+            if not model_manager.can_install(from_code, target):
+                raise HelperError("unavailable", f"No {from_code} → {target} model exists")
+            debug_log(f"Model {from_code} → {target} not installed, reporting it pending")
+            raise model_manager.ModelPending(from_code, target)
         if install_on_demand:
             print(f"[translate] Model {from_code} → {target} not installed, attempting auto-download...", file=sys.stderr)
-            debug_log(f"Model {from_code} → {target} not installed, attempting auto-download...")
-            if auto_download_model(from_code, target, debug_func=debug_log):
+            try:
+                model_manager.install(from_code, target)
+            except HelperError as e:
+                print(f"[translate] ERROR: {e}", file=sys.stderr)
+            else:
                 # Reload installed languages after download
-                installed = argostrans.get_installed_languages()
-                src_lang = next((l for l in installed if l.code == from_code), None)
-                tgt_lang = next((l for l in installed if l.code == target), None)
-                debug_log(f"After download - Source lang: {src_lang.code if src_lang else 'None'}")
-                debug_log(f"After download - Target lang: {tgt_lang.code if tgt_lang else 'None'}")
+                translator = get_translator(from_code, target)
+                debug_log(f"After download - translator: {translator}")
         else:
             print(f"[translate] ERROR: Model {from_code} → {target} not installed", file=sys.stderr)
             print(f"[translate] Auto-download is disabled. Please install models manually using setup_models.py", file=sys.stderr)
             debug_log(f"Model {from_code} → {target} not installed, auto-download disabled")
-            return text
+            raise HelperError("unavailable", f"No {from_code} → {target} model is installed")
+
+    if translator is None:
+        debug_log("No translator found")
+        raise HelperError("unavailable", f"No {from_code} → {target} model could be installed")
+
+    # Only segments never seen before reach the model, in one batch
+    debug_log(f"Translator found: {translator}")
+    translator = argos_batch.BatchTranslator(translator, max_batch_tokens, debug_func=debug_log,
+                                             beam_size=_DECODER.get("beam_size", 0))
+    return translation_memory.wrap(translator, from_code, target, "argos")
+
+
+# Worker mode leaves downloads to model_manager.py's helper
+DEFER_INSTALL = False
+
+# Models loaded by a warm request; each one costs a few hundred MB
+WARM_MAX_MODELS = 2
+# Assumed when the translation memory has no history yet
+WARM_DEFAULT_SOURCES = ["en"]
+
+
+def warm_up(target: str) -> List[str]:
+    """
+    Import Argos and load the models into target for the source languages
+    the translation memory saw most, so the first request skips it. Only
+    installed models are loaded; nothing is downloaded.
+
+    Returns:
+        The source language codes whose models are now loaded
+    """
+    if os.environ.get("TRANSLATE_FAKE_UPPERCASE") == "1":
+        return []
+    try:
+        import argostranslate.translate  # noqa: F401
+    except ImportError as e:
+        raise HelperError("unavailable", f"Argos Translate is not installed: {e}")
+
+    sources = translation_memory.common_source_languages(target, "argos", WARM_MAX_MODELS + 1)
+    warmed = []
+    for code in sources or WARM_DEFAULT_SOURCES:
+        if code == target or len(warmed) >= WARM_MAX_MODELS:
+            continue
+        translator = get_translator(code, target)
+        if translator is None:
+            continue
+        try:
+            # Models and the sentence splitter load on first use
+            translator.translate("Hello.")
+        except Exception as e:
+            debug_log(f"Warm-up of {code} → {target} failed: {e}")
+            continue
+        warmed.append(code)
+    print(f"[translate] Warm start: {len(warmed)} models into {target} loaded", file=sys.stderr)
+    return warmed
+
+
+def _note_stats(translator, stats: Optional[dict]) -> None:
+    tm_stats = translation_memory.stats_of(translator)
+    if tm_stats:
+        debug_log(f"Translation memory: {tm_stats['tm_hits']} hits, {tm_stats['tm_misses']} misses")
+        if stats is not None:
+            stats.update(tm_stats)
+
+
+def translate_offline(text: str, target: str, is_html: bool, install_on_demand: bool = True,
+                      stats: Optional[dict] = None,
+                      emit: Optional[segment_stream.Emitter] = None,
+                      max_batch_tokens: int = 0, source: Optional[str] = None) -> str:
+    """
+    Translate text using ArgosTranslate offline translation.
+
+    Args:
+        text: Text or HTML to translate
+        target: Target language code (ISO 639-1)
+        is_html: Whether input is HTML (preserves structure if True)
+        install_on_demand: Whether to auto-download missing models (default: True)
+        stats: If given, receives translation memory hit/miss counts
+        emit: If given, receives streaming events for HTML input
+        max_batch_tokens: Tokens per model batch, 0 for the default
+        source: Source language code, or None to detect it
+
+    Returns:
+        Translated text, or original text if translation fails
+
+    Raises:
+        HelperError: No translator is available
+    """
+    debug_log(f"=== TRANSLATE REQUEST ===")
+    debug_log(f"Input length: {len(text)}")
+    debug_log(f"Input preview: {text[:200] if len(text) > 200 else text}")
+    debug_log(f"Target: {target}, HTML: {is_html}, Install-on-demand: {install_on_demand}")
 
-    if src_lang and tgt_lang:
+    # For HTML, detect the language on the text content
+    sample = text
+    if is_html:
         try:
-            translator = src_lang.get_translation(tgt_lang)
-            debug_log(f"Translator found: {translator}")
+            from bs4 import BeautifulSoup
+            sample = BeautifulSoup(text, 'html.parser').get_text()
+        except (ImportError, ValueError):
+            pass  # Fall back to full HTML
+
+    translator = get_offline_translator(sample, target, install_on_demand, max_batch_tokens, source)
+    if translator is None:
+        return text
 
-            # Use our custom HTML translation for HTML content
+    try:
+        # Use our custom HTML translation for HTML content
+        with stage_timings.stage("inference"):
             if is_html:
-                result = translate_html_carefully(translator, text)
-                debug_log(f"HTML translation result length: {len(result)}")
-                debug_log(f"Translation preview: {result[:200] if len(result) > 200 else result}")
-                return result
-
-            # Plain text translation
-            result = translator.translate(text)
-            debug_log(f"Translation result length: {len(result)}")
-            debug_log(f"Translation preview: {result[:200] if len(result) > 200 else result}")
-            return result
+                result = translate_html_carefully(translator, text, emit)
+            else:
+                result = translator.translate(text)
+        debug_log(f"Translation result length: {len(result)}")
+        debug_log(f"Translation preview: {result[:200] if len(result) > 200 else result}")
+        _note_stats(translator, stats)
+        return result
+    except (RuntimeError, ValueError, AttributeError, OSError) as e:
+        debug_log(f"Translation failed: {e}")
+        print(f"[translate] ERROR: Translation failed: {e}", file=sys.stderr)
+        return text
+
+
+def translate_segments_offline(segments: List[str], target: str, install_on_demand: bool = True,
+                               stats: Optional[dict] = None,
+                               emit: Optional[segment_stream.Emitter] = None,
+                               max_batch_tokens: int = 0,
+                               source: Optional[str] = None) -> List[str]:
+    """
+    Translate text segments that the extension already cut out of an
+    HTML document, so no HTML needs to be parsed here.
+
+    Returns:
+        One translation per segment; untranslatable segments come back as is
+    """
+    debug_log(f"=== SEGMENTS REQUEST: {len(segments)} segments, target {target} ===")
+
+    translator = None
+    if segments:
+        translator = get_offline_translator("\n".join(segments), target, install_on_demand,
+                                            max_batch_tokens, source)
+    if translator is None:
+        return list(segments)
+
+    def translate_chunk(chunk: List[str]) -> List[str]:
+        try:
+            with stage_timings.stage("inference"):
+                if hasattr(translator, "translate_batch"):
+                    return list(translator.translate_batch(chunk))
+                return [translator.translate(seg) for seg in chunk]
         except (RuntimeError, ValueError, AttributeError, OSError) as e:
-            debug_log(f"Translation failed: {e}")
             print(f"[translate] ERROR: Translation failed: {e}", file=sys.stderr)
-            return text
+            return list(chunk)
+
+    if emit is None:
+        result = translate_chunk(segments)
+    else:
+        result = []
+        for start, end in segment_stream.chunk_ranges(len(segments)):
+            translated = translate_chunk(segments[start:end])
+            segment_stream.emit_segments(emit, start, translated)
+            result.extend(translated)
+
+    _note_stats(translator, stats)
+    return result
+
+
+def _trim_models(memory_budget: int) -> dict:
+    """Unload translators over the budget; the response fields reporting it."""
+    unloaded = _TRANSLATORS.trim(memory_budget, debug_log)
+    report = {"models": _TRANSLATORS.pairs()}
+    if unloaded:
+        report["unloaded"] = unloaded
+    return report
+
+
+def handle_request(request: dict, out) -> dict:
+    """
+    Serve a single worker request and return its result. Streaming events,
+    if requested, are written to out before this returns.
+
+    Raises:
+        HelperError: The request could not be served
+    """
+    segments = request.get("segments")
+    stats = {}
+    emit = segment_stream.make_emitter(out, request.get("id")) if request.get("stream") else None
+    target = request.get("target", "en")
+    install_on_demand = bool(request.get("install_on_demand", True))
+    max_batch_tokens = int(request.get("max_batch_tokens", 0))
+    source = request.get("source") or None
+    memory_budget = int(request.get("memory_budget", 0))
+    configure_decoder(int(request.get("inter_threads", 0)), int(request.get("intra_threads", 0)),
+                      str(request.get("compute_type") or "auto"), int(request.get("beam_size", 0)),
+                      int(request.get("pool_size", 1)))
+    stage_timings.begin_request()
+    try:
+        if request.get("warm"):
+            return {"translated": "", "warmed": warm_up(target), **_trim_models(memory_budget)}
+        if segments is not None:
+            result = {"translations": translate_segments_offline(
+                segments, target, install_on_demand, stats, emit, max_batch_tokens, source)}
+        else:
+            result = {"translated": translate_offline(
+                request.get("text", ""), target, bool(request.get("html", False)),
+                install_on_demand, stats, emit, max_batch_tokens, source)}
+    except model_manager.ModelPending as e:
+        # Not an error: the originals, and which model to fetch
+        pending = {"source": e.source, "target": e.target}
+        if segments is not None:
+            return {"translations": list(segments), "model_pending": pending, **stage_timings.collect()}
+        return {"translated": request.get("text", ""), "model_pending": pending, **stage_timings.collect()}
+    except HelperError:
+        raise
+    except Exception as e:
+        debug_log(f"Exception while serving request: {e}")
+        print(f"[translate] ERROR: Unexpected exception: {e}", file=sys.stderr)
+        raise HelperError("failed", str(e))
+    result.update(stats)
+    result.update(stage_timings.collect())
+    result.update(_trim_models(memory_budget))
+    return result
+
+
+def serve_worker() -> int:
+    """
+    Resident mode: read request frames from stdin and answer each with a
+    response frame on stdout, until stdin is closed.
+    """
+    global DEFER_INSTALL
 
-    # Best-effort: no-op if translator cannot be found
-    debug_log("No translator found, returning original")
-    return text
+    out = worker_protocol.binary_stdout()
+    DEFER_INSTALL = True
+    debug_log("=== WORKER STARTED ===")
+
+    while True:
+        try:
+            frame = worker_protocol.read_frame(sys.stdin.buffer)
+        except (worker_protocol.ProtocolError, ValueError) as e:
+            # The stream cannot be resynchronized; the extension restarts us
+            print(f"[translate] ERROR: Malformed worker request: {e}", file=sys.stderr)
+            return 1
+        if frame is None:
+            break  # EOF: the extension closed our stdin
+
+        meta, payload = frame
+        request_id = meta.get("id")
+        try:
+            result = handle_request(worker_protocol.decode_request(meta, payload), out)
+        except (HelperError, UnicodeDecodeError) as e:
+            code = getattr(e, "code", "invalid-request")
+            worker_protocol.write_error(out, request_id, code, str(e))
+        else:
+            worker_protocol.write_response(out, request_id, result)
+
+    debug_log("=== WORKER STOPPED ===")
+    return 0
 
 def main() -> int:
     """Main entry point for the translation runner."""
@@ -305,21 +599,41 @@ def main() -> int:
                     help="Enable automatic download of missing models (default)")
     ap.add_argument("--no-install-on-demand", dest="install_on_demand", action="store_false",
                     help="Disable automatic download of missing models")
+    ap.add_argument("--max-batch-tokens", type=int, default=0,
+                    help=f"Tokens per model batch (default: {argos_batch.DEFAULT_MAX_BATCH_TOKENS})")
+    ap.add_argument("--inter-threads", type=int, default=0,
+                    help="CTranslate2 batches translated in parallel (default: from the cores)")
+    ap.add_argument("--intra-threads", type=int, default=0,
+                    help="CTranslate2 threads per batch (default: from the cores)")
+    ap.add_argument("--compute-type", default="auto",
+                    help="CTranslate2 compute type, e.g. int8 or float16 (default: auto)")
+    ap.add_argument("--beam-size", type=int, default=0,
+                    help="Beams while decoding (default: 4, or 2 on a CPU with few cores)")
+    ap.add_argument("--worker", action="store_true",
+                    help="Stay resident and serve framed requests on stdin/stdout")
     ap.add_argument("--debug", action="store_true", help=f"Enable debug logging to {DEBUG_LOG_FILE}")
     args = ap.parse_args()
 
     # Enable debug mode if requested
     if args.debug:
         DEBUG_MODE = True
+
+    if args.worker:
+        return serve_worker()
+
+    if args.debug:
         debug_log("\n\n=== NEW TRANSLATION REQUEST (DEBUG MODE) ===")
         debug_log(f"Args: target={args.target}, html={args.is_html}, install_on_demand={args.install_on_demand}")
 
+    configure_decoder(args.inter_threads, args.intra_threads, args.compute_type, args.beam_size)
+
     data = sys.stdin.read()
     if args.debug:
         debug_log(f"Read {len(data)} bytes from stdin")
 
     try:
-        out = translate_offline(data, args.target, args.is_html, args.install_on_demand)
+        out = translate_offline(data, args.target, args.is_html, args.install_on_demand,
+                                max_batch_tokens=args.max_batch_tokens)
         if args.debug:
             debug_log(f"Output length: {len(out)}")
     except Exception as e:
@@ -8,8 +8,23 @@ Options:
   --target <lang>     target ISO 639-1 language code (default: en)
   --provider <name>   translation provider (google, mymemory, libre, etc.)
   --html | --text     hint whether input is HTML (default: text)
+  --worker            stay resident and serve framed requests on stdin
   --debug             enable debug logging to /tmp/translate_online_debug.log
 
+In worker mode requests and responses are binary frames (see
+worker_protocol.py): a JSON header with the parameters, such as
+  {"id": 1, "target": "en", "provider": "google", "payload": "text"}
+followed by the raw text. The extension cuts HTML into text segments
+itself and sends them NUL-separated with "payload": "segments"; the
+response then holds one translation per segment.
+Responses also carry "tm_hits"/"tm_misses": how many text segments were
+answered by the shared translation memory (see translation_memory.py),
+and "timings": milliseconds spent detecting the language and waiting for
+the service (see stage_timings.py).
+Requests with "stream": true are preceded by "segments" event frames (and
+a "skeleton" for whole documents) so the preview can fill in as segments
+finish (see segment_stream.py).
+
 Supported providers:
   - google: Google Translate (free, no API key)
   - mymemory: MyMemory Translator (free, no API key, 500 chars/request limit)
@@ -22,7 +37,17 @@ import argparse
 import os
 import sys
 import json
-from typing import Optional
+from typing import List, Optional
+
+# First, so the start-up time reported covers the imports below
+import stage_timings
+
+import online_chunks
+import segment_stream
+import translation_memory
+import worker_protocol
+
+stage_timings.startup_done()
 
 # Debug logging support
 DEBUG_MODE = False
@@ -38,6 +63,11 @@ def debug_log(msg):
             pass
 
 
+# Translator instances keyed by (provider, source, target, api_key, base_url). Only
+# reused across requests in worker mode.
+_TRANSLATORS = {}
+
+
 def detect_language(text: str, is_html: bool = False) -> str:
     """
     Detect the source language of the text.
@@ -59,7 +89,8 @@ def detect_language(text: str, is_html: bool = False) -> str:
             text = soup.get_text()
 
         # Detect language
-        lang_code = detect(text)
+        with stage_timings.stage("detect"):
+            lang_code = detect(text)
         debug_log(f"Detected language: {lang_code}")
         return lang_code
     except Exception as e:
@@ -67,7 +98,59 @@ def detect_language(text: str, is_html: bool = False) -> str:
         return "auto"
 
 
-def translate_html_carefully(translator, html_content: str) -> str:
+# Texts per provider call when nothing is streamed
+BATCH_SIZE = 50
+
+
+def batch_ranges(count: int) -> List[tuple]:
+    """(start, end) ranges of BATCH_SIZE texts covering count texts."""
+    return [(i, min(i + BATCH_SIZE, count)) for i in range(0, count, BATCH_SIZE)]
+
+
+def translate_texts(translator, batch: List[str]) -> List[str]:
+    """Translate one chunk of texts, keeping the original on errors"""
+    try:
+        # Try batch translation first (faster)
+        if hasattr(translator, 'translate_batch'):
+            result = list(translator.translate_batch(batch))
+            debug_log(f"Batch translated {len(batch)} texts")
+            # Texts whose requests failed come back as None
+            return [t if t is not None else orig for t, orig in zip(result, batch)]
+    except online_chunks.ChunkFailed as e:
+        # Already retried request by request; trying again text by text
+        # would only hit the same limit
+        debug_log(f"Batch translation failed: {e}, keeping originals")
+        return list(batch)
+    except Exception as e:
+        debug_log(f"Batch translation failed: {e}, falling back to individual")
+    # Fallback: translate individually
+    result = []
+    for text in batch:
+        try:
+            result.append(translator.translate(text))
+        except Exception as e:
+            debug_log(f"Individual translation error for '{text[:50]}': {e}")
+            result.append(text)  # Keep original on error
+    return result
+
+
+def translate_segment_list(translator, segments: List[str],
+                           emit: Optional[segment_stream.Emitter] = None) -> List[str]:
+    """
+    Translate text segments cut out of a document by the extension.
+    With emit, each finished chunk is reported as a "segments" event.
+    """
+    ranges = batch_ranges(len(segments)) if emit is None else segment_stream.chunk_ranges(len(segments))
+    result = []
+    for start, end in ranges:
+        translated = translate_texts(translator, segments[start:end])[:end - start]
+        segment_stream.emit_segments(emit, start, translated)
+        result.extend(translated)
+    return result
+
+
+def translate_html_carefully(translator, html_content: str,
+                             emit: Optional[segment_stream.Emitter] = None) -> str:
     """
     Translate HTML content while preserving structure.
     Uses BeautifulSoup to parse and only translate text nodes.
@@ -76,6 +159,8 @@ def translate_html_carefully(translator, html_content: str) -> str:
     Args:
         translator: deep-translator translator instance
         html_content: HTML content to translate
+        emit: If given, receives the marked-up document and each finished
+              chunk of segments while the translation runs
 
     Returns:
         Translated HTML with preserved structure
@@ -149,49 +234,34 @@ def translate_html_carefully(translator, html_content: str) -> str:
 
         debug_log(f"Collected {len(texts_to_translate)} text nodes for translation")
 
-        # Translate in batches for efficiency
-        translated_texts = []
-        batch_size = 50  # Process 50 texts at a time
-
-        for i in range(0, len(texts_to_translate), batch_size):
-            batch = texts_to_translate[i:i + batch_size]
+        def apply_translation(i, translated):
+            """Put translated text for node i back into the document"""
+            node_info = nodes_to_update[i]
+            replaced = node_info['leading'] + translated + node_info['trailing']
             try:
-                # Try batch translation first (faster)
-                if hasattr(translator, 'translate_batch'):
-                    batch_result = translator.translate_batch(batch)
-                    translated_texts.extend(batch_result)
-                    debug_log(f"Batch translated {len(batch)} texts")
-                else:
-                    # Fallback to individual translation
-                    for text in batch:
-                        try:
-                            translated_texts.append(translator.translate(text))
-                        except Exception as e:
-                            debug_log(f"Translation error for '{text[:50]}': {e}")
-                            translated_texts.append(text)  # Keep original on error
+                node_info['node'].replace_with(replaced)
+                debug_log(f"Translated: '{texts_to_translate[i][:50]}' -> '{translated[:50]}'")
             except Exception as e:
-                debug_log(f"Batch translation failed: {e}, falling back to individual")
-                # Fallback: translate individually
-                for text in batch:
-                    try:
-                        translated_texts.append(translator.translate(text))
-                    except Exception as e2:
-                        debug_log(f"Individual translation error for '{text[:50]}': {e2}")
-                        translated_texts.append(text)  # Keep original on error
-
-        # Apply translations back to nodes
-        for i, node_info in enumerate(nodes_to_update):
-            if i < len(translated_texts):
-                try:
-                    node = node_info['node']
-                    leading = node_info['leading']
-                    trailing = node_info['trailing']
-                    translated = translated_texts[i]
-
-                    node.replace_with(leading + translated + trailing)
-                    debug_log(f"Translated: '{texts_to_translate[i][:50]}' -> '{translated[:50]}'")
-                except Exception as e:
-                    debug_log(f"Failed to update node: {e}")
+                debug_log(f"Failed to update node: {e}")
+            return replaced
+
+        if emit is None:
+            ranges = batch_ranges(len(texts_to_translate))
+            spans = None
+        else:
+            # Small chunks first, so the first words show up quickly
+            ranges = list(segment_stream.chunk_ranges(len(texts_to_translate)))
+            spans = segment_stream.mark_segments(soup, [info['node'] for info in nodes_to_update])
+            segment_stream.emit_skeleton(emit, soup, len(texts_to_translate))
+
+        for start, end in ranges:
+            translated_texts = translate_texts(translator, texts_to_translate[start:end])
+            texts = [apply_translation(start + j, translated)
+                     for j, translated in enumerate(translated_texts[:end - start])]
+            segment_stream.emit_segments(emit, start, texts)
+
+        if spans is not None:
+            segment_stream.unmark_segments(spans)
 
         return str(soup)
     except Exception as e:
@@ -206,16 +276,82 @@ def translate_html_carefully(translator, html_content: str) -> str:
             return html_content  # Return original if all else fails
 
 
+def get_translator(provider: str, source_lang: str, target_lang: str, api_key: Optional[str] = None,
+                   base_url: Optional[str] = None):
+    """
+    Return a (cached) deep-translator instance for the provider and language pair.
+    Raises ValueError for unsupported or misconfigured providers.
+    """
+    from deep_translator import GoogleTranslator, MyMemoryTranslator, LibreTranslator
+
+    key = (provider, source_lang, target_lang, api_key, base_url)
+    if key in _TRANSLATORS:
+        return _TRANSLATORS[key]
+
+    translator = None
+
+    if provider == "google":
+        # Google Translate: Free, no API key, auto-detect supported
+        translator = GoogleTranslator(source=source_lang, target=target_lang)
+        debug_log("Using Google Translate (free, unlimited)")
+
+    elif provider == "mymemory":
+        # MyMemory: Free but limited (500 chars/request), requires email in API call
+        # Note: MyMemory API has been known to be unstable
+        try:
+            translator = MyMemoryTranslator(source=source_lang, target=target_lang)
+            debug_log("Using MyMemory Translator (free, 500 char limit)")
+        except Exception as e:
+            debug_log(f"MyMemory initialization error: {e}")
+            raise ValueError(f"MyMemory translator not available: {e}")
+
+    elif provider == "libre":
+        # LibreTranslate: Multiple public instances, some require API key
+        base_url = base_url or os.environ.get("LIBRE_TRANSLATE_URL", "https://libretranslate.de")
+        debug_log(f"Using LibreTranslate instance: {base_url}")
+
+        # Try with API key first, fallback to no key
+        try:
+            if api_key:
+                translator = LibreTranslator(source=source_lang, target=target_lang,
+                                            base_url=base_url, api_key=api_key)
+            else:
+                # Try without API key (some instances allow this)
+                translator = LibreTranslator(source=source_lang, target=target_lang,
+                                            base_url=base_url)
+            debug_log("LibreTranslate initialized successfully")
+        except Exception as e:
+            debug_log(f"LibreTranslate initialization error: {e}")
+            if "api" in str(e).lower() or "key" in str(e).lower():
+                raise ValueError(
+                    f"LibreTranslate requires API key for {base_url}. "
+                    "Try a different instance URL via LIBRE_TRANSLATE_URL environment variable "
+                    "(e.g., https://libretranslate.de or https://translate.argosopentech.com)"
+                )
+            raise
+
+    else:
+        raise ValueError(f"Unsupported provider: {provider}. Supported: google, libre")
+
+    _TRANSLATORS[key] = translator
+    return translator
+
+
 def translate_online(
     text: str,
     target_lang: str,
     provider: str,
     is_html: bool = False,
-    api_key: Optional[str] = None
+    api_key: Optional[str] = None,
+    emit: Optional[segment_stream.Emitter] = None,
+    segments: Optional[List[str]] = None,
+    source_lang: Optional[str] = None,
+    base_url: Optional[str] = None,
+    limits: online_chunks.Limits = online_chunks.DEFAULT_LIMITS
 ) -> dict:
     """
     Translate text using the specified online provider via deep-translator.
-    Implements retry logic for network issues and rate limiting.
+    Requests are packed, rate limited and retried by online_chunks.
 
     Args:
         text: Text to translate
@@ -223,24 +359,39 @@ def translate_online(
         provider: Provider name (google, mymemory, libre, etc.)
         is_html: Whether input is HTML
         api_key: Optional API key for providers that require it
+        emit: If given, receives streaming events for HTML input
+        segments: Text segments to translate instead of text
+        source_lang: Source language code, or None to detect it
+        base_url: LibreTranslate server, or None for the default
+        limits: Request size and rate limits, and the requests paid for
 
     Returns:
-        Dict with "translated" key containing translated text, and optional "error" key
+        Dict with "translated" key containing translated text (or
+        "translations" for segments) and "extra_requests", the requests
+        sent beyond limits.tokens, or an "error" key with its worker
+        error "code"
     """
-    import time
+    def unchanged(**extra) -> dict:
+        # Nothing was sent: every token paid for goes back
+        extra.setdefault("extra_requests", -limits.tokens)
+        if segments is not None:
+            return dict(translations=list(segments), **extra)
+        return dict(translated=text, **extra)
+
+    if segments is not None:
+        text = "\n".join(segments)
 
     try:
-        from deep_translator import GoogleTranslator, MyMemoryTranslator, LibreTranslator
+        with stage_timings.stage("import"):
+            import deep_translator  # noqa: F401
         from deep_translator.exceptions import (
             NotValidPayload,
             TranslationNotFound,
-            RequestError,
-            TooManyRequests,
         )
     except ImportError as e:
         error_msg = f"Required library not installed: {e}. Please run: pip install deep-translator"
         debug_log(f"Import error: {error_msg}")
-        return {"error": error_msg, "translated": text}
+        return unchanged(error=error_msg, code="unavailable")
 
     debug_log(f"Translating with provider: {provider}")
     debug_log(f"Target language: {target_lang}")
@@ -250,131 +401,136 @@ def translate_online(
     # Validate input
     if not text or not text.strip():
         debug_log("Empty input text")
-        return {"translated": text}
+        return unchanged()
 
     try:
-        # Detect source language
-        source_lang = detect_language(text, is_html)
-        debug_log(f"Detected source language: {source_lang}")
+        # Detect source language unless the caller knows it
+        if not source_lang:
+            source_lang = detect_language(text, is_html and segments is None)
+            debug_log(f"Detected source language: {source_lang}")
 
         if source_lang == target_lang:
             debug_log("Source and target languages are the same, returning input")
-            return {"translated": text}
-
-        # Create appropriate translator instance based on provider
-        translator = None
-
-        if provider == "google":
-            # Google Translate: Free, no API key, auto-detect supported
-            translator = GoogleTranslator(source=source_lang, target=target_lang)
-            debug_log("Using Google Translate (free, unlimited)")
-
-        elif provider == "mymemory":
-            # MyMemory: Free but limited (500 chars/request), requires email in API call
-            # Note: MyMemory API has been known to be unstable
-            try:
-                translator = MyMemoryTranslator(source=source_lang, target=target_lang)
-                debug_log("Using MyMemory Translator (free, 500 char limit)")
-            except Exception as e:
-                debug_log(f"MyMemory initialization error: {e}")
-                raise ValueError(f"MyMemory translator not available: {e}")
-
-        elif provider == "libre":
-            # LibreTranslate: Multiple public instances, some require API key
-            base_url = os.environ.get("LIBRE_TRANSLATE_URL", "https://libretranslate.de")
-            debug_log(f"Using LibreTranslate instance: {base_url}")
-
-            # Try with API key first, fallback to no key
-            try:
-                if api_key:
-                    translator = LibreTranslator(source=source_lang, target=target_lang,
-                                                base_url=base_url, api_key=api_key)
-                else:
-                    # Try without API key (some instances allow this)
-                    translator = LibreTranslator(source=source_lang, target=target_lang,
-                                                base_url=base_url)
-                debug_log("LibreTranslate initialized successfully")
-            except Exception as e:
-                debug_log(f"LibreTranslate initialization error: {e}")
-                if "api" in str(e).lower() or "key" in str(e).lower():
-                    raise ValueError(
-                        f"LibreTranslate requires API key for {base_url}. "
-                        "Try a different instance URL via LIBRE_TRANSLATE_URL environment variable "
-                        "(e.g., https://libretranslate.de or https://translate.argosopentech.com)"
-                    )
-                raise
-
-        else:
-            raise ValueError(f"Unsupported provider: {provider}. Supported: google, libre")
+            return unchanged()
 
+        translator = get_translator(provider, source_lang, target_lang, api_key, base_url)
         debug_log(f"Translator created: {type(translator).__name__}")
 
-        # Retry configuration
-        max_retries = 3
-        retry_delay = 1  # seconds
+        # Packs segments into few requests, paced and retried per request
+        chunked = online_chunks.ChunkedTranslator(translator, limits)
+
+        # Only segments never seen before use the provider's quota
+        translator = translation_memory.wrap(chunked, source_lang, target_lang, provider)
+
+        # Translate based on content type
+        if segments is not None:
+            with stage_timings.stage("request"):
+                result = {"translations": translate_segment_list(translator, segments, emit)}
+            result.update(translation_memory.stats_of(translator))
+            result["extra_requests"] = chunked.extra_requests
+            return result
+        with stage_timings.stage("request"):
+            if is_html:
+                translated = translate_html_carefully(translator, text, emit)
+            else:
+                translated = translator.translate(text)
 
-        for attempt in range(max_retries):
-            try:
-                # Translate based on content type
-                if is_html:
-                    translated = translate_html_carefully(translator, text)
-                else:
-                    # For plain text, handle provider-specific limits
-                    if provider == "mymemory" and len(text) > 500:
-                        # MyMemory has 500 char limit, split into sentences
-                        debug_log("Splitting text for MyMemory (500 char limit)")
-                        sentences = text.split('. ')
-                        translated_sentences = []
-                        for sentence in sentences:
-                            if sentence.strip():
-                                translated_sentences.append(translator.translate(sentence.strip()))
-                                time.sleep(0.5)  # Rate limiting
-                        translated = '. '.join(translated_sentences)
-                    else:
-                        translated = translator.translate(text)
-
-                debug_log(f"Translation successful, output length: {len(translated)} chars")
-                return {"translated": translated}
-
-            except TooManyRequests as e:
-                debug_log(f"Rate limit hit (attempt {attempt + 1}/{max_retries}): {e}")
-                if attempt < max_retries - 1:
-                    wait_time = retry_delay * (2 ** attempt)  # Exponential backoff
-                    debug_log(f"Waiting {wait_time}s before retry...")
-                    time.sleep(wait_time)
-                else:
-                    raise
-
-            except RequestError as e:
-                debug_log(f"Network error (attempt {attempt + 1}/{max_retries}): {e}")
-                if attempt < max_retries - 1:
-                    wait_time = retry_delay * (2 ** attempt)
-                    debug_log(f"Waiting {wait_time}s before retry...")
-                    time.sleep(wait_time)
-                else:
-                    raise
+        debug_log(f"Translation successful, output length: {len(translated)} chars")
+        result = {"translated": translated}
+        result.update(translation_memory.stats_of(translator))
+        result["extra_requests"] = chunked.extra_requests
+        return result
 
     except NotValidPayload as e:
         error_msg = f"Invalid input for translation: {e}"
         debug_log(f"Validation error: {error_msg}")
-        return {"error": error_msg, "translated": text}
+        return unchanged(error=error_msg, code="invalid-request")
 
     except TranslationNotFound as e:
         error_msg = f"Translation not found: {e}"
         debug_log(f"Translation not found: {error_msg}")
-        return {"error": error_msg, "translated": text}
+        return unchanged(error=error_msg, code="failed")
 
     except ValueError as e:
         error_msg = str(e)
         debug_log(f"Configuration error: {error_msg}")
-        return {"error": error_msg, "translated": text}
+        return unchanged(error=error_msg, code="invalid-request")
 
     except Exception as e:
         error_msg = f"Translation failed: {type(e).__name__}: {e}"
         debug_log(f"Unexpected error: {error_msg}")
         import traceback
         debug_log(traceback.format_exc())
-        return {"error": error_msg, "translated": text}
+        return unchanged(error=error_msg, code="failed")
+
+
+def serve_worker() -> int:
+    """
+    Resident mode: read request frames from stdin and answer each with a
+    response frame on stdout, until stdin is closed.
+    """
+    out = worker_protocol.binary_stdout()
+    debug_log("Online worker started")
+
+    while True:
+        try:
+            frame = worker_protocol.read_frame(sys.stdin.buffer)
+        except (worker_protocol.ProtocolError, ValueError) as e:
+            # The stream cannot be resynchronized; the extension restarts us
+            debug_log(f"Malformed worker request: {e}")
+            print(f"[translate] ERROR: Malformed worker request: {e}", file=sys.stderr)
+            return 1
+        if frame is None:
+            break  # EOF: the extension closed our stdin
+
+        meta, payload = frame
+        request_id = meta.get("id")
+        try:
+            request = worker_protocol.decode_request(meta, payload)
+        except (worker_protocol.HelperError, UnicodeDecodeError) as e:
+            worker_protocol.write_error(out, request_id, getattr(e, "code", "invalid-request"), str(e))
+            continue
+
+        emit = segment_stream.make_emitter(out, request_id) if request.get("stream") else None
+        text = request.get("text", "")
+        stage_timings.begin_request()
+        segments = request.get("segments")
+        limits = online_chunks.Limits.from_request(request)
+        if segments is not None:
+            result = translate_online(
+                text="",
+                target_lang=request.get("target", "en"),
+                provider=request.get("provider", "google"),
+                api_key=request.get("api_key"),
+                emit=emit,
+                segments=segments,
+                source_lang=request.get("source"),
+                base_url=request.get("url"),
+                limits=limits,
+            )
+        elif not text:
+            result = {"translated": text, "extra_requests": -limits.tokens}
+        else:
+            result = translate_online(
+                text=text,
+                target_lang=request.get("target", "en"),
+                provider=request.get("provider", "google"),
+                is_html=bool(request.get("html", False)),
+                api_key=request.get("api_key"),
+                emit=emit,
+                source_lang=request.get("source"),
+                base_url=request.get("url"),
+                limits=limits,
+            )
+
+        if "error" in result:
+            worker_protocol.write_error(out, request_id, result.get("code", "failed"), result["error"])
+        else:
+            result.update(stage_timings.collect())
+            worker_protocol.write_response(out, request_id, result)
+
+    debug_log("Online worker stopped")
+    return 0
 
 
 def main():
@@ -388,12 +544,17 @@ def main():
     parser.add_argument("--text", dest="is_html", action="store_false", help="Input is plain text")
     parser.add_argument("--debug", action="store_true", help="Enable debug logging")
     parser.add_argument("--api-key", help="API key for providers that require it")
+    parser.add_argument("--worker", action="store_true",
+                        help="Stay resident and serve framed requests on stdin/stdout")
     parser.set_defaults(is_html=False)
 
     args = parser.parse_args()
 
     DEBUG_MODE = args.debug
 
+    if args.worker:
+        return serve_worker()
+
     if DEBUG_MODE:
         debug_log("=" * 60)
         debug_log(f"Online translation runner started")
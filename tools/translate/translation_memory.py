@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+translation_memory.py
+Persistent segment-level translation memory shared by the runners.
+
+Newsletters, notifications and long threads repeat the same footers,
+disclaimers and signatures across thousands of messages. Each translated
+text segment is stored in an SQLite database keyed by
+(normalized segment, source language, target language, provider), so only
+segments that were never seen before reach the Argos model or an online API.
+
+Lookups and stores are batched per document. The database lives at
+$XDG_CACHE_HOME/evolution-translate/translation-memory.sqlite unless
+TRANSLATE_TM_PATH is set; TRANSLATE_TM_PATH=off disables the memory.
+"""
+
+import os
+import re
+import sqlite3
+import sys
+import time
+from typing import Dict, Iterable, List, Optional
+
+# Keep the database bounded; the least recently used rows go first
+MAX_ROWS = 200000
+# SQLite's default limit on host parameters is 999
+_LOOKUP_CHUNK = 400
+
+_WS_RE = re.compile(r"\s+")
+
+
+def normalize(text: str) -> str:
+    """Collapse runs of whitespace so reflowed copies of a segment match."""
+    return _WS_RE.sub(" ", text).strip()
+
+
+def default_path() -> Optional[str]:
+    """Database location, or None when the memory is disabled."""
+    env = os.environ.get("TRANSLATE_TM_PATH")
+    if env:
+        return None if env.lower() == "off" else env
+    cache_home = os.environ.get("XDG_CACHE_HOME") or os.path.join(os.path.expanduser("~"), ".cache")
+    return os.path.join(cache_home, "evolution-translate", "translation-memory.sqlite")
+
+
+class TranslationMemory:
+    """SQLite-backed store of segment translations with hit/miss counters."""
+
+    def __init__(self, path: str):
+        os.makedirs(os.path.dirname(path) or ".", exist_ok=True)
+        self._db = sqlite3.connect(path)
+        self._db.execute("PRAGMA journal_mode=WAL")
+        self._db.execute("PRAGMA synchronous=NORMAL")
+        self._db.execute(
+            "CREATE TABLE IF NOT EXISTS segments ("
+            " source_text TEXT NOT NULL,"
+            " source_lang TEXT NOT NULL,"
+            " target_lang TEXT NOT NULL,"
+            " provider TEXT NOT NULL,"
+            " translated TEXT NOT NULL,"
+            " last_used INTEGER NOT NULL,"
+            " PRIMARY KEY (source_text, source_lang, target_lang, provider))"
+        )
+        self._db.execute("CREATE INDEX IF NOT EXISTS segments_last_used ON segments (last_used)")
+        self._db.commit()
+        self.hits = 0
+        self.misses = 0
+
+    def lookup_many(self, segments: Iterable[str], source_lang: str,
+                    target_lang: str, provider: str) -> Dict[str, str]:
+        """Return {normalized segment: translation} for every known segment."""
+        keys = list(dict.fromkeys(normalize(s) for s in segments))
+        found = {}
+        for i in range(0, len(keys), _LOOKUP_CHUNK):
+            chunk = keys[i:i + _LOOKUP_CHUNK]
+            marks = ",".join("?" * len(chunk))
+            rows = self._db.execute(
+                f"SELECT source_text, translated FROM segments"
+                f" WHERE source_lang = ? AND target_lang = ? AND provider = ?"
+                f" AND source_text IN ({marks})",
+                [source_lang, target_lang, provider] + chunk,
+            )
+            found.update(rows.fetchall())
+
+        if found:
+            now = int(time.time())
+            self._db.executemany(
+                "UPDATE segments SET last_used = ? WHERE source_text = ? AND source_lang = ?"
+                " AND target_lang = ? AND provider = ?",
+                [(now, k, source_lang, target_lang, provider) for k in found],
+            )
+            self._db.commit()
+        return found
+
+    def store_many(self, pairs: Dict[str, str], source_lang: str,
+                   target_lang: str, provider: str) -> None:
+        """Remember {segment: translation}; segments are normalized here."""
+        if not pairs:
+            return
+        now = int(time.time())
+        self._db.executemany(
+            "INSERT OR REPLACE INTO segments VALUES (?, ?, ?, ?, ?, ?)",
+            [(normalize(s), source_lang, target_lang, provider, t, now) for s, t in pairs.items()],
+        )
+        self._prune()
+        self._db.commit()
+
+    def common_sources(self, target_lang: str, provider: str, limit: int) -> List[str]:
+        """Source languages most often translated into target_lang."""
+        rows = self._db.execute(
+            "SELECT source_lang FROM segments WHERE target_lang = ? AND provider = ?"
+            " GROUP BY source_lang ORDER BY COUNT(*) DESC LIMIT ?",
+            (target_lang, provider, limit),
+        )
+        return [row[0] for row in rows.fetchall()]
+
+    def _prune(self) -> None:
+        (count,) = self._db.execute("SELECT COUNT(*) FROM segments").fetchone()
+        if count <= MAX_ROWS:
+            return
+        # Drop an extra 10% so we don't prune on every store
+        excess = count - MAX_ROWS + MAX_ROWS // 10
+        self._db.execute(
+            "DELETE FROM segments WHERE rowid IN"
+            " (SELECT rowid FROM segments ORDER BY last_used LIMIT ?)",
+            (excess,),
+        )
+
+    def hit_ratio(self) -> float:
+        total = self.hits + self.misses
+        return self.hits / total if total else 0.0
+
+
+_MEMORY = None
+_MEMORY_FAILED = False
+
+
+def get_memory() -> Optional[TranslationMemory]:
+    """Process-wide memory, or None if disabled or the database is unusable."""
+    global _MEMORY, _MEMORY_FAILED
+    if _MEMORY is None and not _MEMORY_FAILED:
+        path = default_path()
+        if path is None:
+            _MEMORY_FAILED = True
+            return None
+        try:
+            _MEMORY = TranslationMemory(path)
+        except (sqlite3.Error, OSError) as e:
+            print(f"[translate] Translation memory unavailable: {e}", file=sys.stderr)
+            _MEMORY_FAILED = True
+    return _MEMORY
+
+
+class MemoryTranslator:
+    """
+    Wraps a translator so translate()/translate_batch() consult the
+    translation memory first and only forward the misses.
+
+    The wrapped translator needs translate(str); if it also has
+    translate_batch(list), misses are sent to it in one call.
+    """
+
+    def __init__(self, translator, memory: TranslationMemory,
+                 source_lang: str, target_lang: str, provider: str):
+        self._translator = translator
+        self._memory = memory
+        self._key = (source_lang, target_lang, provider)
+        self.hits = 0
+        self.misses = 0
+
+    def _translate_misses(self, texts: List[str]) -> List[str]:
+        batch = getattr(self._translator, "translate_batch", None)
+        if batch is not None and len(texts) > 1:
+            return list(batch(texts))
+        return [self._translator.translate(t) for t in texts]
+
+    def translate_batch(self, texts: List[str]) -> List[str]:
+        keys = [normalize(t) for t in texts]
+        try:
+            known = self._memory.lookup_many(keys, *self._key)
+        except sqlite3.Error as e:
+            # Another helper may hold the lock; translate without the memory
+            print(f"[translate] Translation memory lookup failed: {e}", file=sys.stderr)
+            known = {}
+
+        # Translate each distinct unknown text once, as written: the
+        # normalized form is only the key, and would lose the line breaks
+        # and indentation of plain text and <pre> segments
+        misses = list(dict.fromkeys(t for t, k in zip(texts, keys) if k not in known))
+        fresh = dict(zip(misses, self._translate_misses(misses))) if misses else {}
+        try:
+            # store_many() normalizes the sources into keys
+            self._memory.store_many({s: t for s, t in fresh.items() if t}, *self._key)
+        except sqlite3.Error as e:
+            print(f"[translate] Translation memory store failed: {e}", file=sys.stderr)
+
+        hits = sum(1 for k in keys if k in known)
+        self.hits += hits
+        self.misses += len(keys) - hits
+        self._memory.hits += hits
+        self._memory.misses += len(keys) - hits
+
+        return [known[k] if k in known else fresh[t] for t, k in zip(texts, keys)]
+
+    def translate(self, text: str) -> str:
+        return self.translate_batch([text])[0]
+
+    def stats(self) -> Dict[str, int]:
+        return {"tm_hits": self.hits, "tm_misses": self.misses}
+
+
+def wrap(translator, source_lang: str, target_lang: str, provider: str):
+    """Return a MemoryTranslator around translator, or translator itself if
+    the memory is disabled."""
+    memory = get_memory()
+    if memory is None:
+        return translator
+    return MemoryTranslator(translator, memory, source_lang, target_lang, provider)
+
+
+def common_source_languages(target_lang: str, provider: str, limit: int) -> List[str]:
+    """Source languages seen most for target_lang, or [] without a memory."""
+    memory = get_memory()
+    if memory is None:
+        return []
+    try:
+        return memory.common_sources(target_lang, provider, limit)
+    except sqlite3.Error as e:
+        print(f"[translate] Translation memory lookup failed: {e}", file=sys.stderr)
+        return []
+
+
+def stats_of(translator) -> Dict[str, int]:
+    """Hit/miss counters of a wrapped translator (empty if not wrapped)."""
+    stats = getattr(translator, "stats", None)
+    return stats() if stats else {}
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+worker_protocol.py
+Framing of requests and responses between the extension and a resident
+helper (--worker).
+
+Every message in either direction is one frame:
+
+  b"TRW1" | meta length (u32, big-endian) | payload length (u32, big-endian)
+  | meta: UTF-8 JSON object | payload: raw UTF-8
+
+The meta object carries the parameters ("id", "target", ...) or the
+outcome; the payload carries the text itself, so documents are never
+JSON-escaped. A payload that holds a list of segments ("payload":
+"segments" in a request, "count" in the meta) separates them with NUL
+bytes.
+
+Responses carry "status": "ok", or "status": "error" with "code"
+("invalid-request", "unavailable" or "failed") and "message".
+"""
+
+import json
+import struct
+import sys
+from typing import BinaryIO, List, Optional, Tuple
+
+MAGIC = b"TRW1"
+_HEADER = struct.Struct(">4sII")
+
+
+class ProtocolError(Exception):
+    """The frame stream is out of sync; the helper should exit."""
+
+
+class HelperError(Exception):
+    """A request that cannot be served; reported as an error status."""
+
+    def __init__(self, code: str, message: str):
+        super().__init__(message)
+        self.code = code
+
+
+def _read_exactly(stream: BinaryIO, size: int) -> bytes:
+    data = b""
+    while len(data) < size:
+        chunk = stream.read(size - len(data))
+        if not chunk:
+            raise ProtocolError("truncated frame")
+        data += chunk
+    return data
+
+
+def read_frame(stream: BinaryIO) -> Optional[Tuple[dict, bytes]]:
+    """Read one frame; returns None at end of stream."""
+    header = stream.read(_HEADER.size)
+    if not header:
+        return None
+    if len(header) < _HEADER.size:
+        header += _read_exactly(stream, _HEADER.size - len(header))
+    magic, meta_len, payload_len = _HEADER.unpack(header)
+    if magic != MAGIC:
+        raise ProtocolError("bad frame magic")
+    meta = json.loads(_read_exactly(stream, meta_len).decode("utf-8"))
+    if not isinstance(meta, dict):
+        raise ProtocolError("frame meta is not an object")
+    return meta, _read_exactly(stream, payload_len)
+
+
+def write_frame(stream: BinaryIO, meta: dict, payload: bytes = b"") -> None:
+    encoded = json.dumps(meta).encode("utf-8")
+    stream.write(_HEADER.pack(MAGIC, len(encoded), len(payload)) + encoded + payload)
+    stream.flush()
+
+
+def join_texts(texts: List[str]) -> bytes:
+    return "\0".join(texts).encode("utf-8")
+
+
+def split_texts(payload: bytes, count: int) -> List[str]:
+    if count <= 0:
+        return []
+    texts = payload.decode("utf-8").split("\0")
+    if len(texts) != count:
+        raise HelperError("invalid-request", f"expected {count} segments, got {len(texts)}")
+    return texts
+
+
+def decode_request(meta: dict, payload: bytes) -> dict:
+    """The request as a dict with "text" or "segments" filled in."""
+    request = dict(meta)
+    if meta.get("payload") == "segments":
+        request["segments"] = split_texts(payload, int(meta.get("count", 0)))
+    else:
+        request["text"] = payload.decode("utf-8")
+    return request
+
+
+def write_response(stream: BinaryIO, request_id, result: dict) -> None:
+    """
+    Write a runner result ({"translated": str} or {"translations": [...]},
+    plus counters) as an ok response frame.
+    """
+    meta = {k: v for k, v in result.items() if k not in ("translated", "translations")}
+    meta.update(id=request_id, status="ok")
+    if "translations" in result:
+        meta["count"] = len(result["translations"])
+        payload = join_texts(result["translations"])
+    else:
+        payload = result.get("translated", "").encode("utf-8")
+    write_frame(stream, meta, payload)
+
+
+def write_error(stream: BinaryIO, request_id, code: str, message: str) -> None:
+    write_frame(stream, {"id": request_id, "status": "error", "code": code, "message": message})
+
+
+def binary_stdout() -> BinaryIO:
+    """
+    Claim stdout for frames. Anything printed by libraries afterwards goes
+    to stderr instead of corrupting the stream.
+    """
+    out = sys.stdout.buffer
+    sys.stdout = sys.stderr
+    return out